@@ -0,0 +1,81 @@
+# Runs a simulation twice, as is and with an environment variable set, and checks
+# that the selected output files of the two runs are the same.
+# These need to be defined by the caller
+# SOURCE_DIR
+# BINARY_DIR
+# ENERGYPLUS_EXE
+# IDF_FILE
+# EPW_FILE
+# TEST_NAME
+# ENVIRONMENT (NAME=VALUE set for the second run)
+# COMPARE_FILES (output files to compare, separated by '+')
+# WEATHER_RUN_PERIODS (true to simulate the run periods of the input file, not only the design days)
+# STRUCTURE_ONLY (true to compare the eso or mtr files without the values of the records)
+
+if( NOT WEATHER_RUN_PERIODS )
+  set( ENV{DDONLY} y )
+endif()
+
+string( REPLACE "+" ";" COMPARE_FILES "${COMPARE_FILES}" )
+string( FIND "${ENVIRONMENT}" "=" EQUAL_POS )
+string( SUBSTRING "${ENVIRONMENT}" 0 ${EQUAL_POS} ENV_NAME )
+math( EXPR EQUAL_POS "${EQUAL_POS} + 1" )
+string( SUBSTRING "${ENVIRONMENT}" ${EQUAL_POS} -1 ENV_VALUE )
+
+set( TEST_DIR "${BINARY_DIR}/testfiles/${TEST_NAME}" )
+execute_process(COMMAND "${CMAKE_COMMAND}" -E remove_directory "${TEST_DIR}" )
+
+foreach( RUN reference variant )
+  set( RUN_DIR "${TEST_DIR}/${RUN}" )
+  file( MAKE_DIRECTORY "${RUN_DIR}" )
+  execute_process(COMMAND "${CMAKE_COMMAND}" -E copy "${SOURCE_DIR}/testfiles/${IDF_FILE}" "${RUN_DIR}/in.idf" )
+  execute_process(COMMAND "${CMAKE_COMMAND}" -E copy "${SOURCE_DIR}/weather/${EPW_FILE}" "${RUN_DIR}/in.epw" )
+  execute_process(COMMAND "${CMAKE_COMMAND}" -E copy "${BINARY_DIR}/Energy+.idd" "${RUN_DIR}/Energy+.idd" )
+  if( "${RUN}" STREQUAL "variant" )
+    set( ENV{${ENV_NAME}} "${ENV_VALUE}" )
+  endif()
+  execute_process(COMMAND "${ENERGYPLUS_EXE}" WORKING_DIRECTORY "${RUN_DIR}" OUTPUT_QUIET ERROR_QUIET )
+  file(READ "${RUN_DIR}/eplusout.end" FILE_CONTENT)
+  string(FIND "${FILE_CONTENT}" "EnergyPlus Completed Successfully" RESULT)
+  if( NOT RESULT EQUAL 0 )
+    message("Test Failed: the ${RUN} run did not complete")
+    return()
+  endif()
+endforeach()
+
+# Time stamps and run times of the runs are not compared
+set( MISMATCH "" )
+foreach( COMPARE_FILE ${COMPARE_FILES} )
+  foreach( RUN reference variant )
+    if( NOT EXISTS "${TEST_DIR}/${RUN}/${COMPARE_FILE}" )
+      message("Test Failed: ${COMPARE_FILE} was not written by the ${RUN} run")
+      return()
+    endif()
+    if( STRUCTURE_ONLY )
+      # data dictionary and time stamps as they are, only the report IDs of the records (IDs above 5)
+      file( STRINGS "${TEST_DIR}/${RUN}/${COMPARE_FILE}" LINES )
+      set( CONTENT_${RUN} "" )
+      foreach( LINE IN LISTS LINES )
+        if( NOT LINE MATCHES "!" )
+          if( LINE MATCHES "^([6-9]|[1-9][0-9]+)," )
+            set( LINE "${CMAKE_MATCH_1}" )
+          endif()
+        endif()
+        set( CONTENT_${RUN} "${CONTENT_${RUN}}${LINE}\n" )
+      endforeach()
+    else()
+      file( READ "${TEST_DIR}/${RUN}/${COMPARE_FILE}" CONTENT_${RUN} )
+    endif()
+    string( REGEX REPLACE "YMD=[^,\n]*" "" CONTENT_${RUN} "${CONTENT_${RUN}}" )
+    string( REGEX REPLACE "Elapsed Time=[^\n]*" "" CONTENT_${RUN} "${CONTENT_${RUN}}" )
+  endforeach()
+  if( NOT "${CONTENT_reference}" STREQUAL "${CONTENT_variant}" )
+    list( APPEND MISMATCH "${COMPARE_FILE}" )
+  endif()
+endforeach()
+
+if( MISMATCH )
+  message("Test Failed: ${MISMATCH} differ with ${ENVIRONMENT}")
+else()
+  message("Test Passed")
+endif()
@@ -167,6 +167,38 @@ function( ADD_SIMULATION_TEST )
 
 endfunction()
 
+# Runs a file as is and with an environment variable set, and compares output files of the two runs
+# ADD_SIMULATION_COMPARISON_TEST(NAME SizingWorkers IDF_FILE 5ZoneAirCooled.idf EPW_FILE USA_CO_Golden-NREL.724666_TMY3.epw
+#   ENVIRONMENT EP_SIZING_WORKERS=2 COMPARE_FILES epluszsz.csv eplusssz.csv)
+# WEATHER_RUN_PERIODS also simulates the run periods of the file, otherwise only the design days are simulated
+# STRUCTURE_ONLY compares eso or mtr files without the values of the records, for variables that change the results
+function( ADD_SIMULATION_COMPARISON_TEST )
+  set(options WEATHER_RUN_PERIODS STRUCTURE_ONLY)
+  set(oneValueArgs NAME IDF_FILE EPW_FILE ENVIRONMENT)
+  set(multiValueArgs COMPARE_FILES)
+  cmake_parse_arguments(ADD_CMP_TEST "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN} )
+
+  get_filename_component(IDF_NAME "${ADD_CMP_TEST_IDF_FILE}" NAME_WE)
+  string( REPLACE ";" "+" COMPARE_FILES "${ADD_CMP_TEST_COMPARE_FILES}" )
+
+  add_test(NAME "comparison.${ADD_CMP_TEST_NAME}.${IDF_NAME}" COMMAND ${CMAKE_COMMAND}
+    -DSOURCE_DIR=${CMAKE_SOURCE_DIR}
+    -DBINARY_DIR=${CMAKE_BINARY_DIR}
+    -DENERGYPLUS_EXE=$<TARGET_FILE:EnergyPlus>
+    -DIDF_FILE=${ADD_CMP_TEST_IDF_FILE}
+    -DEPW_FILE=${ADD_CMP_TEST_EPW_FILE}
+    -DTEST_NAME=${ADD_CMP_TEST_NAME}.${IDF_NAME}
+    -DENVIRONMENT=${ADD_CMP_TEST_ENVIRONMENT}
+    -DCOMPARE_FILES=${COMPARE_FILES}
+    -DWEATHER_RUN_PERIODS=${ADD_CMP_TEST_WEATHER_RUN_PERIODS}
+    -DSTRUCTURE_ONLY=${ADD_CMP_TEST_STRUCTURE_ONLY}
+    -P ${CMAKE_SOURCE_DIR}/cmake/CompareSimulations.cmake
+  )
+  SET_TESTS_PROPERTIES("comparison.${ADD_CMP_TEST_NAME}.${IDF_NAME}" PROPERTIES PASS_REGULAR_EXPRESSION "Test Passed")
+  SET_TESTS_PROPERTIES("comparison.${ADD_CMP_TEST_NAME}.${IDF_NAME}" PROPERTIES FAIL_REGULAR_EXPRESSION "ERROR;FAIL;Test Failed")
+
+endfunction()
+
 macro( ADD_CXX_DEFINITIONS NEWFLAGS )
   SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${NEWFLAGS}")
 endmacro()
@@ -1,10 +1,10 @@
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <string>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
-#include <ObjexxFCL/FArray3D.hh>
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/string.functions.hh>
@@ -163,6 +163,9 @@ namespace CurveManager {
 	FArray1D< TableDataStruct > TempTableData;
 	FArray1D< TableDataStruct > Temp2TableData;
 	FArray1D< TableLookupData > TableLookup;
+	FArray1D_int LagrangeStart( 5, 1 ); // first table point of the interpolation stencil along each independent variable
+	FArray1D_int LagrangeEnd( 5, 1 ); // last table point of the interpolation stencil along each independent variable
+	FArray2D< Real64 > LagrangeWeight; // Lagrange coefficient of each stencil point along each independent variable
 
 	// Functions
 
@@ -2364,6 +2367,8 @@ namespace CurveManager {
 			ShowFatalError( "GetCurveInput: Errors found in getting Curve Objects.  Preceding condition(s) cause termination." );
 		}
 
+		PrepareTableLookupGrids();
+
 	}
 
 	void
@@ -3446,6 +3451,253 @@ Label999: ;
 		return DLAG;
 	}
 
+	void
+	PrepareTableLookupGrids()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Preprocesses the table data once after input so that TableLookupObject and
+		// PerformanceTableObject do not search or scan the independent variable arrays in full
+		// on every call.
+
+		// METHODOLOGY EMPLOYED:
+		// Records the range of the PerformanceTableObject arrays and whether each independent
+		// variable is strictly increasing.  Increasing arrays are searched starting from the
+		// bracket found on the previous evaluation (hinted search), which is O(1) when successive
+		// evaluations are near each other.  Arrays that are not increasing keep the original
+		// linear scan so results are identical either way.  The Lagrange scratch arrays are
+		// sized to the largest interpolation order.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int TableNum; // loop index over tables
+		int MaxOrder; // largest interpolation order of any table
+
+		MaxOrder = 2;
+		for ( TableNum = 1; TableNum <= isize( TableLookup ); ++TableNum ) {
+			auto & Table( TableLookup( TableNum ) );
+			Table.IVAscending.allocate( 5 );
+			Table.IVHint.allocate( 5 );
+			Table.IVAscending = false;
+			Table.IVHint = 1;
+			if ( Table.NumIndependentVars >= 1 ) Table.IVAscending( 1 ) = IsStrictlyAscending( Table.X1Var );
+			if ( Table.NumIndependentVars >= 2 ) Table.IVAscending( 2 ) = IsStrictlyAscending( Table.X2Var );
+			if ( Table.NumIndependentVars >= 3 ) Table.IVAscending( 3 ) = IsStrictlyAscending( Table.X3Var );
+			if ( Table.NumIndependentVars >= 4 ) Table.IVAscending( 4 ) = IsStrictlyAscending( Table.X4Var );
+			if ( Table.NumIndependentVars >= 5 ) Table.IVAscending( 5 ) = IsStrictlyAscending( Table.X5Var );
+			MaxOrder = max( MaxOrder, Table.InterpolationOrder );
+		}
+
+		for ( TableNum = 1; TableNum <= isize( PerfCurveTableData ); ++TableNum ) {
+			auto & PerfTable( PerfCurveTableData( TableNum ) );
+			if ( allocated( PerfTable.X1 ) && ( size( PerfTable.X1 ) > 0 ) ) {
+				PerfTable.X1Min = minval( PerfTable.X1 );
+				PerfTable.X1Max = maxval( PerfTable.X1 );
+				PerfTable.X1Ascending = IsStrictlyAscending( PerfTable.X1 );
+			}
+			if ( allocated( PerfTable.X2 ) && ( size( PerfTable.X2 ) > 0 ) ) {
+				PerfTable.X2Min = minval( PerfTable.X2 );
+				PerfTable.X2Max = maxval( PerfTable.X2 );
+				PerfTable.X2Ascending = IsStrictlyAscending( PerfTable.X2 );
+			}
+			PerfTable.X1Hint = 1;
+			PerfTable.X2Hint = 1;
+		}
+
+		LagrangeWeight.allocate( MaxOrder, 5 );
+		LagrangeWeight = 1.0;
+
+	}
+
+	bool
+	IsStrictlyAscending( FArray1< Real64 > const & X ) // independent variable values
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns TRUE if the array values are strictly increasing.
+
+		for ( int I = 2; I <= isize( X ); ++I ) {
+			if ( ! ( X( I ) > X( I - 1 ) ) ) return false;
+		}
+		return true;
+
+	}
+
+	int
+	FindTableLowerBracket(
+		FArray1< Real64 > const & X, // independent variable values
+		Real64 const XX, // interpolation point
+		bool const Ascending, // TRUE if X is strictly increasing
+		int & Hint // bracket found on the previous call, updated on return
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the last index I for which XX >= X(I), as the linear scan in
+		// PerformanceTableObject did.  The caller has already handled XX outside the table range.
+
+		// METHODOLOGY EMPLOYED:
+		// For increasing arrays the previous result and its neighbor are tried first, then a
+		// binary search; otherwise the full linear scan is kept.
+
+		int const NX( isize( X ) );
+		int Found( 0 );
+
+		if ( ! Ascending ) {
+			for ( int I = 1; I <= NX; ++I ) {
+				if ( XX >= X( I ) ) Found = I;
+			}
+			return Found;
+		}
+
+		if ( ( Hint >= 1 ) && ( Hint <= NX ) && ( XX >= X( Hint ) ) ) {
+			if ( ( Hint == NX ) || ( XX < X( Hint + 1 ) ) ) return Hint;
+			if ( ( Hint + 1 == NX ) || ( XX < X( Hint + 2 ) ) ) return ++Hint;
+		}
+		Found = int( std::upper_bound( X.data(), X.data() + NX, XX ) - X.data() );
+		Hint = max( Found, 1 );
+		return Found;
+
+	}
+
+	void
+	SetupLagrangeStencil(
+		FArray1< Real64 > const & X, // independent variable values
+		int const NX, // number of independent variable values
+		int const M, // number of points to be considered in the interpolation
+		Real64 const XX, // interpolation point
+		bool const Ascending, // TRUE if X is strictly increasing
+		int & Hint, // bracket found on the previous call, updated on return
+		int & ISPT, // first point of the stencil
+		int & IEPT, // last point of the stencil
+		FArray1S< Real64 > Weight // Lagrange coefficient of each stencil point
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Selects the interpolation points along one independent variable exactly as DLAG does
+		// and computes their Lagrange coefficients so they can be reused for every slice of the table.
+
+		// METHODOLOGY EMPLOYED:
+		// DLAG scans for the first X(I) that is not less than XX.  For increasing arrays this is the
+		// lower bound of XX, found by checking the previous result first and then by binary search.
+		// An exact match is a one point stencil with a coefficient of 1.  The coefficients are computed
+		// term by term in the same order as Interpolate_Lagrange.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int I; // first index with X(I) >= XX, NX + 1 if none
+		int M1; // number of points to be interpolated
+		Real64 Lagrange; // intermediate variable
+
+		if ( Ascending ) {
+			if ( ( Hint >= 1 ) && ( Hint <= NX + 1 ) && ( ( Hint > NX ) || ( X( Hint ) >= XX ) ) && ( ( Hint == 1 ) || ( X( Hint - 1 ) < XX ) ) ) {
+				I = Hint;
+			} else {
+				I = int( std::lower_bound( X.data(), X.data() + NX, XX ) - X.data() ) + 1;
+				Hint = I;
+			}
+		} else {
+			for ( I = 1; I <= NX; ++I ) {
+				if ( XX - X( I ) <= 0.0 ) break;
+			}
+		}
+
+		M1 = min( M, NX );
+		if ( ( I <= NX ) && ( XX - X( I ) == 0.0 ) ) { // exact interpolation point found in X array
+			ISPT = I;
+			IEPT = I;
+			Weight( 1 ) = 1.0;
+			return;
+		} else if ( I <= NX ) { // found X point just greater than interpolation point
+			if ( I == 1 ) {
+				if ( M1 > 2 ) M1 = 2; // limit to linear extrapolation
+			}
+			ISPT = I - ( ( M1 + 1 ) / 2 );
+			if ( ISPT <= 0 ) ISPT = 1;
+			IEPT = ISPT + M1 - 1;
+			if ( IEPT > NX ) {
+				ISPT = NX - M1 + 1;
+				IEPT = NX;
+			}
+		} else { // interpolation point is greater than max X value
+			if ( M1 > 2 ) M1 = 2; // limit to linear extrapolation
+			ISPT = NX - M1 + 1;
+			IEPT = NX;
+		}
+
+		for ( int J = ISPT; J <= IEPT; ++J ) {
+			Lagrange = 1.0;
+			Real64 const X_J( X( J ) );
+			for ( int K = ISPT; K <= IEPT; ++K ) {
+				if ( K != J ) {
+					Lagrange *= ( ( XX - X( K ) ) / ( X_J - X( K ) ) );
+				}
+			}
+			Weight( J - ISPT + 1 ) = Lagrange;
+		}
+
+	}
+
 	Real64
 	PerformanceCurveObject(
 		int const CurveIndex, // index of curve in curve array
@@ -3638,11 +3890,10 @@ Label999: ;
 		Real64 X1ValLow;
 		Real64 X1ValHigh;
 		//INTEGER   :: MaxSizeArray
-		int X1Val;
-		int X2Val;
 		int TableIndex;
 
 		TableIndex = PerfCurve( CurveIndex ).TableIndex;
+		if ( ! allocated( TableLookup( TableIndex ).IVHint ) ) PrepareTableLookupGrids();
 
 		V1 = max( min( Var1, PerfCurve( CurveIndex ).Var1Max ), PerfCurve( CurveIndex ).Var1Min );
 
@@ -3661,8 +3912,8 @@ Label999: ;
 		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
+			TempX1Low = PerfCurveTableData( TableIndex ).X1Min;
+			TempX1High = PerfCurveTableData( TableIndex ).X1Max;
 			if ( V1 <= TempX1Low ) {
 				TempX1LowPtr = 1;
 				TempX1HighPtr = 1;
@@ -3670,9 +3921,7 @@ Label999: ;
 				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
 				TempX1HighPtr = TempX1LowPtr;
 			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
+				TempX1LowPtr = FindTableLowerBracket( PerfCurveTableData( TableIndex ).X1, V1, PerfCurveTableData( TableIndex ).X1Ascending, PerfCurveTableData( TableIndex ).X1Hint );
 				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
 					TempX1HighPtr = TempX1LowPtr;
 				} else {
@@ -3688,8 +3937,8 @@ Label999: ;
 
 		} else if ( SELECT_CASE_var == 2 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
+			TempX1Low = PerfCurveTableData( TableIndex ).X1Min;
+			TempX1High = PerfCurveTableData( TableIndex ).X1Max;
 			if ( V1 <= TempX1Low ) {
 				TempX1LowPtr = 1;
 				TempX1HighPtr = 1;
@@ -3697,17 +3946,15 @@ Label999: ;
 				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
 				TempX1HighPtr = TempX1LowPtr;
 			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
+				TempX1LowPtr = FindTableLowerBracket( PerfCurveTableData( TableIndex ).X1, V1, PerfCurveTableData( TableIndex ).X1Ascending, PerfCurveTableData( TableIndex ).X1Hint );
 				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
 					TempX1HighPtr = TempX1LowPtr;
 				} else {
 					TempX1HighPtr = TempX1LowPtr + 1;
 				}
 			}
-			TempX2Low = minval( PerfCurveTableData( TableIndex ).X2 );
-			TempX2High = maxval( PerfCurveTableData( TableIndex ).X2 );
+			TempX2Low = PerfCurveTableData( TableIndex ).X2Min;
+			TempX2High = PerfCurveTableData( TableIndex ).X2Max;
 
 			if ( V2 <= TempX2Low ) {
 				TempX2LowPtr = 1;
@@ -3716,9 +3963,7 @@ Label999: ;
 				TempX2LowPtr = size( PerfCurveTableData( TableIndex ).X2 );
 				TempX2HighPtr = TempX2LowPtr;
 			} else {
-				for ( X2Val = 1; X2Val <= isize( PerfCurveTableData( TableIndex ).X2 ); ++X2Val ) {
-					if ( V2 >= PerfCurveTableData( TableIndex ).X2( X2Val ) ) TempX2LowPtr = X2Val;
-				}
+				TempX2LowPtr = FindTableLowerBracket( PerfCurveTableData( TableIndex ).X2, V2, PerfCurveTableData( TableIndex ).X2Ascending, PerfCurveTableData( TableIndex ).X2Hint );
 				if ( V2 == PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) ) {
 					TempX2HighPtr = TempX2LowPtr;
 				} else {
@@ -3811,37 +4056,18 @@ Label999: ;
 		Real64 V4; // 4th independent variable after limits imposed
 		Real64 V5; // 5th independent variable after limits imposed
 
-		int NX;
-		int NY;
-		int NV3;
-		int NV4;
-		int NV5;
 		int TableIndex;
-		//REAL(r64), ALLOCATABLE, DIMENSION(:)     :: ONEDVALS
-		FArray2D< Real64 > TWODVALS;
-		FArray3D< Real64 > THREEDVALS;
-		FArray1D< Real64 > VALSX;
-		FArray1D< Real64 > VALSY;
-		FArray1D< Real64 > VALSV3;
-		FArray1D< Real64 > VALSV4;
-		FArray1D< Real64 > VALSV5;
-		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:) :: HPVAL
-		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:) :: HPVALS
-		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:,:) :: DVLTRN
-		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:,:) :: FiveDArray
-		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:) :: FourDArray
-		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:) :: ThreeDArray
-		//REAL(r64), ALLOCATABLE, DIMENSION(:,:) :: TwoDArray
-		//REAL(r64), ALLOCATABLE, DIMENSION(:) :: OneDArray
-		int IV3;
-		int IV4;
-		int IV5;
-		int IEXTX;
-		int IEXTY;
-		int IEXTV3;
-		int IEXTV4;
-		int IEXTV5;
 		int NUMPT;
+		int K1; // stencil loop index along 1st independent variable
+		int K2; // stencil loop index along 2nd independent variable
+		int K3; // stencil loop index along 3rd independent variable
+		int K4; // stencil loop index along 4th independent variable
+		int K5; // stencil loop index along 5th independent variable
+		Real64 Sum1; // interpolated value along 1st independent variable
+		Real64 Sum2; // interpolated value along 2nd independent variable
+		Real64 Sum3; // interpolated value along 3rd independent variable
+		Real64 Sum4; // interpolated value along 4th independent variable
+		Real64 Sum5; // interpolated value along 5th independent variable
 
 		TableIndex = PerfCurve( CurveIndex ).TableIndex;
 
@@ -3927,126 +4153,71 @@ Label999: ;
 			V5 = 0.0;
 		}
 
-		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
-		if ( SELECT_CASE_var == 1 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = 1;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			TableValue = DLAG( V1, VALSX( 1 ), VALSX, VALSX, TableLookup( TableIndex ).TableLookupZData( _, _, 1, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
-		} else if ( SELECT_CASE_var == 2 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			TableValue = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, 1, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
-			VALSY.deallocate();
-		} else if ( SELECT_CASE_var == 3 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			TWODVALS.allocate( NV3, 1 );
-			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
-			for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-				TWODVALS( IV3, 1 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
-			}
-			if ( NV3 == 1 ) {
-				TableValue = TWODVALS( 1, 1 );
-			} else {
-				TableValue = DLAG( V3, 1.0, VALSV3, VALSV3, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
-			}
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-		} else if ( SELECT_CASE_var == 4 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			TWODVALS.allocate( NV3, NV4 );
-			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
-			for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
-				for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-					TWODVALS( IV3, IV4 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, IV4, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
-				}
-			}
-			// final interpolation of 2-D array in V3 and V4
-			TableValue = DLAG( V3, V4, VALSV3, VALSV4, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
-		} else if ( SELECT_CASE_var == 5 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NV5 = TableLookup( TableIndex ).NumX5Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			VALSV5.allocate( NV5 );
-			VALSV5 = TableLookup( TableIndex ).X5Var;
-			THREEDVALS.allocate( NV3, NV4, NV5 );
-			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
-				for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
-					for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-						THREEDVALS( IV3, IV4, IV5 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, IV4, IV5 ), NX, NY, NUMPT, IEXTX, IEXTY );
-					}
-				}
-			}
-			TWODVALS.allocate( NV5, 1 );
-			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
-				TWODVALS( IV5, 1 ) = DLAG( V3, V4, VALSV3, VALSV4, THREEDVALS( _, _, IV5 ), NV3, NV4, NUMPT, IEXTX, IEXTY );
-			}
-			if ( NV5 == 1 ) {
-				TableValue = TWODVALS( 1, 1 );
-			} else {
-				TableValue = DLAG( V5, 1.0, VALSV5, VALSV5, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
-			}
-			TWODVALS.deallocate();
-			THREEDVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
-			VALSV5.deallocate();
-		} else {
+		auto & Table( TableLookup( TableIndex ) );
+		if ( ( Table.NumIndependentVars < 1 ) || ( Table.NumIndependentVars > 5 ) ) {
 			TableValue = 0.0;
 			ShowSevereError( "Errors found in table output calculation for " + PerfCurve( CurveIndex ).Name );
 			ShowContinueError( "...Possible causes are selection of Interpolation Method or Type or Number" " of Independent Variables or Points." );
 			ShowFatalError( "PerformanceTableObject: Previous error causes program termination." );
-		}}
+		}
+		if ( ! allocated( Table.IVHint ) ) PrepareTableLookupGrids();
+
+		// Locate the interpolation stencil and its Lagrange coefficients once along each independent variable.
+		// The stencils match those DLAG chooses, and the nested sums below accumulate in the same order as the
+		// nested DLAG calls did, so results are unchanged while only the stencil slices of the table are visited.
+		NUMPT = Table.InterpolationOrder;
+		SetupLagrangeStencil( Table.X1Var, Table.NumX1Vars, NUMPT, V1, Table.IVAscending( 1 ), Table.IVHint( 1 ), LagrangeStart( 1 ), LagrangeEnd( 1 ), LagrangeWeight( _, 1 ) );
+		if ( Table.NumIndependentVars >= 2 ) {
+			SetupLagrangeStencil( Table.X2Var, Table.NumX2Vars, NUMPT, V2, Table.IVAscending( 2 ), Table.IVHint( 2 ), LagrangeStart( 2 ), LagrangeEnd( 2 ), LagrangeWeight( _, 2 ) );
+		} else {
+			LagrangeStart( 2 ) = 1;
+			LagrangeEnd( 2 ) = 1;
+			LagrangeWeight( 1, 2 ) = 1.0;
+		}
+		if ( Table.NumIndependentVars >= 3 ) {
+			SetupLagrangeStencil( Table.X3Var, Table.NumX3Vars, NUMPT, V3, Table.IVAscending( 3 ), Table.IVHint( 3 ), LagrangeStart( 3 ), LagrangeEnd( 3 ), LagrangeWeight( _, 3 ) );
+		} else {
+			LagrangeStart( 3 ) = 1;
+			LagrangeEnd( 3 ) = 1;
+			LagrangeWeight( 1, 3 ) = 1.0;
+		}
+		if ( Table.NumIndependentVars >= 4 ) {
+			SetupLagrangeStencil( Table.X4Var, Table.NumX4Vars, NUMPT, V4, Table.IVAscending( 4 ), Table.IVHint( 4 ), LagrangeStart( 4 ), LagrangeEnd( 4 ), LagrangeWeight( _, 4 ) );
+		} else {
+			LagrangeStart( 4 ) = 1;
+			LagrangeEnd( 4 ) = 1;
+			LagrangeWeight( 1, 4 ) = 1.0;
+		}
+		if ( Table.NumIndependentVars >= 5 ) {
+			SetupLagrangeStencil( Table.X5Var, Table.NumX5Vars, NUMPT, V5, Table.IVAscending( 5 ), Table.IVHint( 5 ), LagrangeStart( 5 ), LagrangeEnd( 5 ), LagrangeWeight( _, 5 ) );
+		} else {
+			LagrangeStart( 5 ) = 1;
+			LagrangeEnd( 5 ) = 1;
+			LagrangeWeight( 1, 5 ) = 1.0;
+		}
+
+		auto const & Z( Table.TableLookupZData );
+		Sum5 = 0.0;
+		for ( K5 = LagrangeStart( 5 ); K5 <= LagrangeEnd( 5 ); ++K5 ) {
+			Sum4 = 0.0;
+			for ( K4 = LagrangeStart( 4 ); K4 <= LagrangeEnd( 4 ); ++K4 ) {
+				Sum3 = 0.0;
+				for ( K3 = LagrangeStart( 3 ); K3 <= LagrangeEnd( 3 ); ++K3 ) {
+					Sum2 = 0.0;
+					for ( K2 = LagrangeStart( 2 ); K2 <= LagrangeEnd( 2 ); ++K2 ) {
+						Sum1 = 0.0;
+						for ( K1 = LagrangeStart( 1 ); K1 <= LagrangeEnd( 1 ); ++K1 ) {
+							Sum1 += LagrangeWeight( K1 - LagrangeStart( 1 ) + 1, 1 ) * Z( K1, K2, K3, K4, K5 );
+						}
+						Sum2 += LagrangeWeight( K2 - LagrangeStart( 2 ) + 1, 2 ) * Sum1;
+					}
+					Sum3 += LagrangeWeight( K3 - LagrangeStart( 3 ) + 1, 3 ) * Sum2;
+				}
+				Sum4 += LagrangeWeight( K4 - LagrangeStart( 4 ) + 1, 4 ) * Sum3;
+			}
+			Sum5 += LagrangeWeight( K5 - LagrangeStart( 5 ) + 1, 5 ) * Sum4;
+		}
+		TableValue = Sum5;
 
 		if ( PerfCurve( CurveIndex ).CurveMinPresent ) TableValue = max( TableValue, PerfCurve( CurveIndex ).CurveMin );
 		if ( PerfCurve( CurveIndex ).CurveMaxPresent ) TableValue = min( TableValue, PerfCurve( CurveIndex ).CurveMax );
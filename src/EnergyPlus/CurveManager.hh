@@ -256,20 +256,52 @@ namespace CurveManager {
 		FArray1D< Real64 > X1;
 		FArray1D< Real64 > X2;
 		FArray2D< Real64 > Y;
+		Real64 X1Min; // minimum of X1 values (set in PrepareTableLookupGrids)
+		Real64 X1Max; // maximum of X1 values (set in PrepareTableLookupGrids)
+		Real64 X2Min; // minimum of X2 values (set in PrepareTableLookupGrids)
+		Real64 X2Max; // maximum of X2 values (set in PrepareTableLookupGrids)
+		bool X1Ascending; // TRUE if X1 values are strictly increasing so a hinted search may be used
+		bool X2Ascending; // TRUE if X2 values are strictly increasing so a hinted search may be used
+		int X1Hint; // lower bracket index along X1 found on the previous evaluation
+		int X2Hint; // lower bracket index along X2 found on the previous evaluation
 
 		// Default Constructor
-		PerfCurveTableDataStruct()
+		PerfCurveTableDataStruct() :
+			X1Min( 0.0 ),
+			X1Max( 0.0 ),
+			X2Min( 0.0 ),
+			X2Max( 0.0 ),
+			X1Ascending( false ),
+			X2Ascending( false ),
+			X1Hint( 1 ),
+			X2Hint( 1 )
 		{}
 
 		// Member Constructor
 		PerfCurveTableDataStruct(
 			FArray1< Real64 > const & X1,
 			FArray1< Real64 > const & X2,
-			FArray2< Real64 > const & Y
+			FArray2< Real64 > const & Y,
+			Real64 const X1Min, // minimum of X1 values (set in PrepareTableLookupGrids)
+			Real64 const X1Max, // maximum of X1 values (set in PrepareTableLookupGrids)
+			Real64 const X2Min, // minimum of X2 values (set in PrepareTableLookupGrids)
+			Real64 const X2Max, // maximum of X2 values (set in PrepareTableLookupGrids)
+			bool const X1Ascending, // TRUE if X1 values are strictly increasing so a hinted search may be used
+			bool const X2Ascending, // TRUE if X2 values are strictly increasing so a hinted search may be used
+			int const X1Hint, // lower bracket index along X1 found on the previous evaluation
+			int const X2Hint // lower bracket index along X2 found on the previous evaluation
 		) :
 			X1( X1 ),
 			X2( X2 ),
-			Y( Y )
+			Y( Y ),
+			X1Min( X1Min ),
+			X1Max( X1Max ),
+			X2Min( X2Min ),
+			X2Max( X2Max ),
+			X1Ascending( X1Ascending ),
+			X2Ascending( X2Ascending ),
+			X1Hint( X1Hint ),
+			X2Hint( X2Hint )
 		{}
 
 	};
@@ -480,6 +512,8 @@ namespace CurveManager {
 		int NumX5Vars; // Number of variables for independent variable #5
 		FArray1D< Real64 > X5Var;
 		FArray5D< Real64 > TableLookupZData;
+		FArray1D_bool IVAscending; // TRUE if the values of each independent variable are strictly increasing
+		FArray1D_int IVHint; // bracket index found along each independent variable on the previous evaluation
 
 		// Default Constructor
 		TableLookupData() :
@@ -506,7 +540,9 @@ namespace CurveManager {
 			FArray1< Real64 > const & X4Var,
 			int const NumX5Vars, // Number of variables for independent variable #5
 			FArray1< Real64 > const & X5Var,
-			FArray5< Real64 > const & TableLookupZData
+			FArray5< Real64 > const & TableLookupZData,
+			FArray1_bool const & IVAscending, // TRUE if the values of each independent variable are strictly increasing
+			FArray1_int const & IVHint // bracket index found along each independent variable on the previous evaluation
 		) :
 			NumIndependentVars( NumIndependentVars ),
 			InterpolationOrder( InterpolationOrder ),
@@ -520,7 +556,9 @@ namespace CurveManager {
 			X4Var( X4Var ),
 			NumX5Vars( NumX5Vars ),
 			X5Var( X5Var ),
-			TableLookupZData( TableLookupZData )
+			TableLookupZData( TableLookupZData ),
+			IVAscending( IVAscending ),
+			IVHint( IVHint )
 		{}
 
 	};
@@ -532,6 +570,9 @@ namespace CurveManager {
 	extern FArray1D< TableDataStruct > TempTableData;
 	extern FArray1D< TableDataStruct > Temp2TableData;
 	extern FArray1D< TableLookupData > TableLookup;
+	extern FArray1D_int LagrangeStart; // first table point of the interpolation stencil along each independent variable
+	extern FArray1D_int LagrangeEnd; // last table point of the interpolation stencil along each independent variable
+	extern FArray2D< Real64 > LagrangeWeight; // Lagrange coefficient of each stencil point along each independent variable
 
 	// Functions
 
@@ -580,6 +621,33 @@ namespace CurveManager {
 		int & IEXTY
 	);
 
+	void
+	PrepareTableLookupGrids();
+
+	bool
+	IsStrictlyAscending( FArray1< Real64 > const & X ); // independent variable values
+
+	int
+	FindTableLowerBracket(
+		FArray1< Real64 > const & X, // independent variable values
+		Real64 const XX, // interpolation point
+		bool const Ascending, // TRUE if X is strictly increasing
+		int & Hint // bracket found on the previous call, updated on return
+	);
+
+	void
+	SetupLagrangeStencil(
+		FArray1< Real64 > const & X, // independent variable values
+		int const NX, // number of independent variable values
+		int const M, // number of points to be considered in the interpolation
+		Real64 const XX, // interpolation point
+		bool const Ascending, // TRUE if X is strictly increasing
+		int & Hint, // bracket found on the previous call, updated on return
+		int & ISPT, // first point of the stencil
+		int & IEPT, // last point of the stencil
+		FArray1S< Real64 > Weight // Lagrange coefficient of each stencil point
+	);
+
 	Real64
 	PerformanceCurveObject(
 		int const CurveIndex, // index of curve in curve array
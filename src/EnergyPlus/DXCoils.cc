@@ -204,6 +204,7 @@ namespace DXCoils {
 	// Object Data
 	FArray1D< DXCoilData > DXCoil;
 	FArray1D< DXCoilNumericFieldData > DXCoilNumericFields;
+	FArray2D< DXCoilFullLoadData > DXCoilFullLoad; // full-load operating point (performance mode or speed, coil)
 
 	// Functions
 
@@ -993,6 +994,7 @@ namespace DXCoils {
 		DXCoilCoolInletAirWBTemp.allocate( NumDXCoils );
 		DXCoilHeatInletAirDBTemp.allocate( NumDXCoils );
 		DXCoilHeatInletAirWBTemp.allocate( NumDXCoils );
+		DXCoilFullLoad.allocate( MaxModes, NumDXCoils );
 		// initialize the module level arrays
 		DXCoilOutletTemp = 0.0;
 		DXCoilOutletHumRat = 0.0;
@@ -6560,6 +6562,8 @@ namespace DXCoils {
 		Real64 DXcoolToHeatPLRRatio; // ratio of cooling PLR to heating PLR, used for cycling fan RH control
 		Real64 HeatRTF; // heating coil part-load ratio, used for cycling fan RH control
 		Real64 HeatingCoilPLF; // heating coil PLF (function of PLR), used for cycling fan RH control
+		bool FullLoadCached; // true if the full-load operating point is reused from the previous evaluation
+		bool CurveClipped; // true if a performance curve output was reset to zero in this evaluation
 
 		// If Performance mode not present, then set to 1.  Used only by Multimode/Multispeed DX coil (otherwise mode = 1)
 		if ( present( PerfMode ) ) {
@@ -6706,23 +6710,35 @@ namespace DXCoils {
 				AirMassFlow = DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
 			}
 
+			// The full-load operating point only depends on the inlet, condenser and flow conditions, so a part-load
+			// ratio search at fixed conditions reuses it and only the cycling and PLF calculations are repeated.
+			auto & FullLoad( DXCoilFullLoad( Mode, DXCoilNum ) );
+			++FullLoad.NumCalls;
+			FullLoadCached = ! AnyEnergyManagementSystemInModel && MatchFullLoadPoint( FullLoad, InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, AirMassFlow, CondInletTemp, OutdoorPressure, DXCoil( DXCoilNum ).RatedTotCap( Mode ) );
+			CurveClipped = false;
+			if ( FullLoadCached ) ++FullLoad.NumHits;
+
 			// Check for valid air volume flow per rated total cooling capacity (200 - 500 cfm/ton)
 
 			// for some reason there are diff's when using coil inlet air pressure
 			// these lines (more to follow) are commented out for the time being
 
-			InletAirWetBulbC = PsyTwbFnTdbWPb( InletAirDryBulbTemp, InletAirHumRat, OutdoorPressure );
-			AirVolumeFlowRate = AirMassFlow / PsyRhoAirFnPbTdbW( OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat );
-			//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
-			//  InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp,InletAirHumRat,InletAirPressure)
-			//  AirVolumeFlowRate = AirMassFlow/ PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
 			if ( DXCoil( DXCoilNum ).RatedTotCap( Mode ) <= 0.0 ) {
 				ShowFatalError( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Rated total cooling capacity is zero or less." );
 			}
-			if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
-				VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap2;
+			if ( FullLoadCached ) {
+				VolFlowperRatedTotCap = FullLoad.VolFlowPerRatedTotCap;
 			} else {
-				VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap( Mode );
+				InletAirWetBulbC = PsyTwbFnTdbWPb( InletAirDryBulbTemp, InletAirHumRat, OutdoorPressure );
+				AirVolumeFlowRate = AirMassFlow / PsyRhoAirFnPbTdbW( OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat );
+				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
+				//  InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp,InletAirHumRat,InletAirPressure)
+				//  AirVolumeFlowRate = AirMassFlow/ PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
+				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
+					VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap2;
+				} else {
+					VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap( Mode );
+				}
 			}
 			if ( ! FirstHVACIteration && ! WarmupFlag && DXCoil( DXCoilNum ).DXCoilType_Num != CoilDX_HeatPumpWaterHeater && ( ( VolFlowperRatedTotCap < MinOperVolFlowPerRatedTotCap( DXCT ) ) || ( VolFlowperRatedTotCap > MaxCoolVolFlowPerRatedTotCap( DXCT ) ) ) ) {
 				if ( DXCoil( DXCoilNum ).ErrIndex1 == 0 ) {
@@ -6745,17 +6761,19 @@ namespace DXCoils {
 			//    Adjust coil bypass factor for actual air flow rate. Use relation CBF = exp(-NTU) where
 			//    NTU = A0/(m*cp). Relationship models the cooling coil as a heat exchanger with Cmin/Cmax = 0.
 
-			RatedCBF = DXCoil( DXCoilNum ).RatedCBF( Mode );
-			if ( RatedCBF > 0.0 ) {
-				A0 = -std::log( RatedCBF ) * DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
-			} else {
-				A0 = 0.0;
-			}
-			ADiff = -A0 / AirMassFlow;
-			if ( ADiff >= EXP_LowerLimit ) {
-				CBF = std::exp( ADiff );
-			} else {
-				CBF = 0.0;
+			if ( ! FullLoadCached ) {
+				RatedCBF = DXCoil( DXCoilNum ).RatedCBF( Mode );
+				if ( RatedCBF > 0.0 ) {
+					A0 = -std::log( RatedCBF ) * DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
+				} else {
+					A0 = 0.0;
+				}
+				ADiff = -A0 / AirMassFlow;
+				if ( ADiff >= EXP_LowerLimit ) {
+					CBF = std::exp( ADiff );
+				} else {
+					CBF = 0.0;
+				}
 			}
 
 			//   check boundary for low ambient temperature and post warnings to individual DX coil buffers to print at end of time step
@@ -6783,93 +6801,119 @@ namespace DXCoils {
 			//  InletAirHumRat may be modified in this ADP/BF loop, use temporary varible for calculations
 			InletAirHumRatTemp = InletAirHumRat;
 			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
-			while ( true ) {
-				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
-					// Coil:DX:HeatPumpWaterHeater does not have total cooling capacity as a function of temp or flow curve
-					TotCapTempModFac = 1.0;
-					TotCapFlowModFac = 1.0;
-				} else {
-					if ( DXCoil( DXCoilNum ).TotCapTempModFacCurveType( Mode ) == BiQuadratic ) {
-						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), InletAirWetBulbC, CondInletTemp );
+			if ( FullLoadCached ) {
+				InletAirWetBulbC = FullLoad.InletAirWetBulb;
+				TotCap = FullLoad.TotCap;
+				SHR = FullLoad.SHR;
+				hDelta = FullLoad.hDelta;
+				Counter = ( FullLoad.DryCoil ? 1 : 0 );
+			} else {
+				while ( true ) {
+					if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
+						// Coil:DX:HeatPumpWaterHeater does not have total cooling capacity as a function of temp or flow curve
+						TotCapTempModFac = 1.0;
+						TotCapFlowModFac = 1.0;
 					} else {
-						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), CondInletTemp );
-					}
+						if ( DXCoil( DXCoilNum ).TotCapTempModFacCurveType( Mode ) == BiQuadratic ) {
+							TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), InletAirWetBulbC, CondInletTemp );
+						} else {
+							TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), CondInletTemp );
+						}
 
-					//    Warn user if curve output goes negative
-					if ( TotCapTempModFac < 0.0 ) {
-						if ( DXCoil( DXCoilNum ).CCapFTempErrorIndex == 0 ) {
-							ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\":" );
-							ShowContinueError( " Total Cooling Capacity Modifier curve (function of temperature) output is negative (" + TrimSigDigits( TotCapTempModFac, 3 ) + ")." );
-							if ( DXCoil( DXCoilNum ).TotCapTempModFacCurveType( Mode ) == BiQuadratic ) {
-								ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + " and an inlet air wet-bulb temperature of " + TrimSigDigits( InletAirWetBulbC, 1 ) + '.' );
-							} else {
-								ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + '.' );
-							}
-							if ( Mode > 1 ) {
-								ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+						//    Warn user if curve output goes negative
+						if ( TotCapTempModFac < 0.0 ) {
+							if ( DXCoil( DXCoilNum ).CCapFTempErrorIndex == 0 ) {
+								ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\":" );
+								ShowContinueError( " Total Cooling Capacity Modifier curve (function of temperature) output is negative (" + TrimSigDigits( TotCapTempModFac, 3 ) + ")." );
+								if ( DXCoil( DXCoilNum ).TotCapTempModFacCurveType( Mode ) == BiQuadratic ) {
+									ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + " and an inlet air wet-bulb temperature of " + TrimSigDigits( InletAirWetBulbC, 1 ) + '.' );
+								} else {
+									ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + '.' );
+								}
+								if ( Mode > 1 ) {
+									ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+								}
+								ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 							}
-							ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
+							ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFTempErrorIndex, TotCapTempModFac, TotCapTempModFac );
+							TotCapTempModFac = 0.0;
+							CurveClipped = true;
 						}
-						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFTempErrorIndex, TotCapTempModFac, TotCapTempModFac );
-						TotCapTempModFac = 0.0;
-					}
 
-					//    Get total capacity modifying factor (function of mass flow) for off-rated conditions
-					TotCapFlowModFac = CurveValue( DXCoil( DXCoilNum ).CCapFFlow( Mode ), AirMassFlowRatio );
-					//    Warn user if curve output goes negative
-					if ( TotCapFlowModFac < 0.0 ) {
-						if ( DXCoil( DXCoilNum ).CCapFFlowErrorIndex == 0 ) {
-							ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\":" );
-							ShowContinueError( " Total Cooling Capacity Modifier curve (function of flow fraction) output is negative (" + TrimSigDigits( TotCapFlowModFac, 3 ) + ")." );
-							ShowContinueError( " Negative value occurs using an air flow fraction of " + TrimSigDigits( AirMassFlowRatio, 3 ) + '.' );
-							ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
-							if ( Mode > 1 ) {
-								ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+						//    Get total capacity modifying factor (function of mass flow) for off-rated conditions
+						TotCapFlowModFac = CurveValue( DXCoil( DXCoilNum ).CCapFFlow( Mode ), AirMassFlowRatio );
+						//    Warn user if curve output goes negative
+						if ( TotCapFlowModFac < 0.0 ) {
+							if ( DXCoil( DXCoilNum ).CCapFFlowErrorIndex == 0 ) {
+								ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\":" );
+								ShowContinueError( " Total Cooling Capacity Modifier curve (function of flow fraction) output is negative (" + TrimSigDigits( TotCapFlowModFac, 3 ) + ")." );
+								ShowContinueError( " Negative value occurs using an air flow fraction of " + TrimSigDigits( AirMassFlowRatio, 3 ) + '.' );
+								ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
+								if ( Mode > 1 ) {
+									ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+								}
 							}
+							ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFFlowErrorIndex, TotCapFlowModFac, TotCapFlowModFac );
+							TotCapFlowModFac = 0.0;
+							CurveClipped = true;
 						}
-						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFFlowErrorIndex, TotCapFlowModFac, TotCapFlowModFac );
-						TotCapFlowModFac = 0.0;
 					}
-				}
-				TotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode ) * TotCapFlowModFac * TotCapTempModFac;
-				// if user specified SHR modifier curves are available calculate the SHR as follows:
-				if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
-					SHR = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).SHRFTemp( Mode ), DXCoil( DXCoilNum ).SHRFFlow( Mode ), DXCoil( DXCoilNum ).RatedSHR( Mode ) );
-					hDelta = TotCap / AirMassFlow;
-					break;
-				} else {
-					// Calculate apparatus dew point conditions using TotCap and CBF
-					hDelta = TotCap / AirMassFlow;
-					hADP = InletAirEnthalpy - hDelta / ( 1.0 - CBF );
-					tADP = PsyTsatFnHPb( hADP, OutdoorPressure, calcDoe2DXCoil );
-					//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
-					//  tADP = PsyTsatFnHPb(hADP,InletAirPressure)
-					wADP = PsyWFnTdbH( tADP, hADP, calcDoe2DXCoil );
-					hTinwADP = PsyHFnTdbW( InletAirDryBulbTemp, wADP );
-					if ( ( InletAirEnthalpy - hADP ) > 1.e-10 ) {
-						SHR = min( ( hTinwADP - hADP ) / ( InletAirEnthalpy - hADP ), 1.0 );
-					} else {
-						SHR = 1.0;
-					}
-					// Check for dry evaporator conditions (win < wadp)
-					if ( wADP > InletAirHumRatTemp || ( Counter >= 1 && Counter < MaxIter ) ) {
-						if ( InletAirHumRatTemp == 0.0 ) InletAirHumRatTemp = 0.00001;
-						werror = ( InletAirHumRatTemp - wADP ) / InletAirHumRatTemp;
-						// Increase InletAirHumRatTemp at constant InletAirTemp to find coil dry-out point. Then use the
-						// capacity at the dry-out point to determine exiting conditions from coil. This is required
-						// since the TotCapTempModFac doesn't work properly with dry-coil conditions.
-						InletAirHumRatTemp = RF * wADP + ( 1.0 - RF ) * InletAirHumRatTemp;
-						InletAirWetBulbC = PsyTwbFnTdbWPb( InletAirDryBulbTemp, InletAirHumRatTemp, OutdoorPressure );
-						//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
-						//  InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp,InletAirHumRatTemp,InletAirPressure)
-						++Counter;
-						if ( std::abs( werror ) > Tolerance ) continue; // Recalculate with modified inlet conditions
+					TotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode ) * TotCapFlowModFac * TotCapTempModFac;
+					// if user specified SHR modifier curves are available calculate the SHR as follows:
+					if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
+						SHR = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).SHRFTemp( Mode ), DXCoil( DXCoilNum ).SHRFFlow( Mode ), DXCoil( DXCoilNum ).RatedSHR( Mode ) );
+						hDelta = TotCap / AirMassFlow;
 						break;
 					} else {
-						break;
+						// Calculate apparatus dew point conditions using TotCap and CBF
+						hDelta = TotCap / AirMassFlow;
+						hADP = InletAirEnthalpy - hDelta / ( 1.0 - CBF );
+						tADP = PsyTsatFnHPb( hADP, OutdoorPressure, calcDoe2DXCoil );
+						//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
+						//  tADP = PsyTsatFnHPb(hADP,InletAirPressure)
+						wADP = PsyWFnTdbH( tADP, hADP, calcDoe2DXCoil );
+						hTinwADP = PsyHFnTdbW( InletAirDryBulbTemp, wADP );
+						if ( ( InletAirEnthalpy - hADP ) > 1.e-10 ) {
+							SHR = min( ( hTinwADP - hADP ) / ( InletAirEnthalpy - hADP ), 1.0 );
+						} else {
+							SHR = 1.0;
+						}
+						// Check for dry evaporator conditions (win < wadp)
+						if ( wADP > InletAirHumRatTemp || ( Counter >= 1 && Counter < MaxIter ) ) {
+							if ( InletAirHumRatTemp == 0.0 ) InletAirHumRatTemp = 0.00001;
+							werror = ( InletAirHumRatTemp - wADP ) / InletAirHumRatTemp;
+							// Increase InletAirHumRatTemp at constant InletAirTemp to find coil dry-out point. Then use the
+							// capacity at the dry-out point to determine exiting conditions from coil. This is required
+							// since the TotCapTempModFac doesn't work properly with dry-coil conditions.
+							InletAirHumRatTemp = RF * wADP + ( 1.0 - RF ) * InletAirHumRatTemp;
+							InletAirWetBulbC = PsyTwbFnTdbWPb( InletAirDryBulbTemp, InletAirHumRatTemp, OutdoorPressure );
+							//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
+							//  InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp,InletAirHumRatTemp,InletAirPressure)
+							++Counter;
+							if ( std::abs( werror ) > Tolerance ) continue; // Recalculate with modified inlet conditions
+							break;
+						} else {
+							break;
+						}
 					}
-				}
-			} // end of DO iteration loop
+				} // end of DO iteration loop
+
+				// Save the full-load operating point; it becomes valid once the EIR modifiers are known
+				FullLoad.Valid = false;
+				FullLoad.InletAirTemp = InletAirDryBulbTemp;
+				FullLoad.InletAirHumRat = InletAirHumRat;
+				FullLoad.InletAirEnthalpy = InletAirEnthalpy;
+				FullLoad.AirMassFlow = AirMassFlow;
+				FullLoad.CondInletTemp = CondInletTemp;
+				FullLoad.Pressure = OutdoorPressure;
+				FullLoad.RatedTotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode );
+				FullLoad.InletAirWetBulb = InletAirWetBulbC;
+				FullLoad.VolFlowPerRatedTotCap = VolFlowperRatedTotCap;
+				FullLoad.TotCap = TotCap;
+				FullLoad.SHR = SHR;
+				FullLoad.hDelta = hDelta;
+				FullLoad.DryCoil = ( Counter > 0 );
+			}
 
 			if ( DXCoil( DXCoilNum ).PLFFPLR( Mode ) > 0 ) {
 				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), PartLoadRatio ); // Calculate part-load factor
@@ -7103,48 +7147,59 @@ namespace DXCoils {
 			}
 
 			// Calculate electricity consumed. First, get EIR modifying factors for off-rated conditions
-			if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
-				//   Coil:DX:HeatPumpWaterHeater does not have EIR temp or flow curves
-				EIRTempModFac = 1.0;
-				EIRFlowModFac = 1.0;
+			if ( FullLoadCached ) {
+				EIRTempModFac = FullLoad.EIRTempModFac;
+				EIRFlowModFac = FullLoad.EIRFlowModFac;
 			} else {
-				EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), InletAirWetBulbC, CondInletTemp );
-
-				//   Warn user if curve output goes negative
-				if ( EIRTempModFac < 0.0 ) {
-					if ( DXCoil( DXCoilNum ).EIRFTempErrorIndex == 0 ) {
-						ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\":" );
-						ShowContinueError( " Energy Input Ratio Modifier curve (function of temperature) output is negative (" + TrimSigDigits( EIRTempModFac, 3 ) + ")." );
-						if ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( Mode ) == BiQuadratic ) {
-							ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + " and an inlet air wet-bulb temperature of " + TrimSigDigits( InletAirWetBulbC, 1 ) + '.' );
-						} else {
-							ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + '.' );
-						}
-						if ( Mode > 1 ) {
-							ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeater ) {
+					//   Coil:DX:HeatPumpWaterHeater does not have EIR temp or flow curves
+					EIRTempModFac = 1.0;
+					EIRFlowModFac = 1.0;
+				} else {
+					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), InletAirWetBulbC, CondInletTemp );
+
+					//   Warn user if curve output goes negative
+					if ( EIRTempModFac < 0.0 ) {
+						if ( DXCoil( DXCoilNum ).EIRFTempErrorIndex == 0 ) {
+							ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\":" );
+							ShowContinueError( " Energy Input Ratio Modifier curve (function of temperature) output is negative (" + TrimSigDigits( EIRTempModFac, 3 ) + ")." );
+							if ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( Mode ) == BiQuadratic ) {
+								ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + " and an inlet air wet-bulb temperature of " + TrimSigDigits( InletAirWetBulbC, 1 ) + '.' );
+							} else {
+								ShowContinueError( " Negative value occurs using a condenser inlet air temperature of " + TrimSigDigits( CondInletTemp, 1 ) + '.' );
+							}
+							if ( Mode > 1 ) {
+								ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+							}
+							ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 						}
-						ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
+						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).EIRFTempErrorIndex, EIRTempModFac, EIRTempModFac );
+						EIRTempModFac = 0.0;
+						CurveClipped = true;
 					}
-					ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).EIRFTempErrorIndex, EIRTempModFac, EIRTempModFac );
-					EIRTempModFac = 0.0;
-				}
 
-				EIRFlowModFac = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( Mode ), AirMassFlowRatio );
+					EIRFlowModFac = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( Mode ), AirMassFlowRatio );
 
-				//   Warn user if curve output goes negative
-				if ( EIRFlowModFac < 0.0 ) {
-					if ( DXCoil( DXCoilNum ).EIRFFlowErrorIndex == 0 ) {
-						ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\":" );
-						ShowContinueError( " Energy Input Ratio Modifier curve (function of flow fraction) output is negative (" + TrimSigDigits( EIRFlowModFac, 3 ) + ")." );
-						ShowContinueError( " Negative value occurs using an air flow fraction of " + TrimSigDigits( AirMassFlowRatio, 3 ) + '.' );
-						ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
-						if ( Mode > 1 ) {
-							ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+					//   Warn user if curve output goes negative
+					if ( EIRFlowModFac < 0.0 ) {
+						if ( DXCoil( DXCoilNum ).EIRFFlowErrorIndex == 0 ) {
+							ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\":" );
+							ShowContinueError( " Energy Input Ratio Modifier curve (function of flow fraction) output is negative (" + TrimSigDigits( EIRFlowModFac, 3 ) + ")." );
+							ShowContinueError( " Negative value occurs using an air flow fraction of " + TrimSigDigits( AirMassFlowRatio, 3 ) + '.' );
+							ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
+							if ( Mode > 1 ) {
+								ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
+							}
 						}
+						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).EIRFFlowErrorIndex, EIRFlowModFac, EIRFlowModFac );
+						EIRFlowModFac = 0.0;
+						CurveClipped = true;
 					}
-					ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).EIRFFlowErrorIndex, EIRFlowModFac, EIRFlowModFac );
-					EIRFlowModFac = 0.0;
 				}
+				FullLoad.EIRTempModFac = EIRTempModFac;
+				FullLoad.EIRFlowModFac = EIRFlowModFac;
+				// Points with clipped curve output are recomputed so the recurring warnings keep counting
+				FullLoad.Valid = ! CurveClipped;
 			}
 
 			EIR = DXCoil( DXCoilNum ).RatedEIR( Mode ) * EIRFlowModFac * EIRTempModFac;
@@ -8365,6 +8420,7 @@ Label50: ;
 		Real64 OutdoorPressure; // Outdoor barometric pressure at condenser (Pa)
 		bool LocalForceOn;
 		Real64 AirMassFlowRatio2; // Ratio of low speed air mass flow to rated air mass flow
+		bool FullLoadCached; // true if the full-load operating point is reused from the previous evaluation
 
 		if ( present( ForceOn ) ) {
 			LocalForceOn = true;
@@ -8415,34 +8471,66 @@ Label50: ;
 
 			RhoAir = PsyRhoAirFnPbTdbW( OutdoorPressure, OutdoorDryBulb, OutdoorHumRat );
 			if ( SpeedRatio > 0.0 ) {
-				// Adjust high speed coil bypass factor for actual maximum air flow rate.
-				RatedCBFHS = DXCoil( DXCoilNum ).RatedCBF( Mode );
-				CBFHS = AdjustCBF( RatedCBFHS, DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode ), DXCoil( DXCoilNum ).InletAirMassFlowRateMax );
-				// get high speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).InletAirMassFlowRateMax, DXCoil( DXCoilNum ).RatedTotCap( Mode ), CBFHS, DXCoil( DXCoilNum ).CCapFTemp( Mode ), DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapHS, SHRHS, CondInletTemp, OutdoorPressure );
-				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
-				//                       CondInletTemp, Node(DXCoil(DXCoilNum)%AirInNode)%Press)
-				// get the high speed SHR from user specified SHR modifier curves
-				if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
-					SHRHS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).SHRFTemp( Mode ), DXCoil( DXCoilNum ).SHRFFlow( Mode ), DXCoil( DXCoilNum ).RatedSHR( Mode ) );
-				}
-				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
-				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
-				//                       Node(DXCoil(DXCoilNum)%AirInNode)%Press)
-				// get the low speed SHR from user specified SHR modifier curves
-				if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
-					SHRLS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio2, DXCoil( DXCoilNum ).SHRFTemp2, DXCoil( DXCoilNum ).SHRFFlow2, DXCoil( DXCoilNum ).RatedSHR2 );
+				// High and low speed performance only depend on the inlet and condenser conditions, so a speed ratio
+				// search at fixed conditions reuses them and only the interpolation between speeds is repeated.
+				auto & FullLoad( DXCoilFullLoad( 1, DXCoilNum ) );
+				++FullLoad.NumCalls;
+				FullLoadCached = ! AnyEnergyManagementSystemInModel && MatchFullLoadPoint( FullLoad, InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, DXCoil( DXCoilNum ).InletAirMassFlowRateMax, CondInletTemp, OutdoorPressure, DXCoil( DXCoilNum ).RatedTotCap( Mode ) );
+				if ( FullLoadCached ) {
+					++FullLoad.NumHits;
+					CBFHS = FullLoad.CBF;
+					TotCapHS = FullLoad.TotCap;
+					SHRHS = FullLoad.SHR;
+					EIRHS = FullLoad.EIR;
+					TotCapLS = FullLoad.TotCap2;
+					SHRLS = FullLoad.SHR2;
+					EIRLS = FullLoad.EIR2;
+				} else {
+					// Adjust high speed coil bypass factor for actual maximum air flow rate.
+					RatedCBFHS = DXCoil( DXCoilNum ).RatedCBF( Mode );
+					CBFHS = AdjustCBF( RatedCBFHS, DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode ), DXCoil( DXCoilNum ).InletAirMassFlowRateMax );
+					// get high speed total capacity and SHR at current conditions
+					CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).InletAirMassFlowRateMax, DXCoil( DXCoilNum ).RatedTotCap( Mode ), CBFHS, DXCoil( DXCoilNum ).CCapFTemp( Mode ), DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapHS, SHRHS, CondInletTemp, OutdoorPressure );
+					//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
+					//                       CondInletTemp, Node(DXCoil(DXCoilNum)%AirInNode)%Press)
+					// get the high speed SHR from user specified SHR modifier curves
+					if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
+						SHRHS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).SHRFTemp( Mode ), DXCoil( DXCoilNum ).SHRFFlow( Mode ), DXCoil( DXCoilNum ).RatedSHR( Mode ) );
+					}
+					// get low speed total capacity and SHR at current conditions
+					CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+					//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
+					//                       Node(DXCoil(DXCoilNum)%AirInNode)%Press)
+					// get the low speed SHR from user specified SHR modifier curves
+					if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
+						SHRLS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio2, DXCoil( DXCoilNum ).SHRFTemp2, DXCoil( DXCoilNum ).SHRFFlow2, DXCoil( DXCoilNum ).RatedSHR2 );
+					}
+					// get high speed EIR at current conditions
+					EIRTempModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), InletAirWetBulbC, CondInletTemp );
+					EIRFlowModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( Mode ), AirMassFlowRatio );
+					EIRHS = DXCoil( DXCoilNum ).RatedEIR( Mode ) * EIRFlowModFacHS * EIRTempModFacHS;
+					// get low speed EIR at current conditions
+					//    EIRTempModFacLS = CurveValue(DXCoil(DXCoilNum)%EIRFTemp(Mode),InletAirWetBulbC,CondInletTemp)
+					//    CR7307 changed EIRTempModFacLS calculation to that shown below.
+					EIRTempModFacLS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp2, InletAirWetBulbC, CondInletTemp );
+					EIRLS = DXCoil( DXCoilNum ).RatedEIR2 * EIRTempModFacLS;
+
+					FullLoad.Valid = true;
+					FullLoad.InletAirTemp = InletAirDryBulbTemp;
+					FullLoad.InletAirHumRat = InletAirHumRat;
+					FullLoad.InletAirEnthalpy = InletAirEnthalpy;
+					FullLoad.AirMassFlow = DXCoil( DXCoilNum ).InletAirMassFlowRateMax;
+					FullLoad.CondInletTemp = CondInletTemp;
+					FullLoad.Pressure = OutdoorPressure;
+					FullLoad.RatedTotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode );
+					FullLoad.CBF = CBFHS;
+					FullLoad.TotCap = TotCapHS;
+					FullLoad.SHR = SHRHS;
+					FullLoad.EIR = EIRHS;
+					FullLoad.TotCap2 = TotCapLS;
+					FullLoad.SHR2 = SHRLS;
+					FullLoad.EIR2 = EIRLS;
 				}
-				// get high speed EIR at current conditions
-				EIRTempModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), InletAirWetBulbC, CondInletTemp );
-				EIRFlowModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( Mode ), AirMassFlowRatio );
-				EIRHS = DXCoil( DXCoilNum ).RatedEIR( Mode ) * EIRFlowModFacHS * EIRTempModFacHS;
-				// get low speed EIR at current conditions
-				//    EIRTempModFacLS = CurveValue(DXCoil(DXCoilNum)%EIRFTemp(Mode),InletAirWetBulbC,CondInletTemp)
-				//    CR7307 changed EIRTempModFacLS calculation to that shown below.
-				EIRTempModFacLS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp2, InletAirWetBulbC, CondInletTemp );
-				EIRLS = DXCoil( DXCoilNum ).RatedEIR2 * EIRTempModFacLS;
 
 				// get current total capacity, SHR, EIR
 				if ( SpeedRatio >= 1.0 ) {
@@ -8550,13 +8638,23 @@ Label50: ;
 					CondInletHumRat = PsyWFnTdbTwbPb( CondInletTemp, OutdoorWetBulb, OutdoorPressure );
 				}
 
-				// Adjust low speed coil bypass factor for actual flow rate.
-				// CBF = AdjustCBF(DXCoil(DXCoilNum)%RatedCBF2,DXCoil(DXCoilNum)%RatedAirMassFlowRate2,AirMassFlow)
-				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
-				// get the low speed SHR from user specified SHR modifier curves
-				if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
-					SHRLS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).SHRFTemp2, DXCoil( DXCoilNum ).SHRFFlow2, DXCoil( DXCoilNum ).RatedSHR2 );
+				// Low speed performance does not depend on the cycling ratio, so reuse it during a cycling ratio search
+				auto & FullLoad( DXCoilFullLoad( 2, DXCoilNum ) );
+				++FullLoad.NumCalls;
+				FullLoadCached = ! AnyEnergyManagementSystemInModel && MatchFullLoadPoint( FullLoad, InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, CondInletTemp, OutdoorPressure, DXCoil( DXCoilNum ).RatedTotCap2 );
+				if ( FullLoadCached ) {
+					++FullLoad.NumHits;
+					TotCapLS = FullLoad.TotCap2;
+					SHRLS = FullLoad.SHR2;
+				} else {
+					// Adjust low speed coil bypass factor for actual flow rate.
+					// CBF = AdjustCBF(DXCoil(DXCoilNum)%RatedCBF2,DXCoil(DXCoilNum)%RatedAirMassFlowRate2,AirMassFlow)
+					// get low speed total capacity and SHR at current conditions
+					CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+					// get the low speed SHR from user specified SHR modifier curves
+					if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
+						SHRLS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).SHRFTemp2, DXCoil( DXCoilNum ).SHRFFlow2, DXCoil( DXCoilNum ).RatedSHR2 );
+					}
 				}
 				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
 				//                       Node(DXCoil(DXCoilNum)%AirInNode)%Press)
@@ -8618,10 +8716,26 @@ Label50: ;
 				OutletAirHumRat = CycRatio * LSOutletAirHumRat + ( 1.0 - CycRatio ) * InletAirHumRat;
 				OutletAirDryBulbTemp = PsyTdbFnHW( OutletAirEnthalpy, OutletAirHumRat );
 				// get low speed EIR at current conditions
-				//    EIRTempModFacLS = CurveValue(DXCoil(DXCoilNum)%EIRFTemp(Mode),InletAirWetBulbC,CondInletTemp)
-				//    CR7307 changed EIRTempModFacLS calculation to that shown below.
-				EIRTempModFacLS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp2, InletAirWetBulbC, CondInletTemp );
-				EIRLS = DXCoil( DXCoilNum ).RatedEIR2 * EIRTempModFacLS;
+				if ( FullLoadCached ) {
+					EIRLS = FullLoad.EIR2;
+				} else {
+					//    EIRTempModFacLS = CurveValue(DXCoil(DXCoilNum)%EIRFTemp(Mode),InletAirWetBulbC,CondInletTemp)
+					//    CR7307 changed EIRTempModFacLS calculation to that shown below.
+					EIRTempModFacLS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp2, InletAirWetBulbC, CondInletTemp );
+					EIRLS = DXCoil( DXCoilNum ).RatedEIR2 * EIRTempModFacLS;
+
+					FullLoad.Valid = true;
+					FullLoad.InletAirTemp = InletAirDryBulbTemp;
+					FullLoad.InletAirHumRat = InletAirHumRat;
+					FullLoad.InletAirEnthalpy = InletAirEnthalpy;
+					FullLoad.AirMassFlow = DXCoil( DXCoilNum ).RatedAirMassFlowRate2;
+					FullLoad.CondInletTemp = CondInletTemp;
+					FullLoad.Pressure = OutdoorPressure;
+					FullLoad.RatedTotCap = DXCoil( DXCoilNum ).RatedTotCap2;
+					FullLoad.TotCap2 = TotCapLS;
+					FullLoad.SHR2 = SHRLS;
+					FullLoad.EIR2 = EIRLS;
+				}
 				// get the part load factor that will account for cycling losses
 				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), CycRatio );
 				if ( PLF < 0.7 ) {
@@ -12909,6 +13023,126 @@ Label50: ;
 
 	}
 
+	bool
+	MatchFullLoadPoint(
+		DXCoilFullLoadData & FullLoad, // cached full-load operating point
+		Real64 const InletAirTemp, // coil inlet air dry-bulb temperature [C]
+		Real64 const InletAirHumRat, // coil inlet air humidity ratio [kg/kg]
+		Real64 const InletAirEnthalpy, // coil inlet air enthalpy [J/kg]
+		Real64 const AirMassFlow, // full-load air mass flow rate through the coil [kg/s]
+		Real64 const CondInletTemp, // condenser inlet temperature [C]
+		Real64 const Pressure, // barometric pressure at the condenser [Pa]
+		Real64 const RatedTotCap // rated total capacity [W]
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determines whether the cached full-load operating point of a DX coil was evaluated
+		// at the given coil inlet, condenser inlet and air flow conditions.
+
+		// METHODOLOGY EMPLOYED:
+		// The conditions must match exactly so a reused operating point gives the same
+		// results as a new evaluation. Part-load and speed ratio solvers call the coil
+		// model repeatedly at unchanged conditions, which is where the cache pays off.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		return ( FullLoad.Valid && FullLoad.InletAirTemp == InletAirTemp && FullLoad.InletAirHumRat == InletAirHumRat && FullLoad.InletAirEnthalpy == InletAirEnthalpy && FullLoad.AirMassFlow == AirMassFlow && FullLoad.CondInletTemp == CondInletTemp && FullLoad.Pressure == Pressure && FullLoad.RatedTotCap == RatedTotCap );
+
+	}
+
+	void
+	ReportDXCoilFullLoadStatistics()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes how often each DX coil reused its full-load operating point to the eio file
+		// at the end of the run.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt Format_800( "('! <DX Coil Full Load Reuse>, DX Coil Type, DX Coil Name, Full Load Evaluations, Reused Evaluations, Reuse Rate {%}')" );
+		static gio::Fmt Format_801( "(' DX Coil Full Load Reuse, ',A,',',A,',',A,',',A,',',A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int DXCoilNum; // DX coil index
+		int NumCalls; // full-load evaluations requested by the coil
+		int NumHits; // full-load evaluations the coil reused
+		bool WriteHeader; // true until the eio header has been written
+
+		if ( NumDXCoils == 0 || ! allocated( DXCoilFullLoad ) ) return;
+
+		WriteHeader = true;
+		for ( DXCoilNum = 1; DXCoilNum <= NumDXCoils; ++DXCoilNum ) {
+			NumCalls = 0;
+			NumHits = 0;
+			for ( int Mode = 1; Mode <= MaxModes; ++Mode ) {
+				NumCalls += DXCoilFullLoad( Mode, DXCoilNum ).NumCalls;
+				NumHits += DXCoilFullLoad( Mode, DXCoilNum ).NumHits;
+			}
+			if ( NumCalls == 0 ) continue;
+			if ( WriteHeader ) {
+				gio::write( OutputFileInits, Format_800 );
+				WriteHeader = false;
+			}
+			gio::write( OutputFileInits, Format_801 ) << DXCoil( DXCoilNum ).DXCoilType << DXCoil( DXCoilNum ).Name << TrimSigDigits( NumCalls ) << TrimSigDigits( NumHits ) << RoundSigDigits( 100.0 * NumHits / NumCalls, 2 );
+		}
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
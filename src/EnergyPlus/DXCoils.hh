@@ -4,6 +4,7 @@
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray1S.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -1128,9 +1129,69 @@ namespace DXCoils {
 		{}
 	};
 
+	struct DXCoilFullLoadData
+	{
+		// Members
+		// Key: inlet and condenser conditions the full-load operating point was evaluated at
+		bool Valid; // true when the entry holds a full-load operating point
+		Real64 InletAirTemp; // coil inlet air dry-bulb temperature [C]
+		Real64 InletAirHumRat; // coil inlet air humidity ratio [kg/kg]
+		Real64 InletAirEnthalpy; // coil inlet air enthalpy [J/kg]
+		Real64 AirMassFlow; // full-load air mass flow rate through the coil [kg/s]
+		Real64 CondInletTemp; // condenser inlet temperature [C]
+		Real64 Pressure; // barometric pressure at the condenser [Pa]
+		Real64 RatedTotCap; // rated total capacity the point was evaluated with [W]
+		// Full-load operating point
+		Real64 InletAirWetBulb; // inlet air wet-bulb (at the dry-out point for a dry coil) [C]
+		Real64 VolFlowPerRatedTotCap; // air volume flow rate per rated total capacity [m3/s-W]
+		Real64 CBF; // coil bypass factor at the full-load air flow
+		Real64 TotCap; // total capacity at full load (high speed for two-speed coils) [W]
+		Real64 SHR; // sensible heat ratio at full load (high speed for two-speed coils)
+		Real64 hDelta; // enthalpy drop across the coil at full load [J/kg]
+		bool DryCoil; // true when the ADP/BF iteration found a dry coil
+		Real64 EIRTempModFac; // EIR modifier (function of temperature) at full load
+		Real64 EIRFlowModFac; // EIR modifier (function of flow fraction) at full load
+		Real64 EIR; // EIR at full load (high speed for two-speed coils)
+		Real64 TotCap2; // low speed total capacity for two-speed coils [W]
+		Real64 SHR2; // low speed sensible heat ratio for two-speed coils
+		Real64 EIR2; // low speed EIR for two-speed coils
+		// Statistics
+		int NumCalls; // number of full-load evaluations requested
+		int NumHits; // number of full-load evaluations served from this entry
+
+		// Default Constructor
+		DXCoilFullLoadData() :
+			Valid( false ),
+			InletAirTemp( 0.0 ),
+			InletAirHumRat( 0.0 ),
+			InletAirEnthalpy( 0.0 ),
+			AirMassFlow( 0.0 ),
+			CondInletTemp( 0.0 ),
+			Pressure( 0.0 ),
+			RatedTotCap( 0.0 ),
+			InletAirWetBulb( 0.0 ),
+			VolFlowPerRatedTotCap( 0.0 ),
+			CBF( 0.0 ),
+			TotCap( 0.0 ),
+			SHR( 0.0 ),
+			hDelta( 0.0 ),
+			DryCoil( false ),
+			EIRTempModFac( 0.0 ),
+			EIRFlowModFac( 0.0 ),
+			EIR( 0.0 ),
+			TotCap2( 0.0 ),
+			SHR2( 0.0 ),
+			EIR2( 0.0 ),
+			NumCalls( 0 ),
+			NumHits( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< DXCoilData > DXCoil;
 	extern FArray1D< DXCoilNumericFieldData > DXCoilNumericFields;
+	extern FArray2D< DXCoilFullLoadData > DXCoilFullLoad; // full-load operating point (performance mode or speed, coil)
 
 	// Functions
 
@@ -1478,6 +1539,21 @@ namespace DXCoils {
 	void
 	SetDXCoilTypeData( std::string const & CoilName ); // must match coil names for the coil type
 
+	bool
+	MatchFullLoadPoint(
+		DXCoilFullLoadData & FullLoad, // cached full-load operating point
+		Real64 const InletAirTemp, // coil inlet air dry-bulb temperature [C]
+		Real64 const InletAirHumRat, // coil inlet air humidity ratio [kg/kg]
+		Real64 const InletAirEnthalpy, // coil inlet air enthalpy [J/kg]
+		Real64 const AirMassFlow, // full-load air mass flow rate through the coil [kg/s]
+		Real64 const CondInletTemp, // condenser inlet temperature [C]
+		Real64 const Pressure, // barometric pressure at the condenser [Pa]
+		Real64 const RatedTotCap // rated total capacity [W]
+	);
+
+	void
+	ReportDXCoilFullLoadStatistics();
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -87,6 +87,8 @@ namespace DataErrorTracking {
 	bool AskForPlantCheckOnAbort( false ); // flag used to tell if plant structure can be checked
 	bool ExitDuringSimulations( false ); // flag used to tell if program is in simulation mode when fatal occurs
 	std::string LastSevereError;
+	bool CacheErrorMessages( false ); // Flag used to keep error messages in CachedErrorMessages (zone sizing worker process)
+	std::vector< std::string > CachedErrorMessages; // Error messages not yet passed to the parent process
 
 	// Object Data
 	FArray1D< RecurringErrorData > RecurringErrors;
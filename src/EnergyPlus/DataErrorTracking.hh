@@ -1,6 +1,10 @@
 #ifndef DataErrorTracking_hh_INCLUDED
 #define DataErrorTracking_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 
@@ -70,6 +74,8 @@ namespace DataErrorTracking {
 	extern bool AskForPlantCheckOnAbort; // flag used to tell if plant structure can be checked
 	extern bool ExitDuringSimulations; // flag used to tell if program is in simulation mode when fatal occurs
 	extern std::string LastSevereError;
+	extern bool CacheErrorMessages; // Flag used to keep error messages in CachedErrorMessages (zone sizing worker process)
+	extern std::vector< std::string > CachedErrorMessages; // Error messages not yet passed to the parent process
 
 	// Types
 
@@ -162,6 +162,7 @@ namespace DataGlobals {
 	bool DisplayUnusedObjects( false ); // True when selection for  "DisplayUnusedObjects" is entered
 	bool DisplayUnusedSchedules( false ); // True when selection for  "DisplayUnusedSchedules" is entered
 	bool DisplayAdvancedReportVariables( false ); // True when selection for  "DisplayAdvancedReportVariables" is entered
+	bool DisplayMemoryUsage( false ); // True when selection for  "DisplayMemoryUsage" is entered
 	bool DisplayZoneAirHeatBalanceOffBalance( false ); // True when selection for  "DisplayZoneAirHeatBalanceOffBalance" is entered
 	bool CreateMinimalSurfaceVariables( false ); // True when selection for  "CreateMinimalSurfaceVariables" is entered
 	Real64 CurrentTime( 0.0 ); // CurrentTime, in fractional hours, from start of day. Uses Loads time step.
@@ -135,6 +135,7 @@ namespace DataGlobals {
 	extern bool DisplayUnusedObjects; // True when selection for  "DisplayUnusedObjects" is entered
 	extern bool DisplayUnusedSchedules; // True when selection for  "DisplayUnusedSchedules" is entered
 	extern bool DisplayAdvancedReportVariables; // True when selection for  "DisplayAdvancedReportVariables" is entered
+	extern bool DisplayMemoryUsage; // True when selection for  "DisplayMemoryUsage" is entered
 	extern bool DisplayZoneAirHeatBalanceOffBalance; // True when selection for  "DisplayZoneAirHeatBalanceOffBalance" is entered
 	extern bool CreateMinimalSurfaceVariables; // True when selection for  "CreateMinimalSurfaceVariables" is entered
 	extern Real64 CurrentTime; // CurrentTime, in fractional hours, from start of day. Uses Loads time step.
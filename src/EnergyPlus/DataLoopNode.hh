@@ -73,82 +73,87 @@ namespace DataLoopNode {
 	struct NodeData
 	{
 		// Members
-		int FluidType; // must be one of the valid parameters
-		int FluidIndex; // For Fluid Properties
+		// State iterated by the air and plant solvers first, so that it is contiguous in the
+		// first 64 bytes of each node (NodeData is not padded or aligned to cache lines)
 		Real64 Temp; // {C}
-		Real64 TempMin; // {C}
-		Real64 TempMax; // {C}
-		Real64 TempSetPoint; // {C}
-		Real64 TempLastTimestep; // [C}   DSU
-		Real64 MassFlowRateRequest; // {kg/s}  DSU
 		Real64 MassFlowRate; // {kg/s}
-		Real64 MassFlowRateMin; // {kg/s}
-		Real64 MassFlowRateMax; // {kg/s}
 		Real64 MassFlowRateMinAvail; // {kg/s}
 		Real64 MassFlowRateMaxAvail; // {kg/s}
-		Real64 MassFlowRateSetPoint; // {kg/s}
-		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
-		Real64 Press; // {Pa}
-		Real64 Enthalpy; // {J/kg}
-		Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
 		Real64 HumRat; // {}
-		Real64 HumRatMin; // {}
-		Real64 HumRatMax; // {}
-		Real64 HumRatSetPoint; // {}
+		Real64 Enthalpy; // {J/kg}
+		Real64 Press; // {Pa}
+		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
+		// Fluid, set points and limits
+		int FluidType; // must be one of the valid parameters
+		int FluidIndex; // For Fluid Properties
+		Real64 TempSetPoint; // {C}
 		Real64 TempSetPointHi; // {C}
 		Real64 TempSetPointLo; // {C}
+		Real64 HumRatSetPoint; // {}
+		Real64 MassFlowRateSetPoint; // {kg/s}
+		Real64 TempMin; // {C}
+		Real64 TempMax; // {C}
+		Real64 HumRatMin; // {}
+		Real64 HumRatMax; // {}
+		Real64 MassFlowRateMin; // {kg/s}
+		Real64 MassFlowRateMax; // {kg/s}
+		Real64 MassFlowRateRequest; // {kg/s}  DSU
+		// Rarely used
+		Real64 TempLastTimestep; // [C}   DSU
+		Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
 		Real64 Height; // {m}
 		//  Following are for Outdoor Air Nodes "read only"
 		Real64 OutAirDryBulb; // {C}
-		bool EMSOverrideOutAirDryBulb; // if true, the EMS is calling to override outdoor air node drybulb setting
-		Real64 EMSValueForOutAirDryBulb; // value EMS is directing to use for outdoor air node's drybulb {C}
 		Real64 OutAirWetBulb; // {C}
-		bool EMSOverrideOutAirWetBulb; // if true, the EMS is calling to override outdoor air node wetbulb setting
+		Real64 EMSValueForOutAirDryBulb; // value EMS is directing to use for outdoor air node's drybulb {C}
 		Real64 EMSValueForOutAirWetBulb; // value EMS is directing to use for outdoor air node's wetbulb {C}
 		// Contaminant
 		Real64 CO2; // {ppm}
 		Real64 CO2SetPoint; // {ppm}
 		Real64 GenContam; // {ppm}
 		Real64 GenContamSetPoint; // {ppm}
+		// Flags
+		bool EMSOverrideOutAirDryBulb; // if true, the EMS is calling to override outdoor air node drybulb setting
+		bool EMSOverrideOutAirWetBulb; // if true, the EMS is calling to override outdoor air node wetbulb setting
 		bool SPMNodeWetBulbRepReq; // Set to true when node has SPM which follows wetbulb
 
 		// Default Constructor
 		NodeData() :
-			FluidType( 0 ),
-			FluidIndex( 0 ),
 			Temp( 0.0 ),
-			TempMin( 0.0 ),
-			TempMax( 0.0 ),
-			TempSetPoint( SensedNodeFlagValue ),
-			TempLastTimestep( 0.0 ),
-			MassFlowRateRequest( 0.0 ),
 			MassFlowRate( 0.0 ),
-			MassFlowRateMin( 0.0 ),
-			MassFlowRateMax( SensedNodeFlagValue ),
 			MassFlowRateMinAvail( 0.0 ),
 			MassFlowRateMaxAvail( 0.0 ),
-			MassFlowRateSetPoint( 0.0 ),
-			Quality( 0.0 ),
-			Press( 0.0 ),
-			Enthalpy( 0.0 ),
-			EnthalpyLastTimestep( 0.0 ),
 			HumRat( 0.0 ),
-			HumRatMin( SensedNodeFlagValue ),
-			HumRatMax( SensedNodeFlagValue ),
-			HumRatSetPoint( SensedNodeFlagValue ),
+			Enthalpy( 0.0 ),
+			Press( 0.0 ),
+			Quality( 0.0 ),
+			FluidType( 0 ),
+			FluidIndex( 0 ),
+			TempSetPoint( SensedNodeFlagValue ),
 			TempSetPointHi( SensedNodeFlagValue ),
 			TempSetPointLo( SensedNodeFlagValue ),
+			HumRatSetPoint( SensedNodeFlagValue ),
+			MassFlowRateSetPoint( 0.0 ),
+			TempMin( 0.0 ),
+			TempMax( 0.0 ),
+			HumRatMin( SensedNodeFlagValue ),
+			HumRatMax( SensedNodeFlagValue ),
+			MassFlowRateMin( 0.0 ),
+			MassFlowRateMax( SensedNodeFlagValue ),
+			MassFlowRateRequest( 0.0 ),
+			TempLastTimestep( 0.0 ),
+			EnthalpyLastTimestep( 0.0 ),
 			Height( -1.0 ),
 			OutAirDryBulb( 0.0 ),
-			EMSOverrideOutAirDryBulb( false ),
-			EMSValueForOutAirDryBulb( 0.0 ),
 			OutAirWetBulb( 0.0 ),
-			EMSOverrideOutAirWetBulb( false ),
+			EMSValueForOutAirDryBulb( 0.0 ),
 			EMSValueForOutAirWetBulb( 0.0 ),
 			CO2( 0.0 ),
 			CO2SetPoint( 0.0 ),
 			GenContam( 0.0 ),
 			GenContamSetPoint( 0.0 ),
+			EMSOverrideOutAirDryBulb( false ),
+			EMSOverrideOutAirWetBulb( false ),
 			SPMNodeWetBulbRepReq( false )
 		{}
 
@@ -191,41 +196,41 @@ namespace DataLoopNode {
 			Real64 const GenContamSetPoint, // {ppm}
 			bool const SPMNodeWetBulbRepReq // Set to true when node has SPM which follows wetbulb
 		) :
-			FluidType( FluidType ),
-			FluidIndex( FluidIndex ),
 			Temp( Temp ),
-			TempMin( TempMin ),
-			TempMax( TempMax ),
-			TempSetPoint( TempSetPoint ),
-			TempLastTimestep( TempLastTimestep ),
-			MassFlowRateRequest( MassFlowRateRequest ),
 			MassFlowRate( MassFlowRate ),
-			MassFlowRateMin( MassFlowRateMin ),
-			MassFlowRateMax( MassFlowRateMax ),
 			MassFlowRateMinAvail( MassFlowRateMinAvail ),
 			MassFlowRateMaxAvail( MassFlowRateMaxAvail ),
-			MassFlowRateSetPoint( MassFlowRateSetPoint ),
-			Quality( Quality ),
-			Press( Press ),
-			Enthalpy( Enthalpy ),
-			EnthalpyLastTimestep( EnthalpyLastTimestep ),
 			HumRat( HumRat ),
-			HumRatMin( HumRatMin ),
-			HumRatMax( HumRatMax ),
-			HumRatSetPoint( HumRatSetPoint ),
+			Enthalpy( Enthalpy ),
+			Press( Press ),
+			Quality( Quality ),
+			FluidType( FluidType ),
+			FluidIndex( FluidIndex ),
+			TempSetPoint( TempSetPoint ),
 			TempSetPointHi( TempSetPointHi ),
 			TempSetPointLo( TempSetPointLo ),
+			HumRatSetPoint( HumRatSetPoint ),
+			MassFlowRateSetPoint( MassFlowRateSetPoint ),
+			TempMin( TempMin ),
+			TempMax( TempMax ),
+			HumRatMin( HumRatMin ),
+			HumRatMax( HumRatMax ),
+			MassFlowRateMin( MassFlowRateMin ),
+			MassFlowRateMax( MassFlowRateMax ),
+			MassFlowRateRequest( MassFlowRateRequest ),
+			TempLastTimestep( TempLastTimestep ),
+			EnthalpyLastTimestep( EnthalpyLastTimestep ),
 			Height( Height ),
 			OutAirDryBulb( OutAirDryBulb ),
-			EMSOverrideOutAirDryBulb( EMSOverrideOutAirDryBulb ),
-			EMSValueForOutAirDryBulb( EMSValueForOutAirDryBulb ),
 			OutAirWetBulb( OutAirWetBulb ),
-			EMSOverrideOutAirWetBulb( EMSOverrideOutAirWetBulb ),
+			EMSValueForOutAirDryBulb( EMSValueForOutAirDryBulb ),
 			EMSValueForOutAirWetBulb( EMSValueForOutAirWetBulb ),
 			CO2( CO2 ),
 			CO2SetPoint( CO2SetPoint ),
 			GenContam( GenContam ),
 			GenContamSetPoint( GenContamSetPoint ),
+			EMSOverrideOutAirDryBulb( EMSOverrideOutAirDryBulb ),
+			EMSOverrideOutAirWetBulb( EMSOverrideOutAirWetBulb ),
 			SPMNodeWetBulbRepReq( SPMNodeWetBulbRepReq )
 		{}
 
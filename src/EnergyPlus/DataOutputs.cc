@@ -53,6 +53,7 @@ namespace DataOutputs {
 
 	// Object Data
 	FArray1D< OutputReportingVariables > OutputVariablesForSimulation;
+	std::unordered_map< std::string, OutputReportingVariablesIndex > OutputVariablesForSimulationIndex; // by upper case variable name
 
 	// Functions
 
@@ -74,7 +75,8 @@ namespace DataOutputs {
 		// in the list of required variables for a simulation.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The pre-scanned requests are indexed by upper case variable name, so the
+		// lookup does not depend on the number of requests.
 
 		// REFERENCES:
 		// na
@@ -98,30 +100,12 @@ namespace DataOutputs {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Found;
-		int Item;
+		// na
 
 		InVariableList = false;
-		Found = 0;
-		for ( Item = 1; Item <= NumConsideredOutputVariables; ++Item ) {
-			if ( ! equali( VariableName, OutputVariablesForSimulation( Item ).VarName ) ) continue;
-			Found = Item;
-			break;
-		}
-		if ( Found != 0 ) {
-			if ( equali( KeyedValue, OutputVariablesForSimulation( Found ).Key ) || OutputVariablesForSimulation( Found ).Key == "*" ) {
-				InVariableList = true;
-			} else {
-				while ( Found != 0 ) {
-					Found = OutputVariablesForSimulation( Found ).Next;
-					if ( Found != 0 ) {
-						if ( equali( KeyedValue, OutputVariablesForSimulation( Found ).Key ) || OutputVariablesForSimulation( Found ).Key == "*" ) {
-							InVariableList = true;
-							break;
-						}
-					}
-				}
-			}
+		auto const Found( OutputVariablesForSimulationIndex.find( uppercased( VariableName ) ) );
+		if ( Found != OutputVariablesForSimulationIndex.end() ) {
+			InVariableList = Found->second.AllKeys || ( Found->second.Keys.count( uppercased( KeyedValue ) ) > 0 );
 		}
 
 		return InVariableList;
@@ -1,6 +1,11 @@
 #ifndef DataOutputs_hh_INCLUDED
 #define DataOutputs_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 
@@ -64,7 +69,23 @@ namespace DataOutputs {
 	};
 
 	// Object Data
+	struct OutputReportingVariablesIndex // Pre-scanned requests of one variable name
+	{
+		// Members
+		int First; // first item of the variable name in OutputVariablesForSimulation
+		bool AllKeys; // true if the variable is requested for all keys ("*")
+		std::unordered_set< std::string > Keys; // requested keys (upper case)
+
+		// Default Constructor
+		OutputReportingVariablesIndex() :
+			First( 0 ),
+			AllKeys( false )
+		{}
+
+	};
+
 	extern FArray1D< OutputReportingVariables > OutputVariablesForSimulation;
+	extern std::unordered_map< std::string, OutputReportingVariablesIndex > OutputVariablesForSimulationIndex; // by upper case variable name
 
 	// Functions
 
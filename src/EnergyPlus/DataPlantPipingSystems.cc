@@ -96,6 +96,9 @@ namespace DataPlantPipingSystems {
 	int const CellType_BasementWallInsu( -15 );
 	int const CellType_BasementFloorInsu( -16 );
 
+	int const SolutionAlgorithm_GaussSeidel( -1 );
+	int const SolutionAlgorithm_ADI( -2 );
+
 	// DERIVED TYPE DEFINITIONS:
 
 	//Input data structure
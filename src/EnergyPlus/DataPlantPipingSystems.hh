@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/FArray3D.hh>
 
 // EnergyPlus Headers
@@ -78,6 +79,9 @@ namespace DataPlantPipingSystems {
 	extern int const CellType_BasementWallInsu;
 	extern int const CellType_BasementFloorInsu;
 
+	extern int const SolutionAlgorithm_GaussSeidel;
+	extern int const SolutionAlgorithm_ADI;
+
 
 	// DERIVED TYPE DEFINITIONS:
 
@@ -701,13 +705,15 @@ namespace DataPlantPipingSystems {
 		Real64 MaximumTemperatureLimit;
 		Real64 Convergence_CurrentToPrevIteration;
 		int MaxIterationsPerTS;
+		int SolutionAlgorithm; // From Enum: SolutionAlgorithm
 
 		// Default Constructor
 		SimulationControl() :
 			MinimumTemperatureLimit( -1000.0 ),
 			MaximumTemperatureLimit( 1000.0 ),
 			Convergence_CurrentToPrevIteration( 0.0 ),
-			MaxIterationsPerTS( 0 )
+			MaxIterationsPerTS( 0 ),
+			SolutionAlgorithm( SolutionAlgorithm_GaussSeidel )
 		{}
 
 		// Member Constructor
@@ -715,12 +721,14 @@ namespace DataPlantPipingSystems {
 			Real64 const MinimumTemperatureLimit,
 			Real64 const MaximumTemperatureLimit,
 			Real64 const Convergence_CurrentToPrevIteration,
-			int const MaxIterationsPerTS
+			int const MaxIterationsPerTS,
+			int const SolutionAlgorithm // From Enum: SolutionAlgorithm
 		) :
 			MinimumTemperatureLimit( MinimumTemperatureLimit ),
 			MaximumTemperatureLimit( MaximumTemperatureLimit ),
 			Convergence_CurrentToPrevIteration( Convergence_CurrentToPrevIteration ),
-			MaxIterationsPerTS( MaxIterationsPerTS )
+			MaxIterationsPerTS( MaxIterationsPerTS ),
+			SolutionAlgorithm( SolutionAlgorithm )
 		{}
 
 	};
@@ -851,6 +859,8 @@ namespace DataPlantPipingSystems {
 		Real64 BasementFloorHeatTransfer;
 		Real64 AverageBasementFloorTemperature;
 		Real64 AverageBasementWallTemperature;
+		int NumIterations; // Iterations in the last domain time step
+		Real64 MaxIterationTempChange; // Largest cell temperature change in the last iteration (deltaC)
 
 		// Default Constructor
 		ReportingInformation() :
@@ -862,7 +872,9 @@ namespace DataPlantPipingSystems {
 			BasementWallHeatTransfer( 0.0 ),
 			BasementFloorHeatTransfer( 0.0 ),
 			AverageBasementFloorTemperature( 0.0 ),
-			AverageBasementWallTemperature( 0.0 )
+			AverageBasementWallTemperature( 0.0 ),
+			NumIterations( 0 ),
+			MaxIterationTempChange( 0.0 )
 		{}
 
 		// Member Constructor
@@ -876,7 +888,9 @@ namespace DataPlantPipingSystems {
 			Real64 const BasementWallHeatTransfer,
 			Real64 const BasementFloorHeatTransfer,
 			Real64 const AverageBasementFloorTemperature,
-			Real64 const AverageBasementWallTemperature
+			Real64 const AverageBasementWallTemperature,
+			int const NumIterations, // Iterations in the last domain time step
+			Real64 const MaxIterationTempChange // Largest cell temperature change in the last iteration (deltaC)
 		) :
 			SurfaceHeatTransfer( SurfaceHeatTransfer ),
 			TotalBoundaryHeatTransfer( TotalBoundaryHeatTransfer ),
@@ -887,7 +901,9 @@ namespace DataPlantPipingSystems {
 			BasementWallHeatTransfer( BasementWallHeatTransfer ),
 			BasementFloorHeatTransfer( BasementFloorHeatTransfer ),
 			AverageBasementFloorTemperature( AverageBasementFloorTemperature ),
-			AverageBasementWallTemperature( AverageBasementWallTemperature )
+			AverageBasementWallTemperature( AverageBasementWallTemperature ),
+			NumIterations( NumIterations ),
+			MaxIterationTempChange( MaxIterationTempChange )
 		{}
 
 	};
@@ -1280,6 +1296,47 @@ namespace DataPlantPipingSystems {
 
 	};
 
+	struct CellStencilInfo
+	{
+		// Members
+		// Conduction stencil of the field cells, stored as flat arrays in the order the cells are swept
+		int NumCells;
+		FArray1D_int CellIndex; // Linear (zero-based) index of each cell in the Cells array
+		FArray1D_int NeighborStart; // Position of each cell's first neighbor (NumCells+1 entries)
+		FArray1D_int NeighborIndex; // Linear (zero-based) index of each neighbor in the Cells array
+		FArray1D_int NeighborDirection; // Direction to each neighbor (From Enum: Direction)
+		FArray1D< Real64 > Resistance; // Conduction resistance to each neighbor
+		FArray1D_int CellStencilNum; // Stencil cell number of each cell by linear index + 1 (0 if not in the stencil)
+		FArray2D_int StencilNeighbor; // Stencil cell number of each cell's neighbor by -Direction (0 if not in the stencil)
+
+		// Default Constructor
+		CellStencilInfo() :
+			NumCells( 0 )
+		{}
+
+		// Member Constructor
+		CellStencilInfo(
+			int const NumCells,
+			FArray1_int const & CellIndex, // Linear (zero-based) index of each cell in the Cells array
+			FArray1_int const & NeighborStart, // Position of each cell's first neighbor (NumCells+1 entries)
+			FArray1_int const & NeighborIndex, // Linear (zero-based) index of each neighbor in the Cells array
+			FArray1_int const & NeighborDirection, // Direction to each neighbor (From Enum: Direction)
+			FArray1< Real64 > const & Resistance, // Conduction resistance to each neighbor
+			FArray1_int const & CellStencilNum, // Stencil cell number of each cell by linear index + 1 (0 if not in the stencil)
+			FArray2_int const & StencilNeighbor // Stencil cell number of each cell's neighbor by -Direction (0 if not in the stencil)
+		) :
+			NumCells( NumCells ),
+			CellIndex( CellIndex ),
+			NeighborStart( NeighborStart ),
+			NeighborIndex( NeighborIndex ),
+			NeighborDirection( NeighborDirection ),
+			Resistance( Resistance ),
+			CellStencilNum( CellStencilNum ),
+			StencilNeighbor( StencilNeighbor )
+		{}
+
+	};
+
 	struct FullDomainStructureInfo
 	{
 		// Members
@@ -1363,6 +1420,8 @@ namespace DataPlantPipingSystems {
 
 		// Main 3D cells array
 		FArray3D< CartesianCell > Cells;
+		// Precomputed stencil for the field cells
+		CellStencilInfo FieldStencil;
 
 		// Default Constructor
 		FullDomainStructureInfo() :
@@ -1496,7 +1555,8 @@ namespace DataPlantPipingSystems {
 			int const NumGroundSurfCells,
 			int const NumInsulationCells,
 
-			FArray3< CartesianCell > const & Cells			
+			FArray3< CartesianCell > const & Cells,
+			CellStencilInfo const & FieldStencil
 		) :
 			Name( Name ),
 			CircuitNames( CircuitNames ),
@@ -1569,7 +1629,8 @@ namespace DataPlantPipingSystems {
 			NumDomainCells( NumDomainCells ),
 			NumGroundSurfCells( NumGroundSurfCells ),
 			NumInsulationCells( NumInsulationCells ),
-			Cells( Cells )
+			Cells( Cells ),
+			FieldStencil( FieldStencil )
 		{}
 
 	};
@@ -319,6 +319,13 @@ namespace DataSurfaces {
 	// 0 otherwise
 	FArray1D_int AdjacentZoneToSurface; // Array of adjacent zones to each surface
 
+	// Surface lists of the heat balance loops (set in HeatBalanceSurfaceManager::SetHeatTransferSurfaceLists)
+	FArray1D_int HTSurfaceList; // Heat transfer surfaces, grouped by zone
+	FArray1D_int ZoneHTSurfaceFirst; // First HTSurfaceList index of each zone
+	FArray1D_int ZoneHTSurfaceLast; // Last HTSurfaceList index of each zone (ZoneHTSurfaceFirst - 1 if none)
+	FArray1D_int HTNonWindowSurfaceList; // Heat transfer surfaces of zones other than windows
+	FArray1D_int HTHistorySurfaceList; // Heat transfer surfaces other than windows using the CTF, EMPD or TDD algorithm
+
 	FArray1D< Real64 > X0; // X-component of translation vector
 	FArray1D< Real64 > Y0; // Y-component of translation vector
 	FArray1D< Real64 > Z0; // Z-component of translation vector
@@ -83,6 +83,14 @@ namespace DataSystemVariables {
 	//  each individual HVAC controller with all controller iterations
 
 	std::string const MinReportFrequencyEnvVar( "MINREPORTFREQUENCY" ); // environment var for reporting frequency.
+	std::string const cSaveTariffMeterData( "SaveTariffMeterData" ); // save the meter data used by the tariffs
+	std::string const cReplayTariffMeterData( "ReplayTariffMeterData" ); // re-evaluate the tariffs from saved meter data
+	std::string const cNumSizingWorkers( "EP_SIZING_WORKERS" ); // number of processes for the zone sizing periods
+	std::string const cDirectCSVOutput( "EP_DIRECT_CSV" ); // write the time series tables while simulating
+	std::string const cNumRunPeriodSegments( "EP_RUNPERIOD_SEGMENTS" ); // number of processes for a weather file run period without tabular reports or tariffs
+	std::string const cRunPeriodSpinUpDays( "EP_RUNPERIOD_SPINUP_DAYS" ); // days simulated ahead of each run period segment
+	std::string const cSunlitFracCacheTolerance( "EP_SUNLIT_CACHE_TOLERANCE" ); // angular tolerance of the sunlit fraction cache
+	std::string const cReportLoopGroups( "EP_REPORT_LOOP_GROUPS" ); // report the independent groups of air and plant loops
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -116,6 +124,14 @@ namespace DataSystemVariables {
 	int MinReportFrequency( -2 ); // Frequency var turned into integer during get report var input.
 	bool SortedIDD( true ); // after processing, use sorted IDD to obtain Defs, etc.
 	bool lMinimalShadowing( false ); // TRUE if MinimalShadowing is to override Solar Distribution flag
+	bool SaveTariffMeterData( false ); // TRUE if the meter data used by the tariffs is written to eplustmd.csv
+	std::string ReplayTariffMeterDataFile; // when not blank, tariffs are re-evaluated from this file without simulating
+	int NumSizingWorkers( 1 ); // number of worker processes for the zone sizing periods (1 = run them in this process)
+	bool DirectCSVOutput( false ); // TRUE if the time series tables (eplusout_<frequency>.csv) are written while simulating
+	int NumRunPeriodSegments( 1 ); // number of segments (worker processes) of a weather file run period (1 = run it in this process)
+	int RunPeriodSpinUpDays( 7 ); // days simulated ahead of a run period segment before its results are reported
+	Real64 SunlitFracCacheTolerance( 0.0 ); // sun direction tolerance {deg} for reusing sunlit fractions (0 = no cache)
+	bool ReportLoopGroups( false ); // TRUE if the independent groups of air loops and plant loops are written to the eio file
 	std::string TempFullFileName;
 	std::string envinputpath1;
 	std::string envinputpath2;
@@ -55,6 +55,14 @@ namespace DataSystemVariables {
 	//  each individual HVAC controller with all controller iterations
 
 	extern std::string const MinReportFrequencyEnvVar; // environment var for reporting frequency.
+	extern std::string const cSaveTariffMeterData; // save the meter data used by the tariffs
+	extern std::string const cReplayTariffMeterData; // re-evaluate the tariffs from saved meter data
+	extern std::string const cNumSizingWorkers; // number of processes for the zone sizing periods
+	extern std::string const cDirectCSVOutput; // write the time series tables while simulating
+	extern std::string const cNumRunPeriodSegments; // number of processes for a weather file run period without tabular reports or tariffs
+	extern std::string const cRunPeriodSpinUpDays; // days simulated ahead of each run period segment
+	extern std::string const cSunlitFracCacheTolerance; // angular tolerance of the sunlit fraction cache
+	extern std::string const cReportLoopGroups; // report the independent groups of air and plant loops
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -88,6 +96,14 @@ namespace DataSystemVariables {
 	extern int MinReportFrequency; // Frequency var turned into integer during get report var input.
 	extern bool SortedIDD; // after processing, use sorted IDD to obtain Defs, etc.
 	extern bool lMinimalShadowing; // TRUE if MinimalShadowing is to override Solar Distribution flag
+	extern bool SaveTariffMeterData; // TRUE if the meter data used by the tariffs is written to eplustmd.csv
+	extern std::string ReplayTariffMeterDataFile; // when not blank, tariffs are re-evaluated from this file without simulating
+	extern int NumSizingWorkers; // number of worker processes for the zone sizing periods (1 = run them in this process)
+	extern bool DirectCSVOutput; // TRUE if the time series tables (eplusout_<frequency>.csv) are written while simulating
+	extern int NumRunPeriodSegments; // number of segments (worker processes) of a weather file run period (1 = run it in this process)
+	extern int RunPeriodSpinUpDays; // days simulated ahead of a run period segment before its results are reported
+	extern Real64 SunlitFracCacheTolerance; // sun direction tolerance {deg} for reusing sunlit fractions (0 = no cache)
+	extern bool ReportLoopGroups; // TRUE if the independent groups of air loops and plant loops are written to the eio file
 	extern std::string TempFullFileName;
 	extern std::string envinputpath1;
 	extern std::string envinputpath2;
@@ -1,6 +1,10 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -15,6 +19,7 @@
 #include <DataGlobalConstants.hh>
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -242,6 +247,18 @@ namespace EconomicTariff {
 	int topOfStack( 0 );
 	int sizeStack( 0 );
 
+	// meter data saved for re-evaluating the tariffs without simulating the building
+	std::string const TariffMeterDataFileName( "eplustmd.csv" );
+	bool replayingMeterData( false ); // true while the tariffs are re-evaluated from saved meter data
+	int numMeterDataCol( 0 ); // number of meters (columns) in the tariff meter data
+	FArray1D_int meterDataIndx; // meter index of each column (not used when replaying)
+	FArray1D_string meterDataName; // meter name of each column
+	FArray1D_string meterDataResource; // resource type of the meter of each column
+	FArray1D_string meterDataUnits; // units of the meter of each column
+	FArray1D< Real64 > meterDataValue; // value of each column for the current timestep [J]
+	FArray1D_int tariffMeterDataCol; // column used by each tariff, zero if its meter has no data
+	std::vector< Real64 > meterDataHistory; // saved values, numMeterDataCol per saved timestep [J]
+
 	//MODULE VARIABLE DECLARATIONS:
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
@@ -255,6 +272,7 @@ namespace EconomicTariff {
 	FArray1D< RatchetType > ratchet;
 	FArray1D< ComputationType > computation;
 	FArray1D< StackType > stack;
+	std::vector< MeterDataStampType > meterDataStamp; // time of each saved timestep
 
 	//======================================================================================================================
 	//======================================================================================================================
@@ -275,8 +293,8 @@ namespace EconomicTariff {
 		//    RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		//    Single routine used to call all get input
-		//    routines for economics.
+		//    Get the economics input and gather the meter data
+		//    used by the tariffs each timestep.
 
 		// METHODOLOGY EMPLOYED:
 
@@ -289,6 +307,51 @@ namespace EconomicTariff {
 		using DataGlobals::DoOutputReporting;
 		using DataGlobals::KindOfSim;
 		using DataGlobals::ksRunPeriodWeather;
+
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		GetInputEconomics();
+		if ( DoOutputReporting && ( KindOfSim == ksRunPeriodWeather ) ) {
+			GatherForEconomics();
+		}
+	}
+
+	void
+	GetInputEconomics()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         Jason Glazer of GARD Analytics, Inc.
+		//    DATE WRITTEN   September 2003
+		//    MODIFIED       Split from UpdateUtilityBills so the tariffs can be read
+		//                   without a simulated timestep (ReplayTariffMeterData)
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//    Single routine used to call all get input
+		//    routines for economics.
+
+		// METHODOLOGY EMPLOYED:
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+
+		// Using/Aliasing
 		using OutputReportTabular::AddTOCEntry;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -327,9 +390,6 @@ namespace EconomicTariff {
 			GetInput = false;
 			if ( ErrorsFound ) ShowFatalError( "UpdateUtilityBills: Preceding errors cause termination." );
 		}
-		if ( DoOutputReporting && ( KindOfSim == ksRunPeriodWeather ) ) {
-			GatherForEconomics();
-		}
 	}
 
 	//======================================================================================================================
@@ -2994,6 +3054,12 @@ namespace EconomicTariff {
 		//   calculation.
 
 		// METHODOLOGY EMPLOYED:
+		//   The value of each meter used by a tariff is read through its
+		//   meter data column. If SaveTariffMeterData is set the values are
+		//   also kept with the time of the timestep so that
+		//   WriteTariffMeterData can write them at the end of the run.
+		//   When replaying saved meter data the meter values are set by
+		//   ReplayTariffMeterData instead.
 
 		// REFERENCES:
 		// na
@@ -3007,6 +3073,11 @@ namespace EconomicTariff {
 		using DataGlobals::TimeStepZone;
 		using ScheduleManager::GetCurrentScheduleValue;
 		using DataEnvironment::Month;
+		using DataEnvironment::DayOfYear_Schedule;
+		using DataEnvironment::DayOfWeek;
+		using DataEnvironment::HolidayIndex;
+		using DataEnvironment::DSTIndicator;
+		using DataSystemVariables::SaveTariffMeterData;
 
 		// Locals
 
@@ -3036,13 +3107,24 @@ namespace EconomicTariff {
 		Real64 curRTPbaseline; // real time price customer baseline load
 		Real64 curRTPenergy; // energy applied to real time price
 		Real64 curRTPcost; // cost for energy for current time
+		int iCol;
 
 		if ( numTariff >= 1 ) {
+			if ( ! replayingMeterData ) {
+				if ( ! tariffMeterDataCol.allocated() ) SetupTariffMeterData();
+				for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+					meterDataValue( iCol ) = GetCurrentMeterValue( meterDataIndx( iCol ) );
+					if ( SaveTariffMeterData ) meterDataHistory.push_back( meterDataValue( iCol ) );
+				}
+				if ( SaveTariffMeterData ) {
+					meterDataStamp.push_back( MeterDataStampType( Month, DayOfYear_Schedule, DayOfWeek, HolidayIndex, DSTIndicator, HourOfDay, TimeStep ) );
+				}
+			}
 			for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
 				isGood = false;
 				//if the meter is defined get the value
-				if ( tariff( iTariff ).reportMeterIndx != 0 ) {
-					curInstantValue = GetCurrentMeterValue( tariff( iTariff ).reportMeterIndx );
+				if ( tariffMeterDataCol( iTariff ) != 0 ) {
+					curInstantValue = meterDataValue( tariffMeterDataCol( iTariff ) );
 				} else {
 					curInstantValue = 0.0;
 				}
@@ -3122,6 +3204,469 @@ namespace EconomicTariff {
 		}
 	}
 
+	void
+	SetupTariffMeterData()
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Make the list of meters whose values are saved for
+		//   re-evaluating the tariffs.
+
+		// METHODOLOGY EMPLOYED:
+		//   Each meter used by at least one tariff gets one column,
+		//   tariffs that share a meter share the column.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+
+		// Using/Aliasing
+		using OutputProcessor::EnergyMeters;
+
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iTariff;
+		int iCol;
+		int found;
+
+		tariffMeterDataCol.dimension( numTariff, 0 );
+		meterDataIndx.dimension( numTariff, 0 );
+		meterDataName.dimension( numTariff );
+		meterDataResource.dimension( numTariff );
+		meterDataUnits.dimension( numTariff );
+		numMeterDataCol = 0;
+		for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
+			if ( tariff( iTariff ).reportMeterIndx == 0 ) continue;
+			found = 0;
+			for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+				if ( meterDataIndx( iCol ) == tariff( iTariff ).reportMeterIndx ) {
+					found = iCol;
+					break;
+				}
+			}
+			if ( found == 0 ) {
+				++numMeterDataCol;
+				meterDataIndx( numMeterDataCol ) = tariff( iTariff ).reportMeterIndx;
+				meterDataName( numMeterDataCol ) = EnergyMeters( tariff( iTariff ).reportMeterIndx ).Name;
+				meterDataResource( numMeterDataCol ) = EnergyMeters( tariff( iTariff ).reportMeterIndx ).ResourceType;
+				meterDataUnits( numMeterDataCol ) = EnergyMeters( tariff( iTariff ).reportMeterIndx ).Units;
+				found = numMeterDataCol;
+			}
+			tariffMeterDataCol( iTariff ) = found;
+		}
+		meterDataValue.dimension( numMeterDataCol, 0.0 );
+	}
+
+	void
+	WriteTariffMeterData()
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Write the meter values gathered for the tariffs to
+		//   TariffMeterDataFileName at the end of the run, if asked
+		//   for with the SaveTariffMeterData environment variable.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+
+		// Using/Aliasing
+		using DataSystemVariables::SaveTariffMeterData;
+
+		if ( ! SaveTariffMeterData || replayingMeterData || numMeterDataCol == 0 || meterDataStamp.empty() ) return;
+		WriteTariffMeterDataFile( TariffMeterDataFileName );
+	}
+
+	void
+	WriteTariffMeterDataFile( std::string const & FileName ) // tariff meter data file to write
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Write the meter values gathered for the tariffs so that
+		//   the tariffs and life-cycle costs can be re-evaluated
+		//   later without simulating the building again.
+
+		// METHODOLOGY EMPLOYED:
+		//   Comma separated file with a header line (timesteps per hour and
+		//   number of meters), lines with the quoted meter names, resource
+		//   types and units, and one line per gathered timestep: month, day
+		//   of year, day of week, holiday, daylight saving indicator, hour,
+		//   timestep and the meter values. Values are written with enough
+		//   digits to be read back exactly. See ReadTariffMeterDataFile.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+
+		// Using/Aliasing
+		using DataGlobals::NumOfTimeStepInHour;
+
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iCol;
+		std::vector< Real64 >::size_type iValue;
+
+		std::ofstream mtd_stream( FileName, std::ios_base::out | std::ios_base::trunc );
+		if ( ! mtd_stream ) {
+			ShowWarningError( "WriteTariffMeterData: Could not open file \"" + FileName + "\" for output (write)." );
+			return;
+		}
+		mtd_stream << "Tariff Meter Data," << NumOfTimeStepInHour << ',' << numMeterDataCol << '\n';
+		mtd_stream << "Meters";
+		for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+			mtd_stream << ',' << quotedCSVField( meterDataName( iCol ) );
+		}
+		mtd_stream << "\nResources";
+		for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+			mtd_stream << ',' << quotedCSVField( meterDataResource( iCol ) );
+		}
+		mtd_stream << "\nUnits";
+		for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+			mtd_stream << ',' << quotedCSVField( meterDataUnits( iCol ) );
+		}
+		mtd_stream << '\n' << std::setprecision( 17 );
+		iValue = 0;
+		for ( auto const & stamp : meterDataStamp ) {
+			mtd_stream << stamp.month << ',' << stamp.dayOfYear << ',' << stamp.dayOfWeek << ',' << stamp.holiday << ',' << stamp.dst << ',' << stamp.hour << ',' << stamp.timeStep;
+			for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+				mtd_stream << ',' << meterDataHistory[ iValue ];
+				++iValue;
+			}
+			mtd_stream << '\n';
+		}
+	}
+
+	void
+	ReadTariffMeterDataFile(
+		std::string const & FileName, // saved tariff meter data file
+		int & savedTimeStepsInHour // timesteps per hour of the saved run
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Read a file written by WriteTariffMeterDataFile back into
+		//   the meter data columns, meterDataStamp and meterDataHistory.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+
+		// Using/Aliasing
+		using General::TrimSigDigits;
+
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "ReadTariffMeterDataFile: " );
+		int const numStampFields( 7 ); // time fields at the start of each record
+		static std::string const listTitle[ 3 ] = { "Meters", "Resources", "Units" }; // titles of the meter lists
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string line;
+		std::vector< std::string > fields;
+		FArray1D_int stampField( numStampFields );
+		int iList;
+		int iCol;
+		int iField;
+		int numRecords;
+		char * fieldEnd;
+
+		std::ifstream mtd_stream( FileName, std::ios_base::in );
+		if ( ! mtd_stream ) {
+			ShowFatalError( RoutineName + "Could not open file \"" + FileName + "\" for input (read)." );
+		}
+
+		// header: title, timesteps per hour and number of meters
+		std::getline( mtd_stream, line );
+		splitCSVLine( line, fields );
+		if ( fields.size() != 3u || fields[ 0 ] != "Tariff Meter Data" ) {
+			ShowFatalError( RoutineName + "File \"" + FileName + "\" is not a tariff meter data file." );
+		}
+		savedTimeStepsInHour = int( std::strtol( fields[ 1 ].c_str(), nullptr, 10 ) );
+		numMeterDataCol = int( std::strtol( fields[ 2 ].c_str(), nullptr, 10 ) );
+		if ( savedTimeStepsInHour <= 0 || numMeterDataCol < 0 ) {
+			ShowFatalError( RoutineName + "File \"" + FileName + "\" is not a tariff meter data file." );
+		}
+
+		// meter names, resource types and units
+		meterDataName.dimension( numMeterDataCol );
+		meterDataResource.dimension( numMeterDataCol );
+		meterDataUnits.dimension( numMeterDataCol );
+		for ( iList = 0; iList < 3; ++iList ) {
+			FArray1D_string & list( iList == 0 ? meterDataName : ( iList == 1 ? meterDataResource : meterDataUnits ) );
+			std::getline( mtd_stream, line );
+			splitCSVLine( line, fields );
+			if ( int( fields.size() ) != numMeterDataCol + 1 || fields[ 0 ] != listTitle[ iList ] ) {
+				ShowFatalError( RoutineName + "File \"" + FileName + "\" has an invalid list of " + listTitle[ iList ] + '.' );
+			}
+			for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+				list( iCol ) = fields[ iCol ];
+			}
+		}
+		meterDataValue.dimension( numMeterDataCol, 0.0 );
+
+		// one record per saved timestep
+		meterDataStamp.clear();
+		meterDataHistory.clear();
+		numRecords = 0;
+		while ( std::getline( mtd_stream, line ) ) {
+			if ( line.empty() ) continue;
+			++numRecords;
+			splitCSVLine( line, fields );
+			if ( int( fields.size() ) != numStampFields + numMeterDataCol ) {
+				ShowFatalError( RoutineName + "Invalid record " + TrimSigDigits( numRecords ) + " in file \"" + FileName + "\"." );
+			}
+			for ( iField = 1; iField <= numStampFields; ++iField ) {
+				stampField( iField ) = int( std::strtol( fields[ iField - 1 ].c_str(), &fieldEnd, 10 ) );
+				if ( fieldEnd == fields[ iField - 1 ].c_str() ) {
+					ShowFatalError( RoutineName + "Invalid record " + TrimSigDigits( numRecords ) + " in file \"" + FileName + "\"." );
+				}
+			}
+			meterDataStamp.push_back( MeterDataStampType( stampField( 1 ), stampField( 2 ), stampField( 3 ), stampField( 4 ), stampField( 5 ), stampField( 6 ), stampField( 7 ) ) );
+			for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+				std::string const & field( fields[ numStampFields + iCol - 1 ] );
+				meterDataHistory.push_back( std::strtod( field.c_str(), &fieldEnd ) );
+				if ( fieldEnd == field.c_str() ) {
+					ShowFatalError( RoutineName + "Invalid record " + TrimSigDigits( numRecords ) + " in file \"" + FileName + "\"." );
+				}
+			}
+		}
+	}
+
+	void
+	ReplayTariffMeterData( std::string const & FileName ) // saved tariff meter data file
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Gather the tariff data from meter values saved by an
+		//   earlier run (WriteTariffMeterData) instead of from the
+		//   simulation, so that new tariffs can be evaluated without
+		//   simulating the building.
+
+		// METHODOLOGY EMPLOYED:
+		//   The building and HVAC are not set up, so the saved meters are
+		//   added to the output processor before the tariffs are read,
+		//   with their saved resource types and units. Each tariff is
+		//   matched to the saved column of its meter by name. For each
+		//   saved timestep the time is restored, the schedules are updated
+		//   for that time and GatherForEconomics is called as it would be
+		//   during the simulation. ComputeTariff and the life-cycle cost
+		//   calculation then run as usual.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+
+		// Using/Aliasing
+		using DataGlobals::HourOfDay;
+		using DataGlobals::TimeStep;
+		using DataGlobals::NumOfTimeStepInHour;
+		using DataEnvironment::Month;
+		using DataEnvironment::DayOfYear_Schedule;
+		using DataEnvironment::DayOfWeek;
+		using DataEnvironment::HolidayIndex;
+		using DataEnvironment::DSTIndicator;
+		using OutputProcessor::AddMeter;
+		using OutputProcessor::EnergyMeters;
+		using OutputProcessor::InitializeOutput;
+		using OutputProcessor::OutputInitialized;
+		using ScheduleManager::UpdateScheduleValues;
+		using General::TrimSigDigits;
+
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "ReplayTariffMeterData: " );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int savedTimeStepsInHour;
+		int iTariff;
+		int iCol;
+		std::vector< Real64 >::size_type iValue;
+
+		ReadTariffMeterDataFile( FileName, savedTimeStepsInHour );
+		if ( savedTimeStepsInHour != NumOfTimeStepInHour ) {
+			ShowSevereError( RoutineName + "File \"" + FileName + "\" was saved with " + TrimSigDigits( savedTimeStepsInHour ) + " timesteps per hour." );
+			ShowContinueError( "...The input file uses " + TrimSigDigits( NumOfTimeStepInHour ) + " timesteps per hour, the Timestep object must match the saved run." );
+			ShowFatalError( "Preceding errors cause termination." );
+		}
+		if ( ! OutputInitialized ) InitializeOutput();
+		for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+			if ( GetMeterIndex( meterDataName( iCol ) ) == 0 ) AddMeter( meterDataName( iCol ), meterDataUnits( iCol ), meterDataResource( iCol ), "", "", "" );
+		}
+
+		GetInputEconomics();
+		if ( numTariff == 0 ) {
+			ShowWarningError( RoutineName + "No UtilityCost:Tariff objects in the input, the saved meter data is not used." );
+			return;
+		}
+
+		// associate each tariff with the saved values of its meter
+		tariffMeterDataCol.dimension( numTariff, 0 );
+		for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
+			if ( tariff( iTariff ).reportMeterIndx == 0 ) continue;
+			tariffMeterDataCol( iTariff ) = FindItem( EnergyMeters( tariff( iTariff ).reportMeterIndx ).Name, meterDataName, numMeterDataCol );
+		}
+
+		// gather each saved timestep
+		replayingMeterData = true;
+		iValue = 0;
+		for ( auto const & stamp : meterDataStamp ) {
+			Month = stamp.month;
+			DayOfYear_Schedule = stamp.dayOfYear;
+			DayOfWeek = stamp.dayOfWeek;
+			HolidayIndex = stamp.holiday;
+			DSTIndicator = stamp.dst;
+			HourOfDay = stamp.hour;
+			TimeStep = stamp.timeStep;
+			for ( iCol = 1; iCol <= numMeterDataCol; ++iCol ) {
+				meterDataValue( iCol ) = meterDataHistory[ iValue ];
+				++iValue;
+			}
+			UpdateScheduleValues();
+			GatherForEconomics();
+		}
+		ShowMessage( RoutineName + "Gathered " + TrimSigDigits( int( meterDataStamp.size() ) ) + " timesteps of saved meter data from \"" + FileName + "\"." );
+	}
+
+	std::string
+	quotedCSVField( std::string const & field ) // field to quote
+	{
+		// FUNCTION INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		//   Quote a field of the tariff meter data file so that meter
+		//   names may contain commas; quotes are doubled.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string quoted( 1, '"' );
+
+		for ( char const c : field ) {
+			if ( c == '"' ) quoted += '"';
+			quoted += c;
+		}
+		quoted += '"';
+		return quoted;
+	}
+
+	void
+	splitCSVLine(
+		std::string const & line, // comma separated line
+		std::vector< std::string > & fields // fields of the line, without quotes
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Split a line of the tariff meter data file into its fields,
+		//   removing the quotes written by quotedCSVField.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string::size_type pos( 0 );
+		bool inQuotes( false );
+
+		fields.assign( 1, std::string() );
+		for ( pos = 0; pos < line.size(); ++pos ) {
+			char const c( line[ pos ] );
+			if ( inQuotes ) {
+				if ( c != '"' ) {
+					fields.back() += c;
+				} else if ( pos + 1 < line.size() && line[ pos + 1 ] == '"' ) {
+					fields.back() += c;
+					++pos;
+				} else {
+					inQuotes = false;
+				}
+			} else if ( c == '"' ) {
+				inQuotes = true;
+			} else if ( c == ',' ) {
+				fields.push_back( std::string() );
+			} else if ( c != '\r' ) {
+				fields.back() += c;
+			}
+		}
+	}
+
 	bool
 	isWithinRange(
 		int const testVal,
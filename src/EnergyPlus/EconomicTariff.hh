@@ -1,6 +1,9 @@
 #ifndef EconomicTariff_hh_INCLUDED
 #define EconomicTariff_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray2D.hh>
@@ -210,6 +213,18 @@ namespace EconomicTariff {
 	extern int topOfStack;
 	extern int sizeStack;
 
+	// meter data saved for re-evaluating the tariffs without simulating the building
+	extern std::string const TariffMeterDataFileName;
+	extern bool replayingMeterData; // true while the tariffs are re-evaluated from saved meter data
+	extern int numMeterDataCol; // number of meters (columns) in the tariff meter data
+	extern FArray1D_int meterDataIndx; // meter index of each column (not used when replaying)
+	extern FArray1D_string meterDataName; // meter name of each column
+	extern FArray1D_string meterDataResource; // resource type of the meter of each column
+	extern FArray1D_string meterDataUnits; // units of the meter of each column
+	extern FArray1D< Real64 > meterDataValue; // value of each column for the current timestep [J]
+	extern FArray1D_int tariffMeterDataCol; // column used by each tariff, zero if its meter has no data
+	extern std::vector< Real64 > meterDataHistory; // saved values, numMeterDataCol per saved timestep [J]
+
 	//MODULE VARIABLE DECLARATIONS:
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
@@ -956,6 +971,49 @@ namespace EconomicTariff {
 
 	};
 
+	struct MeterDataStampType
+	{
+		// Members
+		int month; // month
+		int dayOfYear; // day of year used for the schedules (DayOfYear_Schedule)
+		int dayOfWeek; // day of week
+		int holiday; // holiday index
+		int dst; // daylight saving time indicator
+		int hour; // hour of day
+		int timeStep; // zone timestep in the hour
+
+		// Default Constructor
+		MeterDataStampType() :
+			month( 0 ),
+			dayOfYear( 0 ),
+			dayOfWeek( 0 ),
+			holiday( 0 ),
+			dst( 0 ),
+			hour( 0 ),
+			timeStep( 0 )
+		{}
+
+		// Member Constructor
+		MeterDataStampType(
+			int const month, // month
+			int const dayOfYear, // day of year used for the schedules (DayOfYear_Schedule)
+			int const dayOfWeek, // day of week
+			int const holiday, // holiday index
+			int const dst, // daylight saving time indicator
+			int const hour, // hour of day
+			int const timeStep // zone timestep in the hour
+		) :
+			month( month ),
+			dayOfYear( dayOfYear ),
+			dayOfWeek( dayOfWeek ),
+			holiday( holiday ),
+			dst( dst ),
+			hour( hour ),
+			timeStep( timeStep )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< EconVarType > econVar;
 	extern FArray1D< TariffType > tariff;
@@ -965,12 +1023,16 @@ namespace EconomicTariff {
 	extern FArray1D< RatchetType > ratchet;
 	extern FArray1D< ComputationType > computation;
 	extern FArray1D< StackType > stack;
+	extern std::vector< MeterDataStampType > meterDataStamp; // time of each saved timestep
 
 	// Functions
 
 	void
 	UpdateUtilityBills();
 
+	void
+	GetInputEconomics();
+
 	//======================================================================================================================
 	//======================================================================================================================
 
@@ -1101,6 +1163,33 @@ namespace EconomicTariff {
 	void
 	GatherForEconomics();
 
+	void
+	SetupTariffMeterData();
+
+	void
+	WriteTariffMeterData();
+
+	void
+	WriteTariffMeterDataFile( std::string const & FileName ); // tariff meter data file to write
+
+	void
+	ReadTariffMeterDataFile(
+		std::string const & FileName, // saved tariff meter data file
+		int & savedTimeStepsInHour // timesteps per hour of the saved run
+	);
+
+	void
+	ReplayTariffMeterData( std::string const & FileName ); // saved tariff meter data file
+
+	std::string
+	quotedCSVField( std::string const & field ); // field to quote
+
+	void
+	splitCSVLine(
+		std::string const & line, // comma separated line
+		std::vector< std::string > & fields // fields of the line, without quotes
+	);
+
 	bool
 	isWithinRange(
 		int const testVal,
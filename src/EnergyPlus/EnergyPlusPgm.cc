@@ -3,6 +3,8 @@
 #endif
 
 // C++ Headers
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #ifndef NDEBUG
 #ifdef __unix__
@@ -346,6 +348,33 @@ EnergyPlusPgm( std::string filepath )
 	get_environment_variable( TraceHVACControllerEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TraceHVACControllerEnvFlag = env_var_on( cEnvValue ); // Yes or True
 
+	// Meter data of the tariffs saved to eplustmd.csv, or read from such a file to re-evaluate the tariffs without simulating
+	get_environment_variable( cSaveTariffMeterData, cEnvValue );
+	if ( ! cEnvValue.empty() ) SaveTariffMeterData = env_var_on( cEnvValue ); // Yes or True
+	get_environment_variable( cReplayTariffMeterData, ReplayTariffMeterDataFile );
+
+	// Number of worker processes that simulate the zone sizing periods side by side
+	get_environment_variable( cNumSizingWorkers, cEnvValue );
+	if ( ! cEnvValue.empty() ) NumSizingWorkers = std::max( 1, int( std::strtol( cEnvValue.c_str(), nullptr, 10 ) ) );
+
+	// Time series tables written directly by the output processor instead of converting the eso afterwards
+	get_environment_variable( cDirectCSVOutput, cEnvValue );
+	if ( ! cEnvValue.empty() ) DirectCSVOutput = env_var_on( cEnvValue ); // Yes or True
+
+	// Number of segments of a weather file run period simulated side by side, and their spin-up days
+	get_environment_variable( cNumRunPeriodSegments, cEnvValue );
+	if ( ! cEnvValue.empty() ) NumRunPeriodSegments = std::max( 1, int( std::strtol( cEnvValue.c_str(), nullptr, 10 ) ) );
+	get_environment_variable( cRunPeriodSpinUpDays, cEnvValue );
+	if ( ! cEnvValue.empty() ) RunPeriodSpinUpDays = std::max( 0, int( std::strtol( cEnvValue.c_str(), nullptr, 10 ) ) );
+
+	// Sun direction tolerance {deg} for reusing the sunlit fractions of an earlier time step
+	get_environment_variable( cSunlitFracCacheTolerance, cEnvValue );
+	if ( ! cEnvValue.empty() ) SunlitFracCacheTolerance = std::max( 0.0, std::strtod( cEnvValue.c_str(), nullptr ) );
+
+	// Independent groups of air loops and plant loops written to the eio file
+	get_environment_variable( cReportLoopGroups, cEnvValue );
+	if ( ! cEnvValue.empty() ) ReportLoopGroups = env_var_on( cEnvValue ); // Yes or True
+
 	{ IOFlags flags; gio::inquire( "eplusout.end", flags ); FileExists = flags.exists(); }
 	if ( FileExists ) {
 		LFN = GetNewUnitNumber();
@@ -430,9 +459,12 @@ EnergyPlusPgm( std::string filepath )
 
 	ShowPsychrometricSummary();
 
-	ReportOrphanRecordObjects();
-	ReportOrphanFluids();
-	ReportOrphanSchedules();
+	// Objects are not used when the tariffs are re-evaluated from saved meter data
+	if ( ReplayTariffMeterDataFile.empty() ) {
+		ReportOrphanRecordObjects();
+		ReportOrphanFluids();
+		ReportOrphanSchedules();
+	}
 
 	EndEnergyPlus();
 }
@@ -16,6 +16,7 @@ extern "C" {
 
 // EnergyPlus Headers
 #include <ExternalInterface.hh>
+#include <ExternalInterfaceSharedMemory.hh>
 #include <DataEnvironment.hh>
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
@@ -95,6 +96,7 @@ namespace ExternalInterface {
 	FArray1D_int varTypes; // Types of variables in keyVarIndexes
 	FArray1D_int varInd; // Index of ErlVariables for ExternalInterface
 	int socketFD( -1 ); // socket file descriptor
+	bool useSharedMemoryIPC( false ); // True if socket.cfg selects the shared memory transport
 	bool ErrorsFound( false ); // Set to true if errors are found
 	bool noMoreValues( false ); // Flag, true if no more values
 	// will be sent by the server
@@ -113,6 +115,7 @@ namespace ExternalInterface {
 	FArray1D< FMUType > FMU; // Variable Types structure
 	FArray1D< FMUType > FMUTemp; // Variable Types structure
 	FArray1D< checkFMUInstanceNameType > checkInstanceName; // Variable Types structure for checking instance names
+	ExternalInterfaceSharedMemory::SharedMemoryIPCType sharedMemoryIPC; // Shared memory channel to the BCVTB
 
 	// Functions
 
@@ -323,7 +326,14 @@ namespace ExternalInterface {
 		if ( ( NumExternalInterfacesBCVTB != 0 ) || ( NumExternalInterfacesFMUExport != 0 ) ) {
 			if ( ErrorsFound ) {
 				// Check if the socket is open
-				if ( socketFD >= 0 ) {
+				if ( useSharedMemoryIPC ) {
+					// Shared memory channel is open, post the flag without waiting for an answer
+					if ( simulationStatus == 1 ) {
+						retVal = ExternalInterfaceSharedMemory::PostSharedMemoryRequest( sharedMemoryIPC, flag1, 0, 0.0, nullptr );
+					} else {
+						retVal = ExternalInterfaceSharedMemory::PostSharedMemoryRequest( sharedMemoryIPC, flag2, 0, 0.0, nullptr );
+					}
+				} else if ( socketFD >= 0 ) {
 					// Socket is open
 					if ( simulationStatus == 1 ) {
 						retVal = sendclientmessage( &socketFD, &flag1 );
@@ -367,6 +377,13 @@ namespace ExternalInterface {
 
 		{ IOFlags flags; gio::inquire( socCfgFilNam, flags ); fileExist = flags.exists(); }
 
+		if ( useSharedMemoryIPC ) {
+			retVal = ExternalInterfaceSharedMemory::PostSharedMemoryRequest( sharedMemoryIPC, FlagToWriteToSocket, 0, 0.0, nullptr );
+			ExternalInterfaceSharedMemory::CloseSharedMemoryChannel( sharedMemoryIPC );
+			useSharedMemoryIPC = false;
+			return;
+		}
+
 		if ( ( socketFD == -1 ) && fileExist ) {
 			socketFD = establishclientsocket( socCfgFilNam.c_str() );
 		}
@@ -381,6 +398,58 @@ namespace ExternalInterface {
 
 	}
 
+	void
+	OpenSharedMemoryIPC()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the shared memory channel if the socket configuration file asks for it.
+
+		// METHODOLOGY EMPLOYED:
+		// If the BCVTB runs on the same machine, socket.cfg may contain the element
+		//   <ipc><sharedmemory name="..."/></ipc>
+		// with the name of a shared memory segment created by the BCVTB. The values of each
+		// time step are then exchanged through this segment instead of the socket.
+		// Without this element the socket is used as before.
+
+		// Using/Aliasing
+		using namespace ExternalInterfaceSharedMemory;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const lenName( 256 ); // Length of the buffer for the segment name
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		char name[ lenName ]; // Name of the shared memory segment
+		int nVal( 0 ); // Number of values found in socket.cfg
+		int retVal; // Return value of the function calls
+
+		useSharedMemoryIPC = false;
+		if ( getnumberofxmlvalues( socCfgFilNam.c_str(), "//ipc/sharedmemory[@name]" ) <= 0 ) return;
+
+		retVal = getxmlvalue( socCfgFilNam.c_str(), "//ipc/sharedmemory[@name]", name, &nVal, lenName );
+		if ( retVal != 0 || nVal != 1 ) {
+			ShowSevereError( "ExternalInterface: Could not read the shared memory name from file \"" + socCfgFilNam + "\"." );
+			ErrorsFound = true;
+			return;
+		}
+
+		retVal = OpenSharedMemoryChannel( name, sharedMemoryIPC );
+		if ( retVal == shmVersionMismatch ) {
+			ShowSevereError( "ExternalInterface: Shared memory \"" + std::string( name ) + "\" uses another version of the data exchange." );
+			ErrorsFound = true;
+		} else if ( retVal != shmOK ) {
+			ShowSevereError( "ExternalInterface: Could not open shared memory \"" + std::string( name ) + "\"." );
+			ErrorsFound = true;
+		} else {
+			useSharedMemoryIPC = true;
+		}
+	}
+
 	void
 	ParseString(
 		std::string const & str, // The string, with all elements separated by ';'
@@ -484,10 +553,14 @@ namespace ExternalInterface {
 			// Get port number
 			{ IOFlags flags; gio::inquire( socCfgFilNam, flags ); socFileExist = flags.exists(); }
 			if ( socFileExist ) {
-				socketFD = establishclientsocket( socCfgFilNam.c_str() );
-				if ( socketFD < 0 ) {
-					ShowSevereError( "ExternalInterface: Could not open socket. File descriptor = " + TrimSigDigits( socketFD ) + '.' );
-					ErrorsFound = true;
+				// The BCVTB may offer a shared memory channel if it runs on the same machine
+				if ( haveExternalInterfaceBCVTB ) OpenSharedMemoryIPC();
+				if ( ! useSharedMemoryIPC ) {
+					socketFD = establishclientsocket( socCfgFilNam.c_str() );
+					if ( socketFD < 0 ) {
+						ShowSevereError( "ExternalInterface: Could not open socket. File descriptor = " + TrimSigDigits( socketFD ) + '.' );
+						ErrorsFound = true;
+					}
 				}
 			} else {
 				ShowSevereError( "ExternalInterface: Did not find file \"" + socCfgFilNam + "\"." );
@@ -684,53 +757,33 @@ namespace ExternalInterface {
 						FMU( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue;
 					}
 				} else {
-					// Get from FMUs, values that will be set in EnergyPlus (Schedule)
-
-					if ( size( FMU(i).Instance(j).fmuOutputVariableSchedule ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec;
-						std::vector<Real64> realVarValueVec;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							valueReferenceVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference );
-							realVarValueVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue );
+					// Get from FMUs, values that will be set in EnergyPlus (Schedule, Variable and Actuator).
+					// All outputs of an instance are read with one call, the value references are
+					// gathered once and kept with the instance.
+					int const nSch( FMU( i ).Instance( j ).NumOutputVariablesSchedule );
+					int const nVar( FMU( i ).Instance( j ).NumOutputVariablesVariable );
+					int const nAct( FMU( i ).Instance( j ).NumOutputVariablesActuator );
+					int nOut( nSch + nVar + nAct );
+					std::vector< unsigned int > & outputValueReferences( FMU( i ).Instance( j ).outputValueReferences );
+					std::vector< Real64 > & outputValues( FMU( i ).Instance( j ).outputValues );
+					if ( int( outputValueReferences.size() ) != nOut ) {
+						outputValueReferences.clear();
+						outputValueReferences.reserve( nOut );
+						for ( k = 1; k <= nSch; ++k ) {
+							outputValueReferences.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( k ).ValueReference );
 						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec[0], &realVarValueVec[0], &FMU( i ).Instance( j ).NumOutputVariablesSchedule, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference = valueReferenceVec[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue = realVarValueVec[x-1];
+						for ( k = 1; k <= nVar; ++k ) {
+							outputValueReferences.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( k ).ValueReference );
 						}
-
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
-							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
+						for ( k = 1; k <= nAct; ++k ) {
+							outputValueReferences.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( k ).ValueReference );
 						}
-
+						outputValues.assign( nOut, 0.0 );
 					}
 
-					// generate vectors here first
-					if ( size(FMU(i).Instance(j).fmuOutputVariableVariable) > 0 ) {
-
-						std::vector<unsigned int> valueReferenceVec2;
-						std::vector<Real64> realVarValueVec2;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							valueReferenceVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference );
-							realVarValueVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue );
-						}
-
+					if ( nOut > 0 ) {
 						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec2[0], &realVarValueVec2[0], &FMU( i ).Instance( j ).NumOutputVariablesVariable, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference = valueReferenceVec2[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue = realVarValueVec2[x-1];
-						}
+						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal( &FMU( i ).Instance( j ).fmicomponent, &outputValueReferences[ 0 ], &outputValues[ 0 ], &nOut, &FMU( i ).Instance( j ).Index );
 
 						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
 							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
@@ -740,32 +793,14 @@ namespace ExternalInterface {
 							StopExternalInterfaceIfError();
 						}
 
-					}
-
-					if ( size( FMU( i ).Instance( j ).fmuOutputVariableActuator ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec3;
-						std::vector<Real64> realVarValueVec3;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							valueReferenceVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference );
-							realVarValueVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue );
+						for ( k = 1; k <= nSch; ++k ) {
+							FMU( i ).Instance( j ).fmuOutputVariableSchedule( k ).RealVarValue = outputValues[ k - 1 ];
 						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec3[0], &realVarValueVec3[0], &FMU( i ).Instance( j ).NumOutputVariablesActuator, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference = valueReferenceVec3[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue = realVarValueVec3[x-1];
+						for ( k = 1; k <= nVar; ++k ) {
+							FMU( i ).Instance( j ).fmuOutputVariableVariable( k ).RealVarValue = outputValues[ nSch + k - 1 ];
 						}
-
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
-							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
+						for ( k = 1; k <= nAct; ++k ) {
+							FMU( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue = outputValues[ nSch + nVar + k - 1 ];
 						}
 					}
 				}
@@ -801,18 +836,23 @@ namespace ExternalInterface {
 
 				if ( ! FlagReIni ) {
 
-					// generate vectors here first
-					std::vector<unsigned int> valueReferenceVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuInputVariable ); ++x ) {
-						valueReferenceVec4.push_back( FMU( i ).Instance( j ).fmuInputVariable( x ).ValueReference );
+					// Reuse the input buffers of the instance, the value references do not change
+					int const nInp( FMU( i ).Instance( j ).NumInputVariablesInIDF );
+					std::vector< unsigned int > & inputValueReferences( FMU( i ).Instance( j ).inputValueReferences );
+					std::vector< Real64 > & inputValues( FMU( i ).Instance( j ).inputValues );
+					if ( int( inputValueReferences.size() ) != nInp ) {
+						inputValueReferences.clear();
+						inputValueReferences.reserve( nInp );
+						for ( k = 1; k <= nInp; ++k ) {
+							inputValueReferences.push_back( FMU( i ).Instance( j ).fmuInputVariable( k ).ValueReference );
+						}
+						inputValues.assign( nInp, 0.0 );
 					}
-
-					std::vector<Real64> rtsValueVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).eplusOutputVariable ); ++x ) {
-						rtsValueVec4.push_back( FMU( i ).Instance( j ).eplusOutputVariable( x ).RTSValue );
+					for ( k = 1; k <= nInp; ++k ) {
+						inputValues[ k - 1 ] = FMU( i ).Instance( j ).eplusOutputVariable( k ).RTSValue;
 					}
 
-					FMU( i ).Instance( j ).fmistatus = fmiEPlusSetReal( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec4[0], &rtsValueVec4[0], &FMU( i ).Instance( j ).NumInputVariablesInIDF, &FMU( i ).Instance( j ).Index );
+					FMU( i ).Instance( j ).fmistatus = fmiEPlusSetReal( &FMU( i ).Instance( j ).fmicomponent, inputValueReferences.data(), inputValues.data(), &FMU( i ).Instance( j ).NumInputVariablesInIDF, &FMU( i ).Instance( j ).Index );
 
 					if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
 						ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to set inputs" );
@@ -2082,7 +2122,9 @@ namespace ExternalInterface {
 			// Exchange data with socket
 			retVal = 0;
 			flaRea = 0;
-			if ( haveExternalInterfaceBCVTB ) {
+			if ( haveExternalInterfaceBCVTB && useSharedMemoryIPC ) {
+				retVal = ExternalInterfaceSharedMemory::ExchangeDoublesWithSharedMemory( sharedMemoryIPC, flaWri, flaRea, nDblWri, nDblRea, preSimTim, dblValWri.data_, curSimTim, dblValRea.data_ );
+			} else if ( haveExternalInterfaceBCVTB ) {
 				retVal = exchangedoubleswithsocket( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_ );
 			} else if ( haveExternalInterfaceFMUExport ) {
 				retVal = exchangedoubleswithsocketFMU( &socketFD, &flaWri, &flaRea, &nDblWri, &nDblRea, &preSimTim, dblValWri.data_, &curSimTim, dblValRea.data_, &FMUExportActivate );
@@ -2098,6 +2140,11 @@ namespace ExternalInterface {
 					ShowSevereError( "ExternalInterface: Socket communication received error value \"" + retValCha + "\" at time = " + TrimSigDigits( preSimTim / 3600, 2 ) + " hours." );
 					gio::write( retValCha, Format_1000 ) << flaRea;
 					ShowContinueError( "ExternalInterface: Flag from server \"" + retValCha + "\"." );
+					if ( useSharedMemoryIPC && retVal == ExternalInterfaceSharedMemory::shmPeerGone ) {
+						ShowContinueError( "ExternalInterface: The process that created the shared memory has exited." );
+					} else if ( useSharedMemoryIPC && retVal == ExternalInterfaceSharedMemory::shmTimeOut ) {
+						ShowContinueError( "ExternalInterface: No answer through the shared memory within " + TrimSigDigits( ExternalInterfaceSharedMemory::sharedMemoryTimeOut, 0 ) + " seconds." );
+					}
 					ErrorsFound = true;
 					StopExternalInterfaceIfError();
 				}
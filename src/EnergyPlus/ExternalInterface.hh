@@ -19,6 +19,7 @@ extern "C" {
 
 // C++ Standard Library Headers
 #include <string>
+#include <vector>
 
 // Objexx Headers
 #include <ObjexxFCL/FArray1D.hh>
@@ -227,6 +228,10 @@ namespace ExternalInterface {
 		FArray1D< fmuOutputVariableActuatorType > fmuOutputVariableActuator;
 		// Variable Types structure for energyplus input variables from type actuator
 		FArray1D< eplusInputVariableActuatorType > eplusInputVariableActuator;
+		std::vector< unsigned int > outputValueReferences; // Value references of all fmu outputs (schedule, variable, actuator)
+		std::vector< Real64 > outputValues; // Values of all fmu outputs, same order as outputValueReferences
+		std::vector< unsigned int > inputValueReferences; // Value references of the fmu inputs
+		std::vector< Real64 > inputValues; // Values of the fmu inputs, same order as inputValueReferences
 
 		// Default Constructor
 		InstanceType() :
@@ -305,6 +310,7 @@ namespace ExternalInterface {
 	extern FArray1D< int > varTypes; // Types of variables in keyVarIndexes
 	extern FArray1D< int > varInd; // Index of ErlVariables for ExternalInterface
 	extern int socketFD; // socket file descriptor
+	extern bool useSharedMemoryIPC; // True if socket.cfg selects the shared memory transport
 	extern bool ErrorsFound; // Set to true if errors are found
 	extern bool noMoreValues; //Flag, true if no more values
 	// will be sent by the server
@@ -325,6 +331,9 @@ namespace ExternalInterface {
 	void
 	CloseSocket( int const FlagToWriteToSocket ); 
 
+	void
+	OpenSharedMemoryIPC();
+
 	void
 	InitExternalInterface();
 	
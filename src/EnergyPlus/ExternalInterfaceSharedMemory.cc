@@ -0,0 +1,494 @@
+// C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// EnergyPlus Headers
+#include <ExternalInterfaceSharedMemory.hh>
+
+namespace EnergyPlus {
+
+namespace ExternalInterfaceSharedMemory {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Shared memory transport for the ExternalInterface, used instead of the BCVTB socket
+	// when the peer runs on the same host (selected with <ipc><sharedmemory name="..."/></ipc>
+	// in socket.cfg).
+
+	// METHODOLOGY EMPLOYED:
+	// The peer creates a named shared memory segment holding one SharedMemoryChannelType and
+	// EnergyPlus opens it. The exchange is lock step like the socket: EnergyPlus posts its
+	// values and waits for the reply of the peer. Each side publishes its data by incrementing
+	// its own counter with release semantics and the other side polls that counter with
+	// acquire semantics, so the handshake needs neither locks nor system calls while the
+	// peer answers quickly. A longer wait sleeps between polls, checks that the process on
+	// the other side is still running and gives up after a time out.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// na
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const maxSharedMemoryDoubles( 1024 ); // Maximum number of doubles in one direction (same as the socket)
+	int const sharedMemoryVersion( 2 ); // Layout version of the shared memory channel
+	Real64 const sharedMemoryTimeOut( 3600.0 ); // Time out [s] of the waits that are not given one
+
+	int const shmOK( 0 );
+	int const shmNotOpen( -1 ); // channel is not open
+	int const shmTooManyDoubles( -2 ); // more doubles than maxSharedMemoryDoubles
+	int const shmTimeOut( -3 ); // no answer within the time out
+	int const shmVersionMismatch( -4 ); // peer uses another layout version
+	int const shmPeerGone( -5 ); // process on the other side has exited
+
+	// The counters are shared between processes, which is only valid for lock-free atomics
+	static_assert( ATOMIC_INT_LOCK_FREE == 2, "Shared memory channel requires lock-free int atomics" );
+	static_assert( maxSharedMemoryDoubles == sizeof( SharedMemoryChannelType::requestValues ) / sizeof( Real64 ), "Shared memory channel size mismatch" );
+
+	// Functions
+
+	namespace {
+
+		std::string
+		PlatformName( std::string const & Name )
+		{
+			// Shared memory object names are /name on POSIX systems
+#ifdef _WIN32
+			return Name;
+#else
+			if ( ! Name.empty() && Name[ 0 ] == '/' ) return Name;
+			return '/' + Name;
+#endif
+		}
+
+		std::int32_t
+		CurrentProcessId()
+		{
+#ifdef _WIN32
+			return std::int32_t( GetCurrentProcessId() );
+#else
+			return std::int32_t( getpid() );
+#endif
+		}
+
+		bool
+		ProcessIsRunning( std::int32_t const ProcessId ) // process id, 0 if unknown
+		{
+			if ( ProcessId <= 0 ) return true; // Nothing to check yet
+#ifdef _WIN32
+			HANDLE Process( OpenProcess( SYNCHRONIZE, FALSE, DWORD( ProcessId ) ) );
+			if ( Process == NULL ) return GetLastError() == ERROR_ACCESS_DENIED;
+			DWORD const Status( WaitForSingleObject( Process, 0 ) );
+			CloseHandle( Process );
+			return Status == WAIT_TIMEOUT;
+#else
+			// Signal 0 only checks that the process exists, EPERM means it exists under another user
+			return kill( pid_t( ProcessId ), 0 ) == 0 || errno == EPERM;
+#endif
+		}
+
+		int
+		WaitForCount(
+			std::atomic< std::int32_t > const & Count, // counter written by the other side
+			std::int32_t const Expected, // value to wait for
+			std::atomic< std::int32_t > const & OtherProcessId, // process id of the other side
+			Real64 const TimeOut // time out [s], zero or negative for sharedMemoryTimeOut
+		)
+		{
+			// Spin briefly since the peer usually answers within microseconds, then yield the
+			// processor for a while, and then sleep between polls with a growing sleep time so
+			// that a slow peer does not lose its core to us.
+			int const SpinCount( 4000 );
+			int const YieldCount( 200 );
+			std::chrono::microseconds const MaxSleepTime( 1000 );
+			Real64 const CheckInterval( 0.1 ); // time between the checks of the other process [s]
+			Real64 const MaxWait( TimeOut > 0.0 ? TimeOut : sharedMemoryTimeOut );
+			int iSpin( 0 );
+			std::chrono::microseconds SleepTime( 10 );
+			Real64 NextCheck( CheckInterval );
+			auto const StartTime( std::chrono::steady_clock::now() );
+
+			while ( Count.load( std::memory_order_acquire ) != Expected ) {
+				if ( iSpin < SpinCount ) {
+					++iSpin;
+					continue;
+				}
+				if ( iSpin < SpinCount + YieldCount ) {
+					++iSpin;
+					std::this_thread::yield();
+					continue;
+				}
+				std::this_thread::sleep_for( SleepTime );
+				SleepTime = std::min( SleepTime * 2, MaxSleepTime );
+				if ( Count.load( std::memory_order_acquire ) == Expected ) break;
+				std::chrono::duration< Real64 > const Elapsed( std::chrono::steady_clock::now() - StartTime );
+				if ( Elapsed.count() > MaxWait ) return shmTimeOut;
+				if ( Elapsed.count() >= NextCheck ) {
+					if ( ! ProcessIsRunning( OtherProcessId.load( std::memory_order_relaxed ) ) ) return shmPeerGone;
+					NextCheck = Elapsed.count() + CheckInterval;
+				}
+			}
+			return shmOK;
+		}
+
+		int
+		MapChannel(
+			std::string const & Name, // name of the shared memory segment
+			bool const Create, // true to create the segment
+			SharedMemoryIPCType & IPC // handle
+		)
+		{
+			std::size_t const Size( sizeof( SharedMemoryChannelType ) );
+			void * Address( nullptr );
+
+			IPC.Name = PlatformName( Name );
+#ifdef _WIN32
+			HANDLE MapHandle;
+			if ( Create ) {
+				MapHandle = CreateFileMappingA( INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, DWORD( Size ), IPC.Name.c_str() );
+			} else {
+				MapHandle = OpenFileMappingA( FILE_MAP_ALL_ACCESS, FALSE, IPC.Name.c_str() );
+			}
+			if ( MapHandle == NULL ) return shmNotOpen;
+			Address = MapViewOfFile( MapHandle, FILE_MAP_ALL_ACCESS, 0, 0, Size );
+			if ( Address == NULL ) {
+				CloseHandle( MapHandle );
+				return shmNotOpen;
+			}
+			IPC.MapHandle = MapHandle;
+#else
+			int const FileDescriptor( Create ? shm_open( IPC.Name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR ) : shm_open( IPC.Name.c_str(), O_RDWR, 0 ) );
+			if ( FileDescriptor < 0 ) return shmNotOpen;
+			if ( Create && ftruncate( FileDescriptor, off_t( Size ) ) != 0 ) {
+				close( FileDescriptor );
+				shm_unlink( IPC.Name.c_str() );
+				return shmNotOpen;
+			}
+			Address = mmap( nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, FileDescriptor, 0 );
+			close( FileDescriptor ); // the mapping stays valid
+			if ( Address == MAP_FAILED ) {
+				if ( Create ) shm_unlink( IPC.Name.c_str() );
+				return shmNotOpen;
+			}
+#endif
+			if ( Create ) {
+				IPC.Channel = new ( Address ) SharedMemoryChannelType();
+				IPC.Channel->version = sharedMemoryVersion;
+				IPC.Channel->peerProcessId.store( CurrentProcessId(), std::memory_order_relaxed );
+			} else {
+				IPC.Channel = static_cast< SharedMemoryChannelType * >( Address );
+			}
+			IPC.Owner = Create;
+			return shmOK;
+		}
+
+	}
+
+	int
+	CreateSharedMemoryChannel(
+		std::string const & Name, // name of the shared memory segment
+		SharedMemoryIPCType & IPC // handle of the created channel
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Creates the shared memory channel. Called by the peer, which plays the role of
+		// the server like for the socket.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		CloseSharedMemoryChannel( IPC );
+		return MapChannel( Name, true, IPC );
+	}
+
+	int
+	OpenSharedMemoryChannel(
+		std::string const & Name, // name of the shared memory segment
+		SharedMemoryIPCType & IPC // handle of the opened channel
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Opens the shared memory channel created by the peer.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int RetVal; // Return value
+
+		CloseSharedMemoryChannel( IPC );
+		RetVal = MapChannel( Name, false, IPC );
+		if ( RetVal != shmOK ) return RetVal;
+		if ( IPC.Channel->version != sharedMemoryVersion ) {
+			CloseSharedMemoryChannel( IPC );
+			return shmVersionMismatch;
+		}
+		// Continue the count of the channel, the peer may have been used by an earlier run
+		IPC.LastCount = IPC.Channel->requestCount.load( std::memory_order_acquire );
+		IPC.Channel->clientProcessId.store( CurrentProcessId(), std::memory_order_relaxed );
+		return shmOK;
+	}
+
+	void
+	CloseSharedMemoryChannel( SharedMemoryIPCType & IPC )
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Unmaps the channel. The peer that created the segment also removes its name.
+
+		if ( IPC.Channel == nullptr ) return;
+#ifdef _WIN32
+		UnmapViewOfFile( IPC.Channel );
+		CloseHandle( static_cast< HANDLE >( IPC.MapHandle ) );
+		IPC.MapHandle = nullptr;
+#else
+		munmap( IPC.Channel, sizeof( SharedMemoryChannelType ) );
+		if ( IPC.Owner ) shm_unlink( IPC.Name.c_str() );
+#endif
+		IPC.Channel = nullptr;
+		IPC.Owner = false;
+		IPC.LastCount = 0;
+	}
+
+	int
+	PostSharedMemoryRequest(
+		SharedMemoryIPCType & IPC, // channel
+		int const flaWri, // flag to write
+		int const nDblWri, // number of doubles to write
+		Real64 const simTimWri, // simulation time to write [s]
+		Real64 const * dblValWri // doubles to write
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the values of EnergyPlus to the channel and publishes them to the peer.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int i; // Loop counter
+
+		if ( IPC.Channel == nullptr ) return shmNotOpen;
+		if ( nDblWri < 0 || nDblWri > maxSharedMemoryDoubles ) return shmTooManyDoubles;
+
+		SharedMemoryChannelType & Channel( *IPC.Channel );
+		Channel.requestFlag = flaWri;
+		Channel.requestNumDoubles = nDblWri;
+		Channel.requestTime = simTimWri;
+		for ( i = 0; i < nDblWri; ++i ) {
+			Channel.requestValues[ i ] = dblValWri[ i ];
+		}
+		++IPC.LastCount;
+		Channel.requestCount.store( IPC.LastCount, std::memory_order_release );
+		return shmOK;
+	}
+
+	int
+	WaitForSharedMemoryReply(
+		SharedMemoryIPCType & IPC, // channel
+		int & flaRea, // flag read
+		int & nDblRea, // number of doubles read
+		Real64 & simTimRea, // simulation time read [s]
+		Real64 * dblValRea, // doubles read
+		Real64 const TimeOut // time out [s], zero or negative for sharedMemoryTimeOut
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Waits until the peer has answered the last request and reads its reply.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int i; // Loop counter
+		int RetVal; // Return value
+
+		if ( IPC.Channel == nullptr ) return shmNotOpen;
+
+		SharedMemoryChannelType const & Channel( *IPC.Channel );
+		RetVal = WaitForCount( Channel.replyCount, IPC.LastCount, Channel.peerProcessId, TimeOut );
+		if ( RetVal != shmOK ) return RetVal;
+		flaRea = Channel.replyFlag;
+		nDblRea = Channel.replyNumDoubles;
+		simTimRea = Channel.replyTime;
+		if ( nDblRea < 0 || nDblRea > maxSharedMemoryDoubles ) return shmTooManyDoubles;
+		for ( i = 0; i < nDblRea; ++i ) {
+			dblValRea[ i ] = Channel.replyValues[ i ];
+		}
+		return shmOK;
+	}
+
+	int
+	ExchangeDoublesWithSharedMemory(
+		SharedMemoryIPCType & IPC, // channel
+		int const flaWri, // flag to write
+		int & flaRea, // flag read
+		int const nDblWri, // number of doubles to write
+		int & nDblRea, // number of doubles read
+		Real64 const simTimWri, // simulation time to write [s]
+		Real64 const * dblValWri, // doubles to write
+		Real64 & simTimRea, // simulation time read [s]
+		Real64 * dblValRea // doubles read
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Shared memory counterpart of exchangedoubleswithsocket: sends the values of
+		// EnergyPlus and waits for the values of the peer.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int RetVal; // Return value
+
+		RetVal = PostSharedMemoryRequest( IPC, flaWri, nDblWri, simTimWri, dblValWri );
+		if ( RetVal != shmOK ) return RetVal;
+		// Wait as long as the peer needs, unless it exits or exceeds sharedMemoryTimeOut
+		return WaitForSharedMemoryReply( IPC, flaRea, nDblRea, simTimRea, dblValRea, 0.0 );
+	}
+
+	int
+	WaitForSharedMemoryRequest(
+		SharedMemoryIPCType & IPC, // channel
+		int & flaRea, // flag read
+		int & nDblRea, // number of doubles read
+		Real64 & simTimRea, // simulation time read [s]
+		Real64 * dblValRea, // doubles read
+		Real64 const TimeOut // time out [s], zero or negative for sharedMemoryTimeOut
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Peer side: waits for the next request of EnergyPlus and reads it.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int i; // Loop counter
+		int RetVal; // Return value
+
+		if ( IPC.Channel == nullptr ) return shmNotOpen;
+
+		SharedMemoryChannelType const & Channel( *IPC.Channel );
+		RetVal = WaitForCount( Channel.requestCount, IPC.LastCount + 1, Channel.clientProcessId, TimeOut );
+		if ( RetVal != shmOK ) return RetVal;
+		++IPC.LastCount;
+		flaRea = Channel.requestFlag;
+		nDblRea = Channel.requestNumDoubles;
+		simTimRea = Channel.requestTime;
+		if ( nDblRea < 0 || nDblRea > maxSharedMemoryDoubles ) return shmTooManyDoubles;
+		for ( i = 0; i < nDblRea; ++i ) {
+			dblValRea[ i ] = Channel.requestValues[ i ];
+		}
+		return shmOK;
+	}
+
+	int
+	PostSharedMemoryReply(
+		SharedMemoryIPCType & IPC, // channel
+		int const flaWri, // flag to write
+		int const nDblWri, // number of doubles to write
+		Real64 const simTimWri, // simulation time to write [s]
+		Real64 const * dblValWri // doubles to write
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Peer side: answers the last request read with WaitForSharedMemoryRequest.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int i; // Loop counter
+
+		if ( IPC.Channel == nullptr ) return shmNotOpen;
+		if ( nDblWri < 0 || nDblWri > maxSharedMemoryDoubles ) return shmTooManyDoubles;
+
+		SharedMemoryChannelType & Channel( *IPC.Channel );
+		Channel.replyFlag = flaWri;
+		Channel.replyNumDoubles = nDblWri;
+		Channel.replyTime = simTimWri;
+		for ( i = 0; i < nDblWri; ++i ) {
+			Channel.replyValues[ i ] = dblValWri[ i ];
+		}
+		Channel.replyCount.store( IPC.LastCount, std::memory_order_release );
+		return shmOK;
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // ExternalInterfaceSharedMemory
+
+} // EnergyPlus
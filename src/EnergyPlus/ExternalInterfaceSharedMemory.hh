@@ -0,0 +1,187 @@
+#ifndef ExternalInterfaceSharedMemory_hh_INCLUDED
+#define ExternalInterfaceSharedMemory_hh_INCLUDED
+
+// C++ Headers
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace ExternalInterfaceSharedMemory {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	extern int const maxSharedMemoryDoubles; // Maximum number of doubles in one direction (same as the socket)
+	extern int const sharedMemoryVersion; // Layout version of the shared memory channel
+	extern Real64 const sharedMemoryTimeOut; // Time out [s] of the waits that are not given one
+
+	// Return values of the exchange routines, negative values are errors like for the socket routines
+	extern int const shmOK;
+	extern int const shmNotOpen; // channel is not open
+	extern int const shmTooManyDoubles; // more doubles than maxSharedMemoryDoubles
+	extern int const shmTimeOut; // no answer within the time out
+	extern int const shmVersionMismatch; // peer uses another layout version
+	extern int const shmPeerGone; // process on the other side has exited
+
+	// Types
+
+	// Layout of the shared memory segment. EnergyPlus posts a request (its values of the
+	// time step) and the peer answers it with a reply. requestCount is only written by
+	// EnergyPlus and replyCount only by the peer, so no locks are needed: a side writes
+	// its data and then publishes it by incrementing its counter (release), the other side
+	// waits until the counter changes (acquire) and then reads the data. While waiting, each
+	// side checks that the process id of the other side is still running.
+	struct SharedMemoryChannelType
+	{
+		// Members
+		std::atomic< std::int32_t > requestCount; // number of requests posted by EnergyPlus
+		std::atomic< std::int32_t > replyCount; // number of requests answered by the peer
+		std::atomic< std::int32_t > peerProcessId; // process id of the peer (0 = unknown)
+		std::atomic< std::int32_t > clientProcessId; // process id of EnergyPlus (0 = not opened yet)
+		std::int32_t version; // layout version, set by the peer that creates the channel
+		std::int32_t requestFlag; // flag from EnergyPlus (0 = values, +1 = end of simulation, <0 = error)
+		std::int32_t requestNumDoubles; // number of doubles from EnergyPlus
+		Real64 requestTime; // simulation time of the request [s]
+		Real64 requestValues[ 1024 ]; // doubles from EnergyPlus
+		std::int32_t replyFlag; // flag from the peer (0 = values, +1 = no more values, <0 = error)
+		std::int32_t replyNumDoubles; // number of doubles from the peer
+		Real64 replyTime; // simulation time of the reply [s]
+		Real64 replyValues[ 1024 ]; // doubles from the peer
+
+		// Default Constructor
+		SharedMemoryChannelType() :
+			requestCount( 0 ),
+			replyCount( 0 ),
+			peerProcessId( 0 ),
+			clientProcessId( 0 ),
+			version( 0 ),
+			requestFlag( 0 ),
+			requestNumDoubles( 0 ),
+			requestTime( 0.0 ),
+			replyFlag( 0 ),
+			replyNumDoubles( 0 ),
+			replyTime( 0.0 )
+		{}
+
+	};
+
+	// Process-local handle of a mapped channel
+	struct SharedMemoryIPCType
+	{
+		// Members
+		std::string Name; // name of the shared memory segment
+		SharedMemoryChannelType * Channel; // mapped segment, null if not open
+		bool Owner; // true if this process created the segment (the peer)
+		void * MapHandle; // file mapping handle (Windows only)
+		std::int32_t LastCount; // last request count posted (EnergyPlus) or answered (peer)
+
+		// Default Constructor
+		SharedMemoryIPCType() :
+			Channel( nullptr ),
+			Owner( false ),
+			MapHandle( nullptr ),
+			LastCount( 0 )
+		{}
+
+	};
+
+	// Functions
+
+	int
+	CreateSharedMemoryChannel(
+		std::string const & Name, // name of the shared memory segment
+		SharedMemoryIPCType & IPC // handle of the created channel
+	);
+
+	int
+	OpenSharedMemoryChannel(
+		std::string const & Name, // name of the shared memory segment
+		SharedMemoryIPCType & IPC // handle of the opened channel
+	);
+
+	void
+	CloseSharedMemoryChannel( SharedMemoryIPCType & IPC );
+
+	int
+	PostSharedMemoryRequest(
+		SharedMemoryIPCType & IPC, // channel
+		int const flaWri, // flag to write
+		int const nDblWri, // number of doubles to write
+		Real64 const simTimWri, // simulation time to write [s]
+		Real64 const * dblValWri // doubles to write
+	);
+
+	int
+	WaitForSharedMemoryReply(
+		SharedMemoryIPCType & IPC, // channel
+		int & flaRea, // flag read
+		int & nDblRea, // number of doubles read
+		Real64 & simTimRea, // simulation time read [s]
+		Real64 * dblValRea, // doubles read
+		Real64 const TimeOut // time out [s], zero or negative for sharedMemoryTimeOut
+	);
+
+	int
+	ExchangeDoublesWithSharedMemory(
+		SharedMemoryIPCType & IPC, // channel
+		int const flaWri, // flag to write
+		int & flaRea, // flag read
+		int const nDblWri, // number of doubles to write
+		int & nDblRea, // number of doubles read
+		Real64 const simTimWri, // simulation time to write [s]
+		Real64 const * dblValWri, // doubles to write
+		Real64 & simTimRea, // simulation time read [s]
+		Real64 * dblValRea // doubles read
+	);
+
+	int
+	WaitForSharedMemoryRequest(
+		SharedMemoryIPCType & IPC, // channel
+		int & flaRea, // flag read
+		int & nDblRea, // number of doubles read
+		Real64 & simTimRea, // simulation time read [s]
+		Real64 * dblValRea, // doubles read
+		Real64 const TimeOut // time out [s], zero or negative for sharedMemoryTimeOut
+	);
+
+	int
+	PostSharedMemoryReply(
+		SharedMemoryIPCType & IPC, // channel
+		int const flaWri, // flag to write
+		int const nDblWri, // number of doubles to write
+		Real64 const simTimWri, // simulation time to write [s]
+		Real64 const * dblValWri // doubles to write
+	);
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // ExternalInterfaceSharedMemory
+
+} // EnergyPlus
+
+#endif
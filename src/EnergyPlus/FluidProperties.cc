@@ -1,5 +1,6 @@
 // C++ Headers
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <limits>
@@ -1877,6 +1878,8 @@ namespace FluidProperties {
 
 		if ( ! ErrorsFound ) InitializeRefrigerantLimits( ErrorsFound ); // Initialize the limits for the refrigerants
 
+		if ( ! ErrorsFound ) InitializeFluidTempGrids(); // Set up the temperature bracket grids for the property lookups
+
 		FluidTemps.deallocate();
 
 		Alphas.deallocate();
@@ -2819,6 +2822,259 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeTempGrid(
+		FArray1< Real64 > const & Temps, // temperature list (ascending)
+		int const FirstIndex, // smallest upper bracket index that may be returned
+		int const LastIndex, // largest upper bracket index that may be returned
+		FluidPropsTempGridData & Grid // uniform cell index built over Temps
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine divides the temperature range Temps(FirstIndex-1) to Temps(LastIndex)
+		// into uniform cells and stores, for each cell, the first upper bracket index whose
+		// temperature is at or above the start of the cell.  The property routines then find
+		// their interpolation bracket by direct indexing rather than a search.
+
+		// METHODOLOGY EMPLOYED:
+		// The cell width is no larger than the smallest temperature spacing (up to a cap on
+		// the number of cells) so a lookup moves at most a step or two from the stored index.
+		// No grid is built (NumCells = 0) if the list is too short or not strictly ascending,
+		// in which case the property routines use their original searches.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MaxNumCells( 4096 ); // cap on the grid size for finely tabulated fluids
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop; // temperature index
+		int CellNum; // grid cell counter
+		int NumCells; // number of grid cells
+		Real64 MinDeltaTemp; // smallest spacing between temperature points
+		Real64 CellWidth; // uniform width of each cell
+		Real64 CellTemp; // temperature at the start of a cell
+
+		Grid.NumCells = 0;
+		Grid.CellIndex.deallocate();
+		if ( FirstIndex < 2 || LastIndex < FirstIndex || LastIndex > Temps.u() ) return;
+
+		MinDeltaTemp = Temps( LastIndex ) - Temps( FirstIndex - 1 );
+		for ( Loop = FirstIndex; Loop <= LastIndex; ++Loop ) {
+			MinDeltaTemp = min( MinDeltaTemp, Temps( Loop ) - Temps( Loop - 1 ) );
+		}
+		if ( MinDeltaTemp <= 0.0 ) return;
+
+		NumCells = min( MaxNumCells, int( std::ceil( ( Temps( LastIndex ) - Temps( FirstIndex - 1 ) ) / MinDeltaTemp ) ) );
+		NumCells = max( NumCells, 1 );
+		CellWidth = ( Temps( LastIndex ) - Temps( FirstIndex - 1 ) ) / NumCells;
+
+		Grid.LowTemp = Temps( FirstIndex - 1 );
+		Grid.InvCellWidth = 1.0 / CellWidth;
+		Grid.NumCells = NumCells;
+		Grid.FirstIndex = FirstIndex;
+		Grid.LastIndex = LastIndex;
+		Grid.CellIndex.allocate( NumCells );
+
+		Loop = FirstIndex;
+		for ( CellNum = 1; CellNum <= NumCells; ++CellNum ) {
+			CellTemp = Grid.LowTemp + ( CellNum - 1 ) * CellWidth;
+			while ( Loop < LastIndex && Temps( Loop ) < CellTemp ) ++Loop;
+			Grid.CellIndex( CellNum ) = Loop;
+		}
+
+	}
+
+	//*****************************************************************************
+
+	void
+	InitializeFluidTempGrids()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine builds the temperature bracket grids used by the glycol property
+		// routines and the refrigerant saturation pressure routine, and the temperature and
+		// pressure bracket grids used by the superheated refrigerant routines.
+
+		// METHODOLOGY EMPLOYED:
+		// The bracket ranges match the searches they replace: the specific heat search
+		// covers the whole temperature list while the other glycol properties and the
+		// saturation pressure search only cover the valid (non-zero) data range set up
+		// by InitializeGlycolTempLimits and InitializeRefrigerantLimits.  The superheated
+		// searches cover the whole temperature and pressure lists.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int GlycolNum;
+		int RefrigNum;
+
+		for ( GlycolNum = 1; GlycolNum <= NumOfGlycols; ++GlycolNum ) {
+			auto & glycol( GlycolData( GlycolNum ) );
+			if ( glycol.CpDataPresent ) {
+				InitializeTempGrid( glycol.CpTemps, 2, glycol.CpTemps.u(), glycol.CpTempGrid );
+			}
+			if ( glycol.RhoDataPresent ) {
+				InitializeTempGrid( glycol.RhoTemps, glycol.RhoLowTempIndex + 1, glycol.RhoHighTempIndex, glycol.RhoTempGrid );
+			}
+			if ( glycol.CondDataPresent ) {
+				InitializeTempGrid( glycol.CondTemps, glycol.CondLowTempIndex + 1, glycol.CondHighTempIndex, glycol.CondTempGrid );
+			}
+			if ( glycol.ViscDataPresent ) {
+				InitializeTempGrid( glycol.ViscTemps, glycol.ViscLowTempIndex + 1, glycol.ViscHighTempIndex, glycol.ViscTempGrid );
+			}
+		}
+
+		for ( RefrigNum = 1; RefrigNum <= NumOfRefrigerants; ++RefrigNum ) {
+			auto & refrig( RefrigData( RefrigNum ) );
+			if ( refrig.NumPsPoints > 0 ) {
+				InitializeTempGrid( refrig.PsTemps, refrig.PsLowTempIndex + 1, refrig.PsHighTempIndex, refrig.PsTempGrid );
+			}
+			if ( refrig.NumSuperTempPts > 1 && refrig.NumSuperPressPts > 1 ) {
+				InitializeTempGrid( refrig.SHTemps, 2, refrig.NumSuperTempPts, refrig.SHTempGrid );
+				InitializeTempGrid( refrig.SHPress, 2, refrig.NumSuperPressPts, refrig.SHPressGrid );
+			}
+		}
+
+	}
+
+	//*****************************************************************************
+
+	int
+	FindTempGridUpperIndex(
+		Real64 const Temperature, // temperature to bracket
+		FArray1< Real64 > const & Temps, // temperature list (ascending)
+		FluidPropsTempGridData const & Grid // uniform cell index built over Temps
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the smallest index Loop in Grid.FirstIndex..Grid.LastIndex
+		// with Temps(Loop) >= Temperature, i.e. the upper point of the interpolation bracket.
+		// Temperature is expected to lie within Temps(FirstIndex-1)..Temps(LastIndex).
+
+		// METHODOLOGY EMPLOYED:
+		// The cell containing the temperature gives a starting index that is corrected by
+		// a short walk, so the result is identical to a linear or binary search.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		int Loop;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int CellNum; // grid cell containing the temperature
+
+		CellNum = int( ( Temperature - Grid.LowTemp ) * Grid.InvCellWidth ) + 1;
+		if ( CellNum < 1 ) CellNum = 1;
+		if ( CellNum > Grid.NumCells ) CellNum = Grid.NumCells;
+
+		Loop = Grid.CellIndex( CellNum );
+		while ( Loop > Grid.FirstIndex && Temps( Loop - 1 ) >= Temperature ) --Loop;
+		while ( Loop < Grid.LastIndex && Temps( Loop ) < Temperature ) ++Loop;
+
+		return Loop;
+
+	}
+
+	//*****************************************************************************
+
+	int
+	FindGridArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		FArray1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsTempGridData const & Grid // uniform cell index built over Array(LowBound) to Array(UpperBound)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the same index as FindArrayIndex: the low point of the
+		// interval containing Value, 0 below the range and UpperBound above it.
+
+		// METHODOLOGY EMPLOYED:
+		// The bracket is found from the uniform grid when one was built over the same
+		// range, otherwise FindArrayIndex does the interval halving.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		if ( Grid.NumCells == 0 || Grid.FirstIndex != LowBound + 1 || Grid.LastIndex != UpperBound ) {
+			return FindArrayIndex( Value, Array, LowBound, UpperBound );
+		} else if ( Value < Array( LowBound ) ) {
+			return 0;
+		} else if ( Value > Array( UpperBound ) ) {
+			return UpperBound;
+		} else {
+			return FindTempGridUpperIndex( Value, Array, Grid ) - 1;
+		}
+
+	}
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols()
 	{
@@ -3404,8 +3660,9 @@ namespace FluidProperties {
 		// This finds the saturation pressure for given temperature.
 
 		// METHODOLOGY EMPLOYED:
-		// Calls FindArrayIndex to find indices either side of requested temperature
-		// and linearly interpolates the corresponding saturation pressure values.
+		// Uses the saturation temperature grid (or FindArrayIndex if no grid was built) to
+		// find indices either side of requested temperature and linearly interpolates the
+		// corresponding saturation pressure values.
 
 		// REFERENCES:
 		// na
@@ -3464,7 +3721,17 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// determine array indices for
-		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+		if ( refrig.PsTempGrid.NumCells > 0 ) {
+			if ( Temperature < refrig.PsTemps( refrig.PsLowTempIndex ) ) {
+				LoTempIndex = 0;
+			} else if ( Temperature > refrig.PsTemps( refrig.PsHighTempIndex ) ) {
+				LoTempIndex = refrig.PsHighTempIndex;
+			} else {
+				LoTempIndex = FindTempGridUpperIndex( Temperature, refrig.PsTemps, refrig.PsTempGrid ) - 1;
+			}
+		} else {
+			LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+		}
 		HiTempIndex = LoTempIndex + 1;
 
 		// check for out of data bounds problems
@@ -4045,8 +4312,8 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		TempIndex = FindGridArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempGrid );
+		LoPressIndex = FindGridArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressGrid );
 
 		// check temperature data range and attempt to cap if necessary
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
@@ -4295,7 +4562,7 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		LoTempIndex = FindGridArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempGrid );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check temperature data range and attempt to cap if necessary
@@ -4565,7 +4832,7 @@ namespace FluidProperties {
 		auto const & Refrig( RefrigData( RefrigNum ) ); // Shorthand name
 
 		// check temperature data range and attempt to cap if necessary
-		TempIndex = FindArrayIndex( Temperature, Refrig.SHTemps, 1, Refrig.NumSuperTempPts );
+		TempIndex = FindGridArrayIndex( Temperature, Refrig.SHTemps, 1, Refrig.NumSuperTempPts, Refrig.SHTempGrid );
 		if ( ( TempIndex > 0 ) && ( TempIndex < Refrig.NumSuperTempPts ) ) { // in range
 			HiTempIndex = TempIndex + 1;
 			TempInterpRatio = ( Temperature - Refrig.SHTemps( TempIndex ) ) / ( Refrig.SHTemps( HiTempIndex ) - Refrig.SHTemps( TempIndex ) );
@@ -4585,7 +4852,7 @@ namespace FluidProperties {
 		}
 
 		// check pressure data range and attempt to cap if necessary
-		LoPressIndex = FindArrayIndex( Pressure, Refrig.SHPress, 1, Refrig.NumSuperPressPts );
+		LoPressIndex = FindGridArrayIndex( Pressure, Refrig.SHPress, 1, Refrig.NumSuperPressPts, Refrig.SHPressGrid );
 		if ( ( LoPressIndex > 0 ) && ( LoPressIndex < Refrig.NumSuperPressPts ) ) { // in range
 			HiPressIndex = LoPressIndex + 1;
 			Real64 const SHPress_Lo( Refrig.SHPress( LoPressIndex ) );
@@ -4806,6 +5073,10 @@ namespace FluidProperties {
 			//	break; // DO loop
 			//}
 			//assert( std::is_sorted( glycol_CpTemps.begin(), glycol_CpTemps.end() ) ); // Sorted temperature array is assumed: Enable if/when arrays have begin()/end()
+			if ( glycol_data.CpTempGrid.NumCells > 0 ) { // Same bracket as the binary search below, found from the temperature grid
+				int const end( FindTempGridUpperIndex( Temperature, glycol_CpTemps, glycol_data.CpTempGrid ) );
+				return GetInterpValue_fast( Temperature, glycol_CpTemps( end - 1 ), glycol_CpTemps( end ), glycol_CpValues( end - 1 ), glycol_CpValues( end ) );
+			}
 			assert( glycol_CpTemps.size() <= static_cast< std::size_t >( std::numeric_limits< int >::max() ) ); // Array indexes are int now so this is future protection
 			int beg( 1 ), mid, end( static_cast< int >( glycol_CpTemps.size() ) ); // 1-based indexing
 			assert( end > 0 );
@@ -4917,10 +5188,15 @@ namespace FluidProperties {
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).RhoLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).RhoHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).RhoTemps( Loop ) ) continue;
+			if ( GlycolData( GlycolIndex ).RhoTempGrid.NumCells > 0 ) {
+				Loop = FindTempGridUpperIndex( Temperature, GlycolData( GlycolIndex ).RhoTemps, GlycolData( GlycolIndex ).RhoTempGrid );
 				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).RhoTemps( Loop - 1 ), GlycolData( GlycolIndex ).RhoTemps( Loop ), GlycolData( GlycolIndex ).RhoValues( Loop - 1 ), GlycolData( GlycolIndex ).RhoValues( Loop ) );
-				break; // DO loop
+			} else {
+				for ( Loop = GlycolData( GlycolIndex ).RhoLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).RhoHighTempIndex; ++Loop ) {
+					if ( Temperature > GlycolData( GlycolIndex ).RhoTemps( Loop ) ) continue;
+					ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).RhoTemps( Loop - 1 ), GlycolData( GlycolIndex ).RhoTemps( Loop ), GlycolData( GlycolIndex ).RhoValues( Loop - 1 ), GlycolData( GlycolIndex ).RhoValues( Loop ) );
+					break; // DO loop
+				}
 			}
 		}
 
@@ -5060,10 +5336,15 @@ namespace FluidProperties {
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).CondLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).CondHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).CondTemps( Loop ) ) continue;
+			if ( GlycolData( GlycolIndex ).CondTempGrid.NumCells > 0 ) {
+				Loop = FindTempGridUpperIndex( Temperature, GlycolData( GlycolIndex ).CondTemps, GlycolData( GlycolIndex ).CondTempGrid );
 				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).CondTemps( Loop - 1 ), GlycolData( GlycolIndex ).CondTemps( Loop ), GlycolData( GlycolIndex ).CondValues( Loop - 1 ), GlycolData( GlycolIndex ).CondValues( Loop ) );
-				break; // DO loop
+			} else {
+				for ( Loop = GlycolData( GlycolIndex ).CondLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).CondHighTempIndex; ++Loop ) {
+					if ( Temperature > GlycolData( GlycolIndex ).CondTemps( Loop ) ) continue;
+					ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).CondTemps( Loop - 1 ), GlycolData( GlycolIndex ).CondTemps( Loop ), GlycolData( GlycolIndex ).CondValues( Loop - 1 ), GlycolData( GlycolIndex ).CondValues( Loop ) );
+					break; // DO loop
+				}
 			}
 		}
 
@@ -5203,10 +5484,15 @@ namespace FluidProperties {
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).ViscLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).ViscHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).ViscTemps( Loop ) ) continue;
+			if ( GlycolData( GlycolIndex ).ViscTempGrid.NumCells > 0 ) {
+				Loop = FindTempGridUpperIndex( Temperature, GlycolData( GlycolIndex ).ViscTemps, GlycolData( GlycolIndex ).ViscTempGrid );
 				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).ViscTemps( Loop - 1 ), GlycolData( GlycolIndex ).ViscTemps( Loop ), GlycolData( GlycolIndex ).ViscValues( Loop - 1 ), GlycolData( GlycolIndex ).ViscValues( Loop ) );
-				break; // DO loop
+			} else {
+				for ( Loop = GlycolData( GlycolIndex ).ViscLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).ViscHighTempIndex; ++Loop ) {
+					if ( Temperature > GlycolData( GlycolIndex ).ViscTemps( Loop ) ) continue;
+					ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).ViscTemps( Loop - 1 ), GlycolData( GlycolIndex ).ViscTemps( Loop ), GlycolData( GlycolIndex ).ViscValues( Loop - 1 ), GlycolData( GlycolIndex ).ViscValues( Loop ) );
+					break; // DO loop
+				}
 			}
 		}
 
@@ -65,6 +65,46 @@ namespace FluidProperties {
 
 	// Types
 
+	struct FluidPropsTempGridData
+	{
+		// Members
+		// Uniform temperature cells over a property temperature list so the interpolation bracket
+		// can be found by direct indexing instead of a search
+		Real64 LowTemp; // temperature at the start of the first cell
+		Real64 InvCellWidth; // inverse of the uniform cell width
+		int NumCells; // number of uniform cells (0 if no grid has been built)
+		int FirstIndex; // smallest upper bracket index that may be returned
+		int LastIndex; // largest upper bracket index that may be returned
+		FArray1D_int CellIndex; // smallest upper bracket index whose temperature is >= the start of each cell
+
+		// Default Constructor
+		FluidPropsTempGridData() :
+			LowTemp( 0.0 ),
+			InvCellWidth( 0.0 ),
+			NumCells( 0 ),
+			FirstIndex( 0 ),
+			LastIndex( 0 )
+		{}
+
+		// Member Constructor
+		FluidPropsTempGridData(
+			Real64 const LowTemp, // temperature at the start of the first cell
+			Real64 const InvCellWidth, // inverse of the uniform cell width
+			int const NumCells, // number of uniform cells (0 if no grid has been built)
+			int const FirstIndex, // smallest upper bracket index that may be returned
+			int const LastIndex, // largest upper bracket index that may be returned
+			FArray1_int const & CellIndex // smallest upper bracket index whose temperature is >= the start of each cell
+		) :
+			LowTemp( LowTemp ),
+			InvCellWidth( InvCellWidth ),
+			NumCells( NumCells ),
+			FirstIndex( FirstIndex ),
+			LastIndex( LastIndex ),
+			CellIndex( CellIndex )
+		{}
+
+	};
+
 	struct FluidPropsRefrigerantData
 	{
 		// Members
@@ -80,6 +120,7 @@ namespace FluidProperties {
 		int PsHighPresIndex; // High Pressure Max Index for Ps (>0.0)
 		FArray1D< Real64 > PsTemps; // Temperatures for saturation pressures
 		FArray1D< Real64 > PsValues; // Saturation pressures at PsTemps
+		FluidPropsTempGridData PsTempGrid; // uniform cell index over PsTemps
 		int NumHPoints; // Number of enthalpy points
 		Real64 HfLowTempValue; // Low Temperature Value for Hf (>0.0)
 		Real64 HfHighTempValue; // High Temperature Value for Hf (max in tables)
@@ -120,6 +161,8 @@ namespace FluidProperties {
 		int NumSuperPressPts; // Number of pressure points for superheated enthalpy
 		FArray1D< Real64 > SHTemps; // Temperatures for superheated gas
 		FArray1D< Real64 > SHPress; // Pressures for superheated gas
+		FluidPropsTempGridData SHTempGrid; // uniform cell index over SHTemps
+		FluidPropsTempGridData SHPressGrid; // uniform cell index over SHPress
 		FArray2D< Real64 > HshValues; // Enthalpy of superheated gas at HshTemps, HshPress
 		FArray2D< Real64 > RhoshValues; // Density of superheated gas at HshTemps, HshPress
 
@@ -179,6 +222,7 @@ namespace FluidProperties {
 			int const PsHighPresIndex, // High Pressure Max Index for Ps (>0.0)
 			FArray1< Real64 > const & PsTemps, // Temperatures for saturation pressures
 			FArray1< Real64 > const & PsValues, // Saturation pressures at PsTemps
+			FluidPropsTempGridData const & PsTempGrid, // uniform cell index over PsTemps
 			int const NumHPoints, // Number of enthalpy points
 			Real64 const HfLowTempValue, // Low Temperature Value for Hf (>0.0)
 			Real64 const HfHighTempValue, // High Temperature Value for Hf (max in tables)
@@ -219,6 +263,8 @@ namespace FluidProperties {
 			int const NumSuperPressPts, // Number of pressure points for superheated enthalpy
 			FArray1< Real64 > const & SHTemps, // Temperatures for superheated gas
 			FArray1< Real64 > const & SHPress, // Pressures for superheated gas
+			FluidPropsTempGridData const & SHTempGrid, // uniform cell index over SHTemps
+			FluidPropsTempGridData const & SHPressGrid, // uniform cell index over SHPress
 			FArray2< Real64 > const & HshValues, // Enthalpy of superheated gas at HshTemps, HshPress
 			FArray2< Real64 > const & RhoshValues // Density of superheated gas at HshTemps, HshPress
 		) :
@@ -234,6 +280,7 @@ namespace FluidProperties {
 			PsHighPresIndex( PsHighPresIndex ),
 			PsTemps( PsTemps ),
 			PsValues( PsValues ),
+			PsTempGrid( PsTempGrid ),
 			NumHPoints( NumHPoints ),
 			HfLowTempValue( HfLowTempValue ),
 			HfHighTempValue( HfHighTempValue ),
@@ -274,6 +321,8 @@ namespace FluidProperties {
 			NumSuperPressPts( NumSuperPressPts ),
 			SHTemps( SHTemps ),
 			SHPress( SHPress ),
+			SHTempGrid( SHTempGrid ),
+			SHPressGrid( SHPressGrid ),
 			HshValues( HshValues ),
 			RhoshValues( RhoshValues )
 		{}
@@ -399,6 +448,7 @@ namespace FluidProperties {
 		int NumCpTempPts; // Number of temperature points for specific heat
 		FArray1D< Real64 > CpTemps; // Temperatures for specific heat of glycol
 		FArray1D< Real64 > CpValues; // Specific heat data values (J/kg-K)
+		FluidPropsTempGridData CpTempGrid; // uniform cell index over CpTemps
 		bool RhoDataPresent; // Flag set when density data is available
 		int NumRhoTempPts; // Number of temperature points for density
 		Real64 RhoLowTempValue; // Low Temperature Value for Rho (>0.0)
@@ -407,6 +457,7 @@ namespace FluidProperties {
 		int RhoHighTempIndex; // High Temperature Max Index for Rho (>0.0)
 		FArray1D< Real64 > RhoTemps; // Temperatures for density of glycol
 		FArray1D< Real64 > RhoValues; // Density data values (kg/m3)
+		FluidPropsTempGridData RhoTempGrid; // uniform cell index over RhoTemps
 		bool CondDataPresent; // Flag set when conductivity data is available
 		int NumCondTempPts; // Number of temperature points for conductivity
 		Real64 CondLowTempValue; // Low Temperature Value for Cond (>0.0)
@@ -415,6 +466,7 @@ namespace FluidProperties {
 		int CondHighTempIndex; // High Temperature Max Index for Cond (>0.0)
 		FArray1D< Real64 > CondTemps; // Temperatures for conductivity of glycol
 		FArray1D< Real64 > CondValues; // conductivity values (W/m-K)
+		FluidPropsTempGridData CondTempGrid; // uniform cell index over CondTemps
 		bool ViscDataPresent; // Flag set when viscosity data is available
 		int NumViscTempPts; // Number of temperature points for viscosity
 		Real64 ViscLowTempValue; // Low Temperature Value for Visc (>0.0)
@@ -423,6 +475,7 @@ namespace FluidProperties {
 		int ViscHighTempIndex; // High Temperature Max Index for Visc (>0.0)
 		FArray1D< Real64 > ViscTemps; // Temperatures for viscosity of glycol
 		FArray1D< Real64 > ViscValues; // viscosity values (mPa-s)
+		FluidPropsTempGridData ViscTempGrid; // uniform cell index over ViscTemps
 
 		// Default Constructor
 		FluidPropsGlycolData() :
@@ -468,6 +521,7 @@ namespace FluidProperties {
 			int const NumCpTempPts, // Number of temperature points for specific heat
 			FArray1< Real64 > const & CpTemps, // Temperatures for specific heat of glycol
 			FArray1< Real64 > const & CpValues, // Specific heat data values (J/kg-K)
+			FluidPropsTempGridData const & CpTempGrid, // uniform cell index over CpTemps
 			bool const RhoDataPresent, // Flag set when density data is available
 			int const NumRhoTempPts, // Number of temperature points for density
 			Real64 const RhoLowTempValue, // Low Temperature Value for Rho (>0.0)
@@ -476,6 +530,7 @@ namespace FluidProperties {
 			int const RhoHighTempIndex, // High Temperature Max Index for Rho (>0.0)
 			FArray1< Real64 > const & RhoTemps, // Temperatures for density of glycol
 			FArray1< Real64 > const & RhoValues, // Density data values (kg/m3)
+			FluidPropsTempGridData const & RhoTempGrid, // uniform cell index over RhoTemps
 			bool const CondDataPresent, // Flag set when conductivity data is available
 			int const NumCondTempPts, // Number of temperature points for conductivity
 			Real64 const CondLowTempValue, // Low Temperature Value for Cond (>0.0)
@@ -484,6 +539,7 @@ namespace FluidProperties {
 			int const CondHighTempIndex, // High Temperature Max Index for Cond (>0.0)
 			FArray1< Real64 > const & CondTemps, // Temperatures for conductivity of glycol
 			FArray1< Real64 > const & CondValues, // conductivity values (W/m-K)
+			FluidPropsTempGridData const & CondTempGrid, // uniform cell index over CondTemps
 			bool const ViscDataPresent, // Flag set when viscosity data is available
 			int const NumViscTempPts, // Number of temperature points for viscosity
 			Real64 const ViscLowTempValue, // Low Temperature Value for Visc (>0.0)
@@ -491,7 +547,8 @@ namespace FluidProperties {
 			int const ViscLowTempIndex, // Low Temperature Min Index for Visc (>0.0)
 			int const ViscHighTempIndex, // High Temperature Max Index for Visc (>0.0)
 			FArray1< Real64 > const & ViscTemps, // Temperatures for viscosity of glycol
-			FArray1< Real64 > const & ViscValues // viscosity values (mPa-s)
+			FArray1< Real64 > const & ViscValues, // viscosity values (mPa-s)
+			FluidPropsTempGridData const & ViscTempGrid // uniform cell index over ViscTemps
 		) :
 			Name( Name ),
 			GlycolName( GlycolName ),
@@ -505,6 +562,7 @@ namespace FluidProperties {
 			NumCpTempPts( NumCpTempPts ),
 			CpTemps( CpTemps ),
 			CpValues( CpValues ),
+			CpTempGrid( CpTempGrid ),
 			RhoDataPresent( RhoDataPresent ),
 			NumRhoTempPts( NumRhoTempPts ),
 			RhoLowTempValue( RhoLowTempValue ),
@@ -513,6 +571,7 @@ namespace FluidProperties {
 			RhoHighTempIndex( RhoHighTempIndex ),
 			RhoTemps( RhoTemps ),
 			RhoValues( RhoValues ),
+			RhoTempGrid( RhoTempGrid ),
 			CondDataPresent( CondDataPresent ),
 			NumCondTempPts( NumCondTempPts ),
 			CondLowTempValue( CondLowTempValue ),
@@ -521,6 +580,7 @@ namespace FluidProperties {
 			CondHighTempIndex( CondHighTempIndex ),
 			CondTemps( CondTemps ),
 			CondValues( CondValues ),
+			CondTempGrid( CondTempGrid ),
 			ViscDataPresent( ViscDataPresent ),
 			NumViscTempPts( NumViscTempPts ),
 			ViscLowTempValue( ViscLowTempValue ),
@@ -528,7 +588,8 @@ namespace FluidProperties {
 			ViscLowTempIndex( ViscLowTempIndex ),
 			ViscHighTempIndex( ViscHighTempIndex ),
 			ViscTemps( ViscTemps ),
-			ViscValues( ViscValues )
+			ViscValues( ViscValues ),
+			ViscTempGrid( ViscTempGrid )
 		{}
 
 	};
@@ -777,6 +838,41 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeTempGrid(
+		FArray1< Real64 > const & Temps, // temperature list (ascending)
+		int const FirstIndex, // smallest upper bracket index that may be returned
+		int const LastIndex, // largest upper bracket index that may be returned
+		FluidPropsTempGridData & Grid // uniform cell index built over Temps
+	);
+
+	//*****************************************************************************
+
+	void
+	InitializeFluidTempGrids();
+
+	//*****************************************************************************
+
+	int
+	FindTempGridUpperIndex(
+		Real64 const Temperature, // temperature to bracket
+		FArray1< Real64 > const & Temps, // temperature list (ascending)
+		FluidPropsTempGridData const & Grid // uniform cell index built over Temps
+	);
+
+	//*****************************************************************************
+
+	int
+	FindGridArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		FArray1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsTempGridData const & Grid // uniform cell index built over Array(LowBound) to Array(UpperBound)
+	);
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols();
 
@@ -331,6 +331,7 @@ namespace GroundHeatExchangers {
 				VerticalGlhe( I ).QnMonthlyAgg = 0.0;
 				VerticalGlhe( I ).QnSubHr = 0.0;
 				VerticalGlhe( I ).LastHourN = 1;
+				VerticalGlhe( I ).HistoryN = 0;
 			}
 			N = 1;
 			UpdateCurSimTime = false;
@@ -390,8 +391,13 @@ namespace GroundHeatExchangers {
 				ToutNew = Tground - tmpQnSubHourly * ( GfuncVal / ( K_Ground_Factor ) + ResistanceBhole - C_1 );
 			}
 		} else {
-			// no monthly super position
-			if ( CurrentSimTime < ( HrsPerMonth + AGG + SubAGG ) ) {
+			if ( VerticalGlhe( GlheNum ).HistoryN == N && VerticalGlhe( GlheNum ).HistoryTime == CurrentSimTime ) {
+				// The load history has not changed since the last call in this time step (e.g. another plant
+				// iteration), so reuse its superposition rather than re-evaluating every history term
+				SumTotal = VerticalGlhe( GlheNum ).HistorySumTotal;
+				RQSubHr = VerticalGlhe( GlheNum ).HistoryRQSubHr;
+
+			} else if ( CurrentSimTime < ( HrsPerMonth + AGG + SubAGG ) ) { // no monthly super position
 
 				// Calculate the Sub Hourly Superposition
 				SumQnSubHourly = 0.0;
@@ -438,9 +444,7 @@ namespace GroundHeatExchangers {
 						SumQnHourly += VerticalGlhe( GlheNum ).QnHr( I ) * RQHour;
 						goto HOURLY_LOOP_exit;
 					}
-					XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
-					INTERP( GlheNum, XI, GfuncVal );
-					RQHour = GfuncVal / ( K_Ground_Factor );
+					RQHour = HourlyResponseFactor( GlheNum, I, TimeSS_Factor, K_Ground_Factor );
 					SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnHr( I + 1 ) ) * RQHour;
 					HOURLY_LOOP_loop: ;
 				}
@@ -454,21 +458,6 @@ namespace GroundHeatExchangers {
 				INTERP( GlheNum, XI, GfuncVal );
 				RQSubHr = GfuncVal / ( K_Ground_Factor );
 
-				if ( MDotActual <= 0.0 ) {
-					tmpQnSubHourly = 0.0;
-					FluidAveTemp = Tground - SumTotal; // Q(N)*RB = 0
-					ToutNew = GlheInletTemp;
-				} else {
-					//Dr.Spitler's Explicit set of equations to calculate the New Outlet Temperature of the U-Tube
-					C0 = RQSubHr;
-					C1 = Tground - ( SumTotal - VerticalGlhe( GlheNum ).QnSubHr( 1 ) * RQSubHr );
-					C2 = BholeLength * NumBholes / ( 2.0 * MDotActual * Cp_Fluid );
-					C3 = MDotActual * Cp_Fluid / ( BholeLength * NumBholes );
-					tmpQnSubHourly = ( C1 - GlheInletTemp ) / ( ResistanceBhole + C0 - C2 + ( 1 / C3 ) );
-					FluidAveTemp = C1 - ( C0 + ResistanceBhole ) * tmpQnSubHourly;
-					ToutNew = C1 + ( C2 - C0 - ResistanceBhole ) * tmpQnSubHourly;
-				}
-
 			} else { // Monthly Aggregation and super position
 
 				NumOfMonths = ( CurrentSimTime + 1 ) / HrsPerMonth;
@@ -502,15 +491,11 @@ namespace GroundHeatExchangers {
 				SumQnHourly = 0.0;
 				HOURLYLOOP: for ( I = 1 + SubAGG; I <= HourlyLimit; ++I ) {
 					if ( I == HourlyLimit ) {
-						XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
-						INTERP( GlheNum, XI, GfuncVal );
-						RQHour = GfuncVal / ( K_Ground_Factor );
+						RQHour = HourlyResponseFactor( GlheNum, I, TimeSS_Factor, K_Ground_Factor );
 						SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnMonthlyAgg( CurrentMonth ) ) * RQHour;
 						goto HOURLYLOOP_exit;
 					}
-					XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
-					INTERP( GlheNum, XI, GfuncVal );
-					RQHour = GfuncVal / ( K_Ground_Factor );
+					RQHour = HourlyResponseFactor( GlheNum, I, TimeSS_Factor, K_Ground_Factor );
 					SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnHr( I + 1 ) ) * RQHour;
 					HOURLYLOOP_loop: ;
 				}
@@ -542,22 +527,27 @@ namespace GroundHeatExchangers {
 				XI = std::log( ( CurrentSimTime - PrevTimeSteps( 2 ) ) / ( TimeSS_Factor ) );
 				INTERP( GlheNum, XI, GfuncVal );
 				RQSubHr = GfuncVal / ( K_Ground_Factor );
-
-				if ( MDotActual <= 0.0 ) {
-					tmpQnSubHourly = 0.0;
-					FluidAveTemp = Tground - SumTotal; // Q(N)*RB = 0
-					ToutNew = GlheInletTemp;
-				} else {
-					// Explicit set of equations to calculate the New Outlet Temperature of the U-Tube
-					C0 = RQSubHr;
-					C1 = Tground - ( SumTotal - VerticalGlhe( GlheNum ).QnSubHr( 1 ) * RQSubHr );
-					C2 = BholeLength * NumBholes / ( 2 * MDotActual * Cp_Fluid );
-					C3 = MDotActual * Cp_Fluid / ( BholeLength * NumBholes );
-					tmpQnSubHourly = ( C1 - GlheInletTemp ) / ( ResistanceBhole + C0 - C2 + ( 1 / C3 ) );
-					FluidAveTemp = C1 - ( C0 + ResistanceBhole ) * tmpQnSubHourly;
-					ToutNew = C1 + ( C2 - C0 - ResistanceBhole ) * tmpQnSubHourly;
-				}
 			} //  end of AGG OR NO AGG
+
+			VerticalGlhe( GlheNum ).HistoryTime = CurrentSimTime;
+			VerticalGlhe( GlheNum ).HistoryN = N;
+			VerticalGlhe( GlheNum ).HistorySumTotal = SumTotal;
+			VerticalGlhe( GlheNum ).HistoryRQSubHr = RQSubHr;
+
+			if ( MDotActual <= 0.0 ) {
+				tmpQnSubHourly = 0.0;
+				FluidAveTemp = Tground - SumTotal; // Q(N)*RB = 0
+				ToutNew = GlheInletTemp;
+			} else {
+				//Dr.Spitler's Explicit set of equations to calculate the New Outlet Temperature of the U-Tube
+				C0 = RQSubHr;
+				C1 = Tground - ( SumTotal - VerticalGlhe( GlheNum ).QnSubHr( 1 ) * RQSubHr );
+				C2 = BholeLength * NumBholes / ( 2.0 * MDotActual * Cp_Fluid );
+				C3 = MDotActual * Cp_Fluid / ( BholeLength * NumBholes );
+				tmpQnSubHourly = ( C1 - GlheInletTemp ) / ( ResistanceBhole + C0 - C2 + ( 1 / C3 ) );
+				FluidAveTemp = C1 - ( C0 + ResistanceBhole ) * tmpQnSubHourly;
+				ToutNew = C1 + ( C2 - C0 - ResistanceBhole ) * tmpQnSubHourly;
+			}
 		} // end of N  = 1 branch
 		GlheBoreholeTemp = Tground - SumTotal; //Autodesk:Uninit SumTotal could have been uninitialized here
 		//Load the QnSubHourly Array with a new value at end of every timestep
@@ -805,6 +795,15 @@ namespace GroundHeatExchangers {
 			VerticalGlhe( GlheNum ).QnSubHr = 0.0;
 			VerticalGlhe( GlheNum ).LastHourN.allocate( VerticalGlhe( GlheNum ).SubAGG + 1 );
 			VerticalGlhe( GlheNum ).LastHourN = 0;
+			// One hourly response slot for each possible time step position within the hour
+			VerticalGlhe( GlheNum ).HourlyResponse.dimension( VerticalGlhe( GlheNum ).QnHr.isize(), MaxTSinHr, 0.0 );
+			VerticalGlhe( GlheNum ).HourlyResponseFrac.dimension( MaxTSinHr, 0.0 );
+			VerticalGlhe( GlheNum ).HourlyResponseCount.dimension( MaxTSinHr, 0 );
+
+			// The g-functions are for the reference radius to length ratio; correct for the actual ratio
+			if ( VerticalGlhe( GlheNum ).BoreholeRadius / VerticalGlhe( GlheNum ).BoreholeLength != VerticalGlhe( GlheNum ).gReferenceRatio ) {
+				VerticalGlhe( GlheNum ).GfuncCorrection = std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * VerticalGlhe( GlheNum ).gReferenceRatio ) );
+			}
 
 			if ( ! Allocated ) {
 				PrevTimeSteps.allocate( ( VerticalGlhe( GlheNum ).SubAGG + 1 ) * MaxTSinHr + 1 );
@@ -1020,8 +1019,6 @@ namespace GroundHeatExchangers {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int NumPairs;
-		Real64 RATIO;
-		Real64 ReferenceRatio;
 
 		//Binary Search Algorithms Variables
 		// REFERENCE      :  DATA STRUCTURES AND ALGORITHM ANALYSIS IN C BY MARK ALLEN WEISS
@@ -1031,8 +1028,6 @@ namespace GroundHeatExchangers {
 		bool Found;
 
 		NumPairs = VerticalGlhe( GlheNum ).NPairs;
-		RATIO = VerticalGlhe( GlheNum ).BoreholeRadius / VerticalGlhe( GlheNum ).BoreholeLength;
-		ReferenceRatio = VerticalGlhe( GlheNum ).gReferenceRatio;
 
 		// The following IF loop determines the g-function for the case
 		// when LnTTsVal is less than the first element of the LnTTs array.
@@ -1041,14 +1036,11 @@ namespace GroundHeatExchangers {
 		if ( LnTTsVal <= VerticalGlhe( GlheNum ).LNTTS( 1 ) ) {
 			GfuncVal = ( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( 1 ) ) / ( VerticalGlhe( GlheNum ).LNTTS( 2 ) - VerticalGlhe( GlheNum ).LNTTS( 1 ) ) ) * ( VerticalGlhe( GlheNum ).GFNC( 2 ) - VerticalGlhe( GlheNum ).GFNC( 1 ) ) + VerticalGlhe( GlheNum ).GFNC( 1 );
 
-			// The following IF statement determines the condition of the ratio
-			// between the borehole radius and the active borehole length.
-			// If RATIO does not equal 0.0005 then a correction factor for
-			// the g-function must be used.
+			// If the ratio between the borehole radius and the active borehole
+			// length differs from the reference ratio then a correction factor
+			// for the g-function must be used (precomputed in GetInput).
 
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
+			GfuncVal -= VerticalGlhe( GlheNum ).GfuncCorrection;
 
 			return;
 		}
@@ -1061,9 +1053,7 @@ namespace GroundHeatExchangers {
 			GfuncVal = ( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( NumPairs ) ) / ( VerticalGlhe( GlheNum ).LNTTS( NumPairs - 1 ) - VerticalGlhe( GlheNum ).LNTTS( NumPairs ) ) ) * ( VerticalGlhe( GlheNum ).GFNC( NumPairs - 1 ) - VerticalGlhe( GlheNum ).GFNC( NumPairs ) ) + VerticalGlhe( GlheNum ).GFNC( NumPairs );
 
 			// Apply correction factor if necessary
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
+			GfuncVal -= VerticalGlhe( GlheNum ).GfuncCorrection;
 
 			return;
 		}
@@ -1096,9 +1086,7 @@ namespace GroundHeatExchangers {
 		if ( Found ) {
 			GfuncVal = VerticalGlhe( GlheNum ).GFNC( Mid );
 			// Apply correction factor if necessary
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
+			GfuncVal -= VerticalGlhe( GlheNum ).GfuncCorrection;
 			return;
 		}
 
@@ -1110,15 +1098,88 @@ namespace GroundHeatExchangers {
 			GfuncVal = ( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( Mid ) ) / ( VerticalGlhe( GlheNum ).LNTTS( Mid - 1 ) - VerticalGlhe( GlheNum ).LNTTS( Mid ) ) ) * ( VerticalGlhe( GlheNum ).GFNC( Mid - 1 ) - VerticalGlhe( GlheNum ).GFNC( Mid ) ) + VerticalGlhe( GlheNum ).GFNC( Mid );
 
 			// Apply correction factor if necessary
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
+			GfuncVal -= VerticalGlhe( GlheNum ).GfuncCorrection;
 			return;
 		}
 	}
 
 	//******************************************************************************
 
+	Real64
+	HourlyResponseFactor(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		int const HourOffset, // Whole hours between the start of the hourly load block and now
+		Real64 const TimeSS_Factor, // Steady state time factor [hr]
+		Real64 const K_Ground_Factor // 2*pi times the ground conductivity [W/(mK)]
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the response factor g/(2*pi*k) to an hourly load block that started
+		// HourOffset whole hours before the start of the current hour.
+
+		// METHODOLOGY EMPLOYED:
+		// The hourly superposition evaluates the g-function at the elapsed times
+		// (fraction of the current hour + HourOffset), which depend only on where the
+		// current time step sits within the hour.  The interpolated response factors are
+		// saved per borefield in one slot per distinct hour fraction, filled on demand,
+		// so each offset is interpolated once rather than on every time step of the run.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		Real64 RQHour;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 HourFrac; // Elapsed fraction of the current hour
+		Real64 XI;
+		Real64 GfuncVal;
+		int Slot;
+		int I;
+
+		HourFrac = CurrentSimTime - int( CurrentSimTime );
+
+		Slot = VerticalGlhe( GlheNum ).HourlyResponseSlot;
+		if ( Slot == 0 || VerticalGlhe( GlheNum ).HourlyResponseFrac( Slot ) != HourFrac ) {
+			Slot = 0;
+			for ( I = 1; I <= MaxTSinHr; ++I ) {
+				if ( VerticalGlhe( GlheNum ).HourlyResponseCount( I ) > 0 && VerticalGlhe( GlheNum ).HourlyResponseFrac( I ) == HourFrac ) {
+					Slot = I;
+					break;
+				}
+			}
+			if ( Slot == 0 ) { // reuse the slots in turn (only reached with variable system time steps)
+				Slot = mod( VerticalGlhe( GlheNum ).HourlyResponseSlot, MaxTSinHr ) + 1;
+				VerticalGlhe( GlheNum ).HourlyResponseFrac( Slot ) = HourFrac;
+				VerticalGlhe( GlheNum ).HourlyResponseCount( Slot ) = 0;
+			}
+			VerticalGlhe( GlheNum ).HourlyResponseSlot = Slot;
+		}
+
+		for ( I = VerticalGlhe( GlheNum ).HourlyResponseCount( Slot ) + 1; I <= HourOffset; ++I ) {
+			XI = std::log( ( HourFrac + I ) / ( TimeSS_Factor ) );
+			INTERP( GlheNum, XI, GfuncVal );
+			VerticalGlhe( GlheNum ).HourlyResponse( I, Slot ) = GfuncVal / ( K_Ground_Factor );
+		}
+		VerticalGlhe( GlheNum ).HourlyResponseCount( Slot ) = max( VerticalGlhe( GlheNum ).HourlyResponseCount( Slot ), HourOffset );
+
+		RQHour = VerticalGlhe( GlheNum ).HourlyResponse( HourOffset, Slot );
+		return RQHour;
+
+	}
+
+	//******************************************************************************
+
 	void
 	InitBoreholeHXSimVars(
 		int const GlheNum,
@@ -1207,6 +1268,7 @@ namespace GroundHeatExchangers {
 			VerticalGlhe( GlheNum ).QnMonthlyAgg = 0.0;
 			VerticalGlhe( GlheNum ).QnSubHr = 0.0;
 			VerticalGlhe( GlheNum ).LastHourN = 0;
+			VerticalGlhe( GlheNum ).HistoryN = 0;
 			PrevTimeSteps = 0.0;
 			CurrentSimTime = 0.0;
 		}
@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -84,6 +85,15 @@ namespace GroundHeatExchangers {
 		int SubAGG; // Minimum subhourly History
 		FArray1D_int LastHourN; // Stores the Previous hour's N for past hours
 		// until the minimum subhourly history
+		Real64 GfuncCorrection; // Correction subtracted from the g-function for the actual radius to length ratio
+		FArray2D< Real64 > HourlyResponse; // Hourly response factors g/(2*pi*k) by hour offset and response slot [K per W/m]
+		FArray1D< Real64 > HourlyResponseFrac; // Fraction of the hour each response slot was evaluated at
+		FArray1D_int HourlyResponseCount; // Number of hour offsets evaluated in each response slot
+		int HourlyResponseSlot; // Response slot most recently filled
+		Real64 HistoryTime; // Simulation time of the saved load history superposition [hr]
+		int HistoryN; // Time step counter of the saved load history superposition
+		Real64 HistorySumTotal; // Saved temperature difference due to all past load blocks
+		Real64 HistoryRQSubHr; // Saved response factor to the last time step's load
 		//loop topology variables
 		int LoopNum;
 		int LoopSideNum;
@@ -115,6 +125,12 @@ namespace GroundHeatExchangers {
 			NPairs( 0 ),
 			AGG( 0 ),
 			SubAGG( 0 ),
+			GfuncCorrection( 0.0 ),
+			HourlyResponseSlot( 0 ),
+			HistoryTime( 0.0 ),
+			HistoryN( 0 ),
+			HistorySumTotal( 0.0 ),
+			HistoryRQSubHr( 0.0 ),
 			LoopNum( 0 ),
 			LoopSideNum( 0 ),
 			BranchNum( 0 ),
@@ -153,6 +169,15 @@ namespace GroundHeatExchangers {
 			int const AGG, // Minimum Hourly Histroy required
 			int const SubAGG, // Minimum subhourly History
 			FArray1_int const & LastHourN, // Stores the Previous hour's N for past hours
+			Real64 const GfuncCorrection, // Correction subtracted from the g-function for the actual radius to length ratio
+			FArray2< Real64 > const & HourlyResponse, // Hourly response factors g/(2*pi*k) by hour offset and response slot [K per W/m]
+			FArray1< Real64 > const & HourlyResponseFrac, // Fraction of the hour each response slot was evaluated at
+			FArray1_int const & HourlyResponseCount, // Number of hour offsets evaluated in each response slot
+			int const HourlyResponseSlot, // Response slot most recently filled
+			Real64 const HistoryTime, // Simulation time of the saved load history superposition [hr]
+			int const HistoryN, // Time step counter of the saved load history superposition
+			Real64 const HistorySumTotal, // Saved temperature difference due to all past load blocks
+			Real64 const HistoryRQSubHr, // Saved response factor to the last time step's load
 			int const LoopNum,
 			int const LoopSideNum,
 			int const BranchNum,
@@ -188,6 +213,15 @@ namespace GroundHeatExchangers {
 			AGG( AGG ),
 			SubAGG( SubAGG ),
 			LastHourN( LastHourN ),
+			GfuncCorrection( GfuncCorrection ),
+			HourlyResponse( HourlyResponse ),
+			HourlyResponseFrac( HourlyResponseFrac ),
+			HourlyResponseCount( HourlyResponseCount ),
+			HourlyResponseSlot( HourlyResponseSlot ),
+			HistoryTime( HistoryTime ),
+			HistoryN( HistoryN ),
+			HistorySumTotal( HistorySumTotal ),
+			HistoryRQSubHr( HistoryRQSubHr ),
 			LoopNum( LoopNum ),
 			LoopSideNum( LoopSideNum ),
 			BranchNum( BranchNum ),
@@ -285,6 +319,16 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	Real64
+	HourlyResponseFactor(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		int const HourOffset, // Whole hours between the start of the hourly load block and now
+		Real64 const TimeSS_Factor, // Steady state time factor [hr]
+		Real64 const K_Ground_Factor // 2*pi times the ground conductivity [W/(mK)]
+	);
+
+	//******************************************************************************
+
 	void
 	InitBoreholeHXSimVars(
 		int const GlheNum,
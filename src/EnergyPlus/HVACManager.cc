@@ -1,6 +1,7 @@
 // C++ Headers
 #include <cmath>
 #include <string>
+#include <unordered_map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -14,6 +15,8 @@
 //#include <CoolTower.hh>
 #include <DataAirflowNetwork.hh>
 #include <DataAirLoop.hh>
+#include <DataAirSystems.hh>
+#include <DataBranchNodeConnections.hh>
 #include <DataContaminantBalance.hh>
 #include <DataConvergParams.hh>
 #include <DataEnvironment.hh>
@@ -37,6 +40,7 @@
 #include <General.hh>
 #include <HVACStandAloneERV.hh>
 #include <IceThermalStorage.hh>
+#include <InputProcessor.hh>
 #include <InternalHeatGains.hh>
 #include <ManageElectricPower.hh>
 #include <NodeInputManager.hh>
@@ -142,6 +146,9 @@ namespace HVACManager {
 
 	int HVACManageIteration( 0 ); // counts iterations to enforce maximum iteration limit
 	int RepIterAir( 0 );
+	int NumLoopConcurrencyGroups( 0 ); // number of independent groups of air loops and plant loops
+	FArray1D_int AirLoopConcurrencyGroup; // independent group number for each primary air system
+	FArray1D_int PlantLoopConcurrencyGroup; // independent group number for each plant and condenser loop
 
 	//FArray1D_bool CrossMixingReportFlag; // TRUE when Cross Mixing is active based on controls
 	//FArray1D_bool MixingReportFlag; // TRUE when Mixing is active based on controls
@@ -601,6 +608,7 @@ namespace HVACManager {
 		using PlantUtilities::CheckForRunawayPlantTemps;
 		using PlantUtilities::AnyPlantSplitterMixerLacksContinuity;
 		using DataGlobals::AnyPlantInModel;
+		using DataSystemVariables::ReportLoopGroups;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -624,6 +632,7 @@ namespace HVACManager {
 		static bool IterSetup( false ); // Set to TRUE after the variable is setup for Output Reporting
 		static int ErrCount( 0 ); // Number of times that the maximum iterations was exceeded
 		static bool MySetPointInit( true );
+		static bool LoopGroupsSetup( false ); // Set to TRUE after the loop concurrency groups are found and reported
 		std::string CharErrOut; // a character string equivalent of ErrCount
 		int que;
 		static int MaxErrCount( 0 );
@@ -742,6 +751,13 @@ namespace HVACManager {
 		// Manages the various component simulations
 		SimSelectedEquipment( SimAirLoopsFlag, SimZoneEquipmentFlag, SimNonZoneEquipmentFlag, SimPlantLoopsFlag, SimElecCircuitsFlag, FirstHVACIteration, SimWithPlantFlowUnlocked );
 
+		// The air loop and zone equipment input is read during the first call above, so the loop dependencies can be found now
+		if ( ReportLoopGroups && ! LoopGroupsSetup && AirLoopInputsFilled ) {
+			SetupLoopConcurrencyGroups();
+			ReportLoopConcurrencyGroups();
+			LoopGroupsSetup = true;
+		}
+
 		// Eventually, when all of the flags are set to false, the
 		// simulation has converged for this system time step.
 
@@ -2639,6 +2655,304 @@ namespace HVACManager {
 
 	}
 
+	void
+	SetupLoopConcurrencyGroups()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the dependency graph between primary air systems and plant/condenser loops
+		// and splits it into groups that share no loop-level state, i.e. sets of loops that
+		// could be simulated independently of every other group within an HVAC iteration.
+		// This is an analysis only: the loops are still simulated in their usual serial order.
+		// The groups are not run concurrently because the component models keep their state in
+		// module variables and function statics that are shared across loops (for example the
+		// fluid property error counters, the curve and schedule managers and the node arrays).
+
+		// METHODOLOGY EMPLOYED:
+		// Union-find over NumPrimaryAirSys + TotNumLoops + NumOfZones entries.  Entries are joined when
+		//  - two plant loop sides are interconnected (LoopSide%Connected, e.g. chillers, heat exchangers),
+		//  - an air loop serves a controlled zone (cooled or heated), so air loops serving the same
+		//    zone are joined through the zone,
+		//  - a plant loop component belongs to an air loop or to the zone equipment of a zone, directly
+		//    or through its parents in the component sets (coils in unitary systems, outdoor air
+		//    systems, air terminal units and zone HVAC units).
+		// The zone entries only link loops; they are not numbered as groups.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataAirSystems::PrimaryAirSystem;
+		using DataBranchNodeConnections::CompSets;
+		using DataBranchNodeConnections::NumCompSets;
+		using DataPlant::DemandSide;
+		using DataPlant::PlantLoop;
+		using DataPlant::SupplySide;
+		using DataPlant::TotNumLoops;
+		using DataZoneEquipment::ZoneEquipConfig;
+		using DataZoneEquipment::ZoneEquipList;
+		using InputProcessor::MakeUPPERCase;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumLoopItems; // number of air loop and plant loop entries in the graph
+		int NumItems; // number of entries in the graph, including the zones
+		int AirLoopNum;
+		int LoopNum;
+		int LoopSideNum;
+		int BranchNum;
+		int CompNum;
+		int ConnNum;
+		int ZoneNum;
+		int CompSetNum;
+		int EquipNum;
+		int Item;
+		int OwnerItem; // air loop or zone entry that owns a plant component
+		int Level;
+		int Root;
+		std::string CompKey; // upper case "type:name" of a component being traced to an air loop or zone
+		FArray1D_int GroupParent; // union-find parent of each entry
+		FArray1D_int GroupOfRoot; // group number assigned to each union-find root
+		std::unordered_map< std::string, int > OwnerOfComp; // air loop or zone entry of each air loop component and zone equipment (upper case "type:name")
+		std::unordered_map< std::string, std::string > ParentOfComp; // parent of each child component in the component sets (upper case "type:name")
+
+		NumLoopItems = NumPrimaryAirSys + TotNumLoops;
+		NumItems = NumLoopItems + NumOfZones;
+		NumLoopConcurrencyGroups = 0;
+		AirLoopConcurrencyGroup.dimension( NumPrimaryAirSys, 0 );
+		PlantLoopConcurrencyGroup.dimension( TotNumLoops, 0 );
+		if ( NumLoopItems == 0 ) return;
+
+		GroupParent.allocate( NumItems );
+		for ( Item = 1; Item <= NumItems; ++Item ) GroupParent( Item ) = Item;
+
+		// Plant loops joined by interconnecting components
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			for ( LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+				auto const & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+				for ( ConnNum = 1; ConnNum <= loop_side.TotalConnected; ++ConnNum ) {
+					if ( loop_side.Connected( ConnNum ).LoopNum < 1 ) continue;
+					JoinLoopGroups( GroupParent, NumPrimaryAirSys + LoopNum, NumPrimaryAirSys + loop_side.Connected( ConnNum ).LoopNum );
+				}
+			}
+		}
+
+		// Air loops joined with the zones they serve
+		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			auto const & air_to_zone( AirToZoneNodeInfo( AirLoopNum ) );
+			for ( Item = 1; Item <= air_to_zone.NumZonesCooled + air_to_zone.NumZonesHeated; ++Item ) {
+				ZoneNum = ( Item <= air_to_zone.NumZonesCooled ) ? air_to_zone.CoolCtrlZoneNums( Item ) : air_to_zone.HeatCtrlZoneNums( Item - air_to_zone.NumZonesCooled );
+				if ( ZoneNum < 1 || ZoneNum > NumOfZones ) continue;
+				JoinLoopGroups( GroupParent, AirLoopNum, NumLoopItems + ZoneNum );
+			}
+		}
+
+		// Owners of the air loop components and branches, and of the zone equipment, keyed the same way as the component sets
+		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			for ( BranchNum = 1; BranchNum <= PrimaryAirSystem( AirLoopNum ).NumBranches; ++BranchNum ) {
+				auto const & branch( PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ) );
+				OwnerOfComp[ "BRANCH:" + MakeUPPERCase( branch.Name ) ] = AirLoopNum;
+				for ( CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+					OwnerOfComp[ MakeUPPERCase( branch.Comp( CompNum ).TypeOf ) + ':' + MakeUPPERCase( branch.Comp( CompNum ).Name ) ] = AirLoopNum;
+				}
+			}
+		}
+		for ( ZoneNum = 1; ZoneNum <= min( NumOfZones, isize( ZoneEquipConfig ), isize( ZoneEquipList ) ); ++ZoneNum ) {
+			if ( ! ZoneEquipConfig( ZoneNum ).IsControlled ) continue;
+			auto const & equip_list( ZoneEquipList( ZoneNum ) );
+			for ( EquipNum = 1; EquipNum <= equip_list.NumOfEquipTypes; ++EquipNum ) {
+				OwnerOfComp[ MakeUPPERCase( equip_list.EquipType( EquipNum ) ) + ':' + MakeUPPERCase( equip_list.EquipName( EquipNum ) ) ] = NumLoopItems + ZoneNum;
+			}
+		}
+
+		// Parent of each child component, from the first component set naming a parent
+		for ( CompSetNum = 1; CompSetNum <= NumCompSets; ++CompSetNum ) {
+			if ( CompSets( CompSetNum ).ParentCType == "UNDEFINED" ) continue;
+			ParentOfComp.insert( std::make_pair( MakeUPPERCase( CompSets( CompSetNum ).CType ) + ':' + MakeUPPERCase( CompSets( CompSetNum ).CName ), MakeUPPERCase( CompSets( CompSetNum ).ParentCType ) + ':' + MakeUPPERCase( CompSets( CompSetNum ).ParentCName ) ) );
+		}
+
+		// Plant loops joined with the air loop or zone owning each of their components
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			for ( LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+				auto const & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+				for ( BranchNum = 1; BranchNum <= loop_side.TotalBranches; ++BranchNum ) {
+					auto const & branch( loop_side.Branch( BranchNum ) );
+					for ( CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+						CompKey = MakeUPPERCase( branch.Comp( CompNum ).TypeOf ) + ':' + MakeUPPERCase( branch.Comp( CompNum ).Name );
+						OwnerItem = 0;
+						for ( Level = 0; Level <= NumCompSets; ++Level ) { // bounded walk up the parent chain
+							auto const owner( OwnerOfComp.find( CompKey ) );
+							if ( owner != OwnerOfComp.end() ) {
+								OwnerItem = owner->second;
+								break;
+							}
+							auto const parent( ParentOfComp.find( CompKey ) );
+							if ( parent == ParentOfComp.end() ) break;
+							CompKey = parent->second;
+						}
+						if ( OwnerItem > 0 ) JoinLoopGroups( GroupParent, OwnerItem, NumPrimaryAirSys + LoopNum );
+					}
+				}
+			}
+		}
+
+		// Number the groups in order of their first member so the numbering is deterministic
+		GroupOfRoot.dimension( NumItems, 0 );
+		for ( Item = 1; Item <= NumLoopItems; ++Item ) {
+			Root = FindLoopGroupRoot( GroupParent, Item );
+			if ( GroupOfRoot( Root ) == 0 ) GroupOfRoot( Root ) = ++NumLoopConcurrencyGroups;
+			if ( Item <= NumPrimaryAirSys ) {
+				AirLoopConcurrencyGroup( Item ) = GroupOfRoot( Root );
+			} else {
+				PlantLoopConcurrencyGroup( Item - NumPrimaryAirSys ) = GroupOfRoot( Root );
+			}
+		}
+
+	}
+
+	void
+	ReportLoopConcurrencyGroups()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the groups found by SetupLoopConcurrencyGroups to the eio file, so the loop
+		// coupling of a model can be inspected.  Nothing else uses the groups.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataAirSystems::PrimaryAirSystem;
+		using DataGlobals::OutputFileInits;
+		using DataPlant::PlantLoop;
+		using DataPlant::TotNumLoops;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int GroupNum;
+		int AirLoopNum;
+		int LoopNum;
+		int NumAirInGroup;
+		int NumPlantInGroup;
+		std::string GroupMembers; // list of loop names in a group for reporting
+
+		if ( NumLoopConcurrencyGroups == 0 ) return;
+
+		gio::write( OutputFileInits, fmtA ) << "! <Loop Concurrency Group>, Group Number, Number of Air Loops, Number of Plant Loops, Loop Names";
+		for ( GroupNum = 1; GroupNum <= NumLoopConcurrencyGroups; ++GroupNum ) {
+			NumAirInGroup = 0;
+			NumPlantInGroup = 0;
+			GroupMembers.clear();
+			for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+				if ( AirLoopConcurrencyGroup( AirLoopNum ) != GroupNum ) continue;
+				++NumAirInGroup;
+				GroupMembers += ',' + PrimaryAirSystem( AirLoopNum ).Name;
+			}
+			for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+				if ( PlantLoopConcurrencyGroup( LoopNum ) != GroupNum ) continue;
+				++NumPlantInGroup;
+				GroupMembers += ',' + PlantLoop( LoopNum ).Name;
+			}
+			gio::write( OutputFileInits, fmtA ) << " Loop Concurrency Group," + RoundSigDigits( GroupNum ) + ',' + RoundSigDigits( NumAirInGroup ) + ',' + RoundSigDigits( NumPlantInGroup ) + GroupMembers;
+		}
+
+	}
+
+	void
+	JoinLoopGroups(
+		FArray1_int & GroupParent, // union-find parent of each air loop, plant loop and zone
+		int const Item1, // first entry to join
+		int const Item2 // second entry to join
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Puts two entries of the loop dependency graph in the same group.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		GroupParent( FindLoopGroupRoot( GroupParent, Item1 ) ) = FindLoopGroupRoot( GroupParent, Item2 );
+
+	}
+
+	int
+	FindLoopGroupRoot(
+		FArray1_int & GroupParent, // union-find parent of each air loop, plant loop and zone
+		int const Item // air loop, plant loop or zone entry to find the root of
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the root entry of the loop group containing Item.
+
+		// METHODOLOGY EMPLOYED:
+		// Union-find root search with path halving.
+
+		// Return value
+		int Root;
+
+		Root = Item;
+		while ( GroupParent( Root ) != Root ) {
+			GroupParent( Root ) = GroupParent( GroupParent( Root ) );
+			Root = GroupParent( Root );
+		}
+		return Root;
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
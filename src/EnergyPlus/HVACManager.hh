@@ -20,6 +20,9 @@ namespace HVACManager {
 
 	extern int HVACManageIteration; // counts iterations to enforce maximum iteration limit
 	extern int RepIterAir;
+	extern int NumLoopConcurrencyGroups; // number of independent groups of air loops and plant loops
+	extern FArray1D_int AirLoopConcurrencyGroup; // independent group number for each primary air system
+	extern FArray1D_int PlantLoopConcurrencyGroup; // independent group number for each plant and condenser loop
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	// and zone equipment simulations
@@ -70,6 +73,25 @@ namespace HVACManager {
 	void
 	UpdateZoneInletConvergenceLog();
 
+	void
+	SetupLoopConcurrencyGroups();
+
+	void
+	ReportLoopConcurrencyGroups();
+
+	void
+	JoinLoopGroups(
+		FArray1_int & GroupParent, // union-find parent of each air loop, plant loop and zone
+		int const Item1, // first entry to join
+		int const Item2 // second entry to join
+	);
+
+	int
+	FindLoopGroupRoot(
+		FArray1_int & GroupParent, // union-find parent of each air loop, plant loop and zone
+		int const Item // air loop, plant loop or zone entry to find the root of
+	);
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -1,4 +1,5 @@
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -75,12 +76,20 @@ namespace HeatBalanceIntRadExchange {
 	static gio::Fmt fmtA( "(A)" );
 	static gio::Fmt fmtx( "(A,I4,1x,A,1x,6f16.8)" );
 	static gio::Fmt fmty( "(A,1x,6f16.8)" );
+	int const MaxScriptFCacheEntries( 8 ); // Script F matrices kept per zone (interior shade/blind configurations)
+	Real64 const StefanBoltzmannConst( 5.6697e-8 ); // Stefan-Boltzmann constant in W/(m2*K4)
 
 	// DERIVED TYPE DEFINITIONS
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
 	int MaxNumOfZoneSurfaces; // Max saved to get large enough space for user input view factors
+	int NumScriptFCacheHits( 0 ); // Script F recalculations served from the zone caches
+	int NumScriptFInverseUpdates( 0 ); // Script F recalculations done by a low rank update of the inverse
+	int NumScriptFInversions( 0 ); // Script F recalculations done by a full matrix inversion
+
+	// Object Data
+	FArray1D< ZoneScriptFCacheData > ZoneScriptFCache;
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceIntRadExchange
 
@@ -130,7 +139,6 @@ namespace HeatBalanceIntRadExchange {
 		// SUBROUTINE ARGUMENTS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const StefanBoltzmannConst( 5.6697e-8 ); // Stefan-Boltzmann constant in W/(m2*K4)
 		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
@@ -262,9 +270,8 @@ namespace HeatBalanceIntRadExchange {
 						}
 					}
 
-					CalcScriptF( n_zone_Surfaces, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_ScriptF );
-					// precalc - multiply by StefanBoltzmannConstant
-					zone_ScriptF *= StefanBoltzmannConst;
+					// ScriptF of this shade/blind configuration (multiplied by StefanBoltzmannConstant)
+					CalcZoneScriptF( ZoneNum );
 				}
 
 			} // End of check if SurfIterations = 0
@@ -453,6 +460,7 @@ namespace HeatBalanceIntRadExchange {
 		// FLOW:
 
 		ZoneInfo.allocate( NumOfZones ); // Allocate the entire derived type
+		ZoneScriptFCache.allocate( NumOfZones );
 
 		ScanForReports( "ViewFactorInfo", ViewFactorReport, _, Option1 );
 
@@ -499,6 +507,7 @@ namespace HeatBalanceIntRadExchange {
 				if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
 				++ZoneSurfNum;
 				ZoneInfo( ZoneNum ).SurfacePtr( ZoneSurfNum ) = SurfNum;
+				if ( Surface( SurfNum ).WindowShadingControlPtr > 0 ) ZoneScriptFCache( ZoneNum ).HasMovableShades = true;
 			}
 			// Initialize the area and emissivity arrays
 			for ( ZoneSurfNum = 1; ZoneSurfNum <= NumOfZoneSurfaces; ++ZoneSurfNum ) {
@@ -1241,7 +1250,7 @@ namespace HeatBalanceIntRadExchange {
 		//  A(i)*F(i,j)=A(j)*F(j,i); F(i,i)=0.; SUM(F(i,j)=1.0, j=1,N)
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const MaxEmissLimit( 0.99999 ); // Limit the emissivity internally/avoid a divide by zero error
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1265,6 +1274,161 @@ namespace HeatBalanceIntRadExchange {
 		++NumCalcScriptF_Calls;
 #endif
 
+		FArray2D< Real64 > Cinverse( N, N ); // Inverse of Cmatrix
+		CalcRadiosityInverse( N, A, F, EMISS, Cinverse );
+		CalcScriptFFromInverse( N, A, EMISS, Cinverse, ScriptF );
+
+	}
+
+	void
+	CalcZoneScriptF( int const ZoneNum ) // Zone number
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the ScriptF (multiplied by the Stefan-Boltzmann constant) of a zone for the inside
+		// surface emissivities in ZoneInfo, which change when interior shades or blinds are
+		// deployed or retracted.
+
+		// METHODOLOGY EMPLOYED:
+		// Emissivities above 0.99999 are limited first, so that cached configurations get the
+		// same limit and warning.  Zones without shading controls always have the same
+		// emissivities, so their ScriptF is calculated directly and nothing is cached.
+		// For the other zones the ScriptF of the most recently used emissivity sets (shade/blind configurations) of
+		// the zone are kept, up to MaxScriptFCacheEntries, and the least recently used one is
+		// replaced.  The emissivities themselves are the key, so a blind with a different slat
+		// angle is a different configuration.  A configuration not in the cache starts from the
+		// inverse of the radiosity coefficient matrix with all shades and blinds retracted:
+		// deploying shades only changes the diagonal terms of the windows, so the inverse is
+		// updated with the Sherman-Morrison-Woodbury formula instead of inverting the matrix
+		// again, unless many windows differ.
+
+		// REFERENCES:
+		// Golub, G. H. and C. F. Van Loan, Matrix Computations, 3rd ed., Sec 2.1.3, Johns Hopkins, 1996.
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MaxEmissLimit( 0.99999 ); // Limit the emissivity internally/avoid a divide by zero error (as CalcRadiosityInverse)
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		auto & zone_info( ZoneInfo( ZoneNum ) );
+		auto & zone_cache( ZoneScriptFCache( ZoneNum ) );
+		int const N( zone_info.NumOfSurfaces );
+		bool Same; // true if two emissivity sets are the same
+
+		for ( int ZoneSurfNum = 1; ZoneSurfNum <= N; ++ZoneSurfNum ) {
+			if ( zone_info.Emissivity( ZoneSurfNum ) > MaxEmissLimit ) { // Check/limit EMISS for this surface to avoid divide by zero below
+				zone_info.Emissivity( ZoneSurfNum ) = MaxEmissLimit;
+				ShowWarningError( "A thermal emissivity above 0.99999 was detected. This is not allowed. Value was reset to 0.99999" );
+			}
+		}
+
+		if ( ! zone_cache.HasMovableShades ) { // Configuration never changes
+			CalcScriptF( N, zone_info.Area, zone_info.F, zone_info.Emissivity, zone_info.ScriptF );
+			// precalc - multiply by StefanBoltzmannConstant
+			zone_info.ScriptF *= StefanBoltzmannConst;
+			++NumScriptFInversions;
+			return;
+		}
+
+		++zone_cache.UseCount;
+
+		// Configuration used before
+		for ( auto & entry : zone_cache.Entries ) {
+			Same = true;
+			for ( int ZoneSurfNum = 1; Same && ZoneSurfNum <= N; ++ZoneSurfNum ) {
+				Same = ( entry.Emissivity( ZoneSurfNum ) == zone_info.Emissivity( ZoneSurfNum ) );
+			}
+			if ( ! Same ) continue;
+			zone_info.ScriptF = entry.ScriptF;
+			entry.LastUse = zone_cache.UseCount;
+			++NumScriptFCacheHits;
+			return;
+		}
+
+		// Inverse with all shades and blinds retracted (redone if the constructions were changed)
+		FArray1D< Real64 > BaseEmissivity( N );
+		for ( int ZoneSurfNum = 1; ZoneSurfNum <= N; ++ZoneSurfNum ) {
+			BaseEmissivity( ZoneSurfNum ) = min( Construct( Surface( zone_info.SurfacePtr( ZoneSurfNum ) ).Construction ).InsideAbsorpThermal, MaxEmissLimit );
+		}
+		Same = zone_cache.BaseEmissivity.allocated();
+		for ( int ZoneSurfNum = 1; Same && ZoneSurfNum <= N; ++ZoneSurfNum ) {
+			Same = ( zone_cache.BaseEmissivity( ZoneSurfNum ) == BaseEmissivity( ZoneSurfNum ) );
+		}
+		if ( ! Same ) {
+			zone_cache.BaseEmissivity = BaseEmissivity;
+			zone_cache.BaseInverse.dimension( N, N );
+			CalcRadiosityInverse( N, zone_info.Area, zone_info.F, BaseEmissivity, zone_cache.BaseInverse );
+			zone_cache.Entries.clear(); // Built with the old constructions
+		}
+
+		// Cache entry for this configuration: a new one, or the least recently used
+		if ( int( zone_cache.Entries.size() ) < MaxScriptFCacheEntries ) zone_cache.Entries.push_back( ScriptFCacheEntry() );
+		auto & entry( *std::min_element( zone_cache.Entries.begin(), zone_cache.Entries.end(), LessRecentlyUsedScriptF ) ); // New entries have LastUse 0
+		entry.Emissivity = zone_info.Emissivity;
+		entry.LastUse = zone_cache.UseCount;
+
+		FArray2D< Real64 > Cinverse( N, N ); // Inverse of the radiosity coefficient matrix
+		if ( UpdateRadiosityInverse( N, zone_info.Area, zone_cache.BaseEmissivity, zone_info.Emissivity, zone_cache.BaseInverse, Cinverse ) ) {
+			++NumScriptFInverseUpdates;
+		} else {
+			CalcRadiosityInverse( N, zone_info.Area, zone_info.F, zone_info.Emissivity, Cinverse );
+			++NumScriptFInversions;
+		}
+		CalcScriptFFromInverse( N, zone_info.Area, zone_info.Emissivity, Cinverse, zone_info.ScriptF );
+		// precalc - multiply by StefanBoltzmannConstant
+		zone_info.ScriptF *= StefanBoltzmannConst;
+		entry.ScriptF = zone_info.ScriptF;
+
+	}
+
+	bool
+	LessRecentlyUsedScriptF(
+		ScriptFCacheEntry const & Entry1, // Cache entry
+		ScriptFCacheEntry const & Entry2 // Cache entry
+	)
+	{
+		// Sort predicate: least recently used Script F cache entry first
+		return Entry1.LastUse < Entry2.LastUse;
+	}
+
+	void
+	CalcRadiosityInverse(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		FArray2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
+		FArray1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		FArray2< Real64 > & Cinverse // Inverse of the radiosity coefficient matrix (N X N)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Curt Pedersen
+		//       DATE WRITTEN   1980
+		//       MODIFIED       July 2000 (COP for the ASHRAE Loads Toolkit)
+		//       RE-ENGINEERED  September 2000 (RKS for EnergyPlus)
+		//       RE-ENGINEERED  June 2014 (Stuart Mentzer): Performance tuned
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Inverts the (AF - EMISS/REFLECTANCE) coefficient matrix of the partial radiosity
+		// calculation of the ScriptF coefficients (split out of CalcScriptF).
+
+		// METHODOLOGY EMPLOYED:
+		// See reference
+
+		// REFERENCES:
+		// Hottel, H. C. and A. F. Sarofim, Radiative Transfer, Ch 3, McGraw Hill, 1967.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MaxEmissLimit( 0.99999 ); // Limit the emissivity internally/avoid a divide by zero error
+
+		assert( equal_dimensions( F, Cinverse ) );
+
 		// Load Cmatrix with AF (AREA * DIRECT VIEW FACTOR) matrix
 		FArray2D< Real64 > Cmatrix( N, N ); // = (AF - EMISS/REFLECTANCE) matrix (but plays other roles)
 		assert( equal_dimensions( Cmatrix, F ) ); // For linear indexing
@@ -1276,7 +1440,6 @@ namespace HeatBalanceIntRadExchange {
 		}
 
 		// Load Cmatrix with (AF - EMISS/REFLECTANCE) matrix
-		FArray1D< Real64 > Excite( N ); // Excitation vector = A*EMISS/REFLECTANCE
 		l = 0u;
 		for ( int i = 1; i <= N; ++i, l += N + 1 ) {
 			Real64 EMISS_i( EMISS( i ) );
@@ -1285,26 +1448,148 @@ namespace HeatBalanceIntRadExchange {
 				ShowWarningError( "A thermal emissivity above 0.99999 was detected. This is not allowed. Value was reset to 0.99999" );
 			}
 			Real64 const EMISS_i_fac( A( i ) / ( 1.0 - EMISS_i ) );
-			Excite( i ) = -EMISS_i * EMISS_i_fac; // Set up matrix columns for partial radiosity calculation
 			Cmatrix[ l ] -= EMISS_i_fac; // Coefficient matrix for partial radiosity calculation // [ l ] == ( i, i )
 		}
 
-		FArray2D< Real64 > Cinverse( N, N ); // Inverse of Cmatrix
 		CalcMatrixInverse( Cmatrix, Cinverse ); // SOLVE THE LINEAR SYSTEM
-		Cmatrix.clear(); // Release memory ASAP
 
-		// Scale Cinverse colums by excitation to get partial radiosity matrix
-		l = 0u;
+	}
+
+	bool
+	UpdateRadiosityInverse(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		FArray1< Real64 > const & BaseEMISS, // Surface emissivities of BaseInverse
+		FArray1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		FArray2< Real64 > const & BaseInverse, // Inverse of the radiosity coefficient matrix for BaseEMISS
+		FArray2< Real64 > & Cinverse // Inverse of the radiosity coefficient matrix for EMISS (N X N)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gets the inverse of the radiosity coefficient matrix for the emissivities EMISS from the
+		// inverse for the emissivities BaseEMISS.  Returns false (and leaves Cinverse as it is) if
+		// too many emissivities differ for this to be faster than CalcRadiosityInverse.
+
+		// METHODOLOGY EMPLOYED:
+		// The emissivity of surface i only enters the diagonal term C(i,i) = A(i)F(i,i) - A(i)/(1-EMISS(i)),
+		// so for the k surfaces with different emissivities C = B + U D U', with U the k unit
+		// columns of these surfaces and D the changes of their diagonal terms.  Sherman-Morrison-
+		// Woodbury:  inv(C) = inv(B) - inv(B) U inv( inv(D) + U' inv(B) U ) U' inv(B),
+		// which takes O(k N^2 + k^3) operations instead of O(N^3).
+
+		// REFERENCES:
+		// Golub, G. H. and C. F. Van Loan, Matrix Computations, 3rd ed., Sec 2.1.3, Johns Hopkins, 1996.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MaxEmissLimit( 0.99999 ); // Limit the emissivity internally/avoid a divide by zero error (as CalcRadiosityInverse)
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1D_int Changed( N ); // Surfaces with an emissivity different from BaseEMISS
+		int K( 0 ); // Number of changed surfaces
+
+		assert( equal_dimensions( BaseInverse, Cinverse ) );
+
+		for ( int i = 1; i <= N; ++i ) {
+			if ( EMISS( i ) > MaxEmissLimit ) { // Check/limit EMISS for this surface to avoid divide by zero below
+				EMISS( i ) = MaxEmissLimit;
+				ShowWarningError( "A thermal emissivity above 0.99999 was detected. This is not allowed. Value was reset to 0.99999" );
+			}
+			if ( EMISS( i ) != min( BaseEMISS( i ), MaxEmissLimit ) ) Changed( ++K ) = i;
+		}
+		if ( 4 * K > N ) return false; // Inverting is about as fast
+
+		Cinverse = BaseInverse;
+		if ( K == 0 ) return true;
+
+		// Capacitance matrix inv(D) + U' inv(B) U (K X K)
+		FArray2D< Real64 > Cap( K, K );
+		for ( int b = 1; b <= K; ++b ) {
+			for ( int a = 1; a <= K; ++a ) {
+				Cap( a, b ) = BaseInverse( Changed( a ), Changed( b ) );
+			}
+		}
+		for ( int a = 1; a <= K; ++a ) {
+			int const i( Changed( a ) );
+			Real64 const Delta( A( i ) / ( 1.0 - min( BaseEMISS( i ), MaxEmissLimit ) ) - A( i ) / ( 1.0 - EMISS( i ) ) ); // Change of C(i,i)
+			Cap( a, a ) += 1.0 / Delta;
+		}
+		FArray2D< Real64 > CapInverse( K, K );
+		CalcMatrixInverse( Cap, CapInverse );
+
+		// W = inv( Cap ) U' inv(B) (K X N)
+		FArray2D< Real64 > W( K, N, 0.0 );
 		for ( int j = 1; j <= N; ++j ) {
-			Real64 const e_j( Excite( j ) );
-			for ( int i = 1; i <= N; ++i, ++l ) {
-				Cinverse[ l ] *= e_j; // [ l ] == ( i, j )
+			for ( int b = 1; b <= K; ++b ) {
+				Real64 const Bbj( BaseInverse( Changed( b ), j ) );
+				for ( int a = 1; a <= K; ++a ) {
+					W( a, j ) += CapInverse( a, b ) * Bbj;
+				}
 			}
 		}
-		Excite.clear(); // Release memory ASAP
 
-		// Form Script F matrix transposed
+		// inv(C) = inv(B) - inv(B) U W
+		for ( int j = 1; j <= N; ++j ) {
+			for ( int a = 1; a <= K; ++a ) {
+				Real64 const Waj( W( a, j ) );
+				if ( Waj == 0.0 ) continue;
+				int const k( Changed( a ) );
+				auto ij( Cinverse.index( 1, j ) ); // [ ij ] == ( i, j )
+				auto ik( BaseInverse.index( 1, k ) ); // [ ik ] == ( i, k )
+				for ( int i = 1; i <= N; ++i, ++ij, ++ik ) {
+					Cinverse[ ij ] -= BaseInverse[ ik ] * Waj;
+				}
+			}
+		}
+
+		return true;
+
+	}
+
+	void
+	CalcScriptFFromInverse(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		FArray1< Real64 > const & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		FArray2< Real64 > const & Cinverse, // Inverse of the radiosity coefficient matrix (N X N)
+		FArray2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Curt Pedersen
+		//       DATE WRITTEN   1980
+		//       MODIFIED       July 2000 (COP for the ASHRAE Loads Toolkit)
+		//       RE-ENGINEERED  September 2000 (RKS for EnergyPlus)
+		//       RE-ENGINEERED  June 2014 (Stuart Mentzer): Performance tuned
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forms the ScriptF coefficients from the inverse of the radiosity coefficient matrix
+		// (split out of CalcScriptF).  The emissivities must be limited as in CalcRadiosityInverse.
+
+		// METHODOLOGY EMPLOYED:
+		// See reference
+
+		// REFERENCES:
+		// Hottel, H. C. and A. F. Sarofim, Radiative Transfer, Ch 3, McGraw Hill, 1967.
+
 		assert( equal_dimensions( Cinverse, ScriptF ) ); // For linear indexing
+
+		// Excitation vector = A*EMISS/REFLECTANCE: scales the Cinverse columns to get the partial radiosity matrix
+		FArray1D< Real64 > Excite( N );
+		for ( int i = 1; i <= N; ++i ) {
+			Real64 const EMISS_i( EMISS( i ) );
+			Excite( i ) = -EMISS_i * ( A( i ) / ( 1.0 - EMISS_i ) );
+		}
+
+		// Form Script F matrix transposed
+		FArray2D< Real64 >::size_type l( 0u );
 		FArray2D< Real64 >::size_type m( 0u );
 		for ( int i = 1; i <= N; ++i ) { // Inefficient order for cache but can reuse multiplier so faster choice depends on N
 			Real64 const EMISS_i( EMISS( i ) );
@@ -1313,10 +1598,10 @@ namespace HeatBalanceIntRadExchange {
 			for ( int j = 1; j <= N; ++j, l += N, ++m ) {
 				if ( i == j ) {
 					//        ScriptF(I,J) = EMISS(I)/(1.0d0-EMISS(I))*(Jmatrix(I,J)-Delta*EMISS(I)), where Delta=1
-					ScriptF[ m ] = EMISS_fac * ( Cinverse[ l ] - EMISS_i ); // [ l ] = ( i, j ), [ m ] == ( j, i )
+					ScriptF[ m ] = EMISS_fac * ( Cinverse[ l ] * Excite( j ) - EMISS_i ); // [ l ] = ( i, j ), [ m ] == ( j, i )
 				} else {
 					//        ScriptF(I,J) = EMISS(I)/(1.0d0-EMISS(I))*(Jmatrix(I,J)-Delta*EMISS(I)), where Delta=0
-					ScriptF[ m ] = EMISS_fac * Cinverse[ l ]; // [ l ] == ( i, j ), [ m ] == ( j, i )
+					ScriptF[ m ] = EMISS_fac * ( Cinverse[ l ] * Excite( j ) ); // [ l ] == ( i, j ), [ m ] == ( j, i )
 				}
 			}
 		}
@@ -1431,6 +1716,44 @@ namespace HeatBalanceIntRadExchange {
 
 	}
 
+	void
+	ReportScriptFCacheStatistics()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes how the ScriptF recalculations for interior shade/blind changes were done to the
+		// eio file at the end of the run.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt Format_800( "('! <Interior Radiant Exchange Script F>, Recalculations, Cached Configurations Used, Low Rank Updates, Full Inversions, Inversions Avoided {%}')" );
+		static gio::Fmt Format_801( "(' Interior Radiant Exchange Script F, ',A,',',A,',',A,',',A,',',A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumCalcs( NumScriptFCacheHits + NumScriptFInverseUpdates + NumScriptFInversions ); // recalculations requested
+
+		if ( NumCalcs == 0 ) return;
+
+		gio::write( OutputFileInits, Format_800 );
+		gio::write( OutputFileInits, Format_801 ) << TrimSigDigits( NumCalcs ) << TrimSigDigits( NumScriptFCacheHits ) << TrimSigDigits( NumScriptFInverseUpdates ) << TrimSigDigits( NumScriptFInversions ) << RoundSigDigits( 100.0 * ( NumCalcs - NumScriptFInversions ) / NumCalcs, 2 );
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -1,10 +1,15 @@
 #ifndef HeatBalanceIntRadExchange_hh_INCLUDED
 #define HeatBalanceIntRadExchange_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
+#include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray1S.hh>
 #include <ObjexxFCL/FArray2A.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/FArray2S.hh>
 #include <ObjexxFCL/Optional.hh>
 
@@ -19,12 +24,49 @@ namespace HeatBalanceIntRadExchange {
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS
+	extern int const MaxScriptFCacheEntries; // Script F matrices kept per zone (interior shade/blind configurations)
 
 	// DERIVED TYPE DEFINITIONS
-	// na
+
+	struct ScriptFCacheEntry
+	{
+		// Members
+		FArray1D< Real64 > Emissivity; // Inside surface emissivities of the configuration (key)
+		FArray2D< Real64 > ScriptF; // Script F times the Stefan-Boltzmann constant //Tuned Transposed
+		int LastUse; // Zone cache use count at the last use of this entry
+
+		// Default Constructor
+		ScriptFCacheEntry() :
+			LastUse( 0 )
+		{}
+
+	};
+
+	struct ZoneScriptFCacheData
+	{
+		// Members
+		bool HasMovableShades; // True if a window of the zone has a shading control (only these zones are cached)
+		FArray1D< Real64 > BaseEmissivity; // Inside surface emissivities with no interior shades or blinds deployed
+		FArray2D< Real64 > BaseInverse; // Inverse of the radiosity coefficient matrix for BaseEmissivity
+		std::vector< ScriptFCacheEntry > Entries; // Recently used configurations
+		int UseCount; // Number of Script F recalculations requested for the zone
+
+		// Default Constructor
+		ZoneScriptFCacheData() :
+			HasMovableShades( false ),
+			UseCount( 0 )
+		{}
+
+	};
 
 	// MODULE VARIABLE DECLARATIONS:
 	extern int MaxNumOfZoneSurfaces; // Max saved to get large enough space for user input view factors
+	extern int NumScriptFCacheHits; // Script F recalculations served from the zone caches
+	extern int NumScriptFInverseUpdates; // Script F recalculations done by a low rank update of the inverse
+	extern int NumScriptFInversions; // Script F recalculations done by a full matrix inversion
+
+	// Object Data
+	extern FArray1D< ZoneScriptFCacheData > ZoneScriptFCache;
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceIntRadExchange
 
@@ -94,12 +136,52 @@ namespace HeatBalanceIntRadExchange {
 		FArray2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
 	);
 
+	void
+	CalcZoneScriptF( int const ZoneNum ); // Zone number
+
+	bool
+	LessRecentlyUsedScriptF(
+		ScriptFCacheEntry const & Entry1, // Cache entry
+		ScriptFCacheEntry const & Entry2 // Cache entry
+	);
+
+	void
+	CalcRadiosityInverse(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		FArray2< Real64 > const & F, // DIRECT VIEW FACTOR MATRIX (N X N)
+		FArray1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		FArray2< Real64 > & Cinverse // Inverse of the radiosity coefficient matrix (N X N)
+	);
+
+	bool
+	UpdateRadiosityInverse(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		FArray1< Real64 > const & BaseEMISS, // Surface emissivities of BaseInverse
+		FArray1< Real64 > & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		FArray2< Real64 > const & BaseInverse, // Inverse of the radiosity coefficient matrix for BaseEMISS
+		FArray2< Real64 > & Cinverse // Inverse of the radiosity coefficient matrix for EMISS (N X N)
+	);
+
+	void
+	CalcScriptFFromInverse(
+		int const N, // Number of surfaces
+		FArray1< Real64 > const & A, // AREA VECTOR- ASSUMED,BE N ELEMENTS LONG
+		FArray1< Real64 > const & EMISS, // VECTOR OF SURFACE EMISSIVITIES
+		FArray2< Real64 > const & Cinverse, // Inverse of the radiosity coefficient matrix (N X N)
+		FArray2< Real64 > & ScriptF // MATRIX OF SCRIPT F FACTORS (N X N) //Tuned Transposed
+	);
+
 	void
 	CalcMatrixInverse(
 		FArray2< Real64 > & A, // Matrix: Gets reduced to L\U form
 		FArray2< Real64 > & I // Returned as inverse matrix
 	);
 
+	void
+	ReportScriptFCacheStatistics();
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
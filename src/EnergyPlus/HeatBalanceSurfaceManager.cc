@@ -381,6 +381,7 @@ namespace HeatBalanceSurfaceManager {
 		// Do the Begin Simulation initializations
 		if ( BeginSimFlag ) {
 			AllocateSurfaceHeatBalArrays(); // Allocate the Module Arrays before any inits take place
+			SetHeatTransferSurfaceLists(); // Lists of the surfaces walked by the heat balance loops
 			InterZoneWindow = any( Zone.HasInterZoneWindow() );
 			IsZoneDV.dimension( NumOfZones, false );
 			IsZoneCV.dimension( NumOfZones, false );
@@ -1422,6 +1423,67 @@ namespace HeatBalanceSurfaceManager {
 
 	}
 
+	void
+	SetHeatTransferSurfaceLists()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets up the lists of surfaces walked by the surface heat balance
+		// loops, so that those loops do not have to test the class, heat transfer flag and
+		// algorithm of every surface (windows and shading surfaces included) each time step.
+
+		// METHODOLOGY EMPLOYED:
+		// The lists are set once at the beginning of the simulation, after the surfaces and
+		// the daylighting devices (which turn light shelves into heat transfer surfaces) are
+		// set up.  They only hold surface numbers: members that can still change during the
+		// simulation (construction, area) are read from the surface itself.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SurfNum;
+		int ZoneNum;
+		int NumHT; // Number of surfaces in HTSurfaceList
+		int NumHTNonWindow; // Number of surfaces in HTNonWindowSurfaceList
+		int NumHTHistory; // Number of surfaces in HTHistorySurfaceList
+
+		HTSurfaceList.dimension( TotSurfaces, 0 );
+		ZoneHTSurfaceFirst.dimension( NumOfZones, 1 );
+		ZoneHTSurfaceLast.dimension( NumOfZones, 0 );
+		HTNonWindowSurfaceList.dimension( TotSurfaces, 0 );
+		HTHistorySurfaceList.dimension( TotSurfaces, 0 );
+
+		NumHT = 0;
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			ZoneHTSurfaceFirst( ZoneNum ) = NumHT + 1;
+			for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+				if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+				HTSurfaceList( ++NumHT ) = SurfNum;
+			}
+			ZoneHTSurfaceLast( ZoneNum ) = NumHT;
+		}
+
+		NumHTNonWindow = 0;
+		NumHTHistory = 0;
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( ! surface.HeatTransSurf || surface.Class == SurfaceClass_Window ) continue;
+			if ( surface.Zone != 0 ) HTNonWindowSurfaceList( ++NumHTNonWindow ) = SurfNum;
+			if ( ( surface.HeatTransferAlgorithm == HeatTransferModel_CTF ) || ( surface.HeatTransferAlgorithm == HeatTransferModel_EMPD ) || ( surface.HeatTransferAlgorithm == HeatTransferModel_TDD ) ) {
+				HTHistorySurfaceList( ++NumHTHistory ) = SurfNum;
+			}
+		}
+
+		HTSurfaceList.redimension( NumHT );
+		HTNonWindowSurfaceList.redimension( NumHTNonWindow );
+		HTHistorySurfaceList.redimension( NumHTHistory );
+
+	}
+
 	void
 	InitThermalAndFluxHistories()
 	{
@@ -3830,12 +3892,11 @@ namespace HeatBalanceSurfaceManager {
 			FirstTimeFlag = false;
 		}
 
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
+		for ( int Loop = 1, Loop_end = HTHistorySurfaceList.u(); Loop <= Loop_end; ++Loop ) { // Loop through all (heat transfer) surfaces...
+			SurfNum = HTHistorySurfaceList( Loop );
 			auto const & surface( Surface( SurfNum ) );
 
-			if ( surface.Class == SurfaceClass_Window || ! surface.HeatTransSurf ) continue;
-
-			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) ) continue;
+			if ( surface.HeatTransferAlgorithm == HeatTransferModel_TDD ) continue;
 
 			int const ConstrNum( surface.Construction );
 			auto const & construct( Construct( ConstrNum ) );
@@ -3885,11 +3946,8 @@ namespace HeatBalanceSurfaceManager {
 
 		} // ...end of loop over all (heat transfer) surfaces...
 
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
-			auto const & surface( Surface( SurfNum ) );
-
-			if ( surface.Class == SurfaceClass_Window || ! surface.HeatTransSurf ) continue;
-			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_TDD ) ) continue;
+		for ( int Loop = 1, Loop_end = HTHistorySurfaceList.u(); Loop <= Loop_end; ++Loop ) { // Loop through all (heat transfer) surfaces...
+			SurfNum = HTHistorySurfaceList( Loop );
 			if ( SUMH( SurfNum ) == 0 ) { // First time step in a block for a surface, update arrays
 				TempExt1( SurfNum ) = TH( SurfNum, 1, 1 );
 				TempInt1( SurfNum ) = TempSurfIn( SurfNum );
@@ -3903,11 +3961,11 @@ namespace HeatBalanceSurfaceManager {
 
 		// SHIFT TEMPERATURE AND FLUX HISTORIES:
 		// SHIFT AIR TEMP AND FLUX SHIFT VALUES WHEN AT BOTTOM OF ARRAY SPACE.
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
+		for ( int Loop = 1, Loop_end = HTHistorySurfaceList.u(); Loop <= Loop_end; ++Loop ) { // Loop through all (heat transfer) surfaces...
+			SurfNum = HTHistorySurfaceList( Loop );
 			auto const & surface( Surface( SurfNum ) );
 
-			if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome || ! surface.HeatTransSurf ) continue;
-			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_TDD ) ) continue;
+			if ( surface.Class == SurfaceClass_TDD_Dome ) continue;
 
 			int const ConstrNum( surface.Construction );
 			auto const & construct( Construct( ConstrNum ) );
@@ -4093,10 +4151,9 @@ namespace HeatBalanceSurfaceManager {
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 			if ( present( ZoneToResimulate ) && ( ZoneNum != ZoneToResimulate ) ) continue;
 			SumAET = 0.0;
-			for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
-				if ( Surface( SurfNum ).HeatTransSurf ) {
-					SumAET += SurfaceAE( SurfNum ) * TempSurfIn( SurfNum );
-				}
+			for ( int Loop = ZoneHTSurfaceFirst( ZoneNum ), Loop_end = ZoneHTSurfaceLast( ZoneNum ); Loop <= Loop_end; ++Loop ) {
+				SurfNum = HTSurfaceList( Loop );
+				SumAET += SurfaceAE( SurfNum ) * TempSurfIn( SurfNum );
 			}
 			if ( ZoneAESum( ZoneNum ) > 0.01 ) {
 				MRT( ZoneNum ) = SumAET / ZoneAESum( ZoneNum );
@@ -4408,8 +4465,9 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		CalcInteriorRadExchange( TH( _, 1, 2 ), 0, NetLWRadToSurf, _, Outside );
 	}
 
-	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
+	for ( int Loop = 1, Loop_end = HTNonWindowSurfaceList.u(); Loop <= Loop_end; ++Loop ) { // Loop through all heat transfer surfaces other than windows...
 
+		SurfNum = HTNonWindowSurfaceList( Loop );
 		ZoneNum = Surface( SurfNum ).Zone;
 
 		if ( present( ZoneToResimulate ) ) {
@@ -4418,9 +4476,6 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 		}
 
-		if ( ! Surface( SurfNum ).HeatTransSurf || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
-
-		if ( Surface( SurfNum ).Class == SurfaceClass_Window ) continue;
 		// Interior windows in partitions use "normal" heat balance calculations
 		// For rest, Outside surface temp of windows not needed in Window5 calculation approach.
 		// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
@@ -4852,6 +4907,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 	using HeatBalanceMovableInsulation::EvalInsideMovableInsulation;
 	using WindowManager::CalcWindowHeatBalance;
+	using WindowManager::WindowHeatBalanceWork;
 	using HeatBalFiniteDiffManager::ManageHeatBalFiniteDiff;
 	using HeatBalFiniteDiffManager::SurfaceFD;
 	using HeatBalanceHAMTManager::ManageHeatBalHAMT;
@@ -5376,7 +5432,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 							// Following call determines inside surface temperature of glazing, and of
 							// frame and/or divider, if present
-							CalcWindowHeatBalance( SurfNum, HcExtSurf( SurfNum ), TempSurfInTmp( SurfNum ), TH11 );
+							CalcWindowHeatBalance( SurfNum, HcExtSurf( SurfNum ), TempSurfInTmp( SurfNum ), TH11, WindowHeatBalanceWork );
 							if ( WinHeatGain( SurfNum ) >= 0.0 ) {
 								WinHeatGainRep( SurfNum ) = WinHeatGain( SurfNum );
 								WinHeatGainRepEnergy( SurfNum ) = WinHeatGainRep( SurfNum ) * TimeStepZone * SecInHour;
@@ -52,6 +52,9 @@ namespace HeatBalanceSurfaceManager {
 	void
 	AllocateSurfaceHeatBalArrays();
 
+	void
+	SetHeatTransferSurfaceLists();
+
 	void
 	InitThermalAndFluxHistories();
 
@@ -140,6 +140,9 @@ namespace InputProcessor {
 	FArray1D_int iListOfObjects;
 	FArray1D_int ObjectGotCount;
 	FArray1D_int ObjectStartRecord;
+	FArray1D_int ObjectRecordIndex; // IDF record numbers grouped by object definition (in input order)
+	FArray1D_int ObjectRecordIndexStart; // Position of each object definition's first record in ObjectRecordIndex
+	int ObjectRecordIndexCount( -1 ); // Number of IDF records when ObjectRecordIndex was built
 	std::string CurrentFieldName; // Current Field Name (IDD)
 	FArray1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	std::string ReplacementName;
@@ -343,6 +346,7 @@ namespace InputProcessor {
 		lNumericFieldBlanks.dimension( MaxNumericIDFDefArgsFound, false );
 
 		IDFRecordsGotten.dimension( NumIDFRecords, false );
+		BuildObjectRecordIndex();
 
 		gio::write( EchoInputFile, fmtLD ) << " Processing Input Data File (in.idf) -- Complete";
 		//   WRITE(EchoInputFile,*) ' Number of IDF "Lines"=',NumIDFRecords
@@ -1128,18 +1132,6 @@ namespace InputProcessor {
 		bool BlankLine( false );
 		std::string::size_type Pos;
 
-		MaxIDFRecords = ObjectsIDFAllocInc;
-		NumIDFRecords = 0;
-		MaxIDFSections = SectionsIDFAllocInc;
-		NumIDFSections = 0;
-
-		SectionsOnFile.allocate( MaxIDFSections );
-		IDFRecords.allocate( MaxIDFRecords );
-		LineItem.Numbers.allocate( MaxNumericArgsFound );
-		LineItem.NumBlank.allocate( MaxNumericArgsFound );
-		LineItem.Alphas.allocate( MaxAlphaArgsFound );
-		LineItem.AlphBlank.allocate( MaxAlphaArgsFound );
-
 		// Check file
 		cross_platform_get_line( idf_stream, InputLine );
 		std::string::size_type const len_line( InputLine.length() );
@@ -1152,6 +1144,20 @@ namespace InputProcessor {
 		}
 		if ( idf_stream ) idf_stream.seekg( 0, std::ios::beg );
 
+		// Size the records from the number of object terminators so that large files
+		// are not copied each time the records are redimensioned.
+		MaxIDFRecords = max( ObjectsIDFAllocInc, CountIDFObjectTerminators( idf_stream ) + 1 );
+		NumIDFRecords = 0;
+		MaxIDFSections = SectionsIDFAllocInc;
+		NumIDFSections = 0;
+
+		SectionsOnFile.allocate( MaxIDFSections );
+		IDFRecords.allocate( MaxIDFRecords );
+		LineItem.Numbers.allocate( MaxNumericArgsFound );
+		LineItem.NumBlank.allocate( MaxNumericArgsFound );
+		LineItem.Alphas.allocate( MaxAlphaArgsFound );
+		LineItem.AlphBlank.allocate( MaxAlphaArgsFound );
+
 		while ( ! EndofFile ) {
 			ReadInputLine( idf_stream, Pos, BlankLine, EndofFile );
 			if ( BlankLine || EndofFile ) continue;
@@ -1165,7 +1171,7 @@ namespace InputProcessor {
 				} else {
 					ValidateObjectandParse( idf_stream, InputLine.substr( 0, Pos ), Pos, EndofFile );
 					if ( NumIDFRecords == MaxIDFRecords ) {
-						IDFRecords.redimension( MaxIDFRecords += ObjectsIDFAllocInc );
+						IDFRecords.redimension( MaxIDFRecords += max( ObjectsIDFAllocInc, MaxIDFRecords / 2 ) );
 					}
 				}
 			} else { // Error condition, no , or ; on first line
@@ -1189,6 +1195,76 @@ namespace InputProcessor {
 
 	}
 
+	int
+	CountIDFObjectTerminators( std::istream & idf_stream )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function counts the ";" characters (outside of comments) in the input data
+		// file.  Each object or section ends with one, so the count is an upper bound on
+		// the number of IDF records.
+
+		// METHODOLOGY EMPLOYED:
+		// Read the file in large blocks (rather than line by line) and scan the characters,
+		// skipping from "!" to the end of the line.  The stream is rewound afterwards.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		int NumTerminators( 0 );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		std::string::size_type const BlockSize( 1048576 );
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string Block( BlockSize, ' ' );
+		std::streamsize NumRead;
+		std::streamsize Pos;
+		bool InComment( false );
+
+		if ( ! idf_stream ) return 0;
+
+		while ( idf_stream ) {
+			idf_stream.read( &Block[ 0 ], BlockSize );
+			NumRead = idf_stream.gcount();
+			for ( Pos = 0; Pos < NumRead; ++Pos ) {
+				char const c( Block[ Pos ] );
+				if ( InComment ) {
+					if ( c == '\n' ) InComment = false;
+				} else if ( c == '!' ) {
+					InComment = true;
+				} else if ( c == ';' ) {
+					++NumTerminators;
+				}
+			}
+		}
+
+		idf_stream.clear();
+		idf_stream.seekg( 0, std::ios::beg );
+
+		return NumTerminators;
+
+	}
+
 	void
 	ValidateSection(
 		std::string const & ProposedSection,
@@ -2121,6 +2197,236 @@ namespace InputProcessor {
 
 	}
 
+	void
+	BuildObjectRecordIndex()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine builds the list of IDF record numbers for each object definition
+		// so that the 'number' instance of an object can be retrieved without scanning the
+		// IDF records.
+
+		// METHODOLOGY EMPLOYED:
+		// Counting sort of the IDF records by object definition.  The records for object
+		// definition Which are ObjectRecordIndex(ObjectRecordIndexStart(Which)) through
+		// ObjectRecordIndex(ObjectRecordIndexStart(Which+1)-1), in the order they appear
+		// in the input.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop;
+		int Which;
+		FArray1D_int NextPos; // Next open position for each object definition
+
+		ObjectRecordIndexStart.dimension( NumObjectDefs + 1, 0 );
+		for ( Loop = 1; Loop <= NumIDFRecords; ++Loop ) {
+			Which = IDFRecords( Loop ).ObjectDefPtr;
+			if ( Which < 1 || Which > NumObjectDefs ) continue;
+			if ( IDFRecords( Loop ).Name != ObjectDef( Which ).Name ) continue;
+			++ObjectRecordIndexStart( Which + 1 );
+		}
+		ObjectRecordIndexStart( 1 ) = 1;
+		for ( Which = 2; Which <= NumObjectDefs + 1; ++Which ) {
+			ObjectRecordIndexStart( Which ) += ObjectRecordIndexStart( Which - 1 );
+		}
+
+		ObjectRecordIndex.dimension( ObjectRecordIndexStart( NumObjectDefs + 1 ) - 1, 0 );
+		NextPos = ObjectRecordIndexStart;
+		for ( Loop = 1; Loop <= NumIDFRecords; ++Loop ) {
+			Which = IDFRecords( Loop ).ObjectDefPtr;
+			if ( Which < 1 || Which > NumObjectDefs ) continue;
+			if ( IDFRecords( Loop ).Name != ObjectDef( Which ).Name ) continue;
+			ObjectRecordIndex( NextPos( Which ) ) = Loop;
+			++NextPos( Which );
+		}
+
+		ObjectRecordIndexCount = NumIDFRecords;
+
+	}
+
+	int
+	GetObjectDefIndex( std::string const & Object )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the object definition index (handle) for an object name.
+		// The handle can be passed to GetNumObjectsFound and GetObjectItem so that
+		// repeated gets of the same object type do not repeat the name lookup.
+		// If it can't find the object in list of objects, a 0 will be returned.
+
+		// METHODOLOGY EMPLOYED:
+		// Look up object in list of objects.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		int GetObjectDefIndex;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		if ( NumObjectDefs == 0 ) {
+			ProcessInput();
+		}
+
+		if ( SortedIDD ) {
+			GetObjectDefIndex = FindItemInSortedList( MakeUPPERCase( Object ), ListOfObjects, NumObjectDefs );
+			if ( GetObjectDefIndex != 0 ) GetObjectDefIndex = iListOfObjects( GetObjectDefIndex );
+		} else {
+			GetObjectDefIndex = FindItemInList( MakeUPPERCase( Object ), ListOfObjects, NumObjectDefs );
+		}
+
+		return GetObjectDefIndex;
+
+	}
+
+	int
+	GetNumObjectsFound( int const ObjectDefIndex )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the number of objects (in input data file)
+		// found in the current run for an object definition index from GetObjectDefIndex.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		if ( ObjectDefIndex < 1 || ObjectDefIndex > NumObjectDefs ) return 0;
+		return ObjectDef( ObjectDefIndex ).NumFound;
+
+	}
+
+	int
+	GetObjectRecordNum(
+		int const ObjectDefIndex,
+		int const Number
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the IDF record number of the 'number' instance of an
+		// object definition, or 0 if there is no such instance.
+
+		// METHODOLOGY EMPLOYED:
+		// Direct lookup in ObjectRecordIndex; the index is rebuilt if records have been
+		// added since it was built.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Pos;
+
+		if ( ObjectDefIndex < 1 || ObjectDefIndex > NumObjectDefs ) return 0;
+		if ( ObjectRecordIndexCount != NumIDFRecords ) BuildObjectRecordIndex();
+
+		if ( Number < 1 ) return 0;
+		Pos = ObjectRecordIndexStart( ObjectDefIndex ) + Number - 1;
+		if ( Pos >= ObjectRecordIndexStart( ObjectDefIndex + 1 ) ) return 0;
+		return ObjectRecordIndex( Pos );
+
+	}
+
 	void
 	GetObjectItem(
 		std::string const & Object,
@@ -2147,8 +2453,70 @@ namespace InputProcessor {
 		// This subroutine gets the 'number' 'object' from the IDFRecord data structure.
 
 		// METHODOLOGY EMPLOYED:
+		// Look up the object definition index and get the item by index.  Callers that
+		// get many instances of one object can call GetObjectDefIndex once instead.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Argument array dimensioning
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
 		// na
 
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Found;
+
+		Found = GetObjectDefIndex( Object );
+		if ( Found == 0 ) { //  This is more of a developer problem
+			ShowFatalError( "IP: GetObjectItem: Requested object=" + MakeUPPERCase( Object ) + ", not found in Object Definitions -- incorrect IDD attached." );
+		}
+
+		GetObjectItem( Found, Number, Alphas, NumAlphas, Numbers, NumNumbers, Status, NumBlank, AlphaBlank, AlphaFieldNames, NumericFieldNames );
+
+	}
+
+	void
+	GetObjectItem(
+		int const ObjectDefIndex,
+		int const Number,
+		FArray1S_string Alphas,
+		int & NumAlphas,
+		FArray1S< Real64 > Numbers,
+		int & NumNumbers,
+		int & Status,
+		Optional< FArray1_bool > NumBlank,
+		Optional< FArray1_bool > AlphaBlank,
+		Optional< FArray1_string > AlphaFieldNames,
+		Optional< FArray1_string > NumericFieldNames
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda K. Lawrie
+		//       DATE WRITTEN   September 1997
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine gets the 'number' 'object' from the IDFRecord data structure,
+		// where the object is given by its object definition index (see GetObjectDefIndex).
+
+		// METHODOLOGY EMPLOYED:
+		// The IDF record is found directly from ObjectRecordIndex.
+
 		// REFERENCES:
 		// na
 
@@ -2170,10 +2538,8 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Count;
 		int LoopIndex;
 		std::string ObjectWord;
-		std::string UCObject;
 		static FArray1D_string AlphaArgs;
 		static FArray1D< Real64 > NumberArgs;
 		static FArray1D_bool AlphaArgsBlank;
@@ -2181,7 +2547,6 @@ namespace InputProcessor {
 		int MaxAlphas;
 		int MaxNumbers;
 		int Found;
-		int StartRecord;
 		std::string cfld1;
 		std::string cfld2;
 		bool GoodItem;
@@ -2206,24 +2571,17 @@ namespace InputProcessor {
 			AlphaArgsBlank.allocate( MaxAlphaArgsFound );
 		}
 
-		Count = 0;
 		Status = -1;
-		UCObject = MakeUPPERCase( Object );
-		if ( SortedIDD ) {
-			Found = FindItemInSortedList( UCObject, ListOfObjects, NumObjectDefs );
-			if ( Found != 0 ) Found = iListOfObjects( Found );
-		} else {
-			Found = FindItemInList( UCObject, ListOfObjects, NumObjectDefs );
-		}
-		if ( Found == 0 ) { //  This is more of a developer problem
-			ShowFatalError( "IP: GetObjectItem: Requested object=" + UCObject + ", not found in Object Definitions -- incorrect IDD attached." );
+		Found = ObjectDefIndex;
+		if ( Found < 1 || Found > NumObjectDefs ) { //  This is more of a developer problem
+			ShowFatalError( "IP: GetObjectItem: Requested object index=" + IPTrimSigDigits( Found ) + ", not found in Object Definitions -- incorrect IDD attached." );
 		}
 
 		if ( ObjectDef( Found ).NumAlpha > 0 ) {
 			if ( ObjectDef( Found ).NumAlpha > MaxAlphas ) {
 				cfld1 = IPTrimSigDigits( ObjectDef( Found ).NumAlpha );
 				cfld2 = IPTrimSigDigits( MaxAlphas );
-				ShowFatalError( "IP: GetObjectItem: " + Object + ", Number of ObjectDef Alpha Args [" + cfld1 + "] > Size of AlphaArg array [" + cfld2 + "]." );
+				ShowFatalError( "IP: GetObjectItem: " + ObjectDef( Found ).Name + ", Number of ObjectDef Alpha Args [" + cfld1 + "] > Size of AlphaArg array [" + cfld2 + "]." );
 			}
 			Alphas( {1,ObjectDef( Found ).NumAlpha} ) = BlankString;
 		}
@@ -2231,60 +2589,53 @@ namespace InputProcessor {
 			if ( ObjectDef( Found ).NumNumeric > MaxNumbers ) {
 				cfld1 = IPTrimSigDigits( ObjectDef( Found ).NumNumeric );
 				cfld2 = IPTrimSigDigits( MaxNumbers );
-				ShowFatalError( "IP: GetObjectItem: " + Object + ", Number of ObjectDef Numeric Args [" + cfld1 + "] > Size of NumericArg array [" + cfld2 + "]." );
+				ShowFatalError( "IP: GetObjectItem: " + ObjectDef( Found ).Name + ", Number of ObjectDef Numeric Args [" + cfld1 + "] > Size of NumericArg array [" + cfld2 + "]." );
 			}
 			Numbers( {1,ObjectDef( Found ).NumNumeric} ) = 0.0;
 		}
 
-		StartRecord = ObjectStartRecord( Found );
-		if ( StartRecord == 0 ) {
-			ShowWarningError( "IP: GetObjectItem: Requested object=" + UCObject + ", not found in IDF." );
+		if ( ObjectStartRecord( Found ) == 0 ) {
+			ShowWarningError( "IP: GetObjectItem: Requested object=" + ObjectDef( Found ).Name + ", not found in IDF." );
 			Status = -1;
-			StartRecord = NumIDFRecords + 1;
 		}
 
 		if ( ObjectGotCount( Found ) == 0 ) {
-			gio::write( EchoInputFile, fmtLD ) << "Getting object=" << UCObject;
+			gio::write( EchoInputFile, fmtLD ) << "Getting object=" << ObjectDef( Found ).Name;
 		}
 		++ObjectGotCount( Found );
 
-		for ( LoopIndex = StartRecord; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( IDFRecords( LoopIndex ).Name == UCObject ) {
-				++Count;
-				if ( Count == Number ) {
-					IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
-					if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
-						ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
-					}
-					NumAlphas = min( MaxAlphas, NumAlphas );
-					NumNumbers = min( MaxNumbers, NumNumbers );
-					GoodItem = true;
-					if ( NumAlphas > 0 ) {
-						Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
-					}
-					if ( NumNumbers > 0 ) {
-						Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
-					}
-					if ( present( NumBlank ) ) {
-						NumBlank = true;
-						if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
-					}
-					if ( present( AlphaBlank ) ) {
-						AlphaBlank = true;
-						if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
-					}
-					if ( present( AlphaFieldNames ) ) {
-						AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
-					}
-					if ( present( NumericFieldNames ) ) {
-						NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
-					}
-					Status = 1;
-					break;
-				}
+		LoopIndex = GetObjectRecordNum( Found, Number );
+		if ( LoopIndex > 0 ) {
+			IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
+			// Read this one
+			GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
+			if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
+				ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
+			}
+			NumAlphas = min( MaxAlphas, NumAlphas );
+			NumNumbers = min( MaxNumbers, NumNumbers );
+			GoodItem = true;
+			if ( NumAlphas > 0 ) {
+				Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
+			}
+			if ( NumNumbers > 0 ) {
+				Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
+			}
+			if ( present( NumBlank ) ) {
+				NumBlank = true;
+				if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
+			}
+			if ( present( AlphaBlank ) ) {
+				AlphaBlank = true;
+				if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
 			}
+			if ( present( AlphaFieldNames ) ) {
+				AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
+			}
+			if ( present( NumericFieldNames ) ) {
+				NumericFieldNames()( {1,ObjectDef( Found ).NumNumeric} ) = ObjectDef( Found ).NumRangeChks( {1,ObjectDef( Found ).NumNumeric} ).FieldName();
+			}
+			Status = 1;
 		}
 
 #ifdef IDDTEST
@@ -2361,7 +2712,7 @@ namespace InputProcessor {
 
 		// METHODOLOGY EMPLOYED:
 		// Use internal IDF record structure for each object occurrence
-		// and compare the name with ObjName.
+		// (through ObjectRecordIndex) and compare the name with ObjName.
 
 		// REFERENCES:
 		// na
@@ -2389,7 +2740,6 @@ namespace InputProcessor {
 		std::string UCObjType; // Upper Case for ObjType
 		bool ItemFound; // Set to true if item found
 		bool ObjectFound; // Set to true if object found
-		int StartRecord; // Start record for objects
 
 		ItemNum = 0;
 		ItemFound = false;
@@ -2406,18 +2756,13 @@ namespace InputProcessor {
 
 			ObjectFound = true;
 			NumObjOfType = ObjectDef( Found ).NumFound;
-			ItemNum = 0;
-			StartRecord = ObjectStartRecord( Found );
-
-			if ( StartRecord > 0 ) {
-				for ( ObjNum = StartRecord; ObjNum <= NumIDFRecords; ++ObjNum ) {
-					if ( IDFRecords( ObjNum ).Name != UCObjType ) continue;
-					++ItemNum;
-					if ( ItemNum > NumObjOfType ) break;
-					if ( IDFRecords( ObjNum ).Alphas( 1 ) == ObjName ) {
-						ItemFound = true;
-						break;
-					}
+
+			for ( ItemNum = 1; ItemNum <= NumObjOfType; ++ItemNum ) {
+				ObjNum = GetObjectRecordNum( Found, ItemNum );
+				if ( ObjNum == 0 ) break;
+				if ( IDFRecords( ObjNum ).Alphas( 1 ) == ObjName ) {
+					ItemFound = true;
+					break;
 				}
 			}
 		}
@@ -5632,7 +5977,8 @@ namespace InputProcessor {
 
 		// METHODOLOGY EMPLOYED:
 		// OutputVariablesForSimulation is a linked list structure for later
-		// semi-easy perusal.
+		// semi-easy perusal.  OutputVariablesForSimulationIndex finds the first
+		// item of a variable name and the requested keys without a search.
 
 		// REFERENCES:
 		// na
@@ -5665,20 +6011,22 @@ namespace InputProcessor {
 			vnameLen = len_trim( VariableName.substr( 0, rbpos ) );
 		}
 
-		FoundOne = false;
 		std::string const VarName( VariableName.substr( 0, vnameLen ) );
-		for ( CurNum = 1; CurNum <= NumConsideredOutputVariables; ++CurNum ) {
-			if ( VarName == OutputVariablesForSimulation( CurNum ).VarName ) {
-				FoundOne = true;
-				break;
-			}
+		OutputReportingVariablesIndex & Index( OutputVariablesForSimulationIndex[ MakeUPPERCase( VarName ) ] );
+		if ( KeyValue == "*" ) {
+			Index.AllKeys = true;
+		} else {
+			Index.Keys.insert( MakeUPPERCase( KeyValue ) );
 		}
+		CurNum = Index.First;
+		FoundOne = ( CurNum != 0 );
 
 		if ( ! FoundOne ) {
 			if ( NumConsideredOutputVariables == MaxConsideredOutputVariables ) {
 				ReAllocateAndPreserveOutputVariablesForSimulation();
 			}
 			++NumConsideredOutputVariables;
+			Index.First = NumConsideredOutputVariables;
 			OutputVariablesForSimulation( NumConsideredOutputVariables ).Key = KeyValue;
 			OutputVariablesForSimulation( NumConsideredOutputVariables ).VarName = VarName;
 			OutputVariablesForSimulation( NumConsideredOutputVariables ).Previous = 0;
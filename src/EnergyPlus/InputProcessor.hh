@@ -89,6 +89,9 @@ namespace InputProcessor {
 	extern FArray1D_int iListOfObjects;
 	extern FArray1D_int ObjectGotCount;
 	extern FArray1D_int ObjectStartRecord;
+	extern FArray1D_int ObjectRecordIndex; // IDF record numbers grouped by object definition (in input order)
+	extern FArray1D_int ObjectRecordIndexStart; // Position of each object definition's first record in ObjectRecordIndex
+	extern int ObjectRecordIndexCount; // Number of IDF records when ObjectRecordIndex was built
 	extern std::string CurrentFieldName; // Current Field Name (IDD)
 	extern FArray1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	extern std::string ReplacementName;
@@ -439,6 +442,9 @@ namespace InputProcessor {
 	void
 	ProcessInputDataFile( std::istream & idf_stream );
 
+	int
+	CountIDFObjectTerminators( std::istream & idf_stream );
+
 	void
 	ValidateSection(
 		std::string const & ProposedSection,
@@ -478,6 +484,21 @@ namespace InputProcessor {
 		int & LastRecord
 	);
 
+	void
+	BuildObjectRecordIndex();
+
+	int
+	GetObjectDefIndex( std::string const & Object );
+
+	int
+	GetNumObjectsFound( int const ObjectDefIndex );
+
+	int
+	GetObjectRecordNum(
+		int const ObjectDefIndex,
+		int const Number
+	);
+
 	void
 	GetObjectItem(
 		std::string const & Object,
@@ -493,6 +514,21 @@ namespace InputProcessor {
 		Optional< FArray1_string > NumericFieldNames = _
 	);
 
+	void
+	GetObjectItem(
+		int const ObjectDefIndex,
+		int const Number,
+		FArray1S_string Alphas,
+		int & NumAlphas,
+		FArray1S< Real64 > Numbers,
+		int & NumNumbers,
+		int & Status,
+		Optional< FArray1_bool > NumBlank = _,
+		Optional< FArray1_bool > AlphaBlank = _,
+		Optional< FArray1_string > AlphaFieldNames = _,
+		Optional< FArray1_string > NumericFieldNames = _
+	);
+
 	int
 	GetObjectItemNum(
 		std::string const & ObjType, // Object Type (ref: IDD Objects)
@@ -0,0 +1,276 @@
+// C++ Headers
+#include <fstream>
+#include <sstream>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include <MemoryUsage.hh>
+#include <DataDaylighting.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataViewFactorInformation.hh>
+#include <General.hh>
+#include <HeatBalanceIntRadExchange.hh>
+#include <OutputProcessor.hh>
+#include <ScheduleManager.hh>
+#include <SolarShading.hh>
+
+namespace EnergyPlus {
+
+namespace MemoryUsage {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Reports how much array storage the modules with the largest run time arrays hold, and the
+	// resident memory of the process, before and after sizing, after the simulation setup (when
+	// all the input has been read) and at the end of the simulation.
+	// The report is requested with the Output:Diagnostics key DisplayMemoryUsage.
+
+	// METHODOLOGY EMPLOYED:
+	// The element storage of each module's arrays (including the arrays nested in its derived
+	// types) is summed from the array sizes.  The largest value sampled at the report stages is
+	// also reported; arrays allocated and freed between two stages are not seen, so it is not a
+	// high-water mark.  The process resident set size and its high-water mark are read from the
+	// operating system where it provides them (/proc/self/status on Linux).
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// na
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using DataGlobals::OutputFileInits;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS
+	int const NumMemoryUsageModules( 5 ); // Number of modules whose array storage is reported
+	int const SolarShadingModule( 1 );
+	int const DaylightingModule( 2 );
+	int const OutputProcessorModule( 3 );
+	int const ScheduleModule( 4 );
+	int const IntRadExchangeModule( 5 );
+	FArray1D_string const ModuleNames( NumMemoryUsageModules, { "Solar Shading", "Daylighting", "Output Processor", "Schedules", "Interior Radiant Exchange" } );
+	Real64 const BytesPerMB( 1048576.0 );
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool MemoryUsageHeaderWritten( false ); // True once the eio header line has been written
+	FArray1D< Real64 > MaxSampledModuleBytes( NumMemoryUsageModules, 0.0 ); // Largest array storage sampled for each module at the report stages
+
+	// Functions
+
+	Real64
+	ModuleArrayBytes( int const ModuleNum ) // Index of the reported module
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the bytes of element storage currently held by the arrays of a module.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Return value
+		Real64 Bytes( 0.0 );
+
+		if ( ModuleNum == SolarShadingModule ) {
+			using namespace DataHeatBalance;
+			using SolarShading::SunlitFracCache;
+			using SolarShading::WindowRevealStatus;
+			Bytes += ArrayBytes( SunlitFrac ) + ArrayBytes( SunlitFracHR ) + ArrayBytes( SunlitFracWithoutReveal );
+			Bytes += ArrayBytes( CosIncAng ) + ArrayBytes( CosIncAngHR );
+			Bytes += ArrayBytes( BackSurfaces ) + ArrayBytes( OverlapAreas ) + ArrayBytes( WindowRevealStatus );
+			Bytes += ArrayBytes( SunlitFracCache );
+			for ( auto const & Entry : SunlitFracCache ) {
+				Bytes += ArrayBytes( Entry.SunCos ) + ArrayBytes( Entry.SAREA ) + ArrayBytes( Entry.SunlitFracWithoutReveal ) + ArrayBytes( Entry.WindowRevealStatus );
+			}
+		} else if ( ModuleNum == DaylightingModule ) {
+			using DataDaylighting::ZoneDaylight;
+			using DataDaylighting::IllumMapCalc;
+			Bytes += ArrayBytes( ZoneDaylight ) + ArrayBytes( IllumMapCalc );
+			for ( int Loop = 1, Loop_end = ZoneDaylight.u(); Loop <= Loop_end; ++Loop ) {
+				auto const & Zone( ZoneDaylight( Loop ) );
+				Bytes += ArrayBytes( Zone.DaylIllFacSky ) + ArrayBytes( Zone.DaylSourceFacSky ) + ArrayBytes( Zone.DaylBackFacSky );
+				Bytes += ArrayBytes( Zone.DaylIllFacSun ) + ArrayBytes( Zone.DaylIllFacSunDisk ) + ArrayBytes( Zone.DaylSourceFacSun );
+				Bytes += ArrayBytes( Zone.DaylSourceFacSunDisk ) + ArrayBytes( Zone.DaylBackFacSun ) + ArrayBytes( Zone.DaylBackFacSunDisk );
+			}
+			for ( int Loop = 1, Loop_end = IllumMapCalc.u(); Loop <= Loop_end; ++Loop ) {
+				auto const & Map( IllumMapCalc( Loop ) );
+				Bytes += ArrayBytes( Map.DaylIllFacSky ) + ArrayBytes( Map.DaylSourceFacSky ) + ArrayBytes( Map.DaylBackFacSky );
+				Bytes += ArrayBytes( Map.DaylIllFacSun ) + ArrayBytes( Map.DaylIllFacSunDisk ) + ArrayBytes( Map.DaylSourceFacSun );
+				Bytes += ArrayBytes( Map.DaylSourceFacSunDisk ) + ArrayBytes( Map.DaylBackFacSun ) + ArrayBytes( Map.DaylBackFacSunDisk );
+			}
+		} else if ( ModuleNum == OutputProcessorModule ) {
+			using namespace OutputProcessor;
+			Bytes += ArrayBytes( RVariableTypes ) + ArrayBytes( IVariableTypes ) + ArrayBytes( DDVariableTypes );
+			Bytes += ArrayBytes( ReqRepVars ) + ArrayBytes( VarMeterArrays ) + ArrayBytes( EnergyMeters );
+			Bytes += ArrayBytes( MeterValue ) + ArrayBytes( TimeValue );
+		} else if ( ModuleNum == ScheduleModule ) {
+			using namespace ScheduleManager;
+			Bytes += ArrayBytes( DaySchedule ) + ArrayBytes( WeekSchedule ) + ArrayBytes( Schedule );
+			for ( int Loop = 1, Loop_end = DaySchedule.u(); Loop <= Loop_end; ++Loop ) {
+				Bytes += ArrayBytes( DaySchedule( Loop ).TSValue );
+			}
+		} else if ( ModuleNum == IntRadExchangeModule ) {
+			using DataViewFactorInformation::ZoneInfo;
+			using HeatBalanceIntRadExchange::ZoneScriptFCache;
+			Bytes += ArrayBytes( ZoneInfo ) + ArrayBytes( ZoneScriptFCache );
+			for ( int Loop = 1, Loop_end = ZoneInfo.u(); Loop <= Loop_end; ++Loop ) {
+				Bytes += ArrayBytes( ZoneInfo( Loop ).F ) + ArrayBytes( ZoneInfo( Loop ).ScriptF );
+			}
+			for ( int Loop = 1, Loop_end = ZoneScriptFCache.u(); Loop <= Loop_end; ++Loop ) {
+				auto const & Cache( ZoneScriptFCache( Loop ) );
+				Bytes += ArrayBytes( Cache.BaseEmissivity ) + ArrayBytes( Cache.BaseInverse ) + ArrayBytes( Cache.Entries );
+				for ( auto const & Entry : Cache.Entries ) {
+					Bytes += ArrayBytes( Entry.Emissivity ) + ArrayBytes( Entry.ScriptF );
+				}
+			}
+		}
+
+		return Bytes;
+
+	}
+
+	void
+	GetProcessMemoryUsage(
+		Real64 & ResidentBytes, // Current resident set size of the process
+		Real64 & PeakResidentBytes // High-water mark of the resident set size
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gets the current and peak resident memory of the process.  Both are returned as -1.0
+		// where the operating system does not make them available.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		ResidentBytes = -1.0;
+		PeakResidentBytes = -1.0;
+
+#ifdef __linux__
+		std::ifstream Status( "/proc/self/status" );
+		std::string Line;
+		while ( std::getline( Status, Line ) ) {
+			bool const IsResident( Line.compare( 0, 6, "VmRSS:" ) == 0 );
+			bool const IsPeak( Line.compare( 0, 6, "VmHWM:" ) == 0 );
+			if ( ! IsResident && ! IsPeak ) continue;
+			std::istringstream Fields( Line.substr( 6 ) );
+			Real64 KiloBytes( 0.0 );
+			if ( ! ( Fields >> KiloBytes ) ) continue;
+			if ( IsResident ) {
+				ResidentBytes = KiloBytes * 1024.0;
+			} else {
+				PeakResidentBytes = KiloBytes * 1024.0;
+			}
+		}
+#endif
+
+	}
+
+	void
+	ReportMemoryUsage( std::string const & Stage ) // Point in the run the report is made at
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the current and largest sampled array storage of each reported module, and the
+		// current and peak resident memory of the process, to the eio file.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt Format_800( "('! <Memory Usage>, Stage, Module, Current {MB}, Max Sampled {MB}')" );
+		static gio::Fmt Format_801( "(' Memory Usage, ',A,',',A,',',A,',',A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 ResidentBytes; // Current resident set size of the process
+		Real64 PeakResidentBytes; // High-water mark of the resident set size
+
+		if ( ! MemoryUsageHeaderWritten ) {
+			gio::write( OutputFileInits, Format_800 );
+			MemoryUsageHeaderWritten = true;
+		}
+
+		for ( int ModuleNum = 1; ModuleNum <= NumMemoryUsageModules; ++ModuleNum ) {
+			Real64 const Bytes( ModuleArrayBytes( ModuleNum ) );
+			MaxSampledModuleBytes( ModuleNum ) = max( MaxSampledModuleBytes( ModuleNum ), Bytes );
+			gio::write( OutputFileInits, Format_801 ) << Stage << ModuleNames( ModuleNum ) << RoundSigDigits( Bytes / BytesPerMB, 3 ) << RoundSigDigits( MaxSampledModuleBytes( ModuleNum ) / BytesPerMB, 3 );
+		}
+
+		GetProcessMemoryUsage( ResidentBytes, PeakResidentBytes );
+		if ( ResidentBytes < 0.0 || PeakResidentBytes < 0.0 ) {
+			gio::write( OutputFileInits, Format_801 ) << Stage << "Process Resident Memory" << "N/A" << "N/A";
+		} else {
+			gio::write( OutputFileInits, Format_801 ) << Stage << "Process Resident Memory" << RoundSigDigits( ResidentBytes / BytesPerMB, 3 ) << RoundSigDigits( PeakResidentBytes / BytesPerMB, 3 );
+		}
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // MemoryUsage
+
+} // EnergyPlus
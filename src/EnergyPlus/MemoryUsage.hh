@@ -0,0 +1,88 @@
+#ifndef MemoryUsage_hh_INCLUDED
+#define MemoryUsage_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace MemoryUsage {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS
+	extern int const NumMemoryUsageModules; // Number of modules whose array storage is reported
+	extern int const SolarShadingModule;
+	extern int const DaylightingModule;
+	extern int const OutputProcessorModule;
+	extern int const ScheduleModule;
+	extern int const IntRadExchangeModule;
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool MemoryUsageHeaderWritten; // True once the eio header line has been written
+	extern FArray1D< Real64 > MaxSampledModuleBytes; // Largest array storage sampled for each module at the report stages
+
+	// Functions
+
+	template< typename A >
+	inline
+	Real64
+	ArrayBytes( A const & Array ) // FArray whose element storage is measured
+	{
+		return Real64( Array.size() ) * sizeof( typename A::value_type );
+	}
+
+	template< typename T >
+	inline
+	Real64
+	ArrayBytes( std::vector< T > const & Array ) // Vector whose element storage is measured
+	{
+		return Real64( Array.capacity() ) * sizeof( T );
+	}
+
+	Real64
+	ModuleArrayBytes( int const ModuleNum ); // Index of the reported module
+
+	void
+	GetProcessMemoryUsage(
+		Real64 & ResidentBytes, // Current resident set size of the process
+		Real64 & PeakResidentBytes // High-water mark of the resident set size
+	);
+
+	void
+	ReportMemoryUsage( std::string const & Stage ); // Point in the run the report is made at
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // MemoryUsage
+
+} // EnergyPlus
+
+#endif
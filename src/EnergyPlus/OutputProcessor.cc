@@ -215,9 +215,12 @@ namespace OutputProcessor {
 	Reference< RealVariables > RVar;
 	Reference< IntegerVariables > IVar;
 	FArray1D< ReqReportVariables > ReqRepVars;
+	std::unordered_map< std::string, ReqReportVariablesIndex > ReqRepVarsIndex; // by upper case variable name
 	FArray1D< MeterArrayType > VarMeterArrays;
 	FArray1D< MeterType > EnergyMeters;
 	FArray1D< EndUseCategoryType > EndUseCategory;
+	FArray1D< DirectCSVFileType > DirectCSVFiles( 5 ); // Time series tables (timestep, hourly, daily, monthly, run period)
+	std::vector< DirectCSVColumnType > DirectCSVColumns; // by report ID
 
 	// Routines tagged on the end of this module:
 	//  AddToOutputVariableList
@@ -440,13 +443,14 @@ namespace OutputProcessor {
 		// This instance being requested will always have a key associated with it.  Matching
 		// instances (from input) may or may not have keys, but only one instance of a reporting
 		// frequency per variable is allowed.  ReportList will be populated with ReqRepVars indices
-		// of those extra things from input that satisfy this condition.
+		// of those extra things from input that satisfy this condition.  The requests are indexed
+		// by upper case variable name and key (ReqRepVarsIndex) when they are read.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using InputProcessor::FindItem;
+		using InputProcessor::MakeUPPERCase;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -462,11 +466,6 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool GetInputFlag( true );
-		int Item;
-		int Loop;
-		int Pos;
-		int MinLook;
-		int MaxLook;
 
 		if ( GetInputFlag ) {
 			GetReportVariableInput();
@@ -474,49 +473,28 @@ namespace OutputProcessor {
 		}
 
 		if ( NumOfReqVariables > 0 ) {
-			// Do a quick check
-			Item = FindItem( VarName, ReqRepVars( {1,NumOfReqVariables} ).VarName(), NumOfReqVariables );
-
 			NumExtraVars = 0;
 			ReportList = 0;
-			MinLook = 999999999;
-			MaxLook = -999999999;
-
-			if ( Item != 0 ) {
-				Loop = Item;
-				Pos = Item;
-				MinLook = min( MinLook, Pos );
-				MaxLook = max( MaxLook, Pos );
-				while ( Loop <= NumOfReqVariables && Pos != 0 ) {
-					//  Mark all with blank keys as used
-					if ( ReqRepVars( Loop ).Key.empty() ) {
-						ReqRepVars( Loop ).Used = true;
-					}
-					if ( Loop < NumOfReqVariables ) {
-						Pos = FindItem( VarName, ReqRepVars( {Loop + 1,NumOfReqVariables} ).VarName(), NumOfReqVariables - Loop );
-						if ( Pos != 0 ) {
-							MinLook = min( MinLook, Loop + Pos );
-							MaxLook = max( MaxLook, Loop + Pos );
-						}
-					} else {
-						Pos = 1;
-					}
-					Loop += Pos;
+
+			auto const Found( ReqRepVarsIndex.find( MakeUPPERCase( VarName ) ) );
+			if ( Found != ReqRepVarsIndex.end() ) {
+				ReqReportVariablesIndex const & Requests( Found->second );
+				//  Mark all with blank keys as used
+				for ( int const Loop : Requests.BlankKeys ) {
+					ReqRepVars( Loop ).Used = true;
+				}
+				auto const KeyFound( Requests.Keys.find( MakeUPPERCase( KeyedValue ) ) );
+				if ( KeyFound != Requests.Keys.end() ) {
+					BuildKeyVarList( KeyFound->second );
 				}
-				BuildKeyVarList( KeyedValue, VarName, MinLook, MaxLook );
-				AddBlankKeys( VarName, MinLook, MaxLook );
+				AddBlankKeys( Requests.BlankKeys );
 			}
 		}
 
 	}
 
 	void
-	BuildKeyVarList(
-		std::string const & KeyedValue, // Associated Key for this variable
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	)
+	BuildKeyVarList( std::vector< int > const & KeyRequests ) // ReqRepVars indices requested for this key and variable
 	{
 
 		// SUBROUTINE INFORMATION:
@@ -530,14 +508,14 @@ namespace OutputProcessor {
 		// pointers to that data structure for this KeyedValue and VariableName.
 
 		// METHODOLOGY EMPLOYED:
-		// Go through the ReqRepVars list and add those
-		// that match (and dont duplicate ones already in the list).
+		// Go through the ReqRepVars requests for this key and variable (from ReqRepVarsIndex)
+		// and add those that dont duplicate ones already in the list.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using InputProcessor::SameString;
+		// na
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -552,14 +530,10 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Loop;
 		int Loop1;
 		bool Dup;
-		FArray1D_int TmpReportList;
 
-		for ( Loop = MinIndx; Loop <= MaxIndx; ++Loop ) {
-			if ( ! SameString( ReqRepVars( Loop ).VarName, VariableName ) ) continue;
-			if ( ! SameString( ReqRepVars( Loop ).Key, KeyedValue ) ) continue;
+		for ( int const Loop : KeyRequests ) {
 
 			//   A match.  Make sure doesnt duplicate
 
@@ -588,11 +562,7 @@ namespace OutputProcessor {
 	}
 
 	void
-	AddBlankKeys(
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	)
+	AddBlankKeys( std::vector< int > const & BlankKeyRequests ) // ReqRepVars indices requested for all keys of this variable
 	{
 
 		// SUBROUTINE INFORMATION:
@@ -607,14 +577,14 @@ namespace OutputProcessor {
 		// a frequency already on the list).
 
 		// METHODOLOGY EMPLOYED:
-		// Go through the ReqRepVars list and add those
-		// that match (and dont duplicate ones already in the list).
+		// Go through the ReqRepVars requests for all keys of this variable (from ReqRepVarsIndex)
+		// and add those that dont duplicate ones already in the list.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
-		using InputProcessor::SameString;
+		// na
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -629,14 +599,10 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Loop;
 		int Loop1;
 		bool Dup;
-		FArray1D_int TmpReportList;
 
-		for ( Loop = MinIndx; Loop <= MaxIndx; ++Loop ) {
-			if ( ! ReqRepVars( Loop ).Key.empty() ) continue;
-			if ( ! SameString( ReqRepVars( Loop ).VarName, VariableName ) ) continue;
+		for ( int const Loop : BlankKeyRequests ) {
 
 			//   A match.  Make sure doesnt duplicate
 
@@ -786,6 +752,13 @@ namespace OutputProcessor {
 
 			ReqRepVars( Loop ).Used = false;
 
+			ReqReportVariablesIndex & Requests( ReqRepVarsIndex[ MakeUPPERCase( ReqRepVars( Loop ).VarName ) ] );
+			if ( ReqRepVars( Loop ).Key.empty() ) {
+				Requests.BlankKeys.push_back( Loop );
+			} else {
+				Requests.Keys[ MakeUPPERCase( ReqRepVars( Loop ).Key ) ].push_back( Loop );
+			}
+
 		}
 
 		if ( ErrorsFound ) {
@@ -3748,7 +3721,9 @@ namespace OutputProcessor {
 
 		// Using/Aliasing
 		using namespace DataPrecisionGlobals;
+		using DataGlobals::eso_stream;
 		using DataStringGlobals::NL;
+		using DataSystemVariables::DirectCSVOutput;
 
 		// Locals
 		// FUNCTION ARGUMENT DEFINITIONS:
@@ -3765,8 +3740,29 @@ namespace OutputProcessor {
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		static int const N( 100 );
 		static char stamp[ N ];
+		static FArray1D_string const MonthNames( 12, { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" } );
+		int TimeSeconds; // End of the reporting interval in seconds of the day
 		assert( reportIDString.length() + DayOfSimChr.length() + ( DayType.present() ? DayType().length() : 0u ) + 26 < N ); // Check will fit in stamp size
 
+		// The eso time stamps also start the rows of the time series tables
+		if ( DirectCSVOutput && out_stream_p == eso_stream ) {
+			if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
+				TimeSeconds = nint( ( ( Hour() - 1 ) * 60.0 + EndMinute() ) * 60.0 );
+				std::sprintf( stamp, " %02d/%02d  %02d:%02d:%02d", Month(), DayOfMonth(), TimeSeconds / 3600, ( TimeSeconds / 60 ) % 60, TimeSeconds % 60 );
+				StartDirectCSVRow( reportingInterval, stamp );
+			} else if ( reportingInterval == ReportHourly ) {
+				std::sprintf( stamp, " %02d/%02d  %02d:00:00", Month(), DayOfMonth(), Hour() );
+				StartDirectCSVRow( reportingInterval, stamp );
+			} else if ( reportingInterval == ReportDaily ) {
+				std::sprintf( stamp, " %02d/%02d", Month(), DayOfMonth() );
+				StartDirectCSVRow( reportingInterval, stamp );
+			} else if ( reportingInterval == ReportMonthly ) {
+				StartDirectCSVRow( reportingInterval, MonthNames( Month() ) );
+			} else if ( reportingInterval == ReportSim ) {
+				StartDirectCSVRow( reportingInterval, "simdays=" + DayOfSimChr );
+			}
+		}
+
 		if ( ( ! out_stream_p ) || ( ! *out_stream_p ) ) return; // Stream
 
 		std::ostream & out_stream( *out_stream_p );
@@ -3832,6 +3828,7 @@ namespace OutputProcessor {
 
 		// Using/Aliasing
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataStringGlobals::NL;
 
 		// Locals
@@ -3871,6 +3868,8 @@ namespace OutputProcessor {
 			if ( eso_stream ) *eso_stream << reportIDChr << ",11," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
 		}
 
+		if ( DirectCSVOutput ) AddDirectCSVColumn( reportingInterval, reportID, keyedValue + ':' + variableName + " [" + UnitsString + ']' );
+
 		if ( sqlite->writeOutputToSQLite() ) {
 			if ( ! present( ScheduleName ) ) {
 				sqlite->createSQLiteReportVariableDictionaryRecord( reportID, storeType, indexGroup, keyedValue, variableName, indexType, UnitsString, reportingInterval );
@@ -3916,6 +3915,7 @@ namespace OutputProcessor {
 
 		// Using/Aliasing
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataGlobals::mtr_stream;
 		using DataStringGlobals::NL;
 
@@ -4001,6 +4001,10 @@ namespace OutputProcessor {
 
 		}
 
+		if ( DirectCSVOutput && ! meterFileOnlyFlag ) {
+			AddDirectCSVColumn( reportingInterval, reportID, ( cumulativeMeterFlag ? "Cumulative " : "" ) + meterName + " [" + UnitsString + ']' );
+		}
+
 		if ( sqlite->writeOutputToSQLite() ) {
 			static std::string const keyedValueStringCum( "Cumulative " );
 			static std::string const keyedValueStringNon( "" );
@@ -4109,6 +4113,7 @@ namespace OutputProcessor {
 		// Using/Aliasing
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataStringGlobals::NL;
 		using General::strip_trailing_zeros;
 
@@ -4169,6 +4174,8 @@ namespace OutputProcessor {
 
 		}
 
+		if ( DirectCSVOutput ) SetDirectCSVValue( reportID, NumberOut );
+
 	}
 
 	void
@@ -4198,6 +4205,7 @@ namespace OutputProcessor {
 
 		// Using/Aliasing
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataGlobals::mtr_stream;
 		using DataGlobals::StdOutputRecordCount;
 		using DataGlobals::StdMeterRecordCount;
@@ -4240,6 +4248,7 @@ namespace OutputProcessor {
 
 			if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << NL;
 			++StdOutputRecordCount;
+			if ( DirectCSVOutput ) SetDirectCSVValue( reportID, NumberOut );
 		}
 
 	}
@@ -4277,6 +4286,7 @@ namespace OutputProcessor {
 		// Using/Aliasing
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataGlobals::mtr_stream;
 		using DataGlobals::StdOutputRecordCount;
 		using DataGlobals::StdMeterRecordCount;
@@ -4353,6 +4363,7 @@ namespace OutputProcessor {
 				if ( eso_stream ) *eso_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
 				++StdOutputRecordCount;
 			}
+			if ( DirectCSVOutput ) SetDirectCSVValue( reportID, NumberOut );
 
 		}
 
@@ -4426,6 +4437,7 @@ namespace OutputProcessor {
 
 		// Using/Aliasing
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataStringGlobals::NL;
 		using General::strip_trailing_zeros;
 		using DataSystemVariables::ReportDuringWarmup;
@@ -4517,6 +4529,7 @@ namespace OutputProcessor {
 		}
 
 		if ( eso_stream ) *eso_stream << creportID << ',' << s << NL;
+		if ( DirectCSVOutput ) SetDirectCSVValue( reportID, s );
 
 	}
 
@@ -4618,6 +4631,7 @@ namespace OutputProcessor {
 		// Using/Aliasing
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataStringGlobals::NL;
 		using General::strip_trailing_zeros;
 
@@ -4667,6 +4681,7 @@ namespace OutputProcessor {
 		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
 			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
 		}
+		if ( DirectCSVOutput ) SetDirectCSVValue( reportID, NumberOut );
 
 	}
 
@@ -4700,6 +4715,7 @@ namespace OutputProcessor {
 
 		// Using/Aliasing
 		using DataGlobals::eso_stream;
+		using DataSystemVariables::DirectCSVOutput;
 		using DataStringGlobals::NL;
 		using General::strip_trailing_zeros;
 
@@ -4730,6 +4746,270 @@ namespace OutputProcessor {
 		}
 
 		if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << NL;
+		if ( DirectCSVOutput ) SetDirectCSVValue( reportID, NumberOut );
+
+	}
+
+	int
+	DirectCSVFileIndex( int const reportingInterval ) // The reporting interval (e.g., hourly, daily)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the time series table (DirectCSVFiles) of a reporting interval.
+		// Detailed and timestep data share a table the same way they share the eso time stamps.
+
+		// Return value
+		int FileIndex;
+
+		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
+			FileIndex = 1;
+		} else if ( reportingInterval == ReportHourly ) {
+			FileIndex = 2;
+		} else if ( reportingInterval == ReportDaily ) {
+			FileIndex = 3;
+		} else if ( reportingInterval == ReportMonthly ) {
+			FileIndex = 4;
+		} else if ( reportingInterval == ReportSim ) {
+			FileIndex = 5;
+		} else {
+			FileIndex = 0;
+		}
+
+		return FileIndex;
+
+	}
+
+	void
+	AddDirectCSVColumn(
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		int const reportID, // The reporting ID for the data
+		std::string const & Heading // Key and name of the data with its units
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine adds a column for a data dictionary item to the time series table
+		// of its reporting interval, opening the table on its first column.
+
+		// METHODOLOGY EMPLOYED:
+		// The tables are written while simulating, so that the eso does not have to be
+		// converted afterwards.  Items can be added to the data dictionary after rows have
+		// been written, so the rows go to a scratch file and the heading line is put in
+		// front of them when the tables are closed (CloseDirectCSVOutput).
+
+		// Using/Aliasing
+		using DataStringGlobals::NL;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static FArray1D_string const FileNames( 5, { "eplusout_timestep.csv", "eplusout_hourly.csv", "eplusout_daily.csv", "eplusout_monthly.csv", "eplusout_runperiod.csv" } );
+		static FArray1D_string const FreqNames( 5, { "(TimeStep)", "(Hourly)", "(Daily)", "(Monthly)", "(RunPeriod)" } );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const FileIndex( DirectCSVFileIndex( reportingInterval ) );
+		int write_stat;
+
+		if ( FileIndex == 0 || reportID < 1 ) return;
+		auto & File( DirectCSVFiles( FileIndex ) );
+
+		if ( File.BodyUnit == 0 ) {
+			File.FileName = FileNames( FileIndex );
+			File.BodyUnit = GetNewUnitNumber();
+			{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( File.BodyUnit, File.FileName + ".tmp", flags ); write_stat = flags.ios(); }
+			if ( write_stat != 0 ) {
+				ShowFatalError( "AddDirectCSVColumn: Could not open file \"" + File.FileName + ".tmp\" for output (write)." );
+			}
+			File.BodyStream = gio::out_stream( File.BodyUnit );
+		}
+
+		if ( reportingInterval == ReportEach ) {
+			File.Headers.push_back( Heading + "(Detailed)" );
+		} else {
+			File.Headers.push_back( Heading + FreqNames( FileIndex ) );
+		}
+		File.Row.emplace_back();
+
+		if ( reportID >= int( DirectCSVColumns.size() ) ) DirectCSVColumns.resize( reportID + 1 );
+		DirectCSVColumns[ reportID ].File = FileIndex;
+		DirectCSVColumns[ reportID ].Column = File.Headers.size();
+
+	}
+
+	void
+	StartDirectCSVRow(
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		std::string const & TimeStamp // Date/Time of the row
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine starts a new row of the time series table of a reporting interval,
+		// writing the previous one.  A time stamp repeating the one of the current row (the
+		// last system time step of a zone time step, for instance) continues the current row,
+		// unless a new environment has started: the monthly and run period stamps (month name,
+		// days simulated) repeat from one environment to the next.
+
+		// Using/Aliasing
+		using DataEnvironment::CurEnvirNum;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const FileIndex( DirectCSVFileIndex( reportingInterval ) );
+
+		if ( FileIndex == 0 ) return;
+		auto & File( DirectCSVFiles( FileIndex ) );
+		if ( File.BodyUnit == 0 ) return;
+
+		if ( File.RowPending && File.Environment == CurEnvirNum && File.TimeStamp == TimeStamp ) return;
+		WriteDirectCSVRow( File );
+		File.TimeStamp = TimeStamp;
+		File.Environment = CurEnvirNum;
+		File.RowPending = true;
+
+	}
+
+	void
+	SetDirectCSVValue(
+		int const reportID, // The reporting ID for the data
+		std::string const & Value // The value as written to the eso
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine puts a reported value in the current row of its time series table.
+
+		if ( reportID < 1 || reportID >= int( DirectCSVColumns.size() ) ) return;
+		auto const & Column( DirectCSVColumns[ reportID ] );
+		if ( Column.File == 0 ) return;
+		auto & File( DirectCSVFiles( Column.File ) );
+		if ( ! File.RowPending ) return;
+
+		File.Row[ Column.Column - 1 ] = Value;
+
+	}
+
+	void
+	WriteDirectCSVRow( DirectCSVFileType & File ) // The time series table
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine writes the current row of a time series table to its scratch file.
+		// The row has the columns known so far; CloseDirectCSVOutput pads it to the final width.
+
+		// Using/Aliasing
+		using DataStringGlobals::NL;
+
+		if ( ! File.RowPending ) return;
+
+		if ( File.BodyStream ) {
+			std::ostream & out_stream( *File.BodyStream );
+			out_stream << File.TimeStamp;
+			for ( auto & Value : File.Row ) {
+				out_stream << ',' << Value;
+				Value.clear();
+			}
+			out_stream << NL;
+		}
+		File.RowPending = false;
+
+	}
+
+	void
+	CloseDirectCSVOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine finishes the time series tables: the heading line is written and
+		// followed by the rows of the scratch file, which is deleted afterwards.
+
+		// METHODOLOGY EMPLOYED:
+		// The rows are copied as they are; only the columns added to the data dictionary
+		// after a row was written are appended to it (blank).
+
+		// Using/Aliasing
+		using DataStringGlobals::NL;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FileUnit; // Unit of the time series table
+		int ScratchUnit; // Unit the scratch file is read back on
+		std::string Line; // Row read from the scratch file
+		int write_stat;
+		int read_stat;
+
+		for ( int FileIndex = 1; FileIndex <= DirectCSVFiles.u(); ++FileIndex ) {
+			auto & File( DirectCSVFiles( FileIndex ) );
+			if ( File.BodyUnit == 0 ) continue;
+
+			WriteDirectCSVRow( File );
+			gio::close( File.BodyUnit );
+			File.BodyStream = nullptr;
+
+			FileUnit = GetNewUnitNumber();
+			{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( FileUnit, File.FileName, flags ); write_stat = flags.ios(); }
+			if ( write_stat != 0 ) {
+				ShowSevereError( "CloseDirectCSVOutput: Could not open file \"" + File.FileName + "\" for output (write)." );
+			} else {
+				std::ostream & out_stream( *gio::out_stream( FileUnit ) );
+				out_stream << "Date/Time";
+				for ( auto const & Heading : File.Headers ) out_stream << ',' << Heading;
+				out_stream << NL;
+
+				// the closed scratch unit may have been reused for the table, so read it back on a new one
+				ScratchUnit = GetNewUnitNumber();
+				{ IOFlags flags; flags.ACTION( "read" ); gio::open( ScratchUnit, File.FileName + ".tmp", flags ); read_stat = flags.ios(); }
+				while ( read_stat == 0 ) {
+					{ IOFlags flags; gio::read( ScratchUnit, fmtA, flags ) >> Line; read_stat = flags.ios(); }
+					if ( read_stat != 0 ) break;
+					out_stream << Line;
+					for ( std::size_t Column = std::count( Line.begin(), Line.end(), ',' ); Column < File.Headers.size(); ++Column ) {
+						out_stream << ',';
+					}
+					out_stream << NL;
+				}
+				gio::close( FileUnit );
+				{ IOFlags flags; flags.DISPOSE( "DELETE" ); gio::close( ScratchUnit, flags ); }
+			}
+
+			File.BodyUnit = 0;
+			File.Headers.clear();
+			File.Row.clear();
+			File.RowPending = false;
+		}
+		DirectCSVColumns.clear();
 
 	}
 
@@ -7608,6 +7888,7 @@ ReportingThisVariable( std::string const & RepVarName )
 	// Using/Aliasing
 	using namespace OutputProcessor;
 	using InputProcessor::FindItem;
+	using InputProcessor::MakeUPPERCase;
 
 	// Return value
 	bool BeingReported;
@@ -7627,11 +7908,7 @@ ReportingThisVariable( std::string const & RepVarName )
 	// FUNCTION LOCAL VARIABLE DECLARATIONS:
 	int Found;
 
-	BeingReported = false;
-	Found = FindItem( RepVarName, ReqRepVars.VarName(), NumOfReqVariables );
-	if ( Found > 0 ) {
-		BeingReported = true;
-	}
+	BeingReported = ( ReqRepVarsIndex.count( MakeUPPERCase( RepVarName ) ) > 0 );
 
 	if ( ! BeingReported ) { // check meter names too
 		Found = FindItem( RepVarName, EnergyMeters.Name(), NumEnergyMeters );
@@ -3,6 +3,9 @@
 
 // C++ Headers
 #include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
@@ -529,6 +532,18 @@ namespace OutputProcessor {
 
 	};
 
+	struct ReqReportVariablesIndex // Requested Report Variables of one variable name
+	{
+		// Members
+		std::vector< int > BlankKeys; // ReqRepVars indices of the requests for all keys (blank or "*"), in input order
+		std::unordered_map< std::string, std::vector< int > > Keys; // ReqRepVars indices by upper case key, in input order
+
+		// Default Constructor
+		ReqReportVariablesIndex()
+		{}
+
+	};
+
 	struct MeterArrayType
 	{
 		// Members
@@ -887,6 +902,42 @@ namespace OutputProcessor {
 
 	};
 
+	struct DirectCSVFileType // Time series table of one reporting frequency (see DataSystemVariables::DirectCSVOutput)
+	{
+		// Members
+		std::string FileName; // Name of the table (eplusout_<frequency>.csv)
+		int BodyUnit; // Unit of the scratch file holding the rows until all the columns are known
+		std::ostream * BodyStream; // Stream of the scratch file
+		std::vector< std::string > Headers; // Column headings, in data dictionary order
+		std::vector< std::string > Row; // Values of the current row by column (blank when not reported)
+		std::string TimeStamp; // Date/Time of the current row
+		int Environment; // Environment (DataEnvironment::CurEnvirNum) of the current row
+		bool RowPending; // True when the current row is not written yet
+
+		// Default Constructor
+		DirectCSVFileType() :
+			BodyUnit( 0 ),
+			BodyStream( nullptr ),
+			Environment( 0 ),
+			RowPending( false )
+		{}
+
+	};
+
+	struct DirectCSVColumnType // Location of a report ID in the time series tables
+	{
+		// Members
+		int File; // DirectCSVFiles index (0 = not in a table)
+		int Column; // Column in the table, not counting the Date/Time column
+
+		// Default Constructor
+		DirectCSVColumnType() :
+			File( 0 ),
+			Column( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< TimeSteps > TimeValue; // Pointers to the actual TimeStep variables
 	extern FArray1D< RealVariableType > RVariableTypes; // Variable Types structure (use NumOfRVariables to traverse)
@@ -897,9 +948,12 @@ namespace OutputProcessor {
 	extern Reference< RealVariables > RVar;
 	extern Reference< IntegerVariables > IVar;
 	extern FArray1D< ReqReportVariables > ReqRepVars;
+	extern std::unordered_map< std::string, ReqReportVariablesIndex > ReqRepVarsIndex; // by upper case variable name
 	extern FArray1D< MeterArrayType > VarMeterArrays;
 	extern FArray1D< MeterType > EnergyMeters;
 	extern FArray1D< EndUseCategoryType > EndUseCategory;
+	extern FArray1D< DirectCSVFileType > DirectCSVFiles; // Time series tables (timestep, hourly, daily, monthly, run period)
+	extern std::vector< DirectCSVColumnType > DirectCSVColumns; // by report ID
 
 	// Functions
 
@@ -919,19 +973,10 @@ namespace OutputProcessor {
 	);
 
 	void
-	BuildKeyVarList(
-		std::string const & KeyedValue, // Associated Key for this variable
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	);
+	BuildKeyVarList( std::vector< int > const & KeyRequests ); // ReqRepVars indices requested for this key and variable
 
 	void
-	AddBlankKeys(
-		std::string const & VariableName, // String Name of variable
-		int const MinIndx, // Min number (from previous routine) for this variable
-		int const MaxIndx // Max number (from previous routine) for this variable
-	);
+	AddBlankKeys( std::vector< int > const & BlankKeyRequests ); // ReqRepVars indices requested for all keys of this variable
 
 	void
 	GetReportVariableInput();
@@ -1248,6 +1293,34 @@ namespace OutputProcessor {
 		Optional< Real64 const > RealValue = _ // the value of the data
 	);
 
+	int
+	DirectCSVFileIndex( int const reportingInterval ); // The reporting interval (e.g., hourly, daily)
+
+	void
+	AddDirectCSVColumn(
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		int const reportID, // The reporting ID for the data
+		std::string const & Heading // Key and name of the data with its units
+	);
+
+	void
+	StartDirectCSVRow(
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		std::string const & TimeStamp // Date/Time of the row
+	);
+
+	void
+	SetDirectCSVValue(
+		int const reportID, // The reporting ID for the data
+		std::string const & Value // The value as written to the eso
+	);
+
+	void
+	WriteDirectCSVRow( DirectCSVFileType & File ); // The time series table
+
+	void
+	CloseDirectCSVOutput();
+
 	int
 	DetermineIndexGroupKeyFromMeterName( std::string const & meterName ); // the meter name
 
@@ -445,25 +445,13 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true );
+		// na
 
 		if ( IndexTypeKey != ZoneTSReporting && IndexTypeKey != HVACTSReporting ) {
 			ShowFatalError( "Invalid reporting requested -- UpdateTabularReports" );
 		}
 
-		if ( GetInput ) {
-			GetInputTabularMonthly();
-			GetInputTabularTimeBins();
-			GetInputTabularStyle();
-			GetInputTabularPredefined();
-			// noel -- noticed this was called once and very slow -- sped up a little by caching keys
-			InitializeTabularMonthly();
-			GetInputFuelAndPollutionFactors();
-			SetupUnitConversions();
-			AddTOCZoneLoadComponentTable();
-			GetInput = false;
-			date_and_time_string( _, _, _, td );
-		}
+		GetInputTabularReports();
 		if ( DoOutputReporting && WriteTabularFiles && ( KindOfSim == ksRunPeriodWeather ) ) {
 			if ( IndexTypeKey == stepTypeZone ) {
 				gatherElapsedTimeBEPS += TimeStepZone;
@@ -485,6 +473,60 @@ namespace OutputReportTabular {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	GetInputTabularReports()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gets the input for all of the tabular reports the first time it is called.
+
+		// METHODOLOGY EMPLOYED:
+		// Normally called from UpdateTabularReports at the first reported timestep, when all the
+		// meters and variables exist. Also called directly when the tariffs are re-evaluated from
+		// saved meter data and no timestep is simulated.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool GetInput( true );
+
+		if ( GetInput ) {
+			GetInputTabularMonthly();
+			GetInputTabularTimeBins();
+			GetInputTabularStyle();
+			GetInputTabularPredefined();
+			// noel -- noticed this was called once and very slow -- sped up a little by caching keys
+			InitializeTabularMonthly();
+			GetInputFuelAndPollutionFactors();
+			SetupUnitConversions();
+			AddTOCZoneLoadComponentTable();
+			GetInput = false;
+			date_and_time_string( _, _, _, td );
+		}
+	}
+
 	void
 	GetInputTabularMonthly()
 	{
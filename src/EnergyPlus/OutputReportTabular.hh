@@ -739,6 +739,9 @@ namespace OutputReportTabular {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	GetInputTabularReports();
+
 	void
 	GetInputTabularMonthly();
 
@@ -407,6 +407,9 @@ namespace PlantPipingSystemsManager {
 					PipingSystemDomains( DomainNum ).FloorHeatFlux = PipingSystemDomains( DomainNum ).AggregateFloorHeatFlux / PipingSystemDomains( DomainNum ).NumHeatFlux;
 				}
 				
+				// Iterations are reported only for the time steps the domain is simulated
+				PipingSystemDomains( DomainNum ).Reporting.NumIterations = 0;
+
 				// Select run interval
 				if ( PipingSystemDomains( DomainNum ).SimTimestepFlag ) {
 					// Keep on going!
@@ -1279,6 +1282,17 @@ namespace PlantPipingSystemsManager {
 					ShowFatalError( "Preceding error causes program termination." );
 				}
 
+				// Set solution algorithm
+				if ( NumAlphas < 11 || lAlphaFieldBlanks( 11 ) || SameString( cAlphaArgs( 11 ), "GAUSSSEIDEL" ) ) {
+					PipingSystemDomains( DomainCtr ).SimControls.SolutionAlgorithm = SolutionAlgorithm_GaussSeidel;
+				} else if ( SameString( cAlphaArgs( 11 ), "ALTERNATINGDIRECTIONIMPLICIT" ) ) {
+					PipingSystemDomains( DomainCtr ).SimControls.SolutionAlgorithm = SolutionAlgorithm_ADI;
+				} else {
+					ShowSevereError( "Invalid " + cAlphaFieldNames( 11 ) + "=" + cAlphaArgs( 11 ) );
+					ShowContinueError( "Found in: " + cAlphaArgs( 1 ) );
+					ErrorsFound = true;
+				}
+
 
 				//******* We'll first set up the domain ********
 				PipingSystemDomains( DomainCtr ).IsActuallyPartOfAHorizontalTrench = false;
@@ -1800,6 +1814,17 @@ namespace PlantPipingSystemsManager {
 				ShowFatalError( "Preceding error causes program termination." );
 			}
 
+			// Set solution algorithm
+			if ( NumAlphas < 10 || lAlphaFieldBlanks( 10 ) || SameString( cAlphaArgs( 10 ), "GAUSSSEIDEL" ) ) {
+				PipingSystemDomains( DomainNum ).SimControls.SolutionAlgorithm = SolutionAlgorithm_GaussSeidel;
+			} else if ( SameString( cAlphaArgs( 10 ), "ALTERNATINGDIRECTIONIMPLICIT" ) ) {
+				PipingSystemDomains( DomainNum ).SimControls.SolutionAlgorithm = SolutionAlgorithm_ADI;
+			} else {
+				ShowSevereError( "Invalid " + cAlphaFieldNames( 10 ) + "=" + cAlphaArgs( 10 ) );
+				ShowContinueError( "Found in: " + cAlphaArgs( 1 ) );
+				ErrorsFound = true;
+			}
+
 			//Domain perimeter offset
 			PipingSystemDomains( DomainNum ).PerimeterOffset = Domain( BasementCtr ).PerimeterOffset;
 
@@ -2582,6 +2607,8 @@ namespace PlantPipingSystemsManager {
 			//Zone-coupled slab outputs
 			SetupOutputVariable( "Zone Coupled Surface Heat Flux [W/m2]", PipingSystemDomains( DomainNum ).HeatFlux, "Zone", "Average", PipingSystemDomains( DomainNum ).Name );
 			SetupOutputVariable( "Zone Coupled Surface Temperature [C]", PipingSystemDomains( DomainNum ).ZoneCoupledSurfaceTemp, "Zone", "Average", PipingSystemDomains( DomainNum ).Name );
+			SetupOutputVariable( "Ground Domain Iteration Count []", PipingSystemDomains( DomainNum ).Reporting.NumIterations, "Zone", "Sum", PipingSystemDomains( DomainNum ).Name );
+			SetupOutputVariable( "Ground Domain Final Iteration Temperature Change [deltaC]", PipingSystemDomains( DomainNum ).Reporting.MaxIterationTempChange, "Zone", "Average", PipingSystemDomains( DomainNum ).Name );
 		} else if ( PipingSystemDomains( DomainNum ).HasCoupledBasement ) {
 			//Zone-coupled basement wall outputs
 			SetupOutputVariable( "Wall Interface Heat Flux [W/m2]", PipingSystemDomains( DomainNum ).WallHeatFlux, "Zone", "Average", PipingSystemDomains( DomainNum ).Name );
@@ -2589,6 +2616,8 @@ namespace PlantPipingSystemsManager {
 			//Zone-coupled basement floor outputs
 			SetupOutputVariable( "Floor Interface Heat Flux [W/m2]", PipingSystemDomains( DomainNum ).FloorHeatFlux, "Zone", "Average", PipingSystemDomains( DomainNum ).Name );
 			SetupOutputVariable( "Floor Interface Temperature [C]", PipingSystemDomains( DomainNum ).BasementFloorTemp, "Zone", "Average", PipingSystemDomains( DomainNum ).Name );
+			SetupOutputVariable( "Ground Domain Iteration Count []", PipingSystemDomains( DomainNum ).Reporting.NumIterations, "Zone", "Sum", PipingSystemDomains( DomainNum ).Name );
+			SetupOutputVariable( "Ground Domain Final Iteration Temperature Change [deltaC]", PipingSystemDomains( DomainNum ).Reporting.MaxIterationTempChange, "Zone", "Average", PipingSystemDomains( DomainNum ).Name );
 		}
 
 	}
@@ -3651,6 +3680,7 @@ namespace PlantPipingSystemsManager {
 			}
 		}
 
+		PipingSystemDomains( DomainNum ).Reporting.MaxIterationTempChange = LocalMax;
 		RetVal = ( LocalMax < PipingSystemDomains( DomainNum ).SimControls.Convergence_CurrentToPrevIteration );
 
 		return RetVal;
@@ -6675,8 +6705,10 @@ namespace PlantPipingSystemsManager {
 			}
 
 			// Begin iterating for this time step
+			PipingSystemDomains( DomainNum ).Reporting.NumIterations = 0;
 			for ( IterationIndex = 1; IterationIndex <= PipingSystemDomains( DomainNum ).SimControls.MaxIterationsPerTS; ++IterationIndex ) {
 
+				++PipingSystemDomains( DomainNum ).Reporting.NumIterations;
 				ShiftTemperaturesForNewIteration( DomainNum );
 
 				if ( PipingSystemDomains( DomainNum ).HasAPipeCircuit ) {
@@ -6718,7 +6750,10 @@ namespace PlantPipingSystemsManager {
 		// <description>
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The cells are swept in array order (X fastest, then Y, then Z).  Field cells are
+		// evaluated from the conduction stencil built in DoOneTimeInitializations, which
+		// lists them in the same order.  With the ADI solution algorithm the field cells are
+		// instead solved implicitly along X, Y and Z lines after the point sweep.
 
 		// REFERENCES:
 		// na
@@ -6732,46 +6767,220 @@ namespace PlantPipingSystemsManager {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int X;
-		int Y;
-		int Z;
+		int StencilCellNum;
+		bool UseLineSolves;
 
-		for ( Z = lbound( PipingSystemDomains( DomainNum ).Cells, 3 ); Z <= ubound( PipingSystemDomains( DomainNum ).Cells, 3 ); ++Z ) {
-			for ( Y = lbound( PipingSystemDomains( DomainNum ).Cells, 2 ); Y <= ubound( PipingSystemDomains( DomainNum ).Cells, 2 ); ++Y ) {
-				for ( X = lbound( PipingSystemDomains( DomainNum ).Cells, 1 ); X <= ubound( PipingSystemDomains( DomainNum ).Cells, 1 ); ++X ) {
+		auto & Cells( PipingSystemDomains( DomainNum ).Cells );
+		auto const & FieldStencil( PipingSystemDomains( DomainNum ).FieldStencil );
+		StencilCellNum = 1;
+		UseLineSolves = ( PipingSystemDomains( DomainNum ).SimControls.SolutionAlgorithm == SolutionAlgorithm_ADI ) && ( FieldStencil.NumCells > 0 );
 
-					{ auto const SELECT_CASE_var( PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).CellType );
-					if ( SELECT_CASE_var == CellType_Pipe ) {
-						//'pipes are simulated separately
-					}
-					else if ( ( SELECT_CASE_var == CellType_GeneralField ) || ( SELECT_CASE_var == CellType_Slab ) || ( SELECT_CASE_var == CellType_HorizInsulation ) || ( SELECT_CASE_var == CellType_VertInsulation ) ) {
-						PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
-					}
-					else if ( SELECT_CASE_var == CellType_GroundSurface ) {
+		for ( std::size_t i = 0, e = Cells.size(); i < e; ++i ) {
+			auto & ThisCell( Cells[ i ] );
 
-						PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateGroundSurfaceTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
-					}
-					else if ( SELECT_CASE_var == CellType_FarfieldBoundary ) {
-						PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateFarfieldBoundaryTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
-					}
-					else if ( ( SELECT_CASE_var == CellType_BasementWall ) || ( SELECT_CASE_var == CellType_BasementCorner ) || ( SELECT_CASE_var == CellType_BasementFloor ) ) {
-						//basement model, zone-coupled. Call EvaluateZoneInterfaceTemperature routine to handle timestep/hourly simulation.
-						if ( PipingSystemDomains( DomainNum ).HasCoupledBasement ){
-							PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateZoneInterfaceTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
-						} 
-						//FHX model.
-						else{
-							PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateBasementCellTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
-						}
-					}
-					else if ( SELECT_CASE_var == CellType_AdiabaticWall ) {
-						PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateAdiabaticSurfaceTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
+			{ auto const SELECT_CASE_var( ThisCell.CellType );
+			if ( SELECT_CASE_var == CellType_Pipe ) {
+				//'pipes are simulated separately
+			}
+			else if ( ( SELECT_CASE_var == CellType_GeneralField ) || ( SELECT_CASE_var == CellType_Slab ) || ( SELECT_CASE_var == CellType_HorizInsulation ) || ( SELECT_CASE_var == CellType_VertInsulation ) ) {
+				if ( StencilCellNum <= FieldStencil.NumCells && FieldStencil.CellIndex( StencilCellNum ) == int( i ) ) {
+					if ( ! UseLineSolves ) ThisCell.MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, StencilCellNum );
+					++StencilCellNum;
+				} else {
+					ThisCell.MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, ThisCell );
+				}
+			}
+			else if ( SELECT_CASE_var == CellType_GroundSurface ) {
+
+				ThisCell.MyBase.Temperature = EvaluateGroundSurfaceTemperature( DomainNum, ThisCell );
+			}
+			else if ( SELECT_CASE_var == CellType_FarfieldBoundary ) {
+				ThisCell.MyBase.Temperature = EvaluateFarfieldBoundaryTemperature( DomainNum, ThisCell );
+			}
+			else if ( ( SELECT_CASE_var == CellType_BasementWall ) || ( SELECT_CASE_var == CellType_BasementCorner ) || ( SELECT_CASE_var == CellType_BasementFloor ) ) {
+				//basement model, zone-coupled. Call EvaluateZoneInterfaceTemperature routine to handle timestep/hourly simulation.
+				if ( PipingSystemDomains( DomainNum ).HasCoupledBasement ){
+					ThisCell.MyBase.Temperature = EvaluateZoneInterfaceTemperature( DomainNum, ThisCell );
+				}
+				//FHX model.
+				else{
+					ThisCell.MyBase.Temperature = EvaluateBasementCellTemperature( DomainNum, ThisCell );
+				}
+			}
+			else if ( SELECT_CASE_var == CellType_AdiabaticWall ) {
+				ThisCell.MyBase.Temperature = EvaluateAdiabaticSurfaceTemperature( DomainNum, ThisCell );
+			}
+			else if ( SELECT_CASE_var == CellType_ZoneGroundInterface ) {
+				ThisCell.MyBase.Temperature = EvaluateZoneInterfaceTemperature( DomainNum, ThisCell );
+			}}
+		}
+
+		if ( UseLineSolves ) {
+			PerformFieldCellLineSolves( DomainNum, Direction_NegativeX, Direction_PositiveX );
+			PerformFieldCellLineSolves( DomainNum, Direction_NegativeY, Direction_PositiveY );
+			PerformFieldCellLineSolves( DomainNum, Direction_NegativeZ, Direction_PositiveZ );
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	PerformFieldCellLineSolves(
+		int const DomainNum,
+		int const NegativeDirection, // From Enum: Direction
+		int const PositiveDirection // From Enum: Direction
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the field cell temperatures implicitly along every line of field cells in one
+		// direction, holding the other neighbor temperatures at their current values.  One call
+		// per direction makes up an alternating direction implicit (ADI) iteration.
+
+		// METHODOLOGY EMPLOYED:
+		// Each line is a run of stencil cells joined through the positive direction.  For each
+		// cell, (1 + sum(Beta/R)) * T - (Beta/R) * T(line neighbors) = T_PrevTimeStep
+		// + sum( (Beta/R) * T(other neighbors) ), which is the implicit form of
+		// EvaluateFieldCellTemperature.  The tridiagonal system is solved with the Thomas algorithm.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static FArray1D_int LineCells; // Stencil cell numbers along the current line
+		static FArray1D< Real64 > Lower; // Coefficient of the previous cell on the line
+		static FArray1D< Real64 > Diag; // Coefficient of the cell itself
+		static FArray1D< Real64 > Upper; // Coefficient of the next cell on the line
+		static FArray1D< Real64 > RHS; // Right hand side, then solved temperatures
+		int StartCellNum;
+		int ThisCellNum;
+		int LineLength;
+		int LineCtr;
+		int NeighborNum;
+		Real64 Beta;
+		Real64 Conductance;
+
+		auto & Cells( PipingSystemDomains( DomainNum ).Cells );
+		auto const & FieldStencil( PipingSystemDomains( DomainNum ).FieldStencil );
+
+		if ( isize( LineCells ) < FieldStencil.NumCells ) {
+			LineCells.dimension( FieldStencil.NumCells, 0 );
+			Lower.dimension( FieldStencil.NumCells, 0.0 );
+			Diag.dimension( FieldStencil.NumCells, 0.0 );
+			Upper.dimension( FieldStencil.NumCells, 0.0 );
+			RHS.dimension( FieldStencil.NumCells, 0.0 );
+		}
+
+		for ( StartCellNum = 1; StartCellNum <= FieldStencil.NumCells; ++StartCellNum ) {
+
+			// Lines start at cells without a field neighbor in the negative direction
+			if ( FieldStencil.StencilNeighbor( -NegativeDirection, StartCellNum ) > 0 ) continue;
+
+			LineLength = 0;
+			ThisCellNum = StartCellNum;
+			while ( ThisCellNum > 0 ) {
+				++LineLength;
+				LineCells( LineLength ) = ThisCellNum;
+				ThisCellNum = FieldStencil.StencilNeighbor( -PositiveDirection, ThisCellNum );
+			}
+
+			// Set up the tridiagonal system
+			for ( LineCtr = 1; LineCtr <= LineLength; ++LineCtr ) {
+				ThisCellNum = LineCells( LineCtr );
+				auto const & ThisCell( Cells[ FieldStencil.CellIndex( ThisCellNum ) ] );
+				Beta = ThisCell.MyBase.Beta;
+				Lower( LineCtr ) = 0.0;
+				Diag( LineCtr ) = 1.0;
+				Upper( LineCtr ) = 0.0;
+				RHS( LineCtr ) = ThisCell.MyBase.Temperature_PrevTimeStep;
+				for ( NeighborNum = FieldStencil.NeighborStart( ThisCellNum ); NeighborNum < FieldStencil.NeighborStart( ThisCellNum + 1 ); ++NeighborNum ) {
+					Conductance = Beta / FieldStencil.Resistance( NeighborNum );
+					Diag( LineCtr ) += Conductance;
+					if ( LineCtr > 1 && FieldStencil.NeighborDirection( NeighborNum ) == NegativeDirection ) {
+						Lower( LineCtr ) = -Conductance;
+					} else if ( LineCtr < LineLength && FieldStencil.NeighborDirection( NeighborNum ) == PositiveDirection ) {
+						Upper( LineCtr ) = -Conductance;
+					} else {
+						RHS( LineCtr ) += Conductance * Cells[ FieldStencil.NeighborIndex( NeighborNum ) ].MyBase.Temperature;
 					}
-					else if ( SELECT_CASE_var == CellType_ZoneGroundInterface ) {
-						PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateZoneInterfaceTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
-					}}
 				}
 			}
+
+			SolveTridiagonalSystem( LineLength, Lower, Diag, Upper, RHS );
+
+			for ( LineCtr = 1; LineCtr <= LineLength; ++LineCtr ) {
+				Cells[ FieldStencil.CellIndex( LineCells( LineCtr ) ) ].MyBase.Temperature = RHS( LineCtr );
+			}
+
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SolveTridiagonalSystem(
+		int const N, // Number of equations
+		FArray1< Real64 > const & Lower, // Sub-diagonal coefficients (Lower(1) is not used)
+		FArray1< Real64 > & Diag, // Diagonal coefficients (overwritten)
+		FArray1< Real64 > const & Upper, // Super-diagonal coefficients (Upper(N) is not used)
+		FArray1< Real64 > & RHS // Right hand side on entry, solution on exit
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the first N equations of a tridiagonal system in place.
+
+		// METHODOLOGY EMPLOYED:
+		// Thomas algorithm: forward elimination and back substitution.  No pivoting is done, which
+		// is safe for the diagonally dominant line equations of the field cells.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Ctr;
+		Real64 Factor;
+
+		if ( N < 1 ) return;
+
+		for ( Ctr = 2; Ctr <= N; ++Ctr ) {
+			Factor = Lower( Ctr ) / Diag( Ctr - 1 );
+			Diag( Ctr ) -= Factor * Upper( Ctr - 1 );
+			RHS( Ctr ) -= Factor * RHS( Ctr - 1 );
+		}
+		RHS( N ) /= Diag( N );
+		for ( Ctr = N - 1; Ctr >= 1; --Ctr ) {
+			RHS( Ctr ) = ( RHS( Ctr ) - Upper( Ctr ) * RHS( Ctr + 1 ) ) / Diag( Ctr );
 		}
 
 	}
@@ -6854,6 +7063,72 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	Real64
+	EvaluateFieldCellTemperature(
+		int const DomainNum,
+		int const StencilCellNum
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Evaluates the new temperature of a field cell from the domain's precomputed
+		// conduction stencil.
+
+		// METHODOLOGY EMPLOYED:
+		// Same expression as the cell version of EvaluateFieldCellTemperature, but the
+		// neighbor cells and resistances are read from the flat stencil arrays instead of
+		// being found and recalculated on every iteration.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 Numerator;
+		Real64 Denominator;
+		Real64 Beta;
+		int NeighborNum;
+
+		auto const & Cells( PipingSystemDomains( DomainNum ).Cells );
+		auto const & FieldStencil( PipingSystemDomains( DomainNum ).FieldStencil );
+		auto const & ThisCell( Cells[ FieldStencil.CellIndex( StencilCellNum ) ] );
+
+		//Set up once-per-cell items
+		Beta = ThisCell.MyBase.Beta;
+
+		//add effect from cell history
+		Numerator = ThisCell.MyBase.Temperature_PrevTimeStep;
+		Denominator = 1.0;
+
+		//loop across each neighbor in the stencil
+		for ( NeighborNum = FieldStencil.NeighborStart( StencilCellNum ); NeighborNum < FieldStencil.NeighborStart( StencilCellNum + 1 ); ++NeighborNum ) {
+			Numerator += ( Beta / FieldStencil.Resistance( NeighborNum ) ) * Cells[ FieldStencil.NeighborIndex( NeighborNum ) ].MyBase.Temperature;
+			Denominator += Beta / FieldStencil.Resistance( NeighborNum );
+		}
+
+		//'now that we have passed all directions, update the temperature
+		return Numerator / Denominator;
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateGroundSurfaceTemperature(
 		int const DomainNum,
@@ -9114,6 +9389,11 @@ namespace PlantPipingSystemsManager {
 		int TotalSegments;
 		int SegCtr2;
 		Real64 ThisCellTemp;
+		int CellType; // From Enum: CellType
+		bool IsStencilCell; // True if the cell is evaluated from the field stencil
+		int NumStencilNeighbors;
+		int StencilCellNum;
+		int NeighborNum;
 				
 		//'initialize cell properties
 		for ( Z = lbound( PipingSystemDomains( DomainNum ).Cells, 3 ); Z <= ubound( PipingSystemDomains( DomainNum ).Cells, 3 ); ++Z ) {
@@ -9165,19 +9445,51 @@ namespace PlantPipingSystemsManager {
 		}
 
 		//'calculate one-time resistance terms for cartesian cells
+		//'and store the field cell resistances as the domain's conduction stencil
+		auto & FieldStencil( PipingSystemDomains( DomainNum ).FieldStencil );
+		FieldStencil.NumCells = 0;
+		FieldStencil.CellIndex.dimension( size( PipingSystemDomains( DomainNum ).Cells ), 0 );
+		FieldStencil.NeighborStart.dimension( size( PipingSystemDomains( DomainNum ).Cells ) + 1, 1 );
+		FieldStencil.NeighborIndex.dimension( 6 * size( PipingSystemDomains( DomainNum ).Cells ), 0 );
+		FieldStencil.NeighborDirection.dimension( 6 * size( PipingSystemDomains( DomainNum ).Cells ), 0 );
+		FieldStencil.Resistance.dimension( 6 * size( PipingSystemDomains( DomainNum ).Cells ), 0.0 );
+		FieldStencil.CellStencilNum.dimension( size( PipingSystemDomains( DomainNum ).Cells ), 0 );
+		NumStencilNeighbors = 0;
 		for ( Z = lbound( PipingSystemDomains( DomainNum ).Cells, 3 ); Z <= ubound( PipingSystemDomains( DomainNum ).Cells, 3 ); ++Z ) {
 			for ( Y = lbound( PipingSystemDomains( DomainNum ).Cells, 2 ); Y <= ubound( PipingSystemDomains( DomainNum ).Cells, 2 ); ++Y ) {
 				for ( X = lbound( PipingSystemDomains( DomainNum ).Cells, 1 ); X <= ubound( PipingSystemDomains( DomainNum ).Cells, 1 ); ++X ) {
+					CellType = PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).CellType;
+					IsStencilCell = ( CellType == CellType_GeneralField ) || ( CellType == CellType_Slab ) || ( CellType == CellType_HorizInsulation ) || ( CellType == CellType_VertInsulation );
+					if ( IsStencilCell ) {
+						++FieldStencil.NumCells;
+						FieldStencil.CellIndex( FieldStencil.NumCells ) = PipingSystemDomains( DomainNum ).Cells.index( X, Y, Z );
+						FieldStencil.CellStencilNum( FieldStencil.CellIndex( FieldStencil.NumCells ) + 1 ) = FieldStencil.NumCells;
+					}
 					EvaluateCellNeighborDirections( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
 					for ( DirectionCtr = 0; DirectionCtr <= ubound( NeighborFieldCells, 1 ); ++DirectionCtr ) {
 						CurDirection = NeighborFieldCells( DirectionCtr );
 						EvaluateNeighborCharacteristics( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ), CurDirection, NeighborTemp, Resistance, NX, NY, NZ );
 						SetAdditionalNeighborData( DomainNum, X, Y, Z, CurDirection, Resistance, PipingSystemDomains( DomainNum ).Cells( NX, NY, NZ ) );
+						if ( IsStencilCell ) {
+							++NumStencilNeighbors;
+							FieldStencil.NeighborIndex( NumStencilNeighbors ) = PipingSystemDomains( DomainNum ).Cells.index( NX, NY, NZ );
+							FieldStencil.NeighborDirection( NumStencilNeighbors ) = CurDirection;
+							FieldStencil.Resistance( NumStencilNeighbors ) = Resistance;
+						}
 					}
+					if ( IsStencilCell ) FieldStencil.NeighborStart( FieldStencil.NumCells + 1 ) = NumStencilNeighbors + 1;
 				}
 			}
 		}
 
+		//'the field cell lines of the line solves are walked through the stencil neighbors in each direction
+		FieldStencil.StencilNeighbor.dimension( 6, FieldStencil.NumCells, 0 );
+		for ( StencilCellNum = 1; StencilCellNum <= FieldStencil.NumCells; ++StencilCellNum ) {
+			for ( NeighborNum = FieldStencil.NeighborStart( StencilCellNum ); NeighborNum < FieldStencil.NeighborStart( StencilCellNum + 1 ); ++NeighborNum ) {
+				FieldStencil.StencilNeighbor( -FieldStencil.NeighborDirection( NeighborNum ), StencilCellNum ) = FieldStencil.CellStencilNum( FieldStencil.NeighborIndex( NeighborNum ) + 1 );
+			}
+		}
+
 		//'create circuit array for convenience
 
 		if ( present ( CircuitNum ) ){
@@ -797,6 +797,40 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	Real64
+	EvaluateFieldCellTemperature(
+		int const DomainNum,
+		int const StencilCellNum
+	);
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	PerformFieldCellLineSolves(
+		int const DomainNum,
+		int const NegativeDirection, // From Enum: Direction
+		int const PositiveDirection // From Enum: Direction
+	);
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SolveTridiagonalSystem(
+		int const N, // Number of equations
+		FArray1< Real64 > const & Lower, // Sub-diagonal coefficients (Lower(1) is not used)
+		FArray1< Real64 > & Diag, // Diagonal coefficients (overwritten)
+		FArray1< Real64 > const & Upper, // Super-diagonal coefficients (Upper(N) is not used)
+		FArray1< Real64 > & RHS // Right hand side on entry, solution on exit
+	);
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateGroundSurfaceTemperature(
 		int const DomainNum,
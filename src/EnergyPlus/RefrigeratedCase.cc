@@ -2,6 +2,8 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -5736,6 +5738,9 @@ namespace RefrigeratedCase {
 			} //NumUnusedGasCoolers and displayextra warnings
 		} //NumSimulationGasCooler > 0
 
+		// Find the detailed systems that exchange energy and have to be iterated together
+		if ( NumRefrigSystems > 0 ) SetupRefrigSystemCoupling();
+
 		//echo input to eio file.
 		ReportRefrigerationComponents();
 
@@ -5745,6 +5750,105 @@ namespace RefrigeratedCase {
 
 	}
 
+	void
+	SetupRefrigSystemCoupling()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Groups the detailed refrigeration systems that exchange energy with each other so that
+		// SimulateDetailedRefrigerationSystems only iterates the systems that need it.
+
+		// METHODOLOGY EMPLOYED:
+		// Systems are connected when one provides mechanical subcooling to another, when one absorbs the
+		// cascade condenser load of another, or when they share a condenser.  Connected systems get the
+		// same coupling group number (the lowest system number in the group).  Systems serving air chillers
+		// are also iterated because their coil loads may be derated to the available compressor capacity.
+		// Secondary loop loads are calculated once before the system iteration, so they do not couple systems.
+		// All other systems keep coupling group zero and are solved once per time step.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int SysNum; // Index to detailed refrigeration system
+		int SysIndex; // Index to a system attached to a condenser
+		int CondNum; // Index to condenser
+		int CascadeLoadIndex; // Index to cascade load of a system
+		int SubcoolerIndex; // Index to subcooler of a system
+		int SubcoolID; // Absolute reference to subcooler
+		int OldGroup; // Group merged into another group
+		int NewGroup; // Group absorbing another group
+		std::vector< std::pair< int, int > > Connections; // Pairs of systems exchanging energy
+		FArray1D_int Group( NumRefrigSystems ); // Group of connected systems, while building the groups
+		FArray1D_bool Coupled( NumRefrigSystems, false ); // True if the system is iterated with other systems
+
+		for ( SysNum = 1; SysNum <= NumRefrigSystems; ++SysNum ) {
+			// System absorbing the cascade condenser load of a lower temperature system
+			for ( CascadeLoadIndex = 1; CascadeLoadIndex <= System( SysNum ).NumCascadeLoads; ++CascadeLoadIndex ) {
+				Connections.emplace_back( SysNum, Condenser( System( SysNum ).CascadeLoadNum( CascadeLoadIndex ) ).CascadeSysID );
+			}
+			// System providing mechanical subcooling to this system
+			for ( SubcoolerIndex = 1; SubcoolerIndex <= System( SysNum ).NumSubcoolers; ++SubcoolerIndex ) {
+				SubcoolID = System( SysNum ).SubcoolerNum( SubcoolerIndex );
+				if ( Subcooler( SubcoolID ).SubcoolerType == LiquidSuction ) continue;
+				Connections.emplace_back( SysNum, Subcooler( SubcoolID ).MechSourceSysID );
+			}
+		}
+		// Systems sharing a condenser
+		for ( CondNum = 1; CondNum <= NumRefrigCondensers; ++CondNum ) {
+			for ( SysIndex = 2; SysIndex <= Condenser( CondNum ).NumSysAttach; ++SysIndex ) {
+				Connections.emplace_back( Condenser( CondNum ).SysNum( 1 ), Condenser( CondNum ).SysNum( SysIndex ) );
+			}
+		}
+
+		for ( SysNum = 1; SysNum <= NumRefrigSystems; ++SysNum ) {
+			Group( SysNum ) = SysNum;
+			if ( System( SysNum ).CoilFlag ) Coupled( SysNum ) = true;
+		}
+		for ( auto const & Connection : Connections ) {
+			if ( Connection.first <= 0 || Connection.second <= 0 ) continue;
+			Coupled( Connection.first ) = true;
+			Coupled( Connection.second ) = true;
+			NewGroup = min( Group( Connection.first ), Group( Connection.second ) );
+			OldGroup = max( Group( Connection.first ), Group( Connection.second ) );
+			if ( NewGroup == OldGroup ) continue;
+			for ( SysNum = 1; SysNum <= NumRefrigSystems; ++SysNum ) {
+				if ( Group( SysNum ) == OldGroup ) Group( SysNum ) = NewGroup;
+			}
+		}
+
+		for ( SysNum = 1; SysNum <= NumRefrigSystems; ++SysNum ) {
+			if ( Coupled( SysNum ) ) {
+				System( SysNum ).CouplingGroup = Group( SysNum );
+			} else {
+				System( SysNum ).CouplingGroup = 0;
+			}
+		}
+
+	}
+
 	//***************************************************************************************************
 	//***************************************************************************************************
 
@@ -8172,7 +8276,8 @@ namespace RefrigeratedCase {
 		// Each refrigeration system is modeled by first simulating the attached refrigerated cases.  The sum
 		// of the total heat transfer for all attached cases determines the load on the compressor rack.
 		// Iterations are used here to account for load transfer between independent refrigeration systems
-		// via mechanical subcoolers.
+		// via mechanical subcoolers, cascade condensers and shared condensers.  Only the systems coupled this
+		// way (see SetupRefrigSystemCoupling) are iterated, until their loads and compressor power converge.
 		// The logical variable, UseSysTimeStep, determines whether we are evaluating only systems driven by
 		// ZoneEquipmentManager on the system time step, or only system driven by HVACManager on the zone time step.
 
@@ -8185,7 +8290,8 @@ namespace RefrigeratedCase {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		// na
+		int const MaxCoupledSystemIter( 10 ); // Maximum number of passes through the coupled systems
+		Real64 const CoupledSystemErrorTol( 0.001 ); // Convergence tolerance for coupled systems
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -8199,9 +8305,13 @@ namespace RefrigeratedCase {
 		static bool DeRate( false ); // If true, need to derate aircoils because load can't be met by system
 		static bool FirstSCLoop( true ); // Flag first time through multi-system loop used when mech subcoolers present
 
-		static int StartMechSubcoolLoop( 3 ); // if no mechanical subcoolers transfer energy between system,
-		//    don't loop
-		static int LoopNum( 0 ); // Index to overall repeat necessary for mechanical subcoolers
+		static int LoopNum( 0 ); // Index to overall repeat necessary for coupled systems
+		int CouplingGroup; // Group of coupled systems the system belongs to (0 = independent system)
+		bool CoupledSystemsConverged; // True when every group of coupled systems has converged
+		Real64 LoadStart; // System load at the start of a pass through the coupled systems [W]
+		Real64 PowerStart; // Compressor power at the start of a pass through the coupled systems [W]
+		static FArray1D_bool CouplingGroupConverged; // True when a group of coupled systems has converged
+		static FArray1D< Real64 > CouplingGroupError; // Largest relative change of a group of coupled systems in a pass
 		static int SubcoolID( 0 ); // Subcooler ID number
 		static int SubcoolerIndex( 0 ); // Subcooler ID number
 		static int CaseID( 0 ); // Absolute reference to case
@@ -8368,19 +8478,28 @@ namespace RefrigeratedCase {
 			} //(((.NOT. UseSysTimeStep).AND.(.NOT. System(SysNum)%CoilFlag)).OR.((UseSysTimeStep).AND.(System(SysNum)%CoilFlag)))
 		} // SysNum
 
-		// Need to know if mechanical subcoolers or cascade condensers or shared condensers
-		//    are present. If so, energy transfer between
-		//    detailed refrigeration systems requires additional iteration at this level.
+		// Systems coupled by mechanical subcoolers, cascade condensers or shared condensers, or serving
+		//    air chillers that may be derated, require additional iteration at this level until the energy
+		//    transferred between them converges. Independent systems are solved on the first pass only.
 
-		StartMechSubcoolLoop = 3;
-		if ( ( NumSimulationMechSubcoolers > 0 ) || ( NumSimulationCascadeCondensers > 0 ) || ( NumSimulationSharedCondensers > 0 ) || ( NumSimulationRefrigAirChillers > 0 ) ) StartMechSubcoolLoop = 1;
+		if ( ! allocated( CouplingGroupConverged ) ) {
+			CouplingGroupConverged.allocate( NumRefrigSystems );
+			CouplingGroupError.allocate( NumRefrigSystems );
+		}
+		CouplingGroupConverged = false;
 
 		FirstSCLoop = true;
-		for ( LoopNum = StartMechSubcoolLoop; LoopNum <= 3; ++LoopNum ) { //Note, for cascade cond loads compared requiring 5 iterations to 3, no difference.
+		for ( LoopNum = 1; LoopNum <= MaxCoupledSystemIter; ++LoopNum ) {
+			CouplingGroupError = 0.0;
 
 			for ( SysNum = 1; SysNum <= NumRefrigSystems; ++SysNum ) {
 				//Only do those systems appropriate for this analysis, supermarket type on load time step or coil type on sys time step
 				if ( ( ( ! UseSysTimeStep ) && ( ! System( SysNum ).CoilFlag ) ) || ( ( UseSysTimeStep ) && ( System( SysNum ).CoilFlag ) ) ) {
+					CouplingGroup = System( SysNum ).CouplingGroup;
+					if ( ( ! FirstSCLoop ) && ( CouplingGroup == 0 || CouplingGroupConverged( CouplingGroup ) ) ) continue;
+					LoadStart = System( SysNum ).TotalSystemLoad;
+					PowerStart = System( SysNum ).TotCompPower + System( SysNum ).TotHiStageCompPower;
+
 					System( SysNum ).SumMechSCLoad = 0.0;
 					System( SysNum ).SumCascadeLoad = 0.0;
 					System( SysNum ).SumCascadeCondCredit = 0.0;
@@ -8503,12 +8622,31 @@ namespace RefrigeratedCase {
 						} //CoilFlag (Numcoils > 0) and load > capacity
 
 					} //System(SysNum)%TotalSystemLoad > 0
+
+					if ( CouplingGroup > 0 ) {
+						CouplingGroupError( CouplingGroup ) = max( CouplingGroupError( CouplingGroup ), std::abs( System( SysNum ).TotalSystemLoad - LoadStart ) / max( System( SysNum ).TotalSystemLoad, MySmallNumber ), std::abs( System( SysNum ).TotCompPower + System( SysNum ).TotHiStageCompPower - PowerStart ) / max( System( SysNum ).TotCompPower + System( SysNum ).TotHiStageCompPower, MySmallNumber ) );
+					}
 				} //(((.NOT. UseSysTimeStep).AND.(.NOT. System(SysNum)%CoilFlag)).OR.((UseSysTimeStep).AND.(System(SysNum)%CoilFlag)))
 			} //SysNum over NumRefrigSystems
+
+			// The first pass has no transfer loads yet, so coupled systems are always repeated at least once
+			CoupledSystemsConverged = true;
+			for ( SysNum = 1; SysNum <= NumRefrigSystems; ++SysNum ) {
+				CouplingGroup = System( SysNum ).CouplingGroup;
+				if ( CouplingGroup == 0 || CouplingGroupConverged( CouplingGroup ) ) continue;
+				if ( ( ! FirstSCLoop ) && ( CouplingGroupError( CouplingGroup ) < CoupledSystemErrorTol ) ) {
+					CouplingGroupConverged( CouplingGroup ) = true;
+				} else {
+					CoupledSystemsConverged = false;
+				}
+			}
 			FirstSCLoop = false;
-		} // LoopNum, three times for buildings with multiple detailed systems connected with mechanical subcoolers
+			if ( CoupledSystemsConverged ) break;
+		} // LoopNum, repeated for detailed systems connected with mechanical subcoolers
 		// or cascade condensers or shared condensers or warehouse coils that might need to be de-rated
 
+		if ( ( ! CoupledSystemsConverged ) && ( ! WarmupFlag ) ) ReportCoupledSystemConvergence( CouplingGroupConverged, CouplingGroupError );
+
 		// Dealing with unmet load has to be done outside iterative loop
 		for ( SysNum = 1; SysNum <= NumRefrigSystems; ++SysNum ) {
 			//Only do those systems appropriate for this analysis, supermarket type on load time step or coil type on sys time step
@@ -8597,6 +8735,66 @@ namespace RefrigeratedCase {
 	//***************************************************************************************************
 	//***************************************************************************************************
 
+	void
+	ReportCoupledSystemConvergence(
+		FArray1_bool const & CouplingGroupConverged, // True when a group of coupled systems has converged
+		FArray1< Real64 > const & CouplingGroupError // Largest relative change of a group of coupled systems in the last pass
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Warns about each group of coupled refrigeration systems whose loads and compressor power were
+		// still changing when SimulateDetailedRefrigerationSystems ran out of passes.
+
+		// METHODOLOGY EMPLOYED:
+		// A coupling group is numbered after its lowest system number (see SetupRefrigSystemCoupling), so
+		// the recurring warning is kept on that system and lists every system in the group.  The largest
+		// relative change in the last pass is tracked as the warning's maximum.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int GroupNum; // Coupling group, numbered after its lowest system number
+		int SysNum; // Index to a detailed refrigeration system in the group
+		std::string GroupSystems; // Names of the systems in the group
+
+		for ( GroupNum = 1; GroupNum <= NumRefrigSystems; ++GroupNum ) {
+			if ( System( GroupNum ).CouplingGroup != GroupNum || CouplingGroupConverged( GroupNum ) ) continue;
+			GroupSystems = System( GroupNum ).Name;
+			for ( SysNum = GroupNum + 1; SysNum <= NumRefrigSystems; ++SysNum ) {
+				if ( System( SysNum ).CouplingGroup == GroupNum ) GroupSystems += ", " + System( SysNum ).Name;
+			}
+			ShowRecurringWarningErrorAtEnd( "Refrigeration:System: coupled systems " + GroupSystems + " did not converge; the loads they transfer to each other may be inaccurate. Largest relative change in the last pass", System( GroupNum ).CouplingWarnIndex, CouplingGroupError( GroupNum ), CouplingGroupError( GroupNum ) );
+		}
+
+	}
+
+	//***************************************************************************************************
+	//***************************************************************************************************
+
 	void
 	SimulateDetailedTransRefrigSystems()
 	{
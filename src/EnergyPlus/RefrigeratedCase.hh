@@ -1043,6 +1043,8 @@ namespace RefrigeratedCase {
 		FArray1D_int WalkInNum; // absolute Index of walk ins (allocated NumWalkIns)
 		int CompSuctControl; // Index to suction control
 		// 2 =fixed, 1=floating
+		int CouplingGroup; // Group of systems iterated together because they exchange energy (0 = independent system)
+		int CouplingWarnIndex; // Recurring warning index when the coupling group led by this system does not converge
 		//INTEGER     :: ServiceType      = 1       ! Index to warehouse or supermarket
 		// 1 = supermarket, 2=warehouse
 		int HiStageWarnIndex1; // Recurring warning index when hi stage compressors unable to meet coil loads
@@ -1143,6 +1145,8 @@ namespace RefrigeratedCase {
 			SystemRejectHeatToZone( false ),
 			CoilFlag( false ),
 			CompSuctControl( 2 ),
+			CouplingGroup( 0 ),
+			CouplingWarnIndex( 0 ),
 			HiStageWarnIndex1( 0 ),
 			HiStageWarnIndex2( 0 ),
 			InsuffCapWarn( 0 ),
@@ -3922,6 +3926,9 @@ namespace RefrigeratedCase {
 	void
 	GetRefrigerationInput();
 
+	void
+	SetupRefrigSystemCoupling();
+
 	//***************************************************************************************************
 	//***************************************************************************************************
 
@@ -3983,6 +3990,15 @@ namespace RefrigeratedCase {
 	//***************************************************************************************************
 	//***************************************************************************************************
 
+	void
+	ReportCoupledSystemConvergence(
+		FArray1_bool const & CouplingGroupConverged, // True when a group of coupled systems has converged
+		FArray1< Real64 > const & CouplingGroupError // Largest relative change of a group of coupled systems in the last pass
+	);
+
+	//***************************************************************************************************
+	//***************************************************************************************************
+
 	void
 	SimulateDetailedTransRefrigSystems();
 
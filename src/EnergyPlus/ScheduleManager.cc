@@ -1,3 +1,8 @@
+// C++ Headers
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
@@ -89,10 +94,15 @@ namespace ScheduleManager {
 	int NumDaySchedules( 0 );
 	int NumWeekSchedules( 0 );
 	int NumSchedules( 0 );
+	int NumActiveSchedules( 0 ); // Number of schedules referenced by the simulation (updated each timestep)
+	int NumReportedSchedules( 0 ); // Number of schedules with a Schedule Value output variable (set each timestep for reporting)
+	int NumFileDaysShared( 0 ); // Number of Schedule:File days that share an identical earlier day profile
 
 	//Logical Variables for Module
 	bool ScheduleInputProcessed( false ); // This is false until the Schedule Input has been processed.
 	bool ScheduleDSTSFileWarningIssued( false );
+	bool ActiveScheduleListChanged( true ); // True when a schedule has been referenced since the active list was built
+	bool ScheduleValuesUpdated( false ); // True once UpdateScheduleValues has set the current values
 
 	//Derived Types Variables
 
@@ -101,6 +111,9 @@ namespace ScheduleManager {
 	FArray1D< DayScheduleData > DaySchedule; // Day Schedule Storage
 	FArray1D< WeekScheduleData > WeekSchedule; // Week Schedule Storage
 	FArray1D< ScheduleData > Schedule; // Schedule Storage
+	FArray1D_int ActiveSchedule; // Schedules updated each timestep (those referenced by the simulation)
+	FArray1D_int ActiveDaySchedulePtr; // Day schedule in effect for the current day for each active schedule
+	FArray1D_int ReportedSchedule; // Schedules with a Schedule Value output variable (reported, metered or read by another report)
 
 	static gio::Fmt fmtLD( "*" );
 	static gio::Fmt fmtA( "(A)" );
@@ -226,6 +239,9 @@ namespace ScheduleManager {
 		int MaxAlps;
 		int AddWeekSch;
 		int AddDaySch;
+		int DupDaySch; // earlier day schedule of the current Schedule:File with the same values
+		std::size_t DayValueHash; // hash of the values of a Schedule:File day
+		std::unordered_map< std::size_t, std::vector< int > > FileDaySchByHash; // day schedules of the current Schedule:File by hash of their values
 		FArray1D_bool AllDays( MaxDayTypes );
 		FArray1D_bool TheseDays( MaxDayTypes );
 		bool ErrorHere;
@@ -1501,6 +1517,7 @@ namespace ScheduleManager {
 				iDay = 0;
 				hDay = 0;
 				ifld = 0;
+				FileDaySchByHash.clear();
 				while ( true ) {
 					// create string of which day of year
 					++iDay;
@@ -1561,6 +1578,35 @@ namespace ScheduleManager {
 							}
 						}
 					}
+					// Days with the same values as an earlier day of this file share its week and day schedule
+					// so only the distinct day profiles are stored (e.g. repeated weekdays and weekends).
+					// Earlier days are found by the hash of their values and then compared value by value.
+					auto const & NewTSValue( DaySchedule( AddDaySch ).TSValue );
+					DayValueHash = DayScheduleValueHash( NewTSValue );
+					auto & SameHashDaySch( FileDaySchByHash[ DayValueHash ] );
+					DupDaySch = 0;
+					for ( int const HashDaySch : SameHashDaySch ) {
+						auto const & DupTSValue( DaySchedule( HashDaySch ).TSValue );
+						FArray2D< Real64 >::size_type TSIndex( 0 );
+						while ( TSIndex < NewTSValue.size() && NewTSValue[ TSIndex ] == DupTSValue[ TSIndex ] ) ++TSIndex;
+						if ( TSIndex == NewTSValue.size() ) {
+							DupDaySch = HashDaySch;
+							break;
+						}
+					}
+					if ( DupDaySch == 0 ) {
+						SameHashDaySch.push_back( AddDaySch );
+					} else {
+						Schedule( SchNum ).WeekSchedulePointer( iDay ) = AddWeekSch - AddDaySch + DupDaySch;
+						DaySchedule( AddDaySch ).Name.clear();
+						DaySchedule( AddDaySch ).ScheduleTypePtr = 0;
+						DaySchedule( AddDaySch ).TSValue = 0.0;
+						WeekSchedule( AddWeekSch ).Name.clear();
+						WeekSchedule( AddWeekSch ).DaySchedulePointer = 0;
+						--AddWeekSch;
+						--AddDaySch;
+						++NumFileDaysShared;
+					}
 					if ( iDay == 59 && rowCnt < 8784 * hrLimitCount ) { // 28 Feb
 						// Dup 28 Feb to 29 Feb (60)
 						++iDay;
@@ -1789,6 +1835,14 @@ namespace ScheduleManager {
 
 		}
 
+		// Release the day and week schedules that were reserved for Schedule:File days now shared with an earlier day
+		if ( NumFileDaysShared > 0 ) {
+			NumDaySchedules -= NumFileDaysShared;
+			NumWeekSchedules -= NumFileDaysShared;
+			DaySchedule.redimension( {0,NumDaySchedules} );
+			WeekSchedule.redimension( {0,NumWeekSchedules} );
+		}
+
 		// Validate by ScheduleLimitsType
 		for ( SchNum = 1; SchNum <= NumSchedules; ++SchNum ) {
 			NumPointer = Schedule( SchNum ).ScheduleTypePtr;
@@ -1837,6 +1891,8 @@ namespace ScheduleManager {
 			}
 		}
 
+		ReportScheduleStorage();
+
 		Alphas.deallocate();
 		cAlphaFields.deallocate();
 		cNumericFields.deallocate();
@@ -2289,42 +2345,295 @@ namespace ScheduleManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ActiveNum;
 		int ScheduleIndex;
 		int WhichHour;
 		int WeekSchedulePointer;
-		int DaySchedulePointer;
+		static int SavedDayOfYear( -1 ); // day of year, day of week and holiday the day schedule pointers were set for
+		static int SavedDayOfWeek( -1 );
+		static int SavedHolidayIndex( -1 );
 
 		if ( ! ScheduleInputProcessed ) {
 			ProcessScheduleInput();
 			ScheduleInputProcessed = true;
 		}
 
-		WhichHour = HourOfDay + DSTIndicator;
-
-		for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+		// Only the schedules referenced by the simulation are updated; the others are only
+		// needed for reporting and ReportScheduleValues sets those.
+		if ( ActiveScheduleListChanged ) {
+			BuildActiveScheduleList();
+			SavedDayOfYear = -1;
+		}
 
-			// Determine which Week Schedule is used
-			//  Cant use stored day of year because of leap year inconsistency
-			WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
+		// The day schedule only changes with the day, so the week/day lookups are done once per day
+		if ( DayOfYear_Schedule != SavedDayOfYear || DayOfWeek != SavedDayOfWeek || HolidayIndex != SavedHolidayIndex ) {
+			for ( ActiveNum = 1; ActiveNum <= NumActiveSchedules; ++ActiveNum ) {
+				// Determine which Week Schedule is used
+				//  Cant use stored day of year because of leap year inconsistency
+				WeekSchedulePointer = Schedule( ActiveSchedule( ActiveNum ) ).WeekSchedulePointer( DayOfYear_Schedule );
 
-			// Now, which day?
-			if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
-			} else {
-				DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
+				// Now, which day?
+				if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
+					ActiveDaySchedulePtr( ActiveNum ) = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
+				} else {
+					ActiveDaySchedulePtr( ActiveNum ) = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
+				}
 			}
+			SavedDayOfYear = DayOfYear_Schedule;
+			SavedDayOfWeek = DayOfWeek;
+			SavedHolidayIndex = HolidayIndex;
+		}
+
+		WhichHour = HourOfDay + DSTIndicator;
+
+		for ( ActiveNum = 1; ActiveNum <= NumActiveSchedules; ++ActiveNum ) {
+			ScheduleIndex = ActiveSchedule( ActiveNum );
+			auto const & TSValue( DaySchedule( ActiveDaySchedulePtr( ActiveNum ) ).TSValue );
 
 			// Hourly Value
 			if ( WhichHour <= 24 ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( WhichHour, TimeStep );
+				Schedule( ScheduleIndex ).CurrentValue = TSValue( WhichHour, TimeStep );
 			} else if ( TimeStep <= NumOfTimeStepInHour ) {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( WhichHour - 24, TimeStep );
+				Schedule( ScheduleIndex ).CurrentValue = TSValue( WhichHour - 24, TimeStep );
 			} else {
-				Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( WhichHour - 24, NumOfTimeStepInHour );
+				Schedule( ScheduleIndex ).CurrentValue = TSValue( WhichHour - 24, NumOfTimeStepInHour );
 			}
 
 		}
 
+		ScheduleValuesUpdated = true;
+
+	}
+
+	void
+	BuildActiveScheduleList()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine lists the schedules that UpdateScheduleValues must update each timestep.
+
+		// METHODOLOGY EMPLOYED:
+		// A schedule is active once it has been referenced through GetScheduleIndex (Used flag).
+		// GetScheduleIndex flags the list for rebuilding when a new schedule is referenced before
+		// the values are first updated, and adds it with AddActiveSchedule after that.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ScheduleIndex;
+
+		NumActiveSchedules = 0;
+		for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+			if ( Schedule( ScheduleIndex ).Used ) ++NumActiveSchedules;
+		}
+		ActiveSchedule.dimension( NumActiveSchedules, 0 );
+		ActiveDaySchedulePtr.dimension( NumActiveSchedules, 0 );
+		NumActiveSchedules = 0;
+		for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+			if ( ! Schedule( ScheduleIndex ).Used ) continue;
+			++NumActiveSchedules;
+			ActiveSchedule( NumActiveSchedules ) = ScheduleIndex;
+		}
+		ActiveScheduleListChanged = false;
+
+	}
+
+	void
+	AddActiveSchedule( int const ScheduleIndex ) // schedule first referenced during the run
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine adds a schedule that is first referenced after the schedule values have
+		// been updated to the active list and sets its current value, so GetScheduleIndex does
+		// not have to update every active schedule.
+
+		// METHODOLOGY EMPLOYED:
+		// The day schedule is found for the current day as UpdateScheduleValues does.  If the list
+		// is already flagged for rebuilding, the rebuild picks the schedule up.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::DayOfYear_Schedule;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int WhichHour;
+		int WeekSchedulePointer;
+		int DaySchedulePointer;
+
+		WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
+		if ( DayOfWeek <= 7 && HolidayIndex > 0 ) {
+			DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( 7 + HolidayIndex );
+		} else {
+			DaySchedulePointer = WeekSchedule( WeekSchedulePointer ).DaySchedulePointer( DayOfWeek );
+		}
+
+		if ( ! ActiveScheduleListChanged ) {
+			ActiveSchedule.redimension( ++NumActiveSchedules, 0 );
+			ActiveDaySchedulePtr.redimension( NumActiveSchedules, 0 );
+			ActiveSchedule( NumActiveSchedules ) = ScheduleIndex;
+			ActiveDaySchedulePtr( NumActiveSchedules ) = DaySchedulePointer;
+		}
+
+		WhichHour = HourOfDay + DSTIndicator;
+		if ( WhichHour <= 24 ) {
+			Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( WhichHour, TimeStep );
+		} else if ( TimeStep <= NumOfTimeStepInHour ) {
+			Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( WhichHour - 24, TimeStep );
+		} else {
+			Schedule( ScheduleIndex ).CurrentValue = DaySchedule( DaySchedulePointer ).TSValue( WhichHour - 24, NumOfTimeStepInHour );
+		}
+
+	}
+
+	std::size_t
+	DayScheduleValueHash( FArray2< Real64 > const & TSValue ) // timestep values of a day schedule
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns a hash of the timestep values of a day schedule so that days
+		// with identical profiles can be found without comparing against every earlier day.
+
+		// METHODOLOGY EMPLOYED:
+		// The value hashes are combined in order.  Equal profiles give equal hashes; callers
+		// still compare the values of days with the same hash.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		std::size_t ValueHash( 0 );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+		// na
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::hash< Real64 > HashValue;
+
+		for ( FArray2< Real64 >::size_type TSIndex = 0; TSIndex < TSValue.size(); ++TSIndex ) {
+			ValueHash ^= HashValue( TSValue[ TSIndex ] ) + 0x9e3779b9 + ( ValueHash << 6 ) + ( ValueHash >> 2 );
+		}
+
+		return ValueHash;
+
+	}
+
+	void
+	ReportScheduleStorage()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine reports the size of the schedule data structures to the eio file.
+
+		// METHODOLOGY EMPLOYED:
+		// Counts the stored day schedule values, week schedule day pointers and schedule
+		// week pointers.  Strings and fixed structure overhead are not included.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt SchStorageFmt0( "('! <Schedule Storage>, Number of Schedules, Number of Week Schedules, Number of Day Schedules, ','Schedule:File Days Sharing a Day Schedule, Schedule Data Size {bytes}')" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Count;
+		std::size_t StorageSize; // bytes in the schedule value and pointer arrays
+
+		StorageSize = 0;
+		for ( Count = 0; Count <= NumDaySchedules; ++Count ) {
+			StorageSize += DaySchedule( Count ).TSValue.size() * sizeof( Real64 );
+		}
+		for ( Count = 0; Count <= NumWeekSchedules; ++Count ) {
+			StorageSize += WeekSchedule( Count ).DaySchedulePointer.size() * sizeof( int );
+		}
+		for ( Count = -1; Count <= NumSchedules; ++Count ) {
+			StorageSize += Schedule( Count ).WeekSchedulePointer.size() * sizeof( int );
+		}
+
+		gio::write( OutputFileInits, SchStorageFmt0 );
+		gio::write( OutputFileInits, fmtA ) << " Schedule Storage," + RoundSigDigits( NumSchedules ) + ',' + RoundSigDigits( NumWeekSchedules ) + ',' + RoundSigDigits( NumDaySchedules ) + ',' + RoundSigDigits( NumFileDaysShared ) + ',' + RoundSigDigits( int( StorageSize ) );
+
 	}
 
 	Real64
@@ -2532,6 +2841,12 @@ namespace ScheduleManager {
 							}
 						}
 					}
+					// Schedules first referenced during the run are added to the active list with their current value
+					if ( ScheduleValuesUpdated ) {
+						AddActiveSchedule( GetScheduleIndex );
+					} else {
+						ActiveScheduleListChanged = true;
+					}
 				}
 			}
 		} else {
@@ -4433,13 +4748,16 @@ namespace ScheduleManager {
 		// slot for later reporting.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Only schedules whose Schedule Value output variable was set up (because it is reported,
+		// metered or read by another report) are listed for reporting; the values of the other
+		// schedules are only read through GetCurrentScheduleValue.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using DataEnvironment::DayOfYear_Schedule;
+		using OutputProcessor::NumOfRVariable;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4456,6 +4774,8 @@ namespace ScheduleManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ScheduleIndex;
+		int ReportNum;
+		int NumRVariableBefore; // number of output variables before the schedule's was set up
 		int WhichHour;
 		static bool DoScheduleReportingSetup( true );
 		int WeekSchedulePointer;
@@ -4467,15 +4787,21 @@ namespace ScheduleManager {
 		}
 
 		if ( DoScheduleReportingSetup ) { // CurrentModuleObject='Any Schedule'
+			ReportedSchedule.dimension( NumSchedules, 0 );
+			NumReportedSchedules = 0;
 			for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
 				// Set Up Reporting
+				NumRVariableBefore = NumOfRVariable;
 				SetupOutputVariable( "Schedule Value []", Schedule( ScheduleIndex ).CurrentValue, "Zone", "Average", Schedule( ScheduleIndex ).Name );
+				if ( NumOfRVariable > NumRVariableBefore ) ReportedSchedule( ++NumReportedSchedules ) = ScheduleIndex;
 			}
+			ReportedSchedule.redimension( NumReportedSchedules );
 			DoScheduleReportingSetup = false;
 		}
 
 		WhichHour = HourOfDay + DSTIndicator;
-		for ( ScheduleIndex = 1; ScheduleIndex <= NumSchedules; ++ScheduleIndex ) {
+		for ( ReportNum = 1; ReportNum <= NumReportedSchedules; ++ReportNum ) {
+			ScheduleIndex = ReportedSchedule( ReportNum );
 			// Determine which Week Schedule is used
 			//  Cant use stored day of year because of leap year inconsistency
 			WeekSchedulePointer = Schedule( ScheduleIndex ).WeekSchedulePointer( DayOfYear_Schedule );
@@ -1,6 +1,9 @@
 #ifndef ScheduleManager_hh_INCLUDED
 #define ScheduleManager_hh_INCLUDED
 
+// C++ Headers
+#include <cstddef>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
 #include <ObjexxFCL/FArray1S.hh>
@@ -43,10 +46,15 @@ namespace ScheduleManager {
 	extern int NumDaySchedules;
 	extern int NumWeekSchedules;
 	extern int NumSchedules;
+	extern int NumActiveSchedules; // Number of schedules referenced by the simulation (updated each timestep)
+	extern int NumReportedSchedules; // Number of schedules with a Schedule Value output variable (set each timestep for reporting)
+	extern int NumFileDaysShared; // Number of Schedule:File days that share an identical earlier day profile
 
 	//Logical Variables for Module
 	extern bool ScheduleInputProcessed; // This is false until the Schedule Input has been processed.
 	extern bool ScheduleDSTSFileWarningIssued;
+	extern bool ActiveScheduleListChanged; // True when a schedule has been referenced since the active list was built
+	extern bool ScheduleValuesUpdated; // True once UpdateScheduleValues has set the current values
 
 	//Derived Types Variables
 
@@ -220,6 +228,9 @@ namespace ScheduleManager {
 	extern FArray1D< DayScheduleData > DaySchedule; // Day Schedule Storage
 	extern FArray1D< WeekScheduleData > WeekSchedule; // Week Schedule Storage
 	extern FArray1D< ScheduleData > Schedule; // Schedule Storage
+	extern FArray1D_int ActiveSchedule; // Schedules updated each timestep (those referenced by the simulation)
+	extern FArray1D_int ActiveDaySchedulePtr; // Day schedule in effect for the current day for each active schedule
+	extern FArray1D_int ReportedSchedule; // Schedules with a Schedule Value output variable (reported, metered or read by another report)
 
 	// Functions
 
@@ -235,6 +246,18 @@ namespace ScheduleManager {
 	void
 	UpdateScheduleValues();
 
+	void
+	BuildActiveScheduleList();
+
+	void
+	AddActiveSchedule( int const ScheduleIndex ); // schedule first referenced during the run
+
+	std::size_t
+	DayScheduleValueHash( FArray2< Real64 > const & TSValue ); // timestep values of a day schedule
+
+	void
+	ReportScheduleStorage();
+
 	Real64
 	LookUpScheduleValue(
 		int const ScheduleIndex,
@@ -4,8 +4,20 @@ extern "C" {
 }
 
 // C++ Headers
+#include <cerrno>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/environment.hh>
@@ -31,6 +43,7 @@ extern "C" {
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataLoopNode.hh>
@@ -48,6 +61,7 @@ extern "C" {
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
 #include <DualDuct.hh>
+#include <DXCoils.hh>
 #include <EconomicLifeCycleCost.hh>
 #include <EconomicTariff.hh>
 #include <EMSManager.hh>
@@ -58,12 +72,14 @@ extern "C" {
 #include <General.hh>
 #include <GeneralRoutines.hh>
 #include <HeatBalanceAirManager.hh>
+#include <HeatBalanceIntRadExchange.hh>
 #include <HeatBalanceManager.hh>
 #include <HeatBalanceSurfaceManager.hh>
 #include <HVACControllers.hh>
 #include <HVACManager.hh>
 #include <InputProcessor.hh>
 #include <ManageElectricPower.hh>
+#include <MemoryUsage.hh>
 #include <MixedAir.hh>
 #include <NodeInputManager.hh>
 #include <OutAirNodeManager.hh>
@@ -148,6 +164,7 @@ namespace SimulationManager {
 	// MODULE VARIABLE DECLARATIONS:
 	bool RunPeriodsInInput( false );
 	bool RunControlInInput( false );
+	int RunPeriodSegment( 0 ); // run period segment simulated by this (worker) process, 0 if none
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -193,6 +210,7 @@ namespace SimulationManager {
 		using OutputReportTabular::WriteTabularReports;
 		using OutputReportTabular::OpenOutputTabularFile;
 		using OutputReportTabular::CloseOutputTabularFile;
+		using OutputReportTabular::GetInputTabularReports;
 		using DataErrorTracking::AskForConnectionsReport;
 		using DataErrorTracking::ExitDuringSimulations;
 		using OutputProcessor::SetupTimePointers;
@@ -200,9 +218,15 @@ namespace SimulationManager {
 		using CostEstimateManager::SimCostEstimate;
 		using EconomicTariff::ComputeTariff; // added for computing annual utility costs
 		using EconomicTariff::WriteTabularTariffReports;
+		using EconomicTariff::WriteTariffMeterData;
+		using EconomicTariff::ReplayTariffMeterData;
 		using General::TrimSigDigits;
 		using OutputReportPredefined::SetPredefinedTables;
 		using HVACControllers::DumpAirLoopStatistics;
+		using DXCoils::ReportDXCoilFullLoadStatistics;
+		using HeatBalanceIntRadExchange::ReportScriptFCacheStatistics;
+		using SolarShading::ReportSunlitFracCacheStatistics;
+		using MemoryUsage::ReportMemoryUsage;
 		using NodeInputManager::SetupNodeVarsForReporting;
 		using NodeInputManager::CheckMarkedNodes;
 		using BranchNodeConnections::CheckNodeConnections;
@@ -228,6 +252,7 @@ namespace SimulationManager {
 		using DataSystemVariables::DeveloperFlag;
 		using DataSystemVariables::TimingFlag;
 		using DataSystemVariables::FullAnnualRun;
+		using DataSystemVariables::ReplayTariffMeterDataFile;
 		using SetPointManager::CheckIfAnyIdealCondEntSetPoint;
 		using Psychrometrics::InitializePsychRoutines;
 		using namespace FaultsManager;
@@ -293,11 +318,22 @@ namespace SimulationManager {
 
 		CheckAndReadFaults();
 
+		// Re-evaluate the tariffs and life-cycle costs from the meter data saved by an earlier run
+		// instead of simulating: the building and HVAC are neither sized nor set up.
+		if ( ! ReplayTariffMeterDataFile.empty() ) {
+			ReplayTariffs();
+			return;
+		}
+
 		ManageBranchInput(); // just gets input and returns.
 
+		if ( DisplayMemoryUsage ) ReportMemoryUsage( "Before Sizing" );
+
 		DoingSizing = true;
 		ManageSizing();
 
+		if ( DisplayMemoryUsage ) ReportMemoryUsage( "After Sizing" );
+
 		BeginFullSimFlag = true;
 		SimsDone = false;
 		if ( DoDesDaySim || DoWeathSim ) {
@@ -321,6 +357,8 @@ namespace SimulationManager {
 		SetupSimulation( ErrorsFound );
 		InitCurveReporting();
 
+		if ( DisplayMemoryUsage ) ReportMemoryUsage( "After Simulation Setup" );
+
 		AskForConnectionsReport = true; // set to true now that input processing and sizing is done.
 		KickOffSimulation = false;
 		WarmupFlag = false;
@@ -397,6 +435,10 @@ namespace SimulationManager {
 			if ( ErrorsFound ) break;
 			if ( ( ! DoDesDaySim ) && ( KindOfSim != ksRunPeriodWeather ) ) continue;
 			if ( ( ! DoWeathSim ) && ( KindOfSim == ksRunPeriodWeather ) ) continue;
+			if ( ( KindOfSim == ksRunPeriodWeather ) && SimulateRunPeriodInSegments() ) {
+				SimsDone = true;
+				continue;
+			}
 
 			++EnvCount;
 
@@ -433,6 +475,7 @@ namespace SimulationManager {
 				} else {
 					DayOfSimChr = "0";
 				}
+				if ( ( RunPeriodSegment > 0 ) && ! WarmupFlag ) BeginRunPeriodSegmentDay();
 				BeginDayFlag = true;
 				EndDayFlag = false;
 
@@ -507,6 +550,8 @@ namespace SimulationManager {
 
 			} // ... End day loop.
 
+			if ( RunPeriodSegment > 0 ) EndRunPeriodSegmentWorker();
+
 			// Need one last call to send latest states to middleware
 			ExternalInterfaceExchangeVariables();
 
@@ -532,6 +577,8 @@ namespace SimulationManager {
 #endif
 		SimCostEstimate();
 
+		WriteTariffMeterData(); // Save the meter data used by the tariffs for later re-evaluation
+
 		ComputeTariff(); //     Compute the utility bills
 
 		ReportForTabularReports(); // For Energy Meters (could have other things that need to be pushed to after simulation)
@@ -548,6 +595,14 @@ namespace SimulationManager {
 
 		DumpAirLoopStatistics(); // Dump runtime statistics for air loop controller simulation to csv file
 
+		ReportDXCoilFullLoadStatistics(); // Report how often DX coils reused their full-load operating point
+
+		ReportScriptFCacheStatistics(); // Report how the interior radiant exchange followed shade/blind changes
+
+		ReportSunlitFracCacheStatistics(); // Report how often sunlit fractions were reused for similar sun positions
+
+		if ( DisplayMemoryUsage ) ReportMemoryUsage( "End of Simulation" );
+
 #ifdef EP_Detailed_Timings
 		epStopTime( "Closeout Reporting=" );
 #endif
@@ -567,6 +622,711 @@ namespace SimulationManager {
 
 	}
 
+#ifndef _WIN32
+	namespace {
+		// Run period segment worker processes write their part of the eso, mtr and eio files and a
+		// status file (error counts, error messages, the counters of the caches and the zone air and
+		// inside surface state at both ends of the segment) next to the output files of the parent process.
+
+		int RunPeriodSegmentSpinUpDays( 0 ); // spin-up days of the segment of the worker process
+		FArray1D_int RunPeriodSegmentErrorCounts( 6, 0 ); // error counters at the start of the worker process
+		std::vector< Real64 > RunPeriodSegmentStartState; // state at the end of the spin-up days (worker process)
+
+		std::string
+		RunPeriodSegmentFileName(
+			int const Segment, // run period segment
+			std::string const & Extension // ".eso", ".mtr", ".eio" or ".sts"
+		)
+		{
+			return "eplusout_seg" + std::to_string( Segment ) + Extension;
+		}
+
+		void
+		GetRunPeriodSegmentErrorCounts( FArray1D_int & Counts )
+		{
+			using namespace DataErrorTracking;
+
+			Counts( 1 ) = TotalSevereErrors;
+			Counts( 2 ) = TotalWarningErrors;
+			Counts( 3 ) = TotalSevereErrorsDuringWarmup;
+			Counts( 4 ) = TotalWarningErrorsDuringWarmup;
+			Counts( 5 ) = TotalSevereErrorsDuringSizing;
+			Counts( 6 ) = TotalWarningErrorsDuringSizing;
+		}
+
+		void
+		GetRunPeriodSegmentState( std::vector< Real64 > & State )
+		{
+			// zone air temperatures, zone air humidity ratios and inside surface temperatures
+			using DataHeatBalFanSys::MAT;
+			using DataHeatBalFanSys::ZoneAirHumRat;
+			using DataHeatBalSurface::TempSurfIn;
+
+			State.clear();
+			for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) State.push_back( MAT( ZoneNum ) );
+			for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) State.push_back( ZoneAirHumRat( ZoneNum ) );
+			for ( int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum ) State.push_back( TempSurfIn( SurfNum ) );
+		}
+
+		void
+		WriteRunPeriodSegmentStatus(
+			bool const Completed, // true if the segment was simulated to its end
+			std::vector< Real64 > const & EndState // state at the end of the segment
+		)
+		{
+			FArray1D_int Counts( 6 );
+			std::vector< Real64 > Statistics; // counters of the caches of the worker process
+			std::ofstream sts_stream( RunPeriodSegmentFileName( RunPeriodSegment, ".sts" ), std::ios_base::out | std::ios_base::trunc );
+			sts_stream.precision( 17 );
+			sts_stream << ( Completed ? "Completed" : "Failed" ) << '\n';
+			GetRunPeriodSegmentErrorCounts( Counts );
+			for ( int i = 1; i <= 6; ++i ) sts_stream << Counts( i ) - RunPeriodSegmentErrorCounts( i ) << ' ';
+			sts_stream << '\n' << RunPeriodSegmentStartState.size();
+			for ( auto const Value : RunPeriodSegmentStartState ) sts_stream << ' ' << Value;
+			sts_stream << '\n' << EndState.size();
+			for ( auto const Value : EndState ) sts_stream << ' ' << Value;
+			SizingManager::GetWorkerStatistics( Statistics );
+			sts_stream << '\n' << Statistics.size();
+			for ( auto const Value : Statistics ) sts_stream << ' ' << Value;
+			sts_stream << '\n' << DataErrorTracking::CachedErrorMessages.size() << '\n';
+			for ( auto const & Message : DataErrorTracking::CachedErrorMessages ) sts_stream << Message << '\n';
+		}
+
+		bool
+		ReadRunPeriodSegmentStatus(
+			int const Segment, // run period segment
+			FArray1D_int & Counts, // error counts added by the segment
+			std::vector< Real64 > & StartState, // state at the end of the spin-up days
+			std::vector< Real64 > & EndState, // state at the end of the segment
+			std::vector< Real64 > & Statistics, // counters of the caches of the segment
+			std::vector< std::string > & Messages // error messages of the segment
+		)
+		{
+			// Returns true if the worker process completed the segment
+			std::ifstream sts_stream( RunPeriodSegmentFileName( Segment, ".sts" ), std::ios_base::in );
+			std::string Status;
+			std::string Line;
+			std::size_t Size( 0 );
+
+			Counts = 0;
+			StartState.clear();
+			EndState.clear();
+			Statistics.clear();
+			Messages.clear();
+			if ( ! std::getline( sts_stream, Status ) ) return false;
+			for ( int i = 1; i <= 6; ++i ) sts_stream >> Counts( i );
+			sts_stream >> Size;
+			StartState.resize( sts_stream ? Size : 0 );
+			for ( auto & Value : StartState ) sts_stream >> Value;
+			sts_stream >> Size;
+			EndState.resize( sts_stream ? Size : 0 );
+			for ( auto & Value : EndState ) sts_stream >> Value;
+			sts_stream >> Size;
+			Statistics.resize( sts_stream ? Size : 0 );
+			for ( auto & Value : Statistics ) sts_stream >> Value;
+			sts_stream >> Size;
+			std::getline( sts_stream, Line );
+			for ( std::size_t i = 0; sts_stream && i < Size; ++i ) {
+				if ( std::getline( sts_stream, Line ) ) Messages.push_back( Line );
+			}
+			return ( Status == "Completed" ) && ! sts_stream.fail();
+		}
+
+		void
+		StitchRunPeriodSegmentOutput(
+			int const OutputUnit, // eso or mtr file unit of this process
+			std::string const & Extension, // ".eso" or ".mtr"
+			std::vector< int > const & SegmentFirstDay, // first day of each segment in the run period
+			std::vector< int > const & SegmentSpinUpDays, // spin-up days of each segment
+			std::vector< bool > const & AveragedReportID, // true for the report IDs of averaged variables
+			int const NumDays, // days in the run period
+			int & RecordCount // count of the data records in the output file
+		)
+		{
+
+			// SUBROUTINE INFORMATION:
+			//       AUTHOR         na
+			//       DATE WRITTEN   na
+			//       MODIFIED       na
+			//       RE-ENGINEERED  na
+
+			// PURPOSE OF THIS SUBROUTINE:
+			// Appends the eso or mtr output of the run period segments to the output file of this
+			// process, as if the run period had been simulated in one piece.
+
+			// METHODOLOGY EMPLOYED:
+			// The worker processes report nothing during their spin-up days, so the time step,
+			// hourly, daily and monthly records are copied as they are, with the day of simulation
+			// of the time stamps counted from the start of the run period.  The environment stamp
+			// (and the end of the data dictionary, if it is not written yet) is taken from the first
+			// segment.  Variables set up after the workers started are in the data dictionary of
+			// every segment: each of these lines is only copied the first time.  The run period records of the segments are combined into one: averaged
+			// variables are weighted by the days of the segments, everything else is summed, and
+			// the minimum and maximum are the extremes over the segments.
+
+			// Using/Aliasing
+			using DataStringGlobals::NL;
+			using General::strip_trailing_zeros;
+			using OutputProcessor::TimeStepStampReportNbr;
+			using OutputProcessor::DailyStampReportNbr;
+			using OutputProcessor::MonthlyStampReportNbr;
+			using OutputProcessor::RunPeriodStampReportNbr;
+
+			// Locals
+			// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+			std::ostream * out_stream( gio::out_stream( OutputUnit ) );
+			std::string Line;
+			std::string RunPeriodStamp; // run period time stamp (of the last segment)
+			std::set< std::string > DictionaryLines; // data dictionary lines copied from the segments
+			std::vector< int > RunPeriodIDs; // report IDs of the run period records, in the order of the file
+			std::map< int, std::vector< std::string > > RunPeriodFields; // fields of the combined run period records
+			std::map< int, Real64 > RunPeriodSum; // sum (averaged variables: day weighted sum) of the run period values
+			bool InRunPeriod( false ); // true while reading the records after a run period time stamp
+
+			if ( ! out_stream ) return;
+
+			for ( std::size_t Segment = 0; Segment < SegmentFirstDay.size(); ++Segment ) {
+				std::ifstream seg_stream( RunPeriodSegmentFileName( Segment + 1, Extension ), std::ios_base::in );
+				int const SegmentNumDays( ( Segment + 1 < SegmentFirstDay.size() ? SegmentFirstDay[ Segment + 1 ] : NumDays + 1 ) - SegmentFirstDay[ Segment ] );
+				InRunPeriod = false;
+				while ( std::getline( seg_stream, Line ) ) {
+					if ( Line.empty() ) continue;
+					if ( ! std::isdigit( Line[ 0 ] ) ) { // End of Data Dictionary
+						if ( Segment == 0 ) {
+							*out_stream << Line << NL;
+							PrintEndDataDictionary = false;
+						}
+						continue;
+					}
+					if ( Line.find( '!' ) != std::string::npos ) { // Data Dictionary (report frequency comment)
+						if ( DictionaryLines.insert( Line ).second ) *out_stream << Line << NL;
+						continue;
+					}
+
+					std::string::size_type const Comma( Line.find( ',' ) );
+					int const ReportID( std::atoi( Line.c_str() ) );
+					if ( ReportID == EnvironmentReportNbr ) {
+						if ( Segment == 0 ) *out_stream << Line << NL;
+						InRunPeriod = false;
+						continue;
+					}
+					if ( ( ReportID == TimeStepStampReportNbr ) || ( ReportID == DailyStampReportNbr ) || ( ReportID == MonthlyStampReportNbr ) || ( ReportID == RunPeriodStampReportNbr ) ) {
+						std::string::size_type const Comma2( Line.find( ',', Comma + 1 ) );
+						int const DayOfSim( std::atoi( Line.c_str() + Comma + 1 ) - SegmentSpinUpDays[ Segment ] + SegmentFirstDay[ Segment ] - 1 );
+						Line = Line.substr( 0, Comma + 1 ) + std::to_string( DayOfSim ) + ( Comma2 == std::string::npos ? BlankString : Line.substr( Comma2 ) );
+						InRunPeriod = ( ReportID == RunPeriodStampReportNbr );
+						if ( InRunPeriod ) {
+							RunPeriodStamp = Line;
+						} else {
+							*out_stream << Line << NL;
+						}
+						continue;
+					}
+					if ( ! InRunPeriod ) {
+						*out_stream << Line << NL;
+						++RecordCount;
+						continue;
+					}
+
+					// run period record: value, then the minimum and the maximum with their dates
+					std::vector< std::string > Fields;
+					std::string::size_type Pos( 0 );
+					while ( true ) {
+						std::string::size_type const Next( Line.find( ',', Pos ) );
+						Fields.push_back( Line.substr( Pos, Next - Pos ) );
+						if ( Next == std::string::npos ) break;
+						Pos = Next + 1;
+					}
+					if ( Fields.size() < 2 ) continue;
+					bool const Averaged( ( ReportID < int( AveragedReportID.size() ) ) && AveragedReportID[ ReportID ] );
+					Real64 const Value( std::atof( Fields[ 1 ].c_str() ) * ( Averaged ? SegmentNumDays : 1 ) );
+					auto const Found( RunPeriodFields.find( ReportID ) );
+					if ( Found == RunPeriodFields.end() ) {
+						RunPeriodIDs.push_back( ReportID );
+						RunPeriodFields[ ReportID ] = Fields;
+						RunPeriodSum[ ReportID ] = Value;
+						continue;
+					}
+					std::vector< std::string > & Combined( Found->second );
+					RunPeriodSum[ ReportID ] += Value;
+					std::size_t const Group( ( Fields.size() - 2 ) / 2 ); // fields of the minimum (and of the maximum)
+					if ( ( Group > 0 ) && ( Fields.size() == Combined.size() ) ) {
+						if ( std::atof( Fields[ 2 ].c_str() ) < std::atof( Combined[ 2 ].c_str() ) ) {
+							std::copy( Fields.begin() + 2, Fields.begin() + 2 + Group, Combined.begin() + 2 );
+						}
+						if ( std::atof( Fields[ 2 + Group ].c_str() ) > std::atof( Combined[ 2 + Group ].c_str() ) ) {
+							std::copy( Fields.begin() + 2 + Group, Fields.end(), Combined.begin() + 2 + Group );
+						}
+					}
+				}
+			}
+
+			if ( RunPeriodIDs.empty() ) return;
+			*out_stream << RunPeriodStamp << NL;
+			for ( auto const ReportID : RunPeriodIDs ) {
+				std::vector< std::string > & Combined( RunPeriodFields[ ReportID ] );
+				bool const Averaged( ( ReportID < int( AveragedReportID.size() ) ) && AveragedReportID[ ReportID ] );
+				Real64 const Value( RunPeriodSum[ ReportID ] / ( Averaged ? NumDays : 1 ) );
+				if ( Value == 0.0 ) {
+					Combined[ 1 ] = "0.0";
+				} else {
+					gio::write( Combined[ 1 ], fmtLD ) << Value;
+					strip_trailing_zeros( strip( Combined[ 1 ] ) );
+				}
+				*out_stream << Combined[ 0 ];
+				for ( std::size_t i = 1; i < Combined.size(); ++i ) *out_stream << ',' << Combined[ i ];
+				*out_stream << NL;
+				++RecordCount;
+			}
+
+		}
+
+		void
+		AppendRunPeriodSegmentInits( int const NumSegments )
+		{
+			// Appends the eio output of the segments (their environment, warmup and other lines) to the
+			// eio file of this process.  The header lines of a record type are only copied the first time.
+			std::ostream * out_stream( gio::out_stream( OutputFileInits ) );
+			std::set< std::string > HeaderLines; // header lines copied from the segments
+			std::string Line;
+
+			if ( ! out_stream ) return;
+			for ( int Segment = 1; Segment <= NumSegments; ++Segment ) {
+				std::ifstream seg_stream( RunPeriodSegmentFileName( Segment, ".eio" ), std::ios_base::in );
+				while ( std::getline( seg_stream, Line ) ) {
+					if ( ! Line.empty() && ( Line[ 0 ] == '!' ) && ! HeaderLines.insert( Line ).second ) continue;
+					*out_stream << Line << DataStringGlobals::NL;
+				}
+			}
+		}
+
+		void
+		RemoveRunPeriodSegmentFiles( int const NumSegments )
+		{
+			for ( int Segment = 1; Segment <= NumSegments; ++Segment ) {
+				std::remove( RunPeriodSegmentFileName( Segment, ".eso" ).c_str() );
+				std::remove( RunPeriodSegmentFileName( Segment, ".mtr" ).c_str() );
+				std::remove( RunPeriodSegmentFileName( Segment, ".eio" ).c_str() );
+				std::remove( RunPeriodSegmentFileName( Segment, ".sts" ).c_str() );
+			}
+		}
+
+		std::string
+		LargestStateDifference(
+			std::vector< Real64 > const & State1, // state at the end of a segment
+			std::vector< Real64 > const & State2, // state at the start of the next segment
+			std::size_t const First, // first state value compared
+			std::size_t const Count, // number of state values compared
+			int const SigDigits, // digits after the decimal point of the difference
+			std::string & Name // name of the zone or surface with the largest difference
+		)
+		{
+			// Returns the largest absolute difference of a part of the state, as text
+			Real64 Largest( -1.0 );
+			Name = "N/A";
+			if ( State1.size() != State2.size() || First + Count > State1.size() ) return "N/A";
+			for ( std::size_t i = First; i < First + Count; ++i ) {
+				Real64 const Difference( std::abs( State1[ i ] - State2[ i ] ) );
+				if ( Difference <= Largest ) continue;
+				Largest = Difference;
+				if ( First + Count <= std::size_t( 2 * NumOfZones ) ) {
+					Name = DataHeatBalance::Zone( ( i - First ) + 1 ).Name;
+				} else {
+					Name = DataSurfaces::Surface( ( i - First ) + 1 ).Name;
+				}
+			}
+			if ( Largest < 0.0 ) return "N/A";
+			return General::RoundSigDigits( Largest, SigDigits );
+		}
+
+	}
+#endif
+
+	bool
+	SimulateRunPeriodInSegments()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Simulates the weather file run period just set up by GetNextEnvironment in segments
+		// side by side in worker processes (environment variable EP_RUNPERIOD_SEGMENTS) and
+		// stitches their eso and mtr output.  Returns false if the run period has to be simulated
+		// in this process; in a worker process it returns false with its segment set up instead.
+
+		// METHODOLOGY EMPLOYED:
+		// The run period is cut at the first days of months, into segments of about the same
+		// length.  Every worker process is a fork of this process.  It simulates its segment
+		// starting EP_RUNPERIOD_SPINUP_DAYS days (default 7) early, after the usual warmup, and
+		// reports nothing during these spin-up days, so that its monthly results only cover its
+		// own days.  The results are an approximation: the thermal history at the start of a
+		// segment comes from the spin-up and not from the previous segment.  The differences of
+		// the zone air and inside surface state at the segment boundaries (end of one segment and
+		// end of the spin-up of the next one) are reported in the eio file to judge it, after the
+		// eio output of the workers (their environment and warmup lines).
+		// Only the eso and mtr files are stitched.  The run period is simulated in this process
+		// with tabular reports or tariffs (OutputReportTabular and EconomicTariff gather every
+		// time step into monthly, bin and extreme value tables of this process; merging them would
+		// mean sending all of these tables back from the workers), SQLite output or time series
+		// tables written while simulating (written directly to their files), cumulative meters or
+		// reporting during warmup (reported during the spin-up days), EMS or the external
+		// interface (they may carry state across days), for run periods that cross the end of the
+		// year or are repeated, and on systems without fork.
+		// The tabular reports and tariffs of the segments are not re-aggregated, so most inputs,
+		// which request at least the summary reports, are simulated in one process: segments only
+		// take effect for inputs whose results are the eso and mtr files.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::EnvironmentName;
+		using DataEnvironment::CurrentOverallSimDay;
+		using InputProcessor::GetNumObjectsFound;
+		using General::InvJulianDay;
+		using General::RoundSigDigits;
+		using OutputProcessor::AveragedVar;
+		using OutputProcessor::NumOfRVariable;
+		using OutputProcessor::NumOfIVariable;
+		using OutputProcessor::RVariableTypes;
+		using OutputProcessor::IVariableTypes;
+		using SizingManager::GetWorkerOutputUnits;
+		using SizingManager::SilenceWorkerOutputUnits;
+		using SizingManager::ResetWorkerStatistics;
+		using SizingManager::AddWorkerStatistics;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "SimulateRunPeriodInSegments: " );
+		static gio::Fmt SegmentHeaderFormat( "('! <Run Period Segment>, Segment Number, Start Date, End Date, Spin-up Days, ',"
+			"'Zone Air Temperature Difference at Start {deltaC}, Zone, Zone Air Humidity Ratio Difference at Start {kgWater/kgDryAir}, Zone, ',"
+			"'Inside Surface Temperature Difference at Start {deltaC}, Surface')" );
+		static gio::Fmt DateFormat( "(I2.2,'/',I2.2)" );
+
+#ifdef _WIN32
+		return false;
+#else
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static bool PrintSegmentHeader( true );
+		std::string Reason; // why the run period is simulated in this process
+		std::vector< int > Boundaries; // days of the run period that are the first days of a month
+		std::vector< int > SegmentFirstDay; // first day of each segment in the run period
+		std::vector< int > SegmentSpinUpDays; // spin-up days of each segment
+		std::vector< pid_t > Pids; // worker processes
+		std::vector< bool > Completed; // true if a segment was simulated to its end
+		std::vector< std::vector< Real64 > > StartState; // state at the end of the spin-up days of each segment
+		std::vector< std::vector< Real64 > > EndState; // state at the end of each segment
+		std::vector< bool > AveragedReportID; // true for the report IDs of averaged variables
+		FArray1D_int Counts( 6 );
+		std::vector< std::string > Messages;
+		std::vector< Real64 > Statistics; // counters of the caches of a segment
+		std::vector< int > OutputUnits; // output units the workers must not write
+		int NumSegments; // number of segments
+		int Month;
+		int Day;
+		bool Available( true );
+		bool ErrorsFound( false );
+
+		if ( NumRunPeriodSegments <= 1 ) return false;
+
+		auto const & envrn( Environment( Envrn ) );
+		int const LocalLeapYearAdd( envrn.IsLeapYear ? 1 : 0 );
+		if ( envrn.ActualWeather || envrn.NumSimYears > 1 || envrn.CurrentYear > 0 || envrn.StartJDay > envrn.EndJDay ) {
+			Reason = "the run period crosses the end of the year, is repeated or uses actual weather years";
+		} else if ( AnyEnergyManagementSystemInModel || GetNumObjectsFound( "ExternalInterface" ) > 0 ) {
+			Reason = "EMS or the external interface is used";
+		} else if ( GetNumObjectsFound( "Output:Table:SummaryReports" ) > 0 || GetNumObjectsFound( "Output:Table:Monthly" ) > 0 || GetNumObjectsFound( "Output:Table:TimeBins" ) > 0 || GetNumObjectsFound( "UtilityCost:Tariff" ) > 0 ) {
+			Reason = "tabular reports or tariffs are requested";
+		} else if ( GetNumObjectsFound( "Output:Meter:Cumulative" ) > 0 || GetNumObjectsFound( "Output:Meter:Cumulative:MeterFileOnly" ) > 0 ) {
+			Reason = "cumulative meters are requested";
+		} else if ( sqlite->writeOutputToSQLite() || DirectCSVOutput || ReportDuringWarmup ) {
+			Reason = "SQLite output, time series tables written while simulating or reporting during warmup are requested";
+		}
+
+		// first days of the months in the run period, other than its first day
+		for ( int JDay = envrn.StartJDay + 1; JDay <= envrn.EndJDay; ++JDay ) {
+			InvJulianDay( JDay, Month, Day, LocalLeapYearAdd );
+			if ( Day == 1 ) Boundaries.push_back( JDay - envrn.StartJDay + 1 );
+		}
+		NumSegments = std::min( NumRunPeriodSegments, int( Boundaries.size() ) + 1 );
+		if ( Reason.empty() && NumSegments < 2 ) Reason = "the run period does not cross the start of a month";
+
+		if ( ! Reason.empty() ) {
+			ShowWarningError( RoutineName + "Run period \"" + EnvironmentName + "\" is simulated in one process because " + Reason + '.' );
+			return false;
+		}
+
+		// segments of about the same length, cut at the first days of months
+		SegmentFirstDay.push_back( 1 );
+		int Last( -1 ); // index of the last boundary used
+		for ( int Cut = 1; Cut < NumSegments; ++Cut ) {
+			Real64 const Target( 1.0 + Real64( NumOfDayInEnvrn ) * Cut / NumSegments );
+			int Best( Last + 1 );
+			for ( int i = Last + 1; i < int( Boundaries.size() ) - ( NumSegments - 1 - Cut ); ++i ) {
+				if ( std::abs( Boundaries[ i ] - Target ) < std::abs( Boundaries[ Best ] - Target ) ) Best = i;
+			}
+			SegmentFirstDay.push_back( Boundaries[ Best ] );
+			Last = Best;
+		}
+		for ( int Segment = 0; Segment < NumSegments; ++Segment ) {
+			SegmentSpinUpDays.push_back( std::min( RunPeriodSpinUpDays, SegmentFirstDay[ Segment ] - 1 ) );
+		}
+
+		DisplayString( "Simulating Run Period in " + RoundSigDigits( NumSegments ) + " Segments for " + EnvironmentName );
+
+		// The workers inherit the stream buffers, which must be empty
+		GetWorkerOutputUnits( OutputUnits );
+		for ( int const Unit : OutputUnits ) gio::flush( Unit );
+		std::cout.flush();
+		for ( int Segment = 0; Segment < NumSegments; ++Segment ) {
+			pid_t const Pid( fork() );
+			if ( Pid == 0 ) {
+				int const NumDays( ( Segment + 1 < NumSegments ? SegmentFirstDay[ Segment + 1 ] : NumOfDayInEnvrn + 1 ) - SegmentFirstDay[ Segment ] );
+
+				// the output files belong to the parent: the worker writes its own eso, mtr and eio files
+				SilenceWorkerOutputUnits( OutputUnits );
+				ResetWorkerStatistics();
+				RunPeriodSegment = Segment + 1;
+				RunPeriodSegmentSpinUpDays = SegmentSpinUpDays[ Segment ];
+				DataErrorTracking::CacheErrorMessages = true;
+				DataErrorTracking::CachedErrorMessages.clear();
+				GetRunPeriodSegmentErrorCounts( RunPeriodSegmentErrorCounts );
+
+				gio::close( OutputFileStandard );
+				{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileStandard, RunPeriodSegmentFileName( RunPeriodSegment, ".eso" ), flags ); }
+				eso_stream = gio::out_stream( OutputFileStandard );
+				gio::close( OutputFileMeters );
+				{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileMeters, RunPeriodSegmentFileName( RunPeriodSegment, ".mtr" ), flags ); }
+				mtr_stream = gio::out_stream( OutputFileMeters );
+				gio::close( OutputFileInits );
+				{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileInits, RunPeriodSegmentFileName( RunPeriodSegment, ".eio" ), flags ); }
+
+				SetRunPeriodSegment( SegmentFirstDay[ Segment ] - RunPeriodSegmentSpinUpDays, NumDays + RunPeriodSegmentSpinUpDays );
+				GetNextEnvironment( Available, ErrorsFound );
+				if ( ! Available || ErrorsFound ) AbortRunPeriodSegmentWorker();
+				return false; // the worker simulates its segment in ManageSimulation
+			}
+			if ( Pid < 0 ) {
+				for ( auto const Worker : Pids ) {
+					kill( Worker, SIGKILL );
+					waitpid( Worker, nullptr, 0 );
+				}
+				RemoveRunPeriodSegmentFiles( NumSegments );
+				ShowWarningError( RoutineName + "Run period \"" + EnvironmentName + "\" is simulated in one process because no worker process could be started." );
+				return false;
+			}
+			Pids.push_back( Pid );
+		}
+		for ( auto const Pid : Pids ) {
+			while ( ( waitpid( Pid, nullptr, 0 ) < 0 ) && ( errno == EINTR ) ) {}
+		}
+
+		// error messages and counts, in the order of the segments
+		Completed.resize( NumSegments );
+		StartState.resize( NumSegments );
+		EndState.resize( NumSegments );
+		for ( int Segment = 0; Segment < NumSegments; ++Segment ) {
+			Completed[ Segment ] = ReadRunPeriodSegmentStatus( Segment + 1, Counts, StartState[ Segment ], EndState[ Segment ], Statistics, Messages );
+			for ( auto const & Message : Messages ) ShowErrorMessage( Message );
+			AddWorkerStatistics( Statistics );
+			DataErrorTracking::TotalSevereErrors += Counts( 1 );
+			DataErrorTracking::TotalWarningErrors += Counts( 2 );
+			DataErrorTracking::TotalSevereErrorsDuringWarmup += Counts( 3 );
+			DataErrorTracking::TotalWarningErrorsDuringWarmup += Counts( 4 );
+			DataErrorTracking::TotalSevereErrorsDuringSizing += Counts( 5 );
+			DataErrorTracking::TotalWarningErrorsDuringSizing += Counts( 6 );
+		}
+		for ( int Segment = 0; Segment < NumSegments; ++Segment ) {
+			if ( Completed[ Segment ] ) continue;
+			RemoveRunPeriodSegmentFiles( NumSegments );
+			ShowSevereError( RoutineName + "Run period segment worker process did not complete segment #" + RoundSigDigits( Segment + 1 ) + " of Run Period " + EnvironmentName );
+			ShowContinueError( "...Run again without the " + cNumRunPeriodSegments + " environment variable to see all of the messages." );
+			ShowFatalError( "Program terminates due to preceding condition." );
+		}
+
+		// stitch the eso and mtr output, the eio output of the segments follows that of this process
+		AppendRunPeriodSegmentInits( NumSegments );
+		for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+			int const ReportID( RVariableTypes( Loop ).ReportID );
+			if ( ReportID < 0 ) continue;
+			if ( ReportID >= int( AveragedReportID.size() ) ) AveragedReportID.resize( ReportID + 1, false );
+			AveragedReportID[ ReportID ] = ( RVariableTypes( Loop ).StoreType == AveragedVar );
+		}
+		for ( int Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
+			int const ReportID( IVariableTypes( Loop ).ReportID );
+			if ( ReportID < 0 ) continue;
+			if ( ReportID >= int( AveragedReportID.size() ) ) AveragedReportID.resize( ReportID + 1, false );
+			AveragedReportID[ ReportID ] = ( IVariableTypes( Loop ).StoreType == AveragedVar );
+		}
+		StitchRunPeriodSegmentOutput( OutputFileStandard, ".eso", SegmentFirstDay, SegmentSpinUpDays, AveragedReportID, NumOfDayInEnvrn, StdOutputRecordCount );
+		StitchRunPeriodSegmentOutput( OutputFileMeters, ".mtr", SegmentFirstDay, SegmentSpinUpDays, AveragedReportID, NumOfDayInEnvrn, StdMeterRecordCount );
+		RemoveRunPeriodSegmentFiles( NumSegments );
+
+		// segment boundaries
+		if ( PrintSegmentHeader ) {
+			gio::write( OutputFileInits, SegmentHeaderFormat );
+			PrintSegmentHeader = false;
+		}
+		for ( int Segment = 0; Segment < NumSegments; ++Segment ) {
+			int const NumDays( ( Segment + 1 < NumSegments ? SegmentFirstDay[ Segment + 1 ] : NumOfDayInEnvrn + 1 ) - SegmentFirstDay[ Segment ] );
+			std::string StDate;
+			std::string EnDate;
+			std::string ZoneTemp( "N/A" );
+			std::string ZoneTempName( "N/A" );
+			std::string ZoneHumRat( "N/A" );
+			std::string ZoneHumRatName( "N/A" );
+			std::string SurfTemp( "N/A" );
+			std::string SurfTempName( "N/A" );
+			InvJulianDay( envrn.StartJDay + SegmentFirstDay[ Segment ] - 1, Month, Day, LocalLeapYearAdd );
+			gio::write( StDate, DateFormat ) << Month << Day;
+			InvJulianDay( envrn.StartJDay + SegmentFirstDay[ Segment ] + NumDays - 2, Month, Day, LocalLeapYearAdd );
+			gio::write( EnDate, DateFormat ) << Month << Day;
+			if ( Segment > 0 ) {
+				ZoneTemp = LargestStateDifference( EndState[ Segment - 1 ], StartState[ Segment ], 0, NumOfZones, 3, ZoneTempName );
+				ZoneHumRat = LargestStateDifference( EndState[ Segment - 1 ], StartState[ Segment ], NumOfZones, NumOfZones, 6, ZoneHumRatName );
+				SurfTemp = LargestStateDifference( EndState[ Segment - 1 ], StartState[ Segment ], 2 * NumOfZones, DataSurfaces::TotSurfaces, 3, SurfTempName );
+			}
+			gio::write( OutputFileInits, fmtA ) << "Run Period Segment," + RoundSigDigits( Segment + 1 ) + ',' + StDate + ',' + EnDate + ',' + RoundSigDigits( SegmentSpinUpDays[ Segment ] ) + ',' + ZoneTemp + ',' + ZoneTempName + ',' + ZoneHumRat + ',' + ZoneHumRatName + ',' + SurfTemp + ',' + SurfTempName;
+		}
+
+		CurrentOverallSimDay += NumOfDayInEnvrn;
+		return true;
+#endif
+
+	}
+
+	void
+	ReplayTariffs()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Takes the place of the sizing, the simulation and the closeout reporting of ManageSimulation
+		// when the tariffs are re-evaluated from saved meter data (ReplayTariffMeterData environment
+		// variable).  Only the utility cost and life-cycle cost results are calculated and reported.
+
+		// METHODOLOGY EMPLOYED:
+		// No building or HVAC input is processed: the saved meters are added to the output processor
+		// by ReplayTariffMeterData, which then gathers the tariff data of every saved timestep.  The
+		// tabular file only gets the tariff, economics and life-cycle cost reports.
+
+		// Using/Aliasing
+		using DataSystemVariables::ReplayTariffMeterDataFile;
+		using EconomicTariff::ComputeTariff;
+		using EconomicTariff::ReplayTariffMeterData;
+		using EconomicTariff::WriteTabularTariffReports;
+		using EconomicLifeCycleCost::GetInputForLifeCycleCost;
+		using EconomicLifeCycleCost::ComputeLifeCycleCostAndReport;
+		using OutputReportTabular::GetInputTabularReports;
+		using OutputReportTabular::OpenOutputTabularFile;
+		using OutputReportTabular::CloseOutputTabularFile;
+
+		DisplayString( "Re-evaluating Tariffs from Saved Meter Data" );
+
+		if ( sqlite->writeOutputToSQLite() ) {
+			sqlite->sqliteBegin();
+			sqlite->createSQLiteSimulationsRecord( 1 );
+			sqlite->sqliteCommit();
+		}
+
+		GetInputForLifeCycleCost();
+		ReplayTariffMeterData( ReplayTariffMeterDataFile );
+		GetInputTabularReports();
+
+		if ( sqlite->writeOutputToSQLite() ) sqlite->sqliteBegin();
+
+		ComputeTariff();
+		OpenOutputTabularFile();
+		WriteTabularTariffReports();
+		ComputeLifeCycleCostAndReport();
+		CloseOutputTabularFile();
+
+		CloseOutputFiles();
+
+		if ( sqlite->writeOutputToSQLite() ) {
+			sqlite->sqliteCommit();
+			sqlite->initializeIndexes();
+		}
+
+	}
+
+	void
+	BeginRunPeriodSegmentDay()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Called at the start of every (non warmup) day of a run period segment worker process:
+		// turns the reporting off for the spin-up days and keeps the state at their end.
+
+#ifndef _WIN32
+		DoOutputReporting = ( DayOfSim > RunPeriodSegmentSpinUpDays );
+		if ( DayOfSim == RunPeriodSegmentSpinUpDays + 1 ) GetRunPeriodSegmentState( RunPeriodSegmentStartState );
+#endif
+
+	}
+
+	void
+	EndRunPeriodSegmentWorker()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Ends a run period segment worker process at the end of its segment.  Never returns.
+
+#ifndef _WIN32
+		std::vector< Real64 > EndState;
+		GetRunPeriodSegmentState( EndState );
+		gio::close( OutputFileStandard );
+		gio::close( OutputFileMeters );
+		gio::close( OutputFileInits );
+		WriteRunPeriodSegmentStatus( true, EndState );
+#endif
+		std::_Exit( EXIT_SUCCESS );
+
+	}
+
+	void
+	AbortRunPeriodSegmentWorker()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Ends a run period segment worker process on a fatal error.  The parent process reports
+		// the cached error messages and stops the simulation.
+
+#ifndef _WIN32
+		WriteRunPeriodSegmentStatus( false, std::vector< Real64 >() );
+#endif
+		std::_Exit( EXIT_FAILURE );
+
+	}
+
 	void
 	GetProjectData()
 	{
@@ -835,6 +1595,8 @@ namespace SimulationManager {
 					DisplayExtraWarnings = true;
 				} else if ( SameString( Alphas( NumA ), "DisplayAdvancedReportVariables" ) ) {
 					DisplayAdvancedReportVariables = true;
+				} else if ( SameString( Alphas( NumA ), "DisplayMemoryUsage" ) ) {
+					DisplayMemoryUsage = true;
 				} else if ( SameString( Alphas( NumA ), "DisplayAllWarnings" ) ) {
 					DisplayAllWarnings = true;
 					DisplayExtraWarnings = true;
@@ -1284,6 +2046,7 @@ namespace SimulationManager {
 		using OutputProcessor::NumTotalIVariable;
 		using OutputProcessor::NumReportList;
 		using OutputProcessor::InstMeterCacheSize;
+		using OutputProcessor::CloseDirectCSVOutput;
 		using OutputReportTabular::maxUniqueKeyCount;
 		using OutputReportTabular::MonthlyFieldSetInputCount;
 		using SolarShading::maxNumberOfFigures;
@@ -1386,6 +2149,7 @@ namespace SimulationManager {
 			{ IOFlags flags; flags.DISPOSE( "DELETE" ); gio::close( OutputFileStandard, flags ); }
 		}
 		eso_stream = nullptr;
+		CloseDirectCSVOutput();
 
 		if ( any_eq( HeatTransferAlgosUsed, UseCondFD ) ) { // echo out relaxation factor, it may have been changed by the program
 			gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference Numerical Parameters>, " "Starting Relaxation Factor, Final Relaxation Factor";
@@ -31,6 +31,7 @@ namespace SimulationManager {
 	// MODULE VARIABLE DECLARATIONS:
 	extern bool RunPeriodsInInput;
 	extern bool RunControlInInput;
+	extern int RunPeriodSegment; // run period segment simulated by this (worker) process, 0 if none
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -39,6 +40,21 @@ namespace SimulationManager {
 	void
 	ManageSimulation();
 
+	void
+	ReplayTariffs();
+
+	bool
+	SimulateRunPeriodInSegments();
+
+	void
+	BeginRunPeriodSegmentDay();
+
+	void
+	EndRunPeriodSegmentWorker();
+
+	void
+	AbortRunPeriodSegmentWorker();
+
 	void
 	GetProjectData();
 
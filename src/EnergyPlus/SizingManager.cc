@@ -1,6 +1,18 @@
 // C++ Headers
+#include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <string>
+#include <vector>
+#ifndef _WIN32
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -11,22 +23,28 @@
 #include <SizingManager.hh>
 #include <CostEstimateManager.hh>
 #include <DataEnvironment.hh>
+#include <DataErrorTracking.hh>
 #include <DataHeatBalance.hh>
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
+#include <DXCoils.hh>
 #include <EMSManager.hh>
 #include <General.hh>
+#include <HeatBalanceIntRadExchange.hh>
 #include <HeatBalanceManager.hh>
 #include <InputProcessor.hh>
+#include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <OutputReportTabular.hh>
 #include <ScheduleManager.hh>
 #include <SimAirServingZones.hh>
+#include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
 #include <UtilityRoutines.hh>
 #include <WeatherManager.hh>
@@ -146,7 +164,6 @@ namespace SizingManager {
 		static bool ErrorsFound( false );
 		static bool SimAir( false );
 		static bool SimZoneEquip( false );
-		static int TimeStepInDay( 0 ); // time step number
 		static int LastMonth( 0 );
 		static int LastDayOfMonth( 0 );
 		static int CtrlZoneNum( 0 ); // controlled zone index
@@ -170,7 +187,6 @@ namespace SizingManager {
 
 		OutputFileZoneSizing = 0;
 		OutputFileSysSizing = 0;
-		TimeStepInDay = 0;
 		SysSizingRunDone = false;
 		ZoneSizingRunDone = false;
 		curName = "Unknown";
@@ -273,124 +289,16 @@ namespace SizingManager {
 
 					++NumSizingPeriodsPerformed;
 
-					BeginEnvrnFlag = true;
-					EndEnvrnFlag = false;
-					EndMonthFlag = false;
-					WarmupFlag = true;
-					DayOfSim = 0;
-					DayOfSimChr = "0";
-					CurEnvirNumSimDay = 1;
-					++CurOverallSimDay;
-					while ( ( DayOfSim < NumOfDayInEnvrn ) || ( WarmupFlag ) ) { // Begin day loop ...
-
-						++DayOfSim;
-						if ( ! WarmupFlag && DayOfSim > 1 ) {
-							++CurEnvirNumSimDay;
-						}
-
-						gio::write( DayOfSimChr, fmtLD ) << DayOfSim;
-						strip( DayOfSimChr );
-						BeginDayFlag = true;
-						EndDayFlag = false;
-
-						if ( WarmupFlag ) {
-							DisplayString( "Warming up" );
-						} else { // (.NOT.WarmupFlag)
-							if ( DayOfSim == 1 ) {
-								if ( ! isPulseZoneSizing ) {
-									DisplayString( "Performing Zone Sizing Simulation" );
-									DisplayString( "...for Sizing Period: #" + RoundSigDigits( NumSizingPeriodsPerformed ) + ' ' + EnvironmentName );
-								} else {
-									DisplayString( "Performing Zone Sizing Simulation for Load Component Report" );
-									DisplayString( "...for Sizing Period: #" + RoundSigDigits( NumSizingPeriodsPerformed ) + ' ' + EnvironmentName );
-								}
-							}
-							UpdateZoneSizing( BeginDay );
-						}
-
-						for ( HourOfDay = 1; HourOfDay <= 24; ++HourOfDay ) { // Begin hour loop ...
-
-							BeginHourFlag = true;
-							EndHourFlag = false;
-
-							for ( TimeStep = 1; TimeStep <= NumOfTimeStepInHour; ++TimeStep ) { // Begin time step (TINC) loop ...
-
-								BeginTimeStepFlag = true;
-
-								// Set the End__Flag variables to true if necessary.  Note that
-								// each flag builds on the previous level.  EndDayFlag cannot be
-								// .TRUE. unless EndHourFlag is also .TRUE., etc.  Note that the
-								// EndEnvrnFlag and the EndSimFlag cannot be set during warmup.
-								// Note also that BeginTimeStepFlag, EndTimeStepFlag, and the
-								// SubTimeStepFlags can/will be set/reset in the HVAC Manager.
-
-								if ( TimeStep == NumOfTimeStepInHour ) {
-									EndHourFlag = true;
-									if ( HourOfDay == 24 ) {
-										EndDayFlag = true;
-										if ( ( ! WarmupFlag ) && ( DayOfSim == NumOfDayInEnvrn ) ) {
-											EndEnvrnFlag = true;
-										}
-									}
-								}
-
-								//set flag for pulse used in load component reporting
-								doLoadComponentPulseNow = false;
-								if ( isPulseZoneSizing ) {
-									if ( ! WarmupFlag ) {
-										if ( DayOfSim == 1 ) { //first day of sizing period
-											if ( HourOfDay == 10 ) { //at 10am
-												if ( TimeStep == 1 ) { //first timestep in hour
-													doLoadComponentPulseNow = true;
-												}
-											}
-										}
-									}
-								}
-
-								ManageWeather();
-
-								if ( ! WarmupFlag ) {
-									TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
-									if ( HourOfDay == 1 && TimeStep == 1 ) {
-										DesDayWeath( CurOverallSimDay ).DateString = TrimSigDigits( Month ) + '/' + TrimSigDigits( DayOfMonth );
-									}
-									DesDayWeath( CurOverallSimDay ).Temp( TimeStepInDay ) = OutDryBulbTemp;
-									DesDayWeath( CurOverallSimDay ).HumRat( TimeStepInDay ) = OutHumRat;
-									DesDayWeath( CurOverallSimDay ).Press( TimeStepInDay ) = OutBaroPress;
-								}
-
-								ManageHeatBalance();
-
-								//  After the first iteration of HeatBalance, all the "input" has been gotten
-								if ( BeginSimFlag ) {
-									if ( GetNumRangeCheckErrorsFound() > 0 ) {
-										ShowFatalError( RoutineName + "Out of \"range\" values found in input" );
-									}
-								}
-
-								BeginHourFlag = false;
-								BeginDayFlag = false;
-								BeginEnvrnFlag = false;
-								BeginSimFlag = false;
-
-							} // ... End time step (TINC) loop.
-
-							PreviousHour = HourOfDay;
-
-						} // ... End hour loop.
-
-						if ( EndDayFlag ) UpdateZoneSizing( EndDay );
-
-						if ( ! WarmupFlag && ( DayOfSim > 0 ) && ( DayOfSim < NumOfDayInEnvrn ) ) {
-							++CurOverallSimDay;
-						}
-
-					} // ... End day loop.
+					SimulateZoneSizingPeriod( NumSizingPeriodsPerformed, false );
 
 					LastMonth = Month;
 					LastDayOfMonth = DayOfMonth;
 
+					// the remaining sizing periods may be simulated side by side in worker processes
+					if ( NumSizingPeriodsPerformed == 1 && ! isPulseZoneSizing ) {
+						if ( SimulateZoneSizingPeriodsInWorkers( NumSizingPeriodsPerformed, LastMonth, LastDayOfMonth, ErrorsFound ) ) break;
+					}
+
 				} // ... End environment loop
 
 				if ( NumSizingPeriodsPerformed > 0 ) {
@@ -457,6 +365,9 @@ namespace SizingManager {
 				ShowFatalError( RoutineName + "Out of \"range\" values found in input" );
 			}
 
+			// The system sizing periods are always simulated in this process: they only replay the
+			// weather and the zone sizing results through UpdateSysSizing, without any zone or HVAC
+			// simulation, so they take a small fraction of the time of the zone sizing periods.
 			ResetEnvironmentCounter();
 			CurEnvirNumSimDay = 0;
 			CurOverallSimDay = 0;
@@ -667,6 +578,917 @@ namespace SizingManager {
 
 	}
 
+	void
+	SimulateZoneSizingPeriod(
+		int const NumSizingPeriodsPerformed, // number of the sizing period (for the display)
+		bool const DeferEndDay // true to leave the end of day update of the zone sizing results to the caller
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Fred Buhl
+		//       DATE WRITTEN   December 2000
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine simulates the days of the current environment (a sizing period)
+		// for the zone sizing calculations.
+
+		// METHODOLOGY EMPLOYED:
+		// The zones are supplied with "Ideal Loads" (moved out of ManageSizing).  A zone sizing
+		// worker process defers the end of day update of the zone sizing results, the parent
+		// process does it in the order of the sizing periods.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using InputProcessor::GetNumRangeCheckErrorsFound;
+		using ZoneEquipmentManager::UpdateZoneSizing;
+		using DataEnvironment::OutDryBulbTemp;
+		using DataEnvironment::OutHumRat;
+		using DataEnvironment::OutBaroPress;
+		using DataEnvironment::Month;
+		using DataEnvironment::DayOfMonth;
+		using DataEnvironment::EndMonthFlag;
+		using DataEnvironment::EnvironmentName;
+		using General::TrimSigDigits;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "ManageSizing: " );
+		static gio::Fmt fmtLD( "*" );
+
+		// INTERFACE BLOCK SPECIFICATIONS: none
+
+		// DERIVED TYPE DEFINITIONS: none
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int TimeStepInDay; // time step number
+
+		// FLOW:
+
+		BeginEnvrnFlag = true;
+		EndEnvrnFlag = false;
+		EndMonthFlag = false;
+		WarmupFlag = true;
+		DayOfSim = 0;
+		DayOfSimChr = "0";
+		CurEnvirNumSimDay = 1;
+		++CurOverallSimDay;
+		while ( ( DayOfSim < NumOfDayInEnvrn ) || ( WarmupFlag ) ) { // Begin day loop ...
+
+			++DayOfSim;
+			if ( ! WarmupFlag && DayOfSim > 1 ) {
+				++CurEnvirNumSimDay;
+			}
+
+			gio::write( DayOfSimChr, fmtLD ) << DayOfSim;
+			strip( DayOfSimChr );
+			BeginDayFlag = true;
+			EndDayFlag = false;
+
+			if ( WarmupFlag ) {
+				DisplayString( "Warming up" );
+			} else { // (.NOT.WarmupFlag)
+				if ( DayOfSim == 1 ) {
+					if ( ! isPulseZoneSizing ) {
+						DisplayString( "Performing Zone Sizing Simulation" );
+						DisplayString( "...for Sizing Period: #" + RoundSigDigits( NumSizingPeriodsPerformed ) + ' ' + EnvironmentName );
+					} else {
+						DisplayString( "Performing Zone Sizing Simulation for Load Component Report" );
+						DisplayString( "...for Sizing Period: #" + RoundSigDigits( NumSizingPeriodsPerformed ) + ' ' + EnvironmentName );
+					}
+				}
+				UpdateZoneSizing( BeginDay );
+			}
+
+			for ( HourOfDay = 1; HourOfDay <= 24; ++HourOfDay ) { // Begin hour loop ...
+
+				BeginHourFlag = true;
+				EndHourFlag = false;
+
+				for ( TimeStep = 1; TimeStep <= NumOfTimeStepInHour; ++TimeStep ) { // Begin time step (TINC) loop ...
+
+					BeginTimeStepFlag = true;
+
+					// Set the End__Flag variables to true if necessary.  Note that
+					// each flag builds on the previous level.  EndDayFlag cannot be
+					// .TRUE. unless EndHourFlag is also .TRUE., etc.  Note that the
+					// EndEnvrnFlag and the EndSimFlag cannot be set during warmup.
+					// Note also that BeginTimeStepFlag, EndTimeStepFlag, and the
+					// SubTimeStepFlags can/will be set/reset in the HVAC Manager.
+
+					if ( TimeStep == NumOfTimeStepInHour ) {
+						EndHourFlag = true;
+						if ( HourOfDay == 24 ) {
+							EndDayFlag = true;
+							if ( ( ! WarmupFlag ) && ( DayOfSim == NumOfDayInEnvrn ) ) {
+								EndEnvrnFlag = true;
+							}
+						}
+					}
+
+					//set flag for pulse used in load component reporting
+					doLoadComponentPulseNow = false;
+					if ( isPulseZoneSizing ) {
+						if ( ! WarmupFlag ) {
+							if ( DayOfSim == 1 ) { //first day of sizing period
+								if ( HourOfDay == 10 ) { //at 10am
+									if ( TimeStep == 1 ) { //first timestep in hour
+										doLoadComponentPulseNow = true;
+									}
+								}
+							}
+						}
+					}
+
+					ManageWeather();
+
+					if ( ! WarmupFlag ) {
+						TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
+						if ( HourOfDay == 1 && TimeStep == 1 ) {
+							DesDayWeath( CurOverallSimDay ).DateString = TrimSigDigits( Month ) + '/' + TrimSigDigits( DayOfMonth );
+						}
+						DesDayWeath( CurOverallSimDay ).Temp( TimeStepInDay ) = OutDryBulbTemp;
+						DesDayWeath( CurOverallSimDay ).HumRat( TimeStepInDay ) = OutHumRat;
+						DesDayWeath( CurOverallSimDay ).Press( TimeStepInDay ) = OutBaroPress;
+					}
+
+					ManageHeatBalance();
+
+					//  After the first iteration of HeatBalance, all the "input" has been gotten
+					if ( BeginSimFlag ) {
+						if ( GetNumRangeCheckErrorsFound() > 0 ) {
+							ShowFatalError( RoutineName + "Out of \"range\" values found in input" );
+						}
+					}
+
+					BeginHourFlag = false;
+					BeginDayFlag = false;
+					BeginEnvrnFlag = false;
+					BeginSimFlag = false;
+
+				} // ... End time step (TINC) loop.
+
+				PreviousHour = HourOfDay;
+
+			} // ... End hour loop.
+
+			if ( EndDayFlag && ! DeferEndDay ) UpdateZoneSizing( EndDay );
+
+			if ( ! WarmupFlag && ( DayOfSim > 0 ) && ( DayOfSim < NumOfDayInEnvrn ) ) {
+				++CurOverallSimDay;
+			}
+
+		} // ... End day loop.
+
+	}
+
+#ifndef _WIN32
+	namespace {
+		// Zone sizing worker processes report back to the parent process through a pipe.  Every
+		// record is [int Kind][int Length][Length bytes] with the payload in native byte order
+		// (the processes are forks of the same executable).
+
+		int const WorkerRecordPeriod( 1 ); // results of one sizing period
+		int const WorkerRecordFailed( 2 ); // the worker stopped on a fatal error
+		int const WorkerRecordFinished( 3 ); // all sizing periods of the worker are done
+
+		// pointers to the time step sequences of the zone sizing data that a sizing period fills in
+		FArray1D< Real64 > ZoneSizingData::* const CalcZoneSizingSeqs[] = {
+			&ZoneSizingData::HeatFlowSeq, &ZoneSizingData::HeatLoadSeq, &ZoneSizingData::HeatZoneTempSeq,
+			&ZoneSizingData::HeatOutTempSeq, &ZoneSizingData::HeatZoneRetTempSeq, &ZoneSizingData::HeatTstatTempSeq,
+			&ZoneSizingData::HeatZoneHumRatSeq, &ZoneSizingData::HeatOutHumRatSeq, &ZoneSizingData::CoolFlowSeq,
+			&ZoneSizingData::CoolLoadSeq, &ZoneSizingData::CoolZoneTempSeq, &ZoneSizingData::CoolOutTempSeq,
+			&ZoneSizingData::CoolZoneRetTempSeq, &ZoneSizingData::CoolTstatTempSeq, &ZoneSizingData::CoolZoneHumRatSeq,
+			&ZoneSizingData::CoolOutHumRatSeq
+		};
+		FArray1D< Real64 > ZoneSizingData::* const ZoneSizingSeqs[] = {
+			&ZoneSizingData::DesHeatSetPtSeq, &ZoneSizingData::HeatTstatTempSeq,
+			&ZoneSizingData::DesCoolSetPtSeq, &ZoneSizingData::CoolTstatTempSeq
+		};
+
+		int SizingWorkerPipe( -1 ); // write end of the pipe to the parent process (worker processes only)
+		int SizingWorkerPeriod( 0 ); // sizing period the worker process is simulating
+		FArray1D_int SizingWorkerErrorCounts( 6, 0 ); // error counters at the start of the sizing period
+
+		void
+		PutInt(
+			std::vector< char > & Buffer,
+			int const Value
+		)
+		{
+			char const * Bytes( reinterpret_cast< char const * >( &Value ) );
+			Buffer.insert( Buffer.end(), Bytes, Bytes + sizeof( Value ) );
+		}
+
+		void
+		PutReal(
+			std::vector< char > & Buffer,
+			Real64 const Value
+		)
+		{
+			char const * Bytes( reinterpret_cast< char const * >( &Value ) );
+			Buffer.insert( Buffer.end(), Bytes, Bytes + sizeof( Value ) );
+		}
+
+		void
+		PutString(
+			std::vector< char > & Buffer,
+			std::string const & Value
+		)
+		{
+			PutInt( Buffer, int( Value.size() ) );
+			Buffer.insert( Buffer.end(), Value.begin(), Value.end() );
+		}
+
+		void
+		PutArray(
+			std::vector< char > & Buffer,
+			FArray1D< Real64 > const & Value
+		)
+		{
+			PutInt( Buffer, int( Value.size() ) );
+			for ( std::size_t i = 0; i < Value.size(); ++i ) PutReal( Buffer, Value[ i ] );
+		}
+
+		int
+		GetInt(
+			std::vector< char > const & Buffer,
+			std::size_t & Pos,
+			bool & OK
+		)
+		{
+			int Value( 0 );
+			if ( OK && Pos + sizeof( Value ) <= Buffer.size() ) {
+				std::memcpy( &Value, &Buffer[ Pos ], sizeof( Value ) );
+				Pos += sizeof( Value );
+			} else {
+				OK = false;
+			}
+			return Value;
+		}
+
+		Real64
+		GetReal(
+			std::vector< char > const & Buffer,
+			std::size_t & Pos,
+			bool & OK
+		)
+		{
+			Real64 Value( 0.0 );
+			if ( OK && Pos + sizeof( Value ) <= Buffer.size() ) {
+				std::memcpy( &Value, &Buffer[ Pos ], sizeof( Value ) );
+				Pos += sizeof( Value );
+			} else {
+				OK = false;
+			}
+			return Value;
+		}
+
+		std::string
+		GetString(
+			std::vector< char > const & Buffer,
+			std::size_t & Pos,
+			bool & OK
+		)
+		{
+			int const Length( GetInt( Buffer, Pos, OK ) );
+			if ( ! OK || Length < 0 || Pos + Length > Buffer.size() ) {
+				OK = false;
+				return std::string();
+			}
+			std::string const Value( &Buffer[ 0 ] + Pos, Length );
+			Pos += Length;
+			return Value;
+		}
+
+		void
+		GetArray(
+			std::vector< char > const & Buffer,
+			std::size_t & Pos,
+			FArray1D< Real64 > & Value,
+			bool & OK
+		)
+		{
+			int const Length( GetInt( Buffer, Pos, OK ) );
+			if ( ! OK || Length != int( Value.size() ) ) {
+				OK = false;
+				return;
+			}
+			for ( std::size_t i = 0; i < Value.size(); ++i ) Value[ i ] = GetReal( Buffer, Pos, OK );
+		}
+
+		void
+		WriteWorkerRecord(
+			int const Kind,
+			std::vector< char > const & Payload
+		)
+		{
+			std::vector< char > Record;
+			PutInt( Record, Kind );
+			PutInt( Record, int( Payload.size() ) );
+			Record.insert( Record.end(), Payload.begin(), Payload.end() );
+			std::size_t Written( 0 );
+			while ( Written < Record.size() ) {
+				ssize_t const Count( write( SizingWorkerPipe, &Record[ 0 ] + Written, Record.size() - Written ) );
+				if ( Count < 0 && errno == EINTR ) continue;
+				if ( Count <= 0 ) std::_Exit( EXIT_FAILURE ); // parent is gone
+				Written += Count;
+			}
+		}
+
+		void
+		GetErrorCounts( FArray1D_int & Counts )
+		{
+			using namespace DataErrorTracking;
+
+			Counts( 1 ) = TotalSevereErrors;
+			Counts( 2 ) = TotalWarningErrors;
+			Counts( 3 ) = TotalSevereErrorsDuringWarmup;
+			Counts( 4 ) = TotalWarningErrorsDuringWarmup;
+			Counts( 5 ) = TotalSevereErrorsDuringSizing;
+			Counts( 6 ) = TotalWarningErrorsDuringSizing;
+		}
+
+		void
+		PutPeriodHeader( std::vector< char > & Buffer )
+		{
+			// sizing period, the error counts it added and its error messages
+			FArray1D_int Counts( 6 );
+			GetErrorCounts( Counts );
+			PutInt( Buffer, SizingWorkerPeriod );
+			for ( int i = 1; i <= 6; ++i ) PutInt( Buffer, Counts( i ) - SizingWorkerErrorCounts( i ) );
+			PutInt( Buffer, int( DataErrorTracking::CachedErrorMessages.size() ) );
+			for ( auto const & Message : DataErrorTracking::CachedErrorMessages ) PutString( Buffer, Message );
+		}
+
+		void
+		RunZoneSizingWorker(
+			int const Worker, // worker number (0 based)
+			int const NumWorkers, // number of worker processes
+			int const NumSizingPeriodsPerformed, // sizing periods done before the workers started
+			std::vector< int > const & OutputUnits, // output units of the parent process
+			int const WriteFD // write end of the pipe to the parent process
+		)
+		{
+
+			// SUBROUTINE INFORMATION:
+			//       AUTHOR         na
+			//       DATE WRITTEN   na
+			//       MODIFIED       na
+			//       RE-ENGINEERED  na
+
+			// PURPOSE OF THIS SUBROUTINE:
+			// Simulates the zone sizing periods given to a worker process and sends the results
+			// to the parent process.  Never returns.
+
+			// METHODOLOGY EMPLOYED:
+			// The worker is a fork of the parent process, so it walks through the remaining
+			// environments the same way as the parent and simulates every NumWorkers'th sizing
+			// period.  The end of day updates of the zone sizing results are left to the parent,
+			// which does them in the order of the sizing periods.  The output files belong to the
+			// parent: the units written while simulating a sizing period (the eso, mtr, eio, audit,
+			// debug and direct csv files and the console) are flushed by the parent before the fork
+			// and silenced in the worker, and its error messages are cached and sent with the results.
+			// The counters of the caches reported at the end of the run are started from zero and
+			// sent to the parent when the worker is done.
+
+			// REFERENCES:
+			// na
+
+			// Using/Aliasing
+			using DataEnvironment::Month;
+			using DataEnvironment::DayOfMonth;
+			using DataZoneEquipment::ZoneEquipConfig;
+
+			// Locals
+			// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+			bool Available( true ); // an environment is available to process
+			bool ErrorsFound( false );
+			int Period( 0 ); // sizing period number counted from the first period of the workers
+			int FirstDay; // first overall simulation day of the sizing period
+			int CtrlZoneNum; // controlled zone index
+			std::vector< char > Buffer;
+			std::vector< Real64 > Statistics; // counters of the caches
+
+			SilenceWorkerOutputUnits( OutputUnits );
+			ResetWorkerStatistics();
+
+			SizingWorkerPipe = WriteFD;
+			DataErrorTracking::CacheErrorMessages = true;
+
+			while ( Available ) {
+
+				GetNextEnvironment( Available, ErrorsFound );
+
+				if ( ! Available ) break;
+				if ( ErrorsFound ) break;
+				if ( KindOfSim == ksRunPeriodWeather ) continue;
+
+				++Period;
+				if ( ( Period - 1 ) % NumWorkers != Worker ) {
+					CurOverallSimDay += NumOfDayInEnvrn;
+					continue;
+				}
+
+				SizingWorkerPeriod = Period;
+				DataErrorTracking::CachedErrorMessages.clear();
+				GetErrorCounts( SizingWorkerErrorCounts );
+
+				FirstDay = CurOverallSimDay + 1;
+				SimulateZoneSizingPeriod( NumSizingPeriodsPerformed + Period, true );
+
+				Buffer.clear();
+				PutPeriodHeader( Buffer );
+				PutInt( Buffer, Month );
+				PutInt( Buffer, DayOfMonth );
+				for ( int Day = FirstDay; Day <= CurOverallSimDay; ++Day ) {
+					PutString( Buffer, DesDayWeath( Day ).DateString );
+					PutArray( Buffer, DesDayWeath( Day ).Temp );
+					PutArray( Buffer, DesDayWeath( Day ).HumRat );
+					PutArray( Buffer, DesDayWeath( Day ).Press );
+					for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+						if ( ! ZoneEquipConfig( CtrlZoneNum ).IsControlled ) continue;
+						auto const & CalcZoneSizingDay( CalcZoneSizing( CtrlZoneNum, Day ) );
+						PutString( Buffer, CalcZoneSizingDay.CoolDesDay );
+						PutString( Buffer, CalcZoneSizingDay.HeatDesDay );
+						PutReal( Buffer, CalcZoneSizingDay.DesHeatDens );
+						PutReal( Buffer, CalcZoneSizingDay.DesCoolDens );
+						PutInt( Buffer, CalcZoneSizingDay.HeatDDNum );
+						PutInt( Buffer, CalcZoneSizingDay.CoolDDNum );
+						for ( auto const Seq : CalcZoneSizingSeqs ) PutArray( Buffer, CalcZoneSizingDay.*Seq );
+						for ( auto const Seq : ZoneSizingSeqs ) PutArray( Buffer, ZoneSizing( CtrlZoneNum, Day ).*Seq );
+					}
+				}
+				WriteWorkerRecord( WorkerRecordPeriod, Buffer );
+
+			}
+
+			// thermostat set point extremes seen by the worker and the counters of its caches
+			Buffer.clear();
+			for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+				PutReal( Buffer, ZoneSizThermSetPtHi( CtrlZoneNum ) );
+				PutReal( Buffer, ZoneSizThermSetPtLo( CtrlZoneNum ) );
+			}
+			GetWorkerStatistics( Statistics );
+			PutInt( Buffer, int( Statistics.size() ) );
+			for ( auto const Value : Statistics ) PutReal( Buffer, Value );
+			WriteWorkerRecord( WorkerRecordFinished, Buffer );
+
+			std::_Exit( EXIT_SUCCESS );
+
+		}
+
+	}
+#endif
+
+	bool
+	SimulateZoneSizingPeriodsInWorkers(
+		int & NumSizingPeriodsPerformed, // number of sizing periods performed
+		int & LastMonth, // month of the last day simulated
+		int & LastDayOfMonth, // day of month of the last day simulated
+		bool & ErrorsFound // true if errors were found getting the environments
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Simulates the remaining zone sizing periods side by side in worker processes
+		// (environment variable EP_SIZING_WORKERS) and merges their results.  Returns false
+		// if the periods have to be simulated in this process.
+
+		// METHODOLOGY EMPLOYED:
+		// The sizing periods do not depend on each other: every one starts with its own begin
+		// environment initialization and warmup, and a zone sizing day only writes its own
+		// slot of the CalcZoneSizing, ZoneSizing and DesDayWeath arrays.  The only link
+		// between the days is the end of day update of CalcFinalZoneSizing, which the workers
+		// leave to this process.  Once all workers are done the day slots are copied from the
+		// worker results and the end of day updates are done in the original order, so the
+		// results are the same as the ones of the serial simulation.
+		// Not done with EMS (its programs may carry state across the periods), with the load
+		// component report (it repeats the zone sizing with the pulse), with weather file
+		// sizing periods or with SQLite output, and only on POSIX systems (fork).
+		// The sizing period display lines are written as the results of each period are merged.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::TotDesDays;
+		using DataEnvironment::TotRunDesPersDays;
+		using DataEnvironment::EnvironmentName;
+		using DataSystemVariables::NumSizingWorkers;
+		using DataZoneEquipment::ZoneEquipConfig;
+		using ZoneEquipmentManager::UpdateZoneSizing;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "ManageSizing: " );
+
+#ifdef _WIN32
+		return false;
+#else
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		bool Available( true ); // an environment is available to process
+		int NumWorkers; // number of worker processes
+		int NumPeriods( 0 ); // number of sizing periods given to the workers
+		int CtrlZoneNum; // controlled zone index
+		std::vector< pid_t > Pids; // worker processes
+		std::vector< int > Pipes; // read ends of the pipes from the workers
+		std::vector< std::vector< char > > Output; // everything the workers sent
+		std::vector< int > PeriodFirstDay; // first overall simulation day of each sizing period
+		std::vector< int > PeriodNumDays; // number of days of each sizing period
+		std::vector< std::string > PeriodName; // name of each sizing period
+		std::vector< int > PeriodDone; // record kind received for each sizing period (0 = none)
+		std::vector< std::size_t > PeriodRecord; // position of the payload of the record of each sizing period
+		std::vector< std::size_t > PeriodWorker; // worker of each sizing period
+		std::vector< int > OutputUnits; // output units the workers must not write
+
+		if ( NumSizingWorkers <= 1 || CompLoadReportIsReq || AnyEnergyManagementSystemInModel ) return false;
+		if ( sqlite->writeOutputToSQLite() ) return false; // the database connection can not be shared with the workers
+		if ( TotRunDesPersDays > 0 ) return false; // the weather file is shared with the workers
+		NumWorkers = std::min( NumSizingWorkers, TotDesDays - CurOverallSimDay );
+		if ( NumWorkers < 2 ) return false;
+
+		// The workers inherit the stream buffers, which must be empty
+		GetWorkerOutputUnits( OutputUnits );
+		for ( int const Unit : OutputUnits ) gio::flush( Unit );
+		std::cout.flush();
+
+		for ( int Worker = 0; Worker < NumWorkers; ++Worker ) {
+			int FDs[ 2 ];
+			pid_t Pid( -1 );
+			if ( pipe( FDs ) == 0 ) {
+				Pid = fork();
+				if ( Pid == 0 ) {
+					for ( int const FD : Pipes ) close( FD );
+					close( FDs[ 0 ] );
+					RunZoneSizingWorker( Worker, NumWorkers, NumSizingPeriodsPerformed, OutputUnits, FDs[ 1 ] );
+				}
+				close( FDs[ 1 ] );
+				if ( Pid < 0 ) close( FDs[ 0 ] );
+			}
+			if ( Pid < 0 ) {
+				for ( std::size_t i = 0; i < Pids.size(); ++i ) {
+					kill( Pids[ i ], SIGKILL );
+					waitpid( Pids[ i ], nullptr, 0 );
+					close( Pipes[ i ] );
+				}
+				return false;
+			}
+			Pids.push_back( Pid );
+			Pipes.push_back( FDs[ 0 ] );
+		}
+
+		// walk through the environments the same way as the workers do
+		while ( Available ) {
+
+			GetNextEnvironment( Available, ErrorsFound );
+
+			if ( ! Available ) break;
+			if ( ErrorsFound ) break;
+			if ( KindOfSim == ksRunPeriodWeather ) continue;
+
+			++NumSizingPeriodsPerformed;
+			PeriodFirstDay.push_back( CurOverallSimDay + 1 );
+			PeriodNumDays.push_back( NumOfDayInEnvrn );
+			PeriodName.push_back( EnvironmentName );
+			PeriodWorker.push_back( NumPeriods % NumWorkers );
+			CurOverallSimDay += NumOfDayInEnvrn;
+			++NumPeriods;
+
+		}
+
+		// collect the worker output, all pipes at once so that no worker blocks on a full pipe
+		Output.resize( NumWorkers );
+		std::vector< pollfd > Polls( NumWorkers );
+		for ( int Worker = 0; Worker < NumWorkers; ++Worker ) {
+			Polls[ Worker ].fd = Pipes[ Worker ];
+			Polls[ Worker ].events = POLLIN;
+		}
+		int NumOpen( NumWorkers );
+		char Chunk[ 65536 ];
+		while ( NumOpen > 0 ) {
+			if ( poll( &Polls[ 0 ], Polls.size(), -1 ) < 0 ) {
+				if ( errno == EINTR ) continue;
+				break;
+			}
+			for ( int Worker = 0; Worker < NumWorkers; ++Worker ) {
+				if ( Polls[ Worker ].fd < 0 || Polls[ Worker ].revents == 0 ) continue;
+				ssize_t const Count( read( Polls[ Worker ].fd, Chunk, sizeof( Chunk ) ) );
+				if ( Count < 0 && errno == EINTR ) continue;
+				if ( Count > 0 ) {
+					Output[ Worker ].insert( Output[ Worker ].end(), Chunk, Chunk + Count );
+				} else {
+					close( Polls[ Worker ].fd );
+					Polls[ Worker ].fd = -1;
+					--NumOpen;
+				}
+			}
+		}
+		for ( int Worker = 0; Worker < NumWorkers; ++Worker ) {
+			if ( Polls[ Worker ].fd >= 0 ) close( Polls[ Worker ].fd );
+			waitpid( Pids[ Worker ], nullptr, 0 );
+		}
+
+		// index the records
+		PeriodDone.assign( NumPeriods, 0 );
+		PeriodRecord.assign( NumPeriods, 0 );
+		for ( int Worker = 0; Worker < NumWorkers; ++Worker ) {
+			std::vector< char > const & Buffer( Output[ Worker ] );
+			std::size_t Pos( 0 );
+			bool OK( true );
+			while ( OK && Pos < Buffer.size() ) {
+				int const Kind( GetInt( Buffer, Pos, OK ) );
+				int const Length( GetInt( Buffer, Pos, OK ) );
+				if ( ! OK || Length < 0 || Pos + Length > Buffer.size() ) break;
+				std::size_t const Payload( Pos );
+				Pos += Length;
+				if ( Kind == WorkerRecordFinished ) {
+					std::size_t Pos2( Payload );
+					for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+						ZoneSizThermSetPtHi( CtrlZoneNum ) = max( ZoneSizThermSetPtHi( CtrlZoneNum ), GetReal( Buffer, Pos2, OK ) );
+						ZoneSizThermSetPtLo( CtrlZoneNum ) = min( ZoneSizThermSetPtLo( CtrlZoneNum ), GetReal( Buffer, Pos2, OK ) );
+					}
+					std::vector< Real64 > Statistics( std::max( GetInt( Buffer, Pos2, OK ), 0 ) );
+					for ( auto & Value : Statistics ) Value = GetReal( Buffer, Pos2, OK );
+					if ( OK ) AddWorkerStatistics( Statistics );
+				} else {
+					std::size_t Pos2( Payload );
+					int const Period( GetInt( Buffer, Pos2, OK ) );
+					if ( OK && Period >= 1 && Period <= NumPeriods && PeriodWorker[ Period - 1 ] == std::size_t( Worker ) ) {
+						PeriodDone[ Period - 1 ] = Kind;
+						PeriodRecord[ Period - 1 ] = Payload;
+					}
+				}
+			}
+		}
+
+		// merge the results in the order of the sizing periods
+		for ( int Period = 1; Period <= NumPeriods; ++Period ) {
+			std::vector< char > const & Buffer( Output[ PeriodWorker[ Period - 1 ] ] );
+			std::size_t Pos( PeriodRecord[ Period - 1 ] );
+			bool OK( PeriodDone[ Period - 1 ] != 0 );
+
+			if ( OK ) {
+				FArray1D_int Counts( 6 );
+				DisplayString( "Performing Zone Sizing Simulation" );
+				DisplayString( "...for Sizing Period: #" + RoundSigDigits( NumSizingPeriodsPerformed - NumPeriods + Period ) + ' ' + PeriodName[ Period - 1 ] );
+				GetInt( Buffer, Pos, OK ); // sizing period
+				for ( int i = 1; i <= 6; ++i ) Counts( i ) = GetInt( Buffer, Pos, OK );
+				int const NumMessages( GetInt( Buffer, Pos, OK ) );
+				for ( int i = 1; OK && i <= NumMessages; ++i ) {
+					std::string const Message( GetString( Buffer, Pos, OK ) );
+					if ( OK ) ShowErrorMessage( Message );
+				}
+				if ( OK ) {
+					DataErrorTracking::TotalSevereErrors += Counts( 1 );
+					DataErrorTracking::TotalWarningErrors += Counts( 2 );
+					DataErrorTracking::TotalSevereErrorsDuringWarmup += Counts( 3 );
+					DataErrorTracking::TotalWarningErrorsDuringWarmup += Counts( 4 );
+					DataErrorTracking::TotalSevereErrorsDuringSizing += Counts( 5 );
+					DataErrorTracking::TotalWarningErrorsDuringSizing += Counts( 6 );
+				}
+			}
+
+			if ( OK && PeriodDone[ Period - 1 ] == WorkerRecordPeriod ) {
+				int const Month( GetInt( Buffer, Pos, OK ) );
+				int const DayOfMonth( GetInt( Buffer, Pos, OK ) );
+				int const FirstDay( PeriodFirstDay[ Period - 1 ] );
+				int const LastDay( FirstDay + PeriodNumDays[ Period - 1 ] - 1 );
+				for ( int Day = FirstDay; OK && Day <= LastDay; ++Day ) {
+					DesDayWeath( Day ).DateString = GetString( Buffer, Pos, OK );
+					GetArray( Buffer, Pos, DesDayWeath( Day ).Temp, OK );
+					GetArray( Buffer, Pos, DesDayWeath( Day ).HumRat, OK );
+					GetArray( Buffer, Pos, DesDayWeath( Day ).Press, OK );
+					for ( CtrlZoneNum = 1; OK && CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+						if ( ! ZoneEquipConfig( CtrlZoneNum ).IsControlled ) continue;
+						auto & CalcZoneSizingDay( CalcZoneSizing( CtrlZoneNum, Day ) );
+						CalcZoneSizingDay.CoolDesDay = GetString( Buffer, Pos, OK );
+						CalcZoneSizingDay.HeatDesDay = GetString( Buffer, Pos, OK );
+						CalcZoneSizingDay.DesHeatDens = GetReal( Buffer, Pos, OK );
+						CalcZoneSizingDay.DesCoolDens = GetReal( Buffer, Pos, OK );
+						CalcZoneSizingDay.HeatDDNum = GetInt( Buffer, Pos, OK );
+						CalcZoneSizingDay.CoolDDNum = GetInt( Buffer, Pos, OK );
+						for ( auto const Seq : CalcZoneSizingSeqs ) GetArray( Buffer, Pos, CalcZoneSizingDay.*Seq, OK );
+						for ( auto const Seq : ZoneSizingSeqs ) GetArray( Buffer, Pos, ZoneSizing( CtrlZoneNum, Day ).*Seq, OK );
+					}
+					if ( OK ) {
+						CurOverallSimDay = Day;
+						UpdateZoneSizing( EndDay );
+					}
+				}
+				LastMonth = Month;
+				LastDayOfMonth = DayOfMonth;
+			} else {
+				OK = false;
+			}
+
+			if ( ! OK ) {
+				ShowSevereError( RoutineName + "Zone sizing worker process did not complete Sizing Period: #" + RoundSigDigits( NumSizingPeriodsPerformed - NumPeriods + Period ) + ' ' + PeriodName[ Period - 1 ] );
+				ShowContinueError( "...Run again without the " + DataSystemVariables::cNumSizingWorkers + " environment variable to see all of the messages." );
+				ShowFatalError( "Program terminates due to preceding condition." );
+			}
+		}
+
+		if ( NumPeriods > 0 ) CurOverallSimDay = PeriodFirstDay.back() + PeriodNumDays.back() - 1;
+
+		return true;
+#endif
+
+	}
+
+	void
+	AbortSizingWorker()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Ends a zone sizing worker process on a fatal error.  The parent process reports the
+		// cached error messages and stops the simulation.
+
+#ifndef _WIN32
+		std::vector< char > Buffer;
+		PutPeriodHeader( Buffer );
+		WriteWorkerRecord( WorkerRecordFailed, Buffer );
+#endif
+		std::_Exit( EXIT_FAILURE );
+
+	}
+
+	void
+	GetWorkerOutputUnits( std::vector< int > & Units ) // gio units written while simulating an environment
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Collects the output units (eso, mtr, eio, audit, err, debug and direct csv files) that a
+		// forked worker process (zone sizing or run period segment) must not write.  The parent
+		// flushes them before the fork, so that the workers inherit empty stream buffers.
+
+		Units.clear();
+		for ( int const Unit : { OutputFileStandard, OutputFileMeters, OutputFileInits, OutputFileDebug } ) {
+			if ( Unit > 0 ) Units.push_back( Unit );
+		}
+		for ( std::string const FileName : { "eplusout.audit", "eplusout.err" } ) {
+			IOFlags flags;
+			gio::inquire( FileName, flags );
+			if ( flags.open() ) Units.push_back( flags.unit() );
+		}
+		for ( int FileNum = 1; FileNum <= isize( OutputProcessor::DirectCSVFiles ); ++FileNum ) {
+			if ( OutputProcessor::DirectCSVFiles( FileNum ).BodyUnit > 0 ) Units.push_back( OutputProcessor::DirectCSVFiles( FileNum ).BodyUnit );
+		}
+
+	}
+
+	void
+	SilenceWorkerOutputUnits( std::vector< int > const & Units ) // gio units flushed by the parent before the fork
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Drops everything a worker process writes to the output units of its parent and to the
+		// console.  A failed stream drops the output of the worker.  Nothing may touch the position
+		// of the stream (gio::inquire does), as that flushes the buffer even with the stream failed.
+
+		for ( int const Unit : Units ) {
+			std::ostream * const Stream( gio::out_stream( Unit ) );
+			if ( Stream ) Stream->setstate( std::ios_base::badbit );
+		}
+		std::cout.setstate( std::ios_base::badbit );
+
+	}
+
+	void
+	ResetWorkerStatistics()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the counters of the caches reported at the end of the run (DX coil full-load
+		// reuse, interior radiant exchange Script F and sunlit fraction cache) from zero in a worker
+		// process, so that it only sends its own counts to the parent.
+
+		using DXCoils::DXCoilFullLoad;
+
+		HeatBalanceIntRadExchange::NumScriptFCacheHits = 0;
+		HeatBalanceIntRadExchange::NumScriptFInverseUpdates = 0;
+		HeatBalanceIntRadExchange::NumScriptFInversions = 0;
+		SolarShading::NumSunlitFracCacheLookups = 0;
+		SolarShading::NumSunlitFracCacheHits = 0;
+		SolarShading::NumSunlitFracCacheChecks = 0;
+		SolarShading::MaxSunlitFracCacheDeviation = 0.0;
+		if ( ! allocated( DXCoilFullLoad ) ) return;
+		for ( std::size_t i = 0; i < DXCoilFullLoad.size(); ++i ) {
+			DXCoilFullLoad[ i ].NumCalls = 0;
+			DXCoilFullLoad[ i ].NumHits = 0;
+		}
+
+	}
+
+	void
+	GetWorkerStatistics( std::vector< Real64 > & Statistics ) // counters of the caches of this process
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gathers the counters of the caches reported at the end of the run for sending them from
+		// a worker process to its parent: the Script F and sunlit fraction cache counters, then the
+		// calls and hits of the full-load point of every DX coil mode.
+
+		using DXCoils::DXCoilFullLoad;
+
+		Statistics.clear();
+		Statistics.push_back( HeatBalanceIntRadExchange::NumScriptFCacheHits );
+		Statistics.push_back( HeatBalanceIntRadExchange::NumScriptFInverseUpdates );
+		Statistics.push_back( HeatBalanceIntRadExchange::NumScriptFInversions );
+		Statistics.push_back( SolarShading::NumSunlitFracCacheLookups );
+		Statistics.push_back( SolarShading::NumSunlitFracCacheHits );
+		Statistics.push_back( SolarShading::NumSunlitFracCacheChecks );
+		Statistics.push_back( SolarShading::MaxSunlitFracCacheDeviation );
+		if ( ! allocated( DXCoilFullLoad ) ) return;
+		for ( std::size_t i = 0; i < DXCoilFullLoad.size(); ++i ) {
+			Statistics.push_back( DXCoilFullLoad[ i ].NumCalls );
+			Statistics.push_back( DXCoilFullLoad[ i ].NumHits );
+		}
+
+	}
+
+	void
+	AddWorkerStatistics( std::vector< Real64 > const & Statistics ) // counters of the caches of a worker process
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the counters of the caches sent by a worker process (see GetWorkerStatistics) to
+		// those of this process.  The largest sunlit fraction difference is the larger of the two.
+
+		// METHODOLOGY EMPLOYED:
+		// The split of the counts (cache hits against recalculations) can differ from the one of
+		// a serial run, as the caches of the workers start from the state at the fork; the totals
+		// are the same.  The DX coil counts are only added if both processes have the same DX coils.
+
+		using DXCoils::DXCoilFullLoad;
+
+		if ( Statistics.size() < 7 ) return;
+		HeatBalanceIntRadExchange::NumScriptFCacheHits += int( Statistics[ 0 ] );
+		HeatBalanceIntRadExchange::NumScriptFInverseUpdates += int( Statistics[ 1 ] );
+		HeatBalanceIntRadExchange::NumScriptFInversions += int( Statistics[ 2 ] );
+		SolarShading::NumSunlitFracCacheLookups += int( Statistics[ 3 ] );
+		SolarShading::NumSunlitFracCacheHits += int( Statistics[ 4 ] );
+		SolarShading::NumSunlitFracCacheChecks += int( Statistics[ 5 ] );
+		SolarShading::MaxSunlitFracCacheDeviation = std::max( SolarShading::MaxSunlitFracCacheDeviation, Statistics[ 6 ] );
+		if ( ! allocated( DXCoilFullLoad ) || Statistics.size() != 7 + 2 * DXCoilFullLoad.size() ) return;
+		for ( std::size_t i = 0; i < DXCoilFullLoad.size(); ++i ) {
+			DXCoilFullLoad[ i ].NumCalls += int( Statistics[ 7 + 2 * i ] );
+			DXCoilFullLoad[ i ].NumHits += int( Statistics[ 8 + 2 * i ] );
+		}
+
+	}
+
 	void
 	GetOARequirements()
 	{
@@ -1,6 +1,9 @@
 #ifndef SizingManager_hh_INCLUDED
 #define SizingManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 
@@ -58,6 +61,38 @@ namespace SizingManager {
 	void
 	ManageSizing();
 
+	void
+	SimulateZoneSizingPeriod(
+		int const NumSizingPeriodsPerformed, // number of the sizing period (for the display)
+		bool const DeferEndDay // true to leave the end of day update of the zone sizing results to the caller
+	);
+
+	bool
+	SimulateZoneSizingPeriodsInWorkers(
+		int & NumSizingPeriodsPerformed, // number of sizing periods performed
+		int & LastMonth, // month of the last day simulated
+		int & LastDayOfMonth, // day of month of the last day simulated
+		bool & ErrorsFound // true if errors were found getting the environments
+	);
+
+	void
+	AbortSizingWorker();
+
+	void
+	GetWorkerOutputUnits( std::vector< int > & Units ); // gio units written while simulating an environment
+
+	void
+	SilenceWorkerOutputUnits( std::vector< int > const & Units ); // gio units flushed by the parent before the fork
+
+	void
+	ResetWorkerStatistics();
+
+	void
+	GetWorkerStatistics( std::vector< Real64 > & Statistics ); // counters of the caches of this process
+
+	void
+	AddWorkerStatistics( std::vector< Real64 > const & Statistics ); // counters of the caches of a worker process
+
 	void
 	GetOARequirements();
 
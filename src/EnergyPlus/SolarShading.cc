@@ -194,6 +194,16 @@ namespace SolarShading {
 	FArray1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
 	FArray1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	int maxNumberOfFigures( 0 );
+	int const SunlitFracCacheCheckInterval( 50 ); // every this many cache hits the shadows are also calculated
+	int const MaxSunlitFracCacheValues( 25000000 ); // limit of the surface values kept in the sunlit fraction cache
+	bool GetSunlitFracCacheSettings( true ); // True until the sunlit fraction cache settings are read
+	bool UseSunlitFracCache( false ); // True if the sunlit fraction cache is used
+	Real64 SunlitFracCacheAngle( 0.0 ); // Angular tolerance of the sunlit fraction cache {rad}
+	Real64 SunlitFracCacheCosAngle( 1.0 ); // Cosine of the angular tolerance
+	int NumSunlitFracCacheLookups( 0 ); // sun positions looked up in the sunlit fraction cache
+	int NumSunlitFracCacheHits( 0 ); // sun positions found in the sunlit fraction cache
+	int NumSunlitFracCacheChecks( 0 ); // cache hits checked against a shadow calculation
+	Real64 MaxSunlitFracCacheDeviation( 0.0 ); // largest sunlit fraction difference found by the checks
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
@@ -201,6 +211,8 @@ namespace SolarShading {
 	FArray1D< SurfaceErrorTracking > TrackTooManyFigures;
 	FArray1D< SurfaceErrorTracking > TrackTooManyVertices;
 	FArray1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	std::vector< SunlitFracCacheEntry > SunlitFracCache;
+	std::map< std::int64_t, int > SunlitFracCacheIndex; // Cache entry of each sun direction cell
 
 	static gio::Fmt fmtLD( "*" );
 
@@ -3494,7 +3506,7 @@ namespace SolarShading {
 			CosIncAng( SurfNum, iHour, iTimeStep ) = CTHETA( SurfNum );
 		}
 
-		SHADOW( iHour, iTimeStep ); // Determine sunlit areas and solar multipliers for all surfaces.
+		CachedSHADOW( iHour, iTimeStep ); // Determine sunlit areas and solar multipliers for all surfaces.
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( Surface( SurfNum ).Area >= 1.e-10 ) {
@@ -3949,6 +3961,168 @@ namespace SolarShading {
 
 	}
 
+	void
+	CachedSHADOW(
+		int const iHour, // Hour index
+		int const TS // Time Step
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Determines the sunlit areas (SHADOW) for the current sun direction, reusing the results of
+		// an earlier time step with about the same sun direction when the environment variable
+		// EP_SUNLIT_CACHE_TOLERANCE gives an angular tolerance {deg}.
+
+		// METHODOLOGY EMPLOYED:
+		// The direction cosines of the sun are rounded to multiples of the tolerance to find the
+		// cell of the sun direction; each cell keeps the results (sunlit areas, sunlit fractions
+		// without reveal, window reveal status, back surface overlaps) of the first sun direction
+		// calculated in it, which are reused if that direction is within the tolerance of the
+		// current one.  The sunlit areas of a sun direction only depend on the geometry, unless
+		// the transmittance of shading surfaces is scheduled, so the cache is not used then.
+		// Every SunlitFracCacheCheckInterval-th hit the shadows are calculated anyway and the
+		// largest difference of the sunlit fractions is kept for the report at the end of the run.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::SunlitFracCacheTolerance;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		std::int64_t const CellOffset( 1 << 20 ); // Keeps the cell numbers of the direction cosines positive
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::int64_t Key( 0 ); // Cell of the sun direction
+		Real64 Deviation; // Sunlit fraction difference of a surface
+
+		if ( GetSunlitFracCacheSettings ) {
+			GetSunlitFracCacheSettings = false;
+			UseSunlitFracCache = false;
+			if ( SunlitFracCacheTolerance > 0.0 ) {
+				if ( ShadingTransmittanceVaries ) {
+					ShowWarningError( "Sunlit fraction cache: not used because the transmittance of shading surfaces is scheduled." );
+				} else {
+					SunlitFracCacheAngle = max( SunlitFracCacheTolerance, 0.001 ) * DegToRadians;
+					SunlitFracCacheCosAngle = std::cos( SunlitFracCacheAngle );
+					UseSunlitFracCache = true;
+				}
+			}
+		}
+
+		if ( ! UseSunlitFracCache || CalcSkyDifShading || iHour == 0 ) {
+			SHADOW( iHour, TS );
+			return;
+		}
+
+		++NumSunlitFracCacheLookups;
+		for ( int i = 1; i <= 3; ++i ) {
+			Key = ( Key << 21 ) + ( nint64( SUNCOS( i ) / SunlitFracCacheAngle ) + CellOffset );
+		}
+
+		auto const iCache( SunlitFracCacheIndex.find( Key ) );
+		if ( iCache != SunlitFracCacheIndex.end() ) {
+			auto const & entry( SunlitFracCache[ iCache->second ] );
+			if ( SUNCOS( 1 ) * entry.SunCos( 1 ) + SUNCOS( 2 ) * entry.SunCos( 2 ) + SUNCOS( 3 ) * entry.SunCos( 3 ) >= SunlitFracCacheCosAngle ) {
+				++NumSunlitFracCacheHits;
+				if ( NumSunlitFracCacheHits % SunlitFracCacheCheckInterval != 0 ) {
+					SAREA = entry.SAREA;
+					for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+						SunlitFracWithoutReveal( SurfNum, iHour, TS ) = entry.SunlitFracWithoutReveal( SurfNum );
+						WindowRevealStatus( SurfNum, iHour, TS ) = entry.WindowRevealStatus( SurfNum );
+					}
+					for ( std::size_t i = 0; i < entry.BackSurfIndex.size(); ++i ) {
+						int const SurfNum( entry.BackSurfIndex[ i ] % TotSurfaces + 1 );
+						int const BackSurf( entry.BackSurfIndex[ i ] / TotSurfaces + 1 );
+						BackSurfaces( SurfNum, BackSurf, iHour, TS ) = entry.BackSurfaces[ i ];
+						OverlapAreas( SurfNum, BackSurf, iHour, TS ) = entry.OverlapAreas[ i ];
+					}
+					return;
+				}
+
+				// Check the cached sunlit fractions against the shadow calculation
+				SHADOW( iHour, TS );
+				++NumSunlitFracCacheChecks;
+				for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+					if ( Surface( SurfNum ).Area < 1.e-10 || Surface( SurfNum ).NetAreaShadowCalc <= 0.0 ) continue;
+					Deviation = std::abs( SAREA( SurfNum ) - entry.SAREA( SurfNum ) ) / Surface( SurfNum ).NetAreaShadowCalc;
+					MaxSunlitFracCacheDeviation = max( MaxSunlitFracCacheDeviation, Deviation );
+				}
+				return;
+			}
+		}
+
+		SHADOW( iHour, TS );
+
+		if ( iCache != SunlitFracCacheIndex.end() ) return; // Cell holds another sun direction
+		if ( double( SunlitFracCache.size() + 1 ) * TotSurfaces > MaxSunlitFracCacheValues ) return; // Cache is full
+
+		SunlitFracCacheIndex[ Key ] = SunlitFracCache.size();
+		SunlitFracCache.push_back( SunlitFracCacheEntry() );
+		auto & entry( SunlitFracCache.back() );
+		entry.SunCos = SUNCOS;
+		entry.SAREA = SAREA;
+		entry.SunlitFracWithoutReveal.allocate( TotSurfaces );
+		entry.WindowRevealStatus.allocate( TotSurfaces );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			entry.SunlitFracWithoutReveal( SurfNum ) = SunlitFracWithoutReveal( SurfNum, iHour, TS );
+			entry.WindowRevealStatus( SurfNum ) = WindowRevealStatus( SurfNum, iHour, TS );
+		}
+		for ( int BackSurf = 1; BackSurf <= MaxBkSurf; ++BackSurf ) {
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( BackSurfaces( SurfNum, BackSurf, iHour, TS ) == 0 && OverlapAreas( SurfNum, BackSurf, iHour, TS ) == 0.0 ) continue;
+				entry.BackSurfIndex.push_back( ( BackSurf - 1 ) * TotSurfaces + ( SurfNum - 1 ) );
+				entry.BackSurfaces.push_back( BackSurfaces( SurfNum, BackSurf, iHour, TS ) );
+				entry.OverlapAreas.push_back( OverlapAreas( SurfNum, BackSurf, iHour, TS ) );
+			}
+		}
+
+	}
+
+	void
+	ReportSunlitFracCacheStatistics()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes how often the sunlit fraction cache was used, and the largest sunlit fraction
+		// difference found by checking it, to the eio file at the end of the run.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::SunlitFracCacheTolerance;
+		using General::RoundSigDigits;
+		using General::TrimSigDigits;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt Format_800( "('! <Sunlit Fraction Cache>, Angular Tolerance {deg}, Sun Positions, Cached Sun Positions Used, Hit Rate {%}, Checked Hits, Maximum Sunlit Fraction Difference, Cache Entries')" );
+		static gio::Fmt Format_801( "(' Sunlit Fraction Cache, ',A,',',A,',',A,',',A,',',A,',',A,',',A)" );
+
+		if ( NumSunlitFracCacheLookups == 0 ) return;
+
+		gio::write( OutputFileInits, Format_800 );
+		gio::write( OutputFileInits, Format_801 ) << RoundSigDigits( SunlitFracCacheTolerance, 3 ) << TrimSigDigits( NumSunlitFracCacheLookups ) << TrimSigDigits( NumSunlitFracCacheHits ) << RoundSigDigits( 100.0 * NumSunlitFracCacheHits / NumSunlitFracCacheLookups, 2 ) << TrimSigDigits( NumSunlitFracCacheChecks ) << RoundSigDigits( MaxSunlitFracCacheDeviation, 5 ) << TrimSigDigits( int( SunlitFracCache.size() ) );
+
+	}
+
 	void
 	SHADOW(
 		int const iHour, // Hour index
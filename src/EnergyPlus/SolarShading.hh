@@ -2,7 +2,10 @@
 #define SolarShading_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <fstream>
+#include <map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
@@ -122,6 +125,16 @@ namespace SolarShading {
 	extern FArray1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
 	extern FArray1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	extern int maxNumberOfFigures;
+	extern int const SunlitFracCacheCheckInterval; // every this many cache hits the shadows are also calculated
+	extern int const MaxSunlitFracCacheValues; // limit of the surface values kept in the sunlit fraction cache
+	extern bool GetSunlitFracCacheSettings; // True until the sunlit fraction cache settings are read
+	extern bool UseSunlitFracCache; // True if the sunlit fraction cache is used
+	extern Real64 SunlitFracCacheAngle; // Angular tolerance of the sunlit fraction cache {rad}
+	extern Real64 SunlitFracCacheCosAngle; // Cosine of the angular tolerance
+	extern int NumSunlitFracCacheLookups; // sun positions looked up in the sunlit fraction cache
+	extern int NumSunlitFracCacheHits; // sun positions found in the sunlit fraction cache
+	extern int NumSunlitFracCacheChecks; // cache hits checked against a shadow calculation
+	extern Real64 MaxSunlitFracCacheDeviation; // largest sunlit fraction difference found by the checks
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
@@ -154,10 +167,29 @@ namespace SolarShading {
 
 	};
 
+	struct SunlitFracCacheEntry
+	{
+		// Members
+		FArray1D< Real64 > SunCos; // Direction cosines of the solar position the shadows were calculated for
+		FArray1D< Real64 > SAREA; // Sunlit area of each surface
+		FArray1D< Real64 > SunlitFracWithoutReveal; // Sunlit fraction of each surface without the window reveal
+		FArray1D_int WindowRevealStatus; // Window reveal status of each surface
+		std::vector< int > BackSurfIndex; // Linear index of the ( surface, back surface ) pairs with an overlap
+		std::vector< int > BackSurfaces; // Back surface number of each pair
+		std::vector< Real64 > OverlapAreas; // Overlap area of each pair
+
+		// Default Constructor
+		SunlitFracCacheEntry()
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< SurfaceErrorTracking > TrackTooManyFigures;
 	extern FArray1D< SurfaceErrorTracking > TrackTooManyVertices;
 	extern FArray1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	extern std::vector< SunlitFracCacheEntry > SunlitFracCache;
+	extern std::map< std::int64_t, int > SunlitFracCacheIndex; // Cache entry of each sun direction cell
 
 	// Functions
 
@@ -317,6 +349,15 @@ namespace SolarShading {
 	void
 	DetermineShadowingCombinations();
 
+	void
+	CachedSHADOW(
+		int const iHour, // Hour index
+		int const TS // Time Step
+	);
+
+	void
+	ReportSunlitFracCacheStatistics();
+
 	void
 	SHADOW(
 		int const iHour, // Hour index
@@ -2706,6 +2706,7 @@ namespace SurfaceGeometry {
 		using InputProcessor::VerifyName;
 		using InputProcessor::SameString;
 		using InputProcessor::GetObjectDefMaxArgs;
+		using InputProcessor::GetObjectDefIndex;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 
@@ -2730,6 +2731,7 @@ namespace SurfaceGeometry {
 		int ZoneNum; // DO loop counter (zones)
 		int Found; // For matching interzone surfaces
 		int Loop;
+		int ObjectDefIndex; // Object definition index for cCurrentModuleObject
 		bool ErrorInName;
 		bool IsBlank;
 		int Item;
@@ -2766,6 +2768,7 @@ namespace SurfaceGeometry {
 			}
 
 			GetObjectDefMaxArgs( cCurrentModuleObject, Loop, SurfaceNumAlpha, SurfaceNumProp );
+			ObjectDefIndex = GetObjectDefIndex( cCurrentModuleObject );
 			if ( Item == 1 ) {
 				if ( SurfaceNumAlpha != 8 ) {
 					ShowSevereError( cCurrentModuleObject + ": Object Definition indicates " "not = 8 Alpha Objects, Number Indicated=" + TrimSigDigits( SurfaceNumAlpha ) );
@@ -2779,7 +2782,7 @@ namespace SurfaceGeometry {
 			}
 
 			for ( Loop = 1; Loop <= ItemsToGet; ++Loop ) {
-				GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+				GetObjectItem( ObjectDefIndex, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 				ErrorInName = false;
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
@@ -3624,6 +3627,7 @@ namespace SurfaceGeometry {
 		using InputProcessor::FindItemInList;
 		using InputProcessor::VerifyName;
 		using InputProcessor::GetObjectDefMaxArgs;
+		using InputProcessor::GetObjectDefIndex;
 		using General::TrimSigDigits;
 		using General::RoundSigDigits;
 
@@ -3648,6 +3652,7 @@ namespace SurfaceGeometry {
 		int SurfaceNumProp; // Number of material properties being passed
 		int Found; // For matching interzone surfaces
 		int Loop;
+		int ObjectDefIndex; // Object definition index for cCurrentModuleObject
 		bool ErrorInName;
 		bool IsBlank;
 		int ValidChk;
@@ -3662,6 +3667,7 @@ namespace SurfaceGeometry {
 
 		cCurrentModuleObject = "FenestrationSurface:Detailed";
 		GetObjectDefMaxArgs( cCurrentModuleObject, Loop, SurfaceNumAlpha, SurfaceNumProp );
+		ObjectDefIndex = GetObjectDefIndex( cCurrentModuleObject );
 
 		if ( SurfaceNumAlpha != 7 ) {
 			ShowSevereError( cCurrentModuleObject + ": Object Definition indicates " "not = 7 Alpha Objects, Number Indicated=" + TrimSigDigits( SurfaceNumAlpha ) );
@@ -3675,7 +3681,7 @@ namespace SurfaceGeometry {
 		NeedToAddSurfaces = 0;
 
 		for ( Loop = 1; Loop <= TotHTSubs; ++Loop ) {
-			GetObjectItem( cCurrentModuleObject, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+			GetObjectItem( ObjectDefIndex, Loop, cAlphaArgs, SurfaceNumAlpha, rNumericArgs, SurfaceNumProp, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 			ErrorInName = false;
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), SurfaceTmp_Name, SurfNum, ErrorInName, IsBlank, cCurrentModuleObject + " Name" );
@@ -253,7 +253,8 @@ namespace TARCOGCommon {
 		FArray1A< Real64 > b,
 		int const n,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//***********************************************************************
@@ -275,10 +276,11 @@ namespace TARCOGCommon {
 		b.dim( n );
 
 		// Locals
-		FArray1D_int indx( n );
+		FArray1D_int & indx( Work.indx );
 		Real64 d;
 
-		ludcmp( a, n, indx, d, nperr, ErrorMessage );
+		indx.dimension( n );
+		ludcmp( a, n, indx, d, nperr, ErrorMessage, Work );
 
 		// Exit on error
 		if ( ( nperr > 0 ) && ( nperr <= 1000 ) ) return;
@@ -294,7 +296,8 @@ namespace TARCOGCommon {
 		FArray1A_int indx,
 		Real64 & d,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 
@@ -313,7 +316,7 @@ namespace TARCOGCommon {
 		Real64 aamax;
 		Real64 dum;
 		Real64 sum;
-		FArray1D< Real64 > vv( NMAX );
+		FArray1D< Real64 > & vv( Work.vv );
 
 		d = 1.0;
 		for ( i = 1; i <= n; ++i ) {
@@ -3,15 +3,264 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
+#include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray2A.hh>
+#include <ObjexxFCL/FArray2D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGGassesParams.hh>
+#include <TARCOGParams.hh>
 
 namespace EnergyPlus {
 
 namespace TARCOGCommon {
 
+	// Types
+
+	struct TARCOGWorkspace // scratch arrays of the TARCOG solve of one glazing system
+	{
+		// Members
+		// TARCOG90
+		FArray1D< Real64 > sconTemp;
+		FArray1D< Real64 > thickTemp;
+		FArray1D< Real64 > told;
+		FArray1D< Real64 > CurGap;
+		FArray1D< Real64 > GapDefMean;
+		// PanesDeflection, DeflectionTemperatures
+		FArray1D< Real64 > DCoeff;
+		FArray1D< Real64 > DPressure; // delta pressure at each glazing layer
+		FArray1D< Real64 > Vini;
+		FArray1D< Real64 > Vgap;
+		FArray1D< Real64 > Pgap;
+		FArray1D< Real64 > Tgap;
+		// Calc_EN673, EN673ISO10292
+		FArray1D< Real64 > rs_EN673;
+		FArray1D< Real64 > dT;
+		FArray1D< Real64 > Gr;
+		FArray1D< Real64 > frctg_EN673;
+		FArray1D_int ipropg_EN673;
+		// Calc_ISO15099
+		FArray1D< Real64 > thetas;
+		FArray1D< Real64 > rir;
+		FArray1D< Real64 > hcgass;
+		FArray1D< Real64 > hrgass;
+		FArray1D< Real64 > qs;
+		FArray1D< Real64 > qvs;
+		FArray1D< Real64 > LaminateAU;
+		FArray1D< Real64 > sumsolU;
+		FArray1D< Real64 > sol0;
+		FArray1D< Real64 > qcgas;
+		FArray1D< Real64 > qcgaps;
+		FArray1D< Real64 > qrgas;
+		FArray1D< Real64 > qrgaps;
+		FArray1D< Real64 > Atop_NOSD;
+		FArray1D< Real64 > Abot_NOSD;
+		FArray1D< Real64 > Al_NOSD;
+		FArray1D< Real64 > Ar_NOSD;
+		FArray1D< Real64 > Ah_NOSD;
+		FArray1D< Real64 > SlatThick_NOSD;
+		FArray1D< Real64 > SlatWidth_NOSD;
+		FArray1D< Real64 > SlatAngle_NOSD;
+		FArray1D< Real64 > SlatCond_NOSD;
+		FArray1D< Real64 > SlatSpacing_NOSD;
+		FArray1D< Real64 > SlatCurve_NOSD;
+		FArray1D< Real64 > vvent_NOSD;
+		FArray1D< Real64 > tvent_NOSD;
+		FArray1D< Real64 > qv_NOSD;
+		FArray1D< Real64 > q_NOSD;
+		FArray1D_int LayerType_NOSD;
+		FArray1D< Real64 > gap_NOSD;
+		FArray1D< Real64 > thick_NOSD;
+		FArray1D< Real64 > scon_NOSD;
+		FArray1D< Real64 > emis_NOSD;
+		FArray1D< Real64 > rir_NOSD;
+		FArray1D< Real64 > tir_NOSD;
+		FArray1D< Real64 > theta_NOSD;
+		FArray2D< Real64 > frct_NOSD;
+		FArray2D_int iprop_NOSD;
+		FArray1D_int nmix_NOSD;
+		FArray1D< Real64 > presure_NOSD;
+		FArray1D< Real64 > hcgas_NOSD;
+		FArray1D< Real64 > hrgas_NOSD;
+		FArray1D< Real64 > LaminateA_NOSD;
+		FArray1D< Real64 > LaminateB_NOSD;
+		FArray1D< Real64 > sumsol_NOSD;
+		FArray1D< Real64 > Ra_NOSD;
+		FArray1D< Real64 > Nu_NOSD;
+		FArray1D< Real64 > Ebb;
+		FArray1D< Real64 > Ebf;
+		FArray1D< Real64 > Rb;
+		FArray1D< Real64 > Rf;
+		FArray1D< Real64 > Ebbs;
+		FArray1D< Real64 > Ebfs;
+		FArray1D< Real64 > Rbs;
+		FArray1D< Real64 > Rfs;
+		FArray1D< Real64 > Ebb_NOSD;
+		FArray1D< Real64 > Ebf_NOSD;
+		FArray1D< Real64 > Rb_NOSD;
+		FArray1D< Real64 > Rf_NOSD;
+		FArray1D< Real64 > ShadeGapKeffConv_NOSD;
+		FArray1D< Real64 > qcgas_NOSD;
+		FArray1D< Real64 > Keff_NOSD;
+		FArray1D< Real64 > qrgas_NOSD;
+		FArray1D_int nslice_NOSD;
+		FArray1D< Real64 > vfreevent_NOSD;
+		FArray1D< Real64 > vfreevent;
+		// therm1d: the system matrix and the iteration vectors are dimensioned by the number of layers
+		FArray2D< Real64 > a;
+		FArray1D< Real64 > b;
+		FArray1D< Real64 > hgas;
+		FArray1D< Real64 > Tgap_therm1d;
+		FArray1D< Real64 > told_therm1d;
+		FArray1D< Real64 > FRes; // function results from current iteration
+		FArray1D< Real64 > FResOld; // function results from previous iteration
+		FArray1D< Real64 > FResDiff; // difference in results between iterations
+		FArray1D< Real64 > Radiation; // radiation on layer surfaces
+		FArray1D< Real64 > x; // theta and Radiation
+		FArray1D< Real64 > dX; // difference in results
+		FArray2D< Real64 > Jacobian; // jacobian of the newton method
+		FArray1D< Real64 > DRes; // jacobian forward-difference approximation
+		FArray2D< Real64 > LeftHandSide; // matrix before the equation solver
+		FArray1D< Real64 > RightHandSide;
+		FArray1D< Real64 > RadiationSave;
+		FArray1D< Real64 > thetaSave;
+		FArray1D_int LayerTypeSpec;
+		// filmi, filmg
+		FArray1D< Real64 > frcti;
+		FArray1D_int ipropi;
+		FArray1D< Real64 > frctg;
+		FArray1D_int ipropg;
+		// shading
+		FArray1D< Real64 > frct1;
+		FArray1D< Real64 > frct2;
+		FArray1D_int iprop1;
+		FArray1D_int iprop2;
+		// GASSES90
+		FArray1D< Real64 > fvis;
+		FArray1D< Real64 > fcon;
+		FArray1D< Real64 > fdens;
+		FArray1D< Real64 > fcp;
+		FArray1D< Real64 > kprime;
+		FArray1D< Real64 > kdblprm;
+		FArray1D< Real64 > mukpdwn;
+		FArray1D< Real64 > kpdown;
+		FArray1D< Real64 > kdpdown;
+		FArray2D< Real64 > grho;
+		// EquationsSolver, ludcmp
+		FArray1D_int indx;
+		FArray1D< Real64 > vv;
+
+		// Default Constructor
+		TARCOGWorkspace() :
+			sconTemp( TARCOGParams::maxlay ),
+			thickTemp( TARCOGParams::maxlay ),
+			told( TARCOGParams::maxlay2 ),
+			CurGap( TARCOGParams::MaxGap ),
+			GapDefMean( TARCOGParams::MaxGap ),
+			DCoeff( TARCOGParams::maxlay ),
+			DPressure( TARCOGParams::maxlay ),
+			Vini( TARCOGParams::MaxGap ),
+			Vgap( TARCOGParams::MaxGap ),
+			Pgap( TARCOGParams::MaxGap ),
+			Tgap( TARCOGParams::MaxGap ),
+			rs_EN673( TARCOGParams::maxlay3 ),
+			dT( TARCOGParams::maxlay1 ),
+			Gr( TARCOGParams::maxlay ),
+			frctg_EN673( TARCOGGassesParams::maxgas ),
+			ipropg_EN673( TARCOGGassesParams::maxgas ),
+			thetas( TARCOGParams::maxlay2 ),
+			rir( TARCOGParams::maxlay2 ),
+			hcgass( TARCOGParams::maxlay1 ),
+			hrgass( TARCOGParams::maxlay1 ),
+			qs( TARCOGParams::maxlay3 ),
+			qvs( TARCOGParams::maxlay1 ),
+			LaminateAU( TARCOGParams::maxlay ),
+			sumsolU( TARCOGParams::maxlay ),
+			sol0( TARCOGParams::maxlay ),
+			qcgas( TARCOGParams::maxlay1 ),
+			qcgaps( TARCOGParams::maxlay1 ),
+			qrgas( TARCOGParams::maxlay1 ),
+			qrgaps( TARCOGParams::maxlay1 ),
+			Atop_NOSD( TARCOGParams::maxlay ),
+			Abot_NOSD( TARCOGParams::maxlay ),
+			Al_NOSD( TARCOGParams::maxlay ),
+			Ar_NOSD( TARCOGParams::maxlay ),
+			Ah_NOSD( TARCOGParams::maxlay ),
+			SlatThick_NOSD( TARCOGParams::maxlay ),
+			SlatWidth_NOSD( TARCOGParams::maxlay ),
+			SlatAngle_NOSD( TARCOGParams::maxlay ),
+			SlatCond_NOSD( TARCOGParams::maxlay ),
+			SlatSpacing_NOSD( TARCOGParams::maxlay ),
+			SlatCurve_NOSD( TARCOGParams::maxlay ),
+			vvent_NOSD( TARCOGParams::maxlay1 ),
+			tvent_NOSD( TARCOGParams::maxlay1 ),
+			qv_NOSD( TARCOGParams::maxlay1 ),
+			q_NOSD( TARCOGParams::maxlay3 ),
+			LayerType_NOSD( TARCOGParams::maxlay ),
+			gap_NOSD( TARCOGParams::maxlay ),
+			thick_NOSD( TARCOGParams::maxlay ),
+			scon_NOSD( TARCOGParams::maxlay ),
+			emis_NOSD( TARCOGParams::maxlay2 ),
+			rir_NOSD( TARCOGParams::maxlay2 ),
+			tir_NOSD( TARCOGParams::maxlay2 ),
+			theta_NOSD( TARCOGParams::maxlay2 ),
+			frct_NOSD( TARCOGParams::maxlay1, TARCOGGassesParams::maxgas ),
+			iprop_NOSD( TARCOGParams::maxlay1, TARCOGGassesParams::maxgas ),
+			nmix_NOSD( TARCOGParams::maxlay1 ),
+			presure_NOSD( TARCOGParams::maxlay1 ),
+			hcgas_NOSD( TARCOGParams::maxlay1 ),
+			hrgas_NOSD( TARCOGParams::maxlay1 ),
+			LaminateA_NOSD( TARCOGParams::maxlay ),
+			LaminateB_NOSD( TARCOGParams::maxlay ),
+			sumsol_NOSD( TARCOGParams::maxlay ),
+			Ra_NOSD( TARCOGParams::maxlay ),
+			Nu_NOSD( TARCOGParams::maxlay ),
+			Ebb( TARCOGParams::maxlay ),
+			Ebf( TARCOGParams::maxlay ),
+			Rb( TARCOGParams::maxlay ),
+			Rf( TARCOGParams::maxlay ),
+			Ebbs( TARCOGParams::maxlay ),
+			Ebfs( TARCOGParams::maxlay ),
+			Rbs( TARCOGParams::maxlay ),
+			Rfs( TARCOGParams::maxlay ),
+			Ebb_NOSD( TARCOGParams::maxlay ),
+			Ebf_NOSD( TARCOGParams::maxlay ),
+			Rb_NOSD( TARCOGParams::maxlay ),
+			Rf_NOSD( TARCOGParams::maxlay ),
+			ShadeGapKeffConv_NOSD( TARCOGParams::MaxGap ),
+			qcgas_NOSD( TARCOGParams::maxlay1 ),
+			Keff_NOSD( TARCOGParams::maxlay1 ),
+			qrgas_NOSD( TARCOGParams::maxlay1 ),
+			nslice_NOSD( TARCOGParams::maxlay ),
+			vfreevent_NOSD( TARCOGParams::maxlay1 ),
+			vfreevent( TARCOGParams::maxlay1 ),
+			hgas( TARCOGParams::maxlay1 ),
+			Tgap_therm1d( TARCOGParams::maxlay1 ),
+			LayerTypeSpec( TARCOGParams::maxlay ),
+			frcti( TARCOGGassesParams::maxgas ),
+			ipropi( TARCOGGassesParams::maxgas ),
+			frctg( TARCOGGassesParams::maxgas ),
+			ipropg( TARCOGGassesParams::maxgas ),
+			frct1( TARCOGGassesParams::maxgas ),
+			frct2( TARCOGGassesParams::maxgas ),
+			iprop1( TARCOGGassesParams::maxgas ),
+			iprop2( TARCOGGassesParams::maxgas ),
+			fvis( TARCOGGassesParams::maxgas ),
+			fcon( TARCOGGassesParams::maxgas ),
+			fdens( TARCOGGassesParams::maxgas ),
+			fcp( TARCOGGassesParams::maxgas ),
+			kprime( TARCOGGassesParams::maxgas ),
+			kdblprm( TARCOGGassesParams::maxgas ),
+			mukpdwn( TARCOGGassesParams::maxgas ),
+			kpdown( TARCOGGassesParams::maxgas ),
+			kdpdown( TARCOGGassesParams::maxgas ),
+			grho( TARCOGGassesParams::maxgas, 3 ),
+			vv( TARCOGParams::maxlay4 )
+		{}
+
+	};
+
 	// Functions
 
 	bool
@@ -57,7 +306,8 @@ namespace TARCOGCommon {
 		FArray1A< Real64 > b,
 		int const n,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -67,7 +317,8 @@ namespace TARCOGCommon {
 		FArray1A_int indx,
 		Real64 & d,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -62,7 +62,8 @@ namespace TARCOGDeflection {
 		FArray1A< Real64 > const PoissonsRat,
 		FArray1A< Real64 > LayerDeflection,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//***********************************************************************
@@ -86,7 +87,7 @@ namespace TARCOGDeflection {
 		//OUTPUT
 
 		//Localy used
-		FArray1D< Real64 > DCoeff( maxlay );
+		FArray1D< Real64 > & DCoeff( Work.DCoeff );
 		int i;
 
 		i = 0;
@@ -99,7 +100,7 @@ namespace TARCOGDeflection {
 		if ( SELECT_CASE_var == NO_DEFLECTION_CALCULATION ) {
 			return;
 		} else if ( SELECT_CASE_var == DEFLECTION_CALC_TEMPERATURE ) {
-			DeflectionTemperatures( nlayer, W, H, Pa, Pini, Tini, NonDeflectedGapWidth, DeflectedGapWidthMax, DeflectedGapWidthMean, PanelTemps, DCoeff, LayerDeflection, nperr, ErrorMessage );
+			DeflectionTemperatures( nlayer, W, H, Pa, Pini, Tini, NonDeflectedGapWidth, DeflectedGapWidthMax, DeflectedGapWidthMean, PanelTemps, DCoeff, LayerDeflection, nperr, ErrorMessage, Work );
 		} else if ( SELECT_CASE_var == DEFLECTION_CALC_GAP_WIDTHS ) {
 			DeflectionWidths( nlayer, W, H, DCoeff, NonDeflectedGapWidth, DeflectedGapWidthMax, DeflectedGapWidthMean, LayerDeflection );
 		} else {
@@ -123,7 +124,8 @@ namespace TARCOGDeflection {
 		FArray1A< Real64 > DCoeff,
 		FArray1A< Real64 > LayerDeflection,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//***********************************************************************************************************
@@ -147,11 +149,11 @@ namespace TARCOGDeflection {
 		static Real64 const Pi_6( pow_6( Pi ) );
 
 		//localy used
-		FArray1D< Real64 > DPressure( maxlay ); // delta pressure at each glazing layer
-		FArray1D< Real64 > Vini( MaxGap );
-		FArray1D< Real64 > Vgap( MaxGap );
-		FArray1D< Real64 > Pgap( MaxGap );
-		FArray1D< Real64 > Tgap( MaxGap );
+		FArray1D< Real64 > & DPressure( Work.DPressure ); // delta pressure at each glazing layer
+		FArray1D< Real64 > & Vini( Work.Vini );
+		FArray1D< Real64 > & Vgap( Work.Vgap );
+		FArray1D< Real64 > & Pgap( Work.Pgap );
+		FArray1D< Real64 > & Tgap( Work.Tgap );
 		Real64 MaxLDSum;
 		Real64 MeanLDSum;
 		Real64 Ratio;
@@ -6,6 +6,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGCommon.hh>
 
 namespace EnergyPlus {
 
@@ -31,7 +32,8 @@ namespace TARCOGDeflection {
 		FArray1A< Real64 > const PoissonsRat,
 		FArray1A< Real64 > LayerDeflection,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -49,7 +51,8 @@ namespace TARCOGDeflection {
 		FArray1A< Real64 > DCoeff,
 		FArray1A< Real64 > LayerDeflection,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -68,7 +68,8 @@ namespace TARCOGGasses90 {
 		Real64 & pr,
 		int const standard,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 
@@ -89,15 +90,15 @@ namespace TARCOGGasses90 {
 		int i;
 		int j;
 
-		FArray1D< Real64 > fvis( maxgas );
-		FArray1D< Real64 > fcon( maxgas );
-		FArray1D< Real64 > fdens( maxgas );
-		FArray1D< Real64 > fcp( maxgas );
-		FArray1D< Real64 > kprime( maxgas );
-		FArray1D< Real64 > kdblprm( maxgas );
-		FArray1D< Real64 > mukpdwn( maxgas );
-		FArray1D< Real64 > kpdown( maxgas );
-		FArray1D< Real64 > kdpdown( maxgas );
+		FArray1D< Real64 > & fvis( Work.fvis );
+		FArray1D< Real64 > & fcon( Work.fcon );
+		FArray1D< Real64 > & fdens( Work.fdens );
+		FArray1D< Real64 > & fcp( Work.fcp );
+		FArray1D< Real64 > & kprime( Work.kprime );
+		FArray1D< Real64 > & kdblprm( Work.kdblprm );
+		FArray1D< Real64 > & mukpdwn( Work.mukpdwn );
+		FArray1D< Real64 > & kpdown( Work.kpdown );
+		FArray1D< Real64 > & kdpdown( Work.kdpdown );
 		Real64 molmix;
 		Real64 cpmixm;
 		Real64 kpmix;
@@ -113,7 +114,7 @@ namespace TARCOGGasses90 {
 
 		//Simon: TODO: this is used for EN673 calculations and it is not assigned properly. Check this
 		//REAL(r64), dimension(maxgas, 3) :: xgrho //Autodesk:Unused
-		FArray2D< Real64 > grho( maxgas, 3 );
+		FArray2D< Real64 > & grho( Work.grho );
 
 		//REAL(r64) gaslaw
 		//DATA gaslaw /8314.51d0/   ! Molar gas constant in Joules/(kmol*K)
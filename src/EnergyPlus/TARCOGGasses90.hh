@@ -7,6 +7,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGCommon.hh>
 
 namespace EnergyPlus {
 
@@ -35,7 +36,8 @@ namespace TARCOGGasses90 {
 		Real64 & pr,
 		int const standard,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
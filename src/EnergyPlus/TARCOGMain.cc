@@ -417,7 +417,8 @@ namespace TARCOGMain {
 		FArray1A< Real64 > ShadeGapKeffConv, // Vector of convective keff values for areas above/below
 		Real64 const SDScalar, // Factor of Venetian SD layer contribution to convection
 		int const SHGCCalc, // SHGC calculation switch:
-		int & NumOfIterations // Number of iterations for reacing solution
+		int & NumOfIterations, // Number of iterations for reacing solution
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 
@@ -586,16 +587,16 @@ namespace TARCOGMain {
 		Real64 trminTemp;
 		Real64 hinTemp;
 		Real64 houtTemp;
-		FArray1D< Real64 > sconTemp( maxlay );
-		FArray1D< Real64 > thickTemp( maxlay );
+		FArray1D< Real64 > & sconTemp( Work.sconTemp );
+		FArray1D< Real64 > & thickTemp( Work.thickTemp );
 
 		//REAL(r64), dimension(maxlay) ::  sol ! Vector of Absorbed solar energy for each layer [W/m2] = dir*asol
 
 		//Internaly used
 		static bool converged( false ); // used for convergence check in case of deflection calculations
-		FArray1D< Real64 > told( maxlay2 );
-		FArray1D< Real64 > CurGap( MaxGap );
-		FArray1D< Real64 > GapDefMean( MaxGap );
+		FArray1D< Real64 > & told( Work.told );
+		FArray1D< Real64 > & CurGap( Work.CurGap );
+		FArray1D< Real64 > & GapDefMean( Work.GapDefMean );
 		Real64 dtmax;
 		int i;
 		int counter;
@@ -639,7 +640,7 @@ namespace TARCOGMain {
 		// deflections in this case do not depend of temperatures and it should be calculated before to avoid
 		// one extra call of temperatures calculations
 		if ( CalcDeflection == DEFLECTION_CALC_GAP_WIDTHS ) {
-			PanesDeflection( CalcDeflection, width, height, nlayer, Pa, Pini, Tini, thick, gap, GapDefMax, GapDefMean, theta, YoungsMod, PoissonsRat, LayerDef, nperr, ErrorMessage );
+			PanesDeflection( CalcDeflection, width, height, nlayer, Pa, Pini, Tini, thick, gap, GapDefMax, GapDefMean, theta, YoungsMod, PoissonsRat, LayerDef, nperr, ErrorMessage, Work );
 			for ( i = 1; i <= nlayer - 1; ++i ) {
 				CurGap( i ) = GapDefMean( i );
 			} //do i = 1, nlayer - 1
@@ -661,9 +662,9 @@ namespace TARCOGMain {
 
 			{ auto const SELECT_CASE_var( standard );
 			if ( SELECT_CASE_var == ISO15099 ) {
-				Calc_ISO15099( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CurGap, thick, scon, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, xgcon, xgvis, xgcp, xwght, gama, nmix, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgas, hrgas, shgc, nperr, ErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, Ra, Nu, ThermalMod, Debug_mode, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, SHGCCalc, NumOfIterations );
+				Calc_ISO15099( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CurGap, thick, scon, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, xgcon, xgvis, xgcp, xwght, gama, nmix, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgas, hrgas, shgc, nperr, ErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, Ra, Nu, ThermalMod, Debug_mode, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, SHGCCalc, NumOfIterations, Work );
 			} else if ( ( SELECT_CASE_var == EN673 ) || ( SELECT_CASE_var == EN673Design ) ) {
-				Calc_EN673( standard, nlayer, tout, tind, CurGap, thick, scon, emis, totsol, tilt, dir, asol, presure, iprop, frct, nmix, xgcon, xgvis, xgcp, xwght, theta, ufactor, hcin, hin, hout, shgc, nperr, ErrorMessage, ibc, hg, hr, hs, Ra, Nu );
+				Calc_EN673( standard, nlayer, tout, tind, CurGap, thick, scon, emis, totsol, tilt, dir, asol, presure, iprop, frct, nmix, xgcon, xgvis, xgcp, xwght, theta, ufactor, hcin, hin, hout, shgc, nperr, ErrorMessage, ibc, hg, hr, hs, Ra, Nu, Work );
 			} else {
 			}}
 
@@ -678,7 +679,7 @@ namespace TARCOGMain {
 			if ( CalcDeflection == DEFLECTION_CALC_TEMPERATURE ) {
 				converged = false;
 				while ( ! ( converged ) ) {
-					PanesDeflection( CalcDeflection, width, height, nlayer, Pa, Pini, Tini, thick, gap, GapDefMax, GapDefMean, theta, YoungsMod, PoissonsRat, LayerDef, nperr, ErrorMessage );
+					PanesDeflection( CalcDeflection, width, height, nlayer, Pa, Pini, Tini, thick, gap, GapDefMax, GapDefMean, theta, YoungsMod, PoissonsRat, LayerDef, nperr, ErrorMessage, Work );
 
 					if ( ! ( GoAhead( nperr ) ) ) {
 						return;
@@ -700,9 +701,9 @@ namespace TARCOGMain {
 					//after performed deflection recalculate temperatures with new gap widths
 					{ auto const SELECT_CASE_var( standard );
 					if ( SELECT_CASE_var == ISO15099 ) {
-						Calc_ISO15099( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, GapDefMean, thick, scon, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, xgcon, xgvis, xgcp, xwght, gama, nmix, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgas, hrgas, shgc, nperr, ErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, Ra, Nu, ThermalMod, Debug_mode, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, SHGCCalc, NumOfIterations );
+						Calc_ISO15099( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, GapDefMean, thick, scon, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, xgcon, xgvis, xgcp, xwght, gama, nmix, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgas, hrgas, shgc, nperr, ErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, Ra, Nu, ThermalMod, Debug_mode, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, SHGCCalc, NumOfIterations, Work );
 					} else if ( ( SELECT_CASE_var == EN673 ) || ( SELECT_CASE_var == EN673Design ) ) {
-						Calc_EN673( standard, nlayer, tout, tind, GapDefMean, thick, scon, emis, totsol, tilt, dir, asol, presure, iprop, frct, nmix, xgcon, xgvis, xgcp, xwght, theta, ufactor, hcin, hin, hout, shgc, nperr, ErrorMessage, ibc, hg, hr, hs, Ra, Nu );
+						Calc_EN673( standard, nlayer, tout, tind, GapDefMean, thick, scon, emis, totsol, tilt, dir, asol, presure, iprop, frct, nmix, xgcon, xgvis, xgcp, xwght, theta, ufactor, hcin, hin, hout, shgc, nperr, ErrorMessage, ibc, hg, hr, hs, Ra, Nu, Work );
 					} else {
 					}} //select case (standard)
 
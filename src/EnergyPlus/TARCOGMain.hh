@@ -7,6 +7,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGCommon.hh>
 
 namespace EnergyPlus {
 
@@ -125,7 +126,8 @@ namespace TARCOGMain {
 		FArray1A< Real64 > ShadeGapKeffConv, // Vector of convective keff values for areas above/below
 		Real64 const SDScalar, // Factor of Venetian SD layer contribution to convection
 		int const SHGCCalc, // SHGC calculation switch:
-		int & NumOfIterations // Number of iterations for reacing solution
+		int & NumOfIterations, // Number of iterations for reacing solution
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	//     NOTICE
@@ -80,7 +80,8 @@ namespace TarcogShading {
 		FArray1A< Real64 > qv,
 		int & nperr,
 		std::string & ErrorMessage,
-		FArray1A< Real64 > vfreevent
+		FArray1A< Real64 > vfreevent,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//**************************************************************************************************************
@@ -163,8 +164,8 @@ namespace TarcogShading {
 		Real64 hc;
 		Real64 hc1;
 		Real64 hc2;
-		FArray1D< Real64 > frct1( maxgas );
-		FArray1D< Real64 > frct2( maxgas );
+		FArray1D< Real64 > & frct1( Work.frct1 );
+		FArray1D< Real64 > & frct2( Work.frct2 );
 		Real64 speed;
 		Real64 Tav;
 		Real64 Tgap;
@@ -185,8 +186,8 @@ namespace TarcogShading {
 		int k;
 		int nmix1;
 		int nmix2;
-		FArray1D_int iprop1( maxgas );
-		FArray1D_int iprop2( maxgas );
+		FArray1D_int & iprop1( Work.iprop1 );
+		FArray1D_int & iprop2( Work.iprop2 );
 
 		// init vectors:
 		qv = 0.0;
@@ -227,7 +228,7 @@ namespace TarcogShading {
 					Tgap = Tgaps( 2 );
 
 					//bi......use Tout as temp of the air at inlet
-					shadingedge( iprop1, frct1, press1, nmix1, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( 2 ), hc, Tout, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed );
+					shadingedge( iprop1, frct1, press1, nmix1, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( 2 ), hc, Tout, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed, Work );
 
 					// exit on error
 					if ( ( nperr > 0 ) && ( nperr < 1000 ) ) return;
@@ -258,7 +259,7 @@ namespace TarcogShading {
 					Tgap = Tgaps( nlayer );
 
 					//bi.........use Tin as temp of the air at inlet
-					shadingedge( iprop2, frct2, press2, nmix2, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( nlayer ), hc, Tin, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed );
+					shadingedge( iprop2, frct2, press2, nmix2, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( nlayer ), hc, Tin, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed, Work );
 
 					// exit on error
 					if ( ( nperr > 0 ) && ( nperr < 1000 ) ) return;
@@ -289,10 +290,10 @@ namespace TarcogShading {
 					//speed2 = vvent(i+1)
 
 					if ( ( CalcForcedVentilation != 0 ) && ( ( vvent( i ) != 0 ) || ( vvent( i + 1 ) != 0 ) ) ) {
-						forcedventilation( iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, s1, height, hc1, vvent( i ), tvent( i ), Temp, Tav1, hcv1, qv1, nperr, ErrorMessage );
-						forcedventilation( iprop2, frct2, press2, nmix1, xwght, xgcon, xgvis, xgcp, s2, height, hc1, vvent( i + 1 ), tvent( i + 1 ), Temp, Tav2, hcv2, qv2, nperr, ErrorMessage );
+						forcedventilation( iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, s1, height, hc1, vvent( i ), tvent( i ), Temp, Tav1, hcv1, qv1, nperr, ErrorMessage, Work );
+						forcedventilation( iprop2, frct2, press2, nmix1, xwght, xgcon, xgvis, xgcp, s2, height, hc1, vvent( i + 1 ), tvent( i + 1 ), Temp, Tav2, hcv2, qv2, nperr, ErrorMessage, Work );
 					} else {
-						shadingin( iprop1, frct1, press1, nmix1, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s1, s2, height, width, angle, hc1, hc2, speed1, speed2, Tgap1, Tgap2, Tav1, Tav2, hcv1, hcv2, qv1, qv2, nperr, ErrorMessage );
+						shadingin( iprop1, frct1, press1, nmix1, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s1, s2, height, width, angle, hc1, hc2, speed1, speed2, Tgap1, Tgap2, Tav1, Tav2, hcv1, hcv2, qv1, qv2, nperr, ErrorMessage, Work );
 					}
 
 					// exit on error
@@ -341,7 +342,8 @@ namespace TarcogShading {
 		Real64 & hcv,
 		Real64 & qv,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//**************************************************************************************************************
@@ -379,7 +381,7 @@ namespace TarcogShading {
 		Real64 con;
 		Real64 visc;
 
-		GASSES90( Tav, iprop, frct, press, nmix, xwght, xgcon, xgvis, xgcp, con, visc, dens, cp, pr, 1, nperr, ErrorMessage );
+		GASSES90( Tav, iprop, frct, press, nmix, xwght, xgcon, xgvis, xgcp, con, visc, dens, cp, pr, 1, nperr, ErrorMessage, Work );
 
 		H0 = ( dens * cp * s * forcedspeed ) / ( 4.0 * hc + 8.0 * forcedspeed );
 
@@ -430,7 +432,8 @@ namespace TarcogShading {
 		Real64 & qv1,
 		Real64 & qv2,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//**************************************************************************************************************
@@ -543,7 +546,7 @@ namespace TarcogShading {
 		P1 = 0.0;
 		P2 = 0.0;
 
-		GASSES90( T0, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, con0, visc0, dens0, cp0, pr0, 1, nperr, ErrorMessage );
+		GASSES90( T0, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, con0, visc0, dens0, cp0, pr0, 1, nperr, ErrorMessage, Work );
 
 		// exit on error:
 		if ( ( nperr > 0 ) && ( nperr < 1000 ) ) return;
@@ -569,8 +572,8 @@ namespace TarcogShading {
 		Real64 const s1_s2_2( pow_2( s1 / s2 ) );
 		while ( ! converged ) {
 			++iter;
-			GASSES90( Tgap1, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, con1, visc1, dens1, cp1, pr1, 1, nperr, ErrorMessage );
-			GASSES90( Tgap2, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, con2, visc2, dens2, cp2, pr2, 1, nperr, ErrorMessage );
+			GASSES90( Tgap1, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, con1, visc1, dens1, cp1, pr1, 1, nperr, ErrorMessage, Work );
+			GASSES90( Tgap2, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, con2, visc2, dens2, cp2, pr2, 1, nperr, ErrorMessage, Work );
 
 			//  A = dens0 * T0 * GravityConstant * ABS(cos(tilt)) * ABS(Tgap1 - Tgap2) / (Tgap1 * Tgap2)
 
@@ -729,7 +732,8 @@ namespace TarcogShading {
 		Real64 & qv,
 		int & nperr,
 		std::string & ErrorMessage,
-		Real64 & speed
+		Real64 & speed,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//**************************************************************************************************************
@@ -815,7 +819,7 @@ namespace TarcogShading {
 		tilt = Pi / 180.0 * ( angle - 90.0 );
 		T0 = 0.0 + KelvinConv;
 
-		GASSES90( T0, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, con0, visc0, dens0, cp0, pr0, 1, nperr, ErrorMessage );
+		GASSES90( T0, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, con0, visc0, dens0, cp0, pr0, 1, nperr, ErrorMessage, Work );
 		//call gasses90(Tenv, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, con1, visc1, dens1, cp1, pr1, 1, &
 		//                nperr, ErrorMessage)
 
@@ -844,7 +848,7 @@ namespace TarcogShading {
 		Real64 const s_2( pow_2( s ) );
 		while ( ! converged ) {
 			++iter;
-			GASSES90( Tgap, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, con2, visc2, dens2, cp2, pr2, 1, nperr, ErrorMessage );
+			GASSES90( Tgap, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, con2, visc2, dens2, cp2, pr2, 1, nperr, ErrorMessage, Work );
 
 			if ( ( nperr > 0 ) && ( nperr < 1000 ) ) return;
 
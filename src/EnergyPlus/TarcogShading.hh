@@ -7,6 +7,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGCommon.hh>
 
 namespace EnergyPlus {
 
@@ -47,7 +48,8 @@ namespace TarcogShading {
 		FArray1A< Real64 > qv,
 		int & nperr,
 		std::string & ErrorMessage,
-		FArray1A< Real64 > vfreevent
+		FArray1A< Real64 > vfreevent,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -70,7 +72,8 @@ namespace TarcogShading {
 		Real64 & hcv,
 		Real64 & qv,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -110,7 +113,8 @@ namespace TarcogShading {
 		Real64 & qv1,
 		Real64 & qv2,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -145,7 +149,8 @@ namespace TarcogShading {
 		Real64 & qv,
 		int & nperr,
 		std::string & ErrorMessage,
-		Real64 & speed
+		Real64 & speed,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	//     NOTICE
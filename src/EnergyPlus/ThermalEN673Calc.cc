@@ -81,7 +81,8 @@ namespace ThermalEN673Calc {
 		FArray1A< Real64 > hr,
 		FArray1A< Real64 > hs,
 		FArray1A< Real64 > Ra,
-		FArray1A< Real64 > Nu
+		FArray1A< Real64 > Nu,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 
@@ -133,7 +134,7 @@ namespace ThermalEN673Calc {
 
 		/// Gaps:
 
-		FArray1D< Real64 > rs( maxlay3 );
+		FArray1D< Real64 > & rs( Work.rs_EN673 );
 		Real64 rtot;
 		Real64 sft;
 
@@ -141,7 +142,7 @@ namespace ThermalEN673Calc {
 		rtot = 0.0;
 		sft = 0.0;
 		if ( GoAhead( nperr ) ) {
-			EN673ISO10292( nlayer, tout, tind, emis, gap, thick, scon, tilt, iprop, frct, xgcon, xgvis, xgcp, xwght, presure, nmix, theta, standard, hg, hr, hs, hin, hout, hcin, ibc, rs, ufactor, Ra, Nu, nperr, ErrorMessage );
+			EN673ISO10292( nlayer, tout, tind, emis, gap, thick, scon, tilt, iprop, frct, xgcon, xgvis, xgcp, xwght, presure, nmix, theta, standard, hg, hr, hs, hin, hout, hcin, ibc, rs, ufactor, Ra, Nu, nperr, ErrorMessage, Work );
 
 			if ( GoAhead( nperr ) ) {
 				rtot = 1.0 / ufactor;
@@ -187,7 +188,8 @@ namespace ThermalEN673Calc {
 		FArray1A< Real64 > Ra,
 		FArray1A< Real64 > Nu,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		// Using
@@ -221,7 +223,7 @@ namespace ThermalEN673Calc {
 		Real64 Tm;
 		Real64 diff;
 		Real64 Rg;
-		FArray1D< Real64 > dT( maxlay1 );
+		FArray1D< Real64 > & dT( Work.dT );
 		int i;
 		int j;
 		int iter;
@@ -230,7 +232,7 @@ namespace ThermalEN673Calc {
 		Real64 con;
 		Real64 cp;
 		Real64 pr;
-		FArray1D< Real64 > Gr( maxlay );
+		FArray1D< Real64 > & Gr( Work.Gr );
 		Real64 A;
 		Real64 n;
 		Real64 hrin;
@@ -239,8 +241,8 @@ namespace ThermalEN673Calc {
 
 		Real64 const eps( 1.0e-4 ); // set iteration accuracy
 
-		FArray1D< Real64 > frctg( maxgas );
-		FArray1D_int ipropg( maxgas );
+		FArray1D< Real64 > & frctg( Work.frctg_EN673 );
+		FArray1D_int & ipropg( Work.ipropg_EN673 );
 
 		//jel..hrin is 4.4 for standard clear glass:
 		if ( ( emis( 2 * nlayer ) < 0.85 ) && ( emis( 2 * nlayer ) > 0.83 ) ) {
@@ -323,7 +325,7 @@ namespace ThermalEN673Calc {
 						ipropg( j ) = iprop( i + 1, j );
 						frctg( j ) = frct( i + 1, j );
 					}
-					GASSES90( Tm, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), xwght, xgcon, xgvis, xgcp, con, visc, dens, cp, pr, standard, nperr, ErrorMessage );
+					GASSES90( Tm, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), xwght, xgcon, xgvis, xgcp, con, visc, dens, cp, pr, standard, nperr, ErrorMessage, Work );
 					Gr( i ) = ( GravityConstant * pow_3( gap( i ) ) * dT( i ) * pow_2( dens ) ) / ( Tm * pow_2( visc ) );
 					Ra( i ) = Gr( i ) * pr;
 					Nu( i ) = A * std::pow( Ra( i ), n );
@@ -375,7 +377,7 @@ namespace ThermalEN673Calc {
 								ipropg( j ) = iprop( i + 1, j );
 								frctg( j ) = frct( i + 1, j );
 							} // j, gas mix
-							GASSES90( Tm, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), xwght, xgcon, xgvis, xgcp, con, visc, dens, cp, pr, standard, nperr, ErrorMessage );
+							GASSES90( Tm, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), xwght, xgcon, xgvis, xgcp, con, visc, dens, cp, pr, standard, nperr, ErrorMessage, Work );
 							Gr( i ) = ( GravityConstant * pow_3( gap( i ) ) * dT( i ) * pow_2( dens ) ) / ( Tm * pow_2( visc ) );
 							Ra( i ) = Gr( i ) * pr;
 							Nu( i ) = A * std::pow( Ra( i ), n );
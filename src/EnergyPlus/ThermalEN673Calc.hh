@@ -7,6 +7,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGCommon.hh>
 
 namespace EnergyPlus {
 
@@ -49,7 +50,8 @@ namespace ThermalEN673Calc {
 		FArray1A< Real64 > hr,
 		FArray1A< Real64 > hs,
 		FArray1A< Real64 > Ra,
-		FArray1A< Real64 > Nu
+		FArray1A< Real64 > Nu,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -84,7 +86,8 @@ namespace ThermalEN673Calc {
 		FArray1A< Real64 > Ra,
 		FArray1A< Real64 > Nu,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
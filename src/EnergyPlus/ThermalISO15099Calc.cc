@@ -233,7 +233,8 @@ namespace ThermalISO15099Calc {
 		FArray1A< Real64 > ShadeGapKeffConv,
 		Real64 const SDScalar,
 		int const SHGCCalc, // SHGC calculation switch:
-		int & NumOfIterations
+		int & NumOfIterations,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 
@@ -325,18 +326,18 @@ namespace ThermalISO15099Calc {
 
 		// Variables
 
-		FArray1D< Real64 > thetas( maxlay2 );
-		FArray1D< Real64 > rir( maxlay2 );
-		FArray1D< Real64 > hcgass( maxlay1 );
-		FArray1D< Real64 > hrgass( maxlay1 );
+		FArray1D< Real64 > & thetas( Work.thetas );
+		FArray1D< Real64 > & rir( Work.rir );
+		FArray1D< Real64 > & hcgass( Work.hcgass );
+		FArray1D< Real64 > & hrgass( Work.hrgass );
 		static FArray1D< Real64 > rs( maxlay3, 0.0 );
 
 		//  REAL(r64) :: grho(maxgas,3)
-		FArray1D< Real64 > qs( maxlay3 );
-		FArray1D< Real64 > qvs( maxlay1 );
-		FArray1D< Real64 > LaminateAU( maxlay );
-		FArray1D< Real64 > sumsolU( maxlay );
-		FArray1D< Real64 > sol0( maxlay );
+		FArray1D< Real64 > & qs( Work.qs );
+		FArray1D< Real64 > & qvs( Work.qvs );
+		FArray1D< Real64 > & LaminateAU( Work.LaminateAU );
+		FArray1D< Real64 > & sumsolU( Work.sumsolU );
+		FArray1D< Real64 > & sol0( Work.sol0 );
 		Real64 shgct_NOSD;
 		Real64 trmout;
 
@@ -351,10 +352,10 @@ namespace ThermalISO15099Calc {
 		Real64 qc1;
 		Real64 qc2;
 		Real64 qcgg;
-		FArray1D< Real64 > qcgas( maxlay1 );
-		FArray1D< Real64 > qcgaps( maxlay1 );
-		FArray1D< Real64 > qrgas( maxlay1 );
-		FArray1D< Real64 > qrgaps( maxlay1 );
+		FArray1D< Real64 > & qcgas( Work.qcgas );
+		FArray1D< Real64 > & qcgaps( Work.qcgaps );
+		FArray1D< Real64 > & qrgas( Work.qrgas );
+		FArray1D< Real64 > & qrgaps( Work.qrgaps );
 
 		Real64 ShadeHcModifiedOut;
 		Real64 ShadeHcModifiedIn;
@@ -367,21 +368,21 @@ namespace ThermalISO15099Calc {
 		int nlayer_NOSD;
 		Real64 AchievedErrorTolerance_NOSD;
 		int NumOfIter_NOSD;
-		FArray1D< Real64 > Atop_NOSD( maxlay );
-		FArray1D< Real64 > Abot_NOSD( maxlay );
-		FArray1D< Real64 > Al_NOSD( maxlay );
-		FArray1D< Real64 > Ar_NOSD( maxlay );
-		FArray1D< Real64 > Ah_NOSD( maxlay );
-		FArray1D< Real64 > SlatThick_NOSD( maxlay );
-		FArray1D< Real64 > SlatWidth_NOSD( maxlay );
-		FArray1D< Real64 > SlatAngle_NOSD( maxlay );
-		FArray1D< Real64 > SlatCond_NOSD( maxlay );
-		FArray1D< Real64 > SlatSpacing_NOSD( maxlay );
-		FArray1D< Real64 > SlatCurve_NOSD( maxlay );
-		FArray1D< Real64 > vvent_NOSD( maxlay1 );
-		FArray1D< Real64 > tvent_NOSD( maxlay1 );
-		FArray1D< Real64 > qv_NOSD( maxlay1 );
-		FArray1D< Real64 > q_NOSD( maxlay3 );
+		FArray1D< Real64 > & Atop_NOSD( Work.Atop_NOSD );
+		FArray1D< Real64 > & Abot_NOSD( Work.Abot_NOSD );
+		FArray1D< Real64 > & Al_NOSD( Work.Al_NOSD );
+		FArray1D< Real64 > & Ar_NOSD( Work.Ar_NOSD );
+		FArray1D< Real64 > & Ah_NOSD( Work.Ah_NOSD );
+		FArray1D< Real64 > & SlatThick_NOSD( Work.SlatThick_NOSD );
+		FArray1D< Real64 > & SlatWidth_NOSD( Work.SlatWidth_NOSD );
+		FArray1D< Real64 > & SlatAngle_NOSD( Work.SlatAngle_NOSD );
+		FArray1D< Real64 > & SlatCond_NOSD( Work.SlatCond_NOSD );
+		FArray1D< Real64 > & SlatSpacing_NOSD( Work.SlatSpacing_NOSD );
+		FArray1D< Real64 > & SlatCurve_NOSD( Work.SlatCurve_NOSD );
+		FArray1D< Real64 > & vvent_NOSD( Work.vvent_NOSD );
+		FArray1D< Real64 > & tvent_NOSD( Work.tvent_NOSD );
+		FArray1D< Real64 > & qv_NOSD( Work.qv_NOSD );
+		FArray1D< Real64 > & q_NOSD( Work.q_NOSD );
 		Real64 hin_NOSD;
 		Real64 flux_NOSD;
 		Real64 hcin_NOSD;
@@ -390,61 +391,61 @@ namespace ThermalISO15099Calc {
 		Real64 hrout_NOSD;
 		Real64 tamb_NOSD;
 		Real64 troom_NOSD;
-		FArray1D_int LayerType_NOSD( maxlay );
+		FArray1D_int & LayerType_NOSD( Work.LayerType_NOSD );
 		Real64 ufactor_NOSD;
 		Real64 sc_NOSD;
 		Real64 hflux_NOSD;
 		Real64 shgc_NOSD;
 		Real64 hout_NOSD;
-		FArray1D< Real64 > gap_NOSD( maxlay );
-		FArray1D< Real64 > thick_NOSD( maxlay );
-		FArray1D< Real64 > scon_NOSD( maxlay );
-		FArray1D< Real64 > emis_NOSD( maxlay2 );
-		FArray1D< Real64 > rir_NOSD( maxlay2 );
-		FArray1D< Real64 > tir_NOSD( maxlay2 );
-		FArray1D< Real64 > theta_NOSD( maxlay2 );
-		FArray2D< Real64 > frct_NOSD( maxlay1, maxgas );
-		FArray2D_int iprop_NOSD( maxlay1, maxgas );
-		FArray1D_int nmix_NOSD( maxlay1 );
-		FArray1D< Real64 > presure_NOSD( maxlay1 );
-		FArray1D< Real64 > hcgas_NOSD( maxlay1 );
-		FArray1D< Real64 > hrgas_NOSD( maxlay1 );
+		FArray1D< Real64 > & gap_NOSD( Work.gap_NOSD );
+		FArray1D< Real64 > & thick_NOSD( Work.thick_NOSD );
+		FArray1D< Real64 > & scon_NOSD( Work.scon_NOSD );
+		FArray1D< Real64 > & emis_NOSD( Work.emis_NOSD );
+		FArray1D< Real64 > & rir_NOSD( Work.rir_NOSD );
+		FArray1D< Real64 > & tir_NOSD( Work.tir_NOSD );
+		FArray1D< Real64 > & theta_NOSD( Work.theta_NOSD );
+		FArray2D< Real64 > & frct_NOSD( Work.frct_NOSD );
+		FArray2D_int & iprop_NOSD( Work.iprop_NOSD );
+		FArray1D_int & nmix_NOSD( Work.nmix_NOSD );
+		FArray1D< Real64 > & presure_NOSD( Work.presure_NOSD );
+		FArray1D< Real64 > & hcgas_NOSD( Work.hcgas_NOSD );
+		FArray1D< Real64 > & hrgas_NOSD( Work.hrgas_NOSD );
 		//REAL(r64) ::  rs_NOSD(maxlay3)!,sol(maxlay)
-		FArray1D< Real64 > LaminateA_NOSD( maxlay );
-		FArray1D< Real64 > LaminateB_NOSD( maxlay );
-		FArray1D< Real64 > sumsol_NOSD( maxlay );
-		FArray1D< Real64 > Ra_NOSD( maxlay );
-		FArray1D< Real64 > Nu_NOSD( maxlay );
+		FArray1D< Real64 > & LaminateA_NOSD( Work.LaminateA_NOSD );
+		FArray1D< Real64 > & LaminateB_NOSD( Work.LaminateB_NOSD );
+		FArray1D< Real64 > & sumsol_NOSD( Work.sumsol_NOSD );
+		FArray1D< Real64 > & Ra_NOSD( Work.Ra_NOSD );
+		FArray1D< Real64 > & Nu_NOSD( Work.Nu_NOSD );
 		Real64 ShadeEmisRatioOut_NOSD;
 		Real64 ShadeEmisRatioIn_NOSD;
 		Real64 ShadeHcRatioOut_NOSD;
 		Real64 ShadeHcRatioIn_NOSD;
 		Real64 ShadeHcModifiedOut_NOSD;
 		Real64 ShadeHcModifiedIn_NOSD;
-		FArray1D< Real64 > Ebb( maxlay );
-		FArray1D< Real64 > Ebf( maxlay );
-		FArray1D< Real64 > Rb( maxlay );
-		FArray1D< Real64 > Rf( maxlay );
-		FArray1D< Real64 > Ebbs( maxlay );
-		FArray1D< Real64 > Ebfs( maxlay );
-		FArray1D< Real64 > Rbs( maxlay );
-		FArray1D< Real64 > Rfs( maxlay );
-		FArray1D< Real64 > Ebb_NOSD( maxlay );
-		FArray1D< Real64 > Ebf_NOSD( maxlay );
-		FArray1D< Real64 > Rb_NOSD( maxlay );
-		FArray1D< Real64 > Rf_NOSD( maxlay );
-
-		FArray1D< Real64 > ShadeGapKeffConv_NOSD( MaxGap );
-		FArray1D< Real64 > qcgas_NOSD( maxlay1 );
-		FArray1D< Real64 > Keff_NOSD( maxlay1 );
-		FArray1D< Real64 > qrgas_NOSD( maxlay1 );
-		FArray1D_int nslice_NOSD( maxlay );
-		FArray1D< Real64 > vfreevent_NOSD( maxlay1 );
+		FArray1D< Real64 > & Ebb( Work.Ebb );
+		FArray1D< Real64 > & Ebf( Work.Ebf );
+		FArray1D< Real64 > & Rb( Work.Rb );
+		FArray1D< Real64 > & Rf( Work.Rf );
+		FArray1D< Real64 > & Ebbs( Work.Ebbs );
+		FArray1D< Real64 > & Ebfs( Work.Ebfs );
+		FArray1D< Real64 > & Rbs( Work.Rbs );
+		FArray1D< Real64 > & Rfs( Work.Rfs );
+		FArray1D< Real64 > & Ebb_NOSD( Work.Ebb_NOSD );
+		FArray1D< Real64 > & Ebf_NOSD( Work.Ebf_NOSD );
+		FArray1D< Real64 > & Rb_NOSD( Work.Rb_NOSD );
+		FArray1D< Real64 > & Rf_NOSD( Work.Rf_NOSD );
+
+		FArray1D< Real64 > & ShadeGapKeffConv_NOSD( Work.ShadeGapKeffConv_NOSD );
+		FArray1D< Real64 > & qcgas_NOSD( Work.qcgas_NOSD );
+		FArray1D< Real64 > & Keff_NOSD( Work.Keff_NOSD );
+		FArray1D< Real64 > & qrgas_NOSD( Work.qrgas_NOSD );
+		FArray1D_int & nslice_NOSD( Work.nslice_NOSD );
+		FArray1D< Real64 > & vfreevent_NOSD( Work.vfreevent_NOSD );
 
 		int FirstSpecularLayer;
 		int LastSpecularLayer;
 
-		FArray1D< Real64 > vfreevent( maxlay1 );
+		FArray1D< Real64 > & vfreevent( Work.vfreevent );
 
 		//cbi...Other variables:
 		Real64 flux;
@@ -502,7 +503,7 @@ namespace ThermalISO15099Calc {
 		if ( ( dir > 0.0 ) || ( SHGCCalc == 0 ) ) {
 			// call therm1d to calculate heat flux with solar radiation
 
-			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, dir, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, rir, emis, gap, thick, scon, tilt, asol, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, vfreevent, qcgas, qrgas, Ebf, Ebb, Rf, Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorToleranceSolar, NumOfIterSolar );
+			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, dir, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, rir, emis, gap, thick, scon, tilt, asol, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, vfreevent, qcgas, qrgas, Ebf, Ebb, Rf, Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorToleranceSolar, NumOfIterSolar, Work );
 
 			NumOfIterations = NumOfIterSolar;
 			//exit on error:
@@ -570,7 +571,7 @@ namespace ThermalISO15099Calc {
 			hout = houtt;
 
 			// call therm1d to calculate heat flux without solar radiation
-			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, 0.0, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, rir, emis, gap, thick, scon, tilt, sol0, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, vfreevent, qcgas, qrgas, Ebf, Ebb, Rf, Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorTolerance, NumOfIter );
+			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, 0.0, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, rir, emis, gap, thick, scon, tilt, sol0, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, vfreevent, qcgas, qrgas, Ebf, Ebb, Rf, Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorTolerance, NumOfIter, Work );
 
 			NumOfIterations = NumOfIter;
 
@@ -647,6 +648,8 @@ namespace ThermalISO15099Calc {
 					rir_NOSD( 2 * i ) = rir( 2 * OriginalIndex );
 
 					gap_NOSD( i ) = gap( OriginalIndex );
+					theta_NOSD( 2 * i - 1 ) = theta( 2 * OriginalIndex - 1 );
+					theta_NOSD( 2 * i ) = theta( 2 * OriginalIndex );
 
 					if ( i < nlayer_NOSD ) {
 						nmix_NOSD( i + 1 ) = nmix( OriginalIndex + 1 );
@@ -692,7 +695,7 @@ namespace ThermalISO15099Calc {
 				//      This is "Unshaded, No solar radiation" pass
 				//cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 				// call therm1d to calculate heat flux with solar radiation
-				therm1d( nlayer_NOSD, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, 0.0, ebsky, Gout, trmout, trmin, ebroom, Gin, tir_NOSD, rir_NOSD, emis_NOSD, gap_NOSD, thick_NOSD, scon_NOSD, tilt, sol0, height, heightt, width, iprop_NOSD, frct_NOSD, presure_NOSD, nmix_NOSD, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta_NOSD, q_NOSD, qv_NOSD, flux_NOSD, hcin_NOSD, hrin_NOSD, hcout_NOSD, hrout_NOSD, hin_NOSD, hout_NOSD, hcgas_NOSD, hrgas_NOSD, ufactor_NOSD, nperr, ErrorMessage, tamb_NOSD, troom_NOSD, ibc, Atop_NOSD, Abot_NOSD, Al_NOSD, Ar_NOSD, Ah_NOSD, vvent_NOSD, tvent_NOSD, LayerType_NOSD, Ra_NOSD, Nu_NOSD, vfreevent_NOSD, qcgas_NOSD, qrgas_NOSD, Ebf_NOSD, Ebb_NOSD, Rf_NOSD, Rb_NOSD, ShadeEmisRatioOut_NOSD, ShadeEmisRatioIn_NOSD, ShadeHcModifiedOut_NOSD, ShadeHcModifiedIn_NOSD, ThermalMod, Debug_mode, AchievedErrorTolerance_NOSD, NumOfIter_NOSD );
+				therm1d( nlayer_NOSD, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, 0.0, ebsky, Gout, trmout, trmin, ebroom, Gin, tir_NOSD, rir_NOSD, emis_NOSD, gap_NOSD, thick_NOSD, scon_NOSD, tilt, sol0, height, heightt, width, iprop_NOSD, frct_NOSD, presure_NOSD, nmix_NOSD, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta_NOSD, q_NOSD, qv_NOSD, flux_NOSD, hcin_NOSD, hrin_NOSD, hcout_NOSD, hrout_NOSD, hin_NOSD, hout_NOSD, hcgas_NOSD, hrgas_NOSD, ufactor_NOSD, nperr, ErrorMessage, tamb_NOSD, troom_NOSD, ibc, Atop_NOSD, Abot_NOSD, Al_NOSD, Ar_NOSD, Ah_NOSD, vvent_NOSD, tvent_NOSD, LayerType_NOSD, Ra_NOSD, Nu_NOSD, vfreevent_NOSD, qcgas_NOSD, qrgas_NOSD, Ebf_NOSD, Ebb_NOSD, Rf_NOSD, Rb_NOSD, ShadeEmisRatioOut_NOSD, ShadeEmisRatioIn_NOSD, ShadeHcModifiedOut_NOSD, ShadeHcModifiedIn_NOSD, ThermalMod, Debug_mode, AchievedErrorTolerance_NOSD, NumOfIter_NOSD, Work );
 
 				NumOfIterations = NumOfIter_NOSD;
 				// exit on error
@@ -866,7 +869,8 @@ namespace ThermalISO15099Calc {
 		int const ThermalMod,
 		int const Debug_mode, // Switch for debug output files:
 		Real64 & AchievedErrorTolerance,
-		int & TotalIndex
+		int & TotalIndex,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//********************************************************************************
@@ -990,11 +994,11 @@ namespace ThermalISO15099Calc {
 		Real64 glsyswidth;
 		//REAL(r64) :: Ebbold(maxlay), Ebfold(maxlay), Rbold(maxlay), Rfold(maxlay)
 		//REAL(r64) :: rs(maxlay3)
-		FArray2D< Real64 > a( 4*nlayer, 4*nlayer );
-		FArray1D< Real64 > b( 4*nlayer );
-		FArray1D< Real64 > hgas( maxlay1 );
+		FArray2D< Real64 > & a( Work.a );
+		FArray1D< Real64 > & b( Work.b );
+		FArray1D< Real64 > & hgas( Work.hgas );
 		//REAL(r64) :: hhatv(maxlay3),hcv(maxlay3), Ebgap(maxlay3), Tgap(maxlay1)
-		FArray1D< Real64 > Tgap( maxlay1 );
+		FArray1D< Real64 > & Tgap( Work.Tgap_therm1d );
 
 		//REAL(r64) ::  alpha
 		int maxiter;
@@ -1002,33 +1006,33 @@ namespace ThermalISO15099Calc {
 		Real64 qr_gap_out;
 		Real64 qr_gap_in;
 
-		FArray1D< Real64 > told( 2*nlayer );
+		FArray1D< Real64 > & told( Work.told_therm1d );
 
 		// Simon: parameters used in case of JCFN iteration method
 		//REAL(r64) :: Dvector(maxlay4) ! store diagonal matrix used in JCFN iterations
-		FArray1D< Real64 > FRes; // store function results from current iteration
-		FArray1D< Real64 > FResOld; // store function results from previous iteration
-		FArray1D< Real64 > FResDiff; // save difference in results between iterations
-		FArray1D< Real64 > Radiation; // radiation on layer surfaces.  used as temporary storage during iterations
+		FArray1D< Real64 > & FRes( Work.FRes ); // store function results from current iteration
+		FArray1D< Real64 > & FResOld( Work.FResOld ); // store function results from previous iteration
+		FArray1D< Real64 > & FResDiff( Work.FResDiff ); // save difference in results between iterations
+		FArray1D< Real64 > & Radiation( Work.Radiation ); // radiation on layer surfaces.  used as temporary storage during iterations
 
-		FArray1D< Real64 > x; // temporary vector for storing results (theta and Radiation).  used for easier handling
-		FArray1D< Real64 > dX; // difference in results
-		FArray2D< Real64 > Jacobian; // diagonal vector for jacobian comuptation-free newton method
-		FArray1D< Real64 > DRes; // used in jacobian forward-difference approximation
+		FArray1D< Real64 > & x( Work.x ); // temporary vector for storing results (theta and Radiation).  used for easier handling
+		FArray1D< Real64 > & dX( Work.dX ); // difference in results
+		FArray2D< Real64 > & Jacobian( Work.Jacobian ); // diagonal vector for jacobian comuptation-free newton method
+		FArray1D< Real64 > & DRes( Work.DRes ); // used in jacobian forward-difference approximation
 
 		// This is used to store matrix before equation solver.  It is important because solver destroys
 		// content of matrices
-		FArray2D< Real64 > LeftHandSide;
-		FArray1D< Real64 > RightHandSide;
+		FArray2D< Real64 > & LeftHandSide( Work.LeftHandSide );
+		FArray1D< Real64 > & RightHandSide( Work.RightHandSide );
 
 		// Simon: Keep best achieved convergence
 		Real64 prevDifference;
 		Real64 Relaxation;
-		FArray1D< Real64 > RadiationSave;
-		FArray1D< Real64 > thetaSave;
+		FArray1D< Real64 > & RadiationSave( Work.RadiationSave );
+		FArray1D< Real64 > & thetaSave( Work.thetaSave );
 		int currentTry;
 
-		FArray1D_int LayerTypeSpec( maxlay );
+		FArray1D_int & LayerTypeSpec( Work.LayerTypeSpec );
 		int SDLayerIndex;
 
 		int CSMFlag;
@@ -1058,20 +1062,23 @@ namespace ThermalISO15099Calc {
 
 		SDLayerIndex = -1;
 
-		// Allocate arrays
-		if ( ! allocated( FRes ) ) FRes.allocate( {1,4 * nlayer} );
-		if ( ! allocated( FResOld ) ) FResOld.allocate( {1,4 * nlayer} );
-		if ( ! allocated( FResDiff ) ) FResDiff.allocate( {1,4 * nlayer} );
-		if ( ! allocated( Radiation ) ) Radiation.allocate( {1,2 * nlayer} );
-		if ( ! allocated( RadiationSave ) ) RadiationSave.allocate( {1,2 * nlayer} );
-		if ( ! allocated( thetaSave ) ) thetaSave.allocate( {1,2 * nlayer} );
-		if ( ! allocated( x ) ) x.allocate( {1,4 * nlayer} );
-		if ( ! allocated( dX ) ) dX.allocate( {1,4 * nlayer} );
-		if ( ! allocated( Jacobian ) ) Jacobian.allocate( {1,4 * nlayer}, {1,4 * nlayer} );
-		if ( ! allocated( DRes ) ) DRes.allocate( {1,4 * nlayer} );
-
-		if ( ! allocated( LeftHandSide ) ) LeftHandSide.allocate( {1,4 * nlayer}, {1,4 * nlayer} );
-		if ( ! allocated( RightHandSide ) ) RightHandSide.allocate( {1,4 * nlayer} );
+		// Size the scratch arrays for this glazing system (only reallocated when the number of layers changes)
+		a.dimension( 4 * nlayer, 4 * nlayer );
+		b.dimension( 4 * nlayer );
+		told.dimension( 2 * nlayer );
+		FRes.dimension( 4 * nlayer );
+		FResOld.dimension( 4 * nlayer );
+		FResDiff.dimension( 4 * nlayer );
+		Radiation.dimension( 2 * nlayer );
+		RadiationSave.dimension( 2 * nlayer );
+		thetaSave.dimension( 2 * nlayer );
+		x.dimension( 4 * nlayer );
+		dX.dimension( 4 * nlayer );
+		Jacobian.dimension( 4 * nlayer, 4 * nlayer );
+		DRes.dimension( 4 * nlayer );
+
+		LeftHandSide.dimension( 4 * nlayer, 4 * nlayer );
+		RightHandSide.dimension( 4 * nlayer );
 
 		dX = 0.0;
 
@@ -1182,7 +1189,7 @@ namespace ThermalISO15099Calc {
 			}
 
 			// evaluate convective/conductive components of gap
-			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, Tgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu );
+			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, Tgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu, Work );
 
 			// exit on error
 			if ( ! ( GoAhead( nperr ) ) ) return;
@@ -1202,7 +1209,7 @@ namespace ThermalISO15099Calc {
 				matrixQBalance( nlayer, a, b, scon, thick, hcgas, hcout, hcin, asol, qv, tind, tout, Gin, Gout, theta, tir, rir, emis );
 			} else {
 				//bi...There are no Venetian layers, or ThermalMod is not CSM, so carry on as usual:
-				shading( theta, gap, hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Tgap, qv, nperr, ErrorMessage, vfreevent );
+				shading( theta, gap, hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Tgap, qv, nperr, ErrorMessage, vfreevent, Work );
 
 				// exit on error
 				if ( ! ( GoAhead( nperr ) ) ) return;
@@ -1252,7 +1259,7 @@ namespace ThermalISO15099Calc {
 			LeftHandSide = a;
 			RightHandSide = b;
 			//end if
-			EquationsSolver( LeftHandSide, RightHandSide, 4 * nlayer, nperr, ErrorMessage );
+			EquationsSolver( LeftHandSide, RightHandSide, 4 * nlayer, nperr, ErrorMessage, Work );
 
 			//if (TurnOnNewton) then
 			//  dx = RightHandSide
@@ -1407,9 +1414,9 @@ namespace ThermalISO15099Calc {
 			}
 
 			// Simon: It is important to recalculate coefficients from most accurate run
-			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, Tgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu );
+			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, Tgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu, Work );
 
-			shading( theta, gap, hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Tgap, qv, nperr, ErrorMessage, vfreevent );
+			shading( theta, gap, hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Tgap, qv, nperr, ErrorMessage, vfreevent, Work );
 		}
 
 		if ( CalcOutcome == CALC_UNKNOWN ) {
@@ -1813,7 +1820,8 @@ namespace ThermalISO15099Calc {
 		Real64 & hrin,
 		Real64 & hrout,
 		FArray1A< Real64 > Ra,
-		FArray1A< Real64 > Nu
+		FArray1A< Real64 > Nu,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//***********************************************************************
@@ -1920,7 +1928,7 @@ namespace ThermalISO15099Calc {
 		//end if
 		//end do
 
-		filmg( tilt, theta, Tgap, nlayer, height, gap, iprop, frct, VacuumPressure, presure, nmix, wght, gcon, gvis, gcp, gama, hcgas, Ra, Nu, nperr, ErrorMessage );
+		filmg( tilt, theta, Tgap, nlayer, height, gap, iprop, frct, VacuumPressure, presure, nmix, wght, gcon, gvis, gcp, gama, hcgas, Ra, Nu, nperr, ErrorMessage, Work );
 
 		if ( ! ( GoAhead( nperr ) ) ) {
 			return;
@@ -1949,7 +1957,7 @@ namespace ThermalISO15099Calc {
 
 		// convective indoor film coeff:
 		if ( ibc( 2 ) <= 0 ) {
-			filmi( tind, theta( nface ), nlayer, tilt, wsi, heightt, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, hcin, ibc( 2 ), nperr, ErrorMessage );
+			filmi( tind, theta( nface ), nlayer, tilt, wsi, heightt, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, hcin, ibc( 2 ), nperr, ErrorMessage, Work );
 		} else if ( ibc( 2 ) == 1 ) {
 			hcin = hin - hrin;
 			//Simon: First iteration is with index = 0 and that means it should reenter iteration with whatever is provided as input
@@ -2025,7 +2033,8 @@ namespace ThermalISO15099Calc {
 		Real64 & hcin,
 		int const ibc,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//***********************************************************************
@@ -2063,9 +2072,9 @@ namespace ThermalISO15099Calc {
 		gcp.dim( maxgas, 3 );
 
 		// Locals
-		FArray1D< Real64 > frcti( maxgas );
+		FArray1D< Real64 > & frcti( Work.frcti );
 		int j;
-		FArray1D_int ipropi( maxgas );
+		FArray1D_int & ipropi( Work.ipropi );
 		Real64 tiltr;
 		Real64 tmean;
 		Real64 delt;
@@ -2097,7 +2106,7 @@ namespace ThermalISO15099Calc {
 				frcti( j ) = frct( nlayer + 1, j );
 			}
 
-			GASSES90( tmean, ipropi, frcti, presure( nlayer + 1 ), nmix( nlayer + 1 ), wght, gcon, gvis, gcp, con, visc, dens, cp, pr, ISO15099, nperr, ErrorMessage );
+			GASSES90( tmean, ipropi, frcti, presure( nlayer + 1 ), nmix( nlayer + 1 ), wght, gcon, gvis, gcp, con, visc, dens, cp, pr, ISO15099, nperr, ErrorMessage, Work );
 
 			//   Calculate grashoff number:
 			//   The grashoff number is the Rayleigh Number (equation 5.29) in SPC142 divided by the Prandtl Number (prand):
@@ -2158,7 +2167,8 @@ namespace ThermalISO15099Calc {
 		FArray1A< Real64 > Rayleigh,
 		FArray1A< Real64 > Nu,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 		//***********************************************************************
@@ -2218,8 +2228,8 @@ namespace ThermalISO15099Calc {
 		Real64 ra;
 		Real64 asp;
 		Real64 gnu;
-		FArray1D< Real64 > frctg( maxgas );
-		FArray1D_int ipropg( maxgas );
+		FArray1D< Real64 > & frctg( Work.frctg );
+		FArray1D_int & ipropg( Work.ipropg );
 		int i;
 		int j;
 		int k;
@@ -2242,7 +2252,7 @@ namespace ThermalISO15099Calc {
 			}
 
 			if ( presure( i + 1 ) > VacuumPressure ) {
-				GASSES90( tmean, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), wght, gcon, gvis, gcp, con, visc, dens, cp, pr, ISO15099, nperr, ErrorMessage );
+				GASSES90( tmean, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), wght, gcon, gvis, gcp, con, visc, dens, cp, pr, ISO15099, nperr, ErrorMessage, Work );
 
 				// Calculate grashoff number:
 				// The grashoff number is the Rayleigh Number (equation 5.29) in SPC142 divided by the Prandtl Number (prand):
@@ -2531,7 +2541,8 @@ namespace ThermalISO15099Calc {
 		FArray1A< Real64 > hgas,
 		FArray1A< Real64 > hhat,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	)
 	{
 
@@ -2621,7 +2632,7 @@ namespace ThermalISO15099Calc {
 			// calc hc_0 as hcin:
 			// convective indoor film coeff:
 			if ( ibc( 2 ) <= 0 ) {
-				filmi( tind, theta( 2 * nlayer - 2 ), nlayer, tilt, wsi, heightt, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, hc_NOSD, ibc( 2 ), nperr, ErrorMessage );
+				filmi( tind, theta( 2 * nlayer - 2 ), nlayer, tilt, wsi, heightt, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, hc_NOSD, ibc( 2 ), nperr, ErrorMessage, Work );
 			} else if ( ibc( 2 ) == 1 ) {
 				hc_NOSD = hin - hrin;
 			} else if ( ibc( 2 ) == 2 && index == 1 ) {
@@ -2653,7 +2664,7 @@ namespace ThermalISO15099Calc {
 				ipropg( l ) = iprop( i + 1, l );
 				frctg( l ) = frct( i + 1, l );
 			}
-			GASSES90( tmean, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), wght, gcon, gvis, gcp, con, visc, dens, cp, pr, ISO15099, nperr, ErrorMessage );
+			GASSES90( tmean, ipropg, frctg, presure( i + 1 ), nmix( i + 1 ), wght, gcon, gvis, gcp, con, visc, dens, cp, pr, ISO15099, nperr, ErrorMessage, Work );
 			gap_NOSD = gap( SDLayerIndex - 1 ) + gap( SDLayerIndex ) + thick( SDLayerIndex );
 			// determine the Rayleigh number:
 			rayl = GravityConstant * pow_3( gap_NOSD ) * delt * cp * pow_2( dens ) / ( tmean * visc * con );
@@ -7,6 +7,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGCommon.hh>
 
 namespace EnergyPlus {
 
@@ -120,7 +121,8 @@ namespace ThermalISO15099Calc {
 		FArray1A< Real64 > ShadeGapKeffConv,
 		Real64 const SDScalar,
 		int const SHGCCalc, // SHGC calculation switch:
-		int & NumOfIterations
+		int & NumOfIterations,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -205,7 +207,8 @@ namespace ThermalISO15099Calc {
 		int const ThermalMod,
 		int const Debug_mode, // Switch for debug output files:
 		Real64 & AchievedErrorTolerance,
-		int & TotalIndex
+		int & TotalIndex,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -314,7 +317,8 @@ namespace ThermalISO15099Calc {
 		Real64 & hrin,
 		Real64 & hrout,
 		FArray1A< Real64 > Ra,
-		FArray1A< Real64 > Nu
+		FArray1A< Real64 > Nu,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -336,7 +340,8 @@ namespace ThermalISO15099Calc {
 		Real64 & hcin,
 		int const ibc,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -361,7 +366,8 @@ namespace ThermalISO15099Calc {
 		FArray1A< Real64 > Rayleigh,
 		FArray1A< Real64 > Nu,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -442,7 +448,8 @@ namespace ThermalISO15099Calc {
 		FArray1A< Real64 > hgas,
 		FArray1A< Real64 > hhat,
 		int & nperr,
-		std::string & ErrorMessage
+		std::string & ErrorMessage,
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	void
@@ -37,6 +37,7 @@ extern "C" {
 #include <OutputReports.hh>
 #include <PlantManager.hh>
 #include <SimulationManager.hh>
+#include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
 #include <SystemReports.hh>
@@ -115,6 +116,12 @@ AbortEnergyPlus(
 	bool TerminalError;
 	int write_stat;
 
+	if ( CacheErrorMessages ) {
+		// Run period segment or zone sizing worker process: the parent process reports the errors and owns the output files
+		if ( SimulationManager::RunPeriodSegment > 0 ) SimulationManager::AbortRunPeriodSegmentWorker();
+		SizingManager::AbortSizingWorker();
+	}
+
 	if ( sqlite && sqlite->writeOutputToSQLite() ) {
 		sqlite->updateSQLiteSimulationRecord( true, false );
 	}
@@ -1567,6 +1574,8 @@ ShowErrorMessage(
 	using DataStringGlobals::IDDVerString;
 	using DataGlobals::DoingInputProcessing;
 	using DataGlobals::CacheIPErrorFile;
+	using DataErrorTracking::CacheErrorMessages;
+	using DataErrorTracking::CachedErrorMessages;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1587,6 +1596,12 @@ ShowErrorMessage(
 	int write_stat;
 	static bool ErrFileOpened( false );
 
+	if ( CacheErrorMessages ) {
+		// Zone sizing worker process, the parent process writes the message
+		CachedErrorMessages.push_back( ErrorMessage );
+		return;
+	}
+
 	if ( TotalErrors == 0 && ! ErrFileOpened ) {
 		StandardErrorOutput = GetNewUnitNumber();
 		{ IOFlags flags; flags.ACTION( "write" ); gio::open( StandardErrorOutput, "eplusout.err", flags ); write_stat = flags.ios(); }
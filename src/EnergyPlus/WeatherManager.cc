@@ -939,6 +939,53 @@ namespace WeatherManager {
 
 	}
 
+	void
+	SetRunPeriodSegment(
+		int const FirstDay, // first day of the segment, counted from the first day of the run period
+		int const NumDays // number of days in the segment
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Shortens the current (weather file run period) environment to a segment of its days
+		// and steps the environment counter back, so that the next call of GetNextEnvironment
+		// sets up the segment in place of the whole run period.
+
+		// METHODOLOGY EMPLOYED:
+		// Only for a run period within one calendar year that is simulated once (see
+		// SimulationManager::SimulateRunPeriodInSegments).  A start day of week given in the
+		// run period is moved along with the start date; the weekdays of the first days of the
+		// months do not change.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::InvJulianDay;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int LocalLeapYearAdd; // leap year day used for the julian days of the run period
+
+		auto & envrn( Environment( Envrn ) );
+		LocalLeapYearAdd = ( envrn.IsLeapYear ? 1 : 0 );
+		envrn.StartJDay += FirstDay - 1;
+		envrn.EndJDay = envrn.StartJDay + NumDays - 1;
+		InvJulianDay( envrn.StartJDay, envrn.StartMonth, envrn.StartDay, LocalLeapYearAdd );
+		InvJulianDay( envrn.EndJDay, envrn.EndMonth, envrn.EndDay, LocalLeapYearAdd );
+		envrn.TotalDays = NumDays;
+		envrn.RawSimDays = NumDays;
+		if ( envrn.DayOfWeek > 0 ) envrn.DayOfWeek = mod( envrn.DayOfWeek + FirstDay - 2, 7 ) + 1;
+		--Envrn;
+
+	}
+
 	void
 	SetupWeekDaysByMonth(
 		int const StMon,
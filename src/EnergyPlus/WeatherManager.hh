@@ -1177,6 +1177,12 @@ namespace WeatherManager {
 		bool & ErrorsFound // will be set to true if severe errors are found in inputs
 	);
 
+	void
+	SetRunPeriodSegment(
+		int const FirstDay, // first day of the segment, counted from the first day of the run period
+		int const NumDays // number of days in the segment
+	);
+
 	void
 	SetupWeekDaysByMonth(
 		int const StMon,
@@ -10,6 +10,7 @@
 #include <EnergyPlus.hh>
 #include <DataBSDFWindow.hh>
 #include <DataVectorTypes.hh>
+#include <TARCOGCommon.hh>
 
 namespace EnergyPlus {
 
@@ -269,7 +270,8 @@ namespace WindowComplexManager {
 		Real64 & SurfInsideTemp, // Inside window surface temperature
 		Real64 & SurfOutsideTemp, // Outside surface temperature (C)
 		Real64 & SurfOutsideEmiss,
-		int const CalcCondition // Calucation condition (summer, winter or no condition)
+		int const CalcCondition, // Calucation condition (summer, winter or no condition)
+		TARCOGCommon::TARCOGWorkspace & Work // scratch arrays of the TARCOG solve
 	);
 
 	// This function check if gas with molecular weight has already been feed into coefficients and
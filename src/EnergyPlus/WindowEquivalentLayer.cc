@@ -553,6 +553,7 @@ namespace WindowEquivalentLayer {
 		FArray1D< Real64 > Q( {0,CFSMAXNL} );
 		FArray1D< Real64 > H( {0,CFSMAXNL+1} );
 		FArray2D< Real64 > Abs1( CFSMAXNL+1, 2 );
+		EQLThermalWorkspace Work; // scratch arrays of the layer solve
 		Real64 QRSW;
 		Real64 QRLW;
 		Real64 QCONV;
@@ -600,7 +601,7 @@ namespace WindowEquivalentLayer {
 		TransNormal = Abs1( NL + 1, 1 );
 
 		// Calculate SHGC using net radiation method (ASHWAT Model)
-		CFSSHGC = ASHWAT_Thermal( FS, TIN, TOUT, HCIN, HCOUT, TRMOUT, TRMIN, BeamSolarInc, BeamSolarInc * Abs1( {1,NL+1}, 1 ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC, true );
+		CFSSHGC = ASHWAT_Thermal( FS, TIN, TOUT, HCIN, HCOUT, TRMOUT, TRMIN, BeamSolarInc, BeamSolarInc * Abs1( {1,NL+1}, 1 ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC, Work, true );
 
 		if ( ! CFSSHGC ) {
 			ShowWarningMessage( RoutineName + "Solar heat gain coefficient calculation failed for " + FS.Name );
@@ -709,7 +710,8 @@ namespace WindowEquivalentLayer {
 		Real64 & SurfInsideTemp, // Inside window surface temperature (innermost face) [C]
 		Real64 & SurfOutsideTemp, // Outside surface temperature (C)
 		Real64 & SurfOutsideEmiss,
-		int const CalcCondition // Calucation condition (summer, winter or no condition)
+		int const CalcCondition, // Calucation condition (summer, winter or no condition)
+		EQLThermalWorkspace & Work // scratch arrays of the heat balance
 	)
 	{
 		// SUBROUTINE INFORMATION:
@@ -769,14 +771,14 @@ namespace WindowEquivalentLayer {
 		Real64 QRLWX;
 		Real64 QCONV;
 		Real64 TSX;
-		FArray1D< Real64 > QOCF( CFSMAXNL );
+		FArray1D< Real64 > & QOCF( Work.QOCF );
 		Real64 QOCFRoom;
-		FArray1D< Real64 > JB( {0,CFSMAXNL} );
-		FArray1D< Real64 > JF( {1,CFSMAXNL+1} );
-		FArray1D< Real64 > T( CFSMAXNL );
-		FArray1D< Real64 > Q( {0,CFSMAXNL} );
-		FArray1D< Real64 > H( {0,CFSMAXNL+1} );
-		FArray1D< Real64 > QAllSWwinAbs( {1,CFSMAXNL+1} );
+		FArray1D< Real64 > & JB( Work.JB );
+		FArray1D< Real64 > & JF( Work.JF );
+		FArray1D< Real64 > & T( Work.T );
+		FArray1D< Real64 > & Q( Work.Q );
+		FArray1D< Real64 > & H( Work.H );
+		FArray1D< Real64 > & QAllSWwinAbs( Work.QAllSWwinAbs );
 
 		bool ASHWAT_ThermalR; // net long wave radiation flux on the inside face of window
 		int EQLNum; // equivalent layer window index
@@ -930,7 +932,7 @@ namespace WindowEquivalentLayer {
 		QAllSWwinAbs( {1,NL + 1} ) = QRadSWwinAbs( SurfNum, {1,NL + 1} );
 		//  Solve energy balance(s) for temperature at each node/layer and
 		//  heat flux, including components, between each pair of nodes/layers
-		ASHWAT_ThermalR = ASHWAT_Thermal( CFS( EQLNum ), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC );
+		ASHWAT_ThermalR = ASHWAT_Thermal( CFS( EQLNum ), TIN, Tout, HcIn, HcOut, TRMOUT, TRMIN, 0.0, QAllSWwinAbs( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, UCG, SHGC, Work );
 		// long wave radiant power to room not including reflected
 		QRLWX = JB( NL ) - ( 1.0 - LWAbsIn ) * JF( NL + 1 );
 		// nominal surface temp = effective radiant temperature
@@ -4860,6 +4862,7 @@ namespace WindowEquivalentLayer {
 		FArray1A< Real64 > HC, // returned: gap convective heat transfer coefficient, W/m2K
 		Real64 & UCG, // returned: center-glass U-factor, W/m2-K
 		Real64 & SHGC, // returned: center-glass SHGC (Solar Heat Gain Coefficient)
+		EQLThermalWorkspace & Work, // scratch arrays of the layer solve
 		Optional_bool_const HCInFlag // If true uses ISO Std 150099 routine for HCIn calc
 	)
 	{
@@ -4928,13 +4931,13 @@ namespace WindowEquivalentLayer {
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 ALPHA;
 		Real64 HCOCFout;
-		FArray2D< Real64 > A( 3*FS.NL+2, 3*FS.NL+4 );
-		FArray1D< Real64 > XSOL( 3*FS.NL+2 );
+		FArray2D< Real64 > & A( Work.A );
+		FArray1D< Real64 > & XSOL( Work.XSOL );
 		Real64 MAXERR;
-		FArray1D< Real64 > TNEW( FS.NL ); // latest estimate of layer temperatures, K
-		FArray1D< Real64 > EB( {0,FS.NL+1} ); // black emissive power by layer, W/m2
+		FArray1D< Real64 > & TNEW( Work.TNEW ); // latest estimate of layer temperatures, K
+		FArray1D< Real64 > & EB( Work.EB ); // black emissive power by layer, W/m2
 		//   EB( 0) = outdoor environment, EB( NL+1) = indoor environment
-		FArray1D< Real64 > HHAT( {0,FS.NL} ); // convective heat transfer coefficient (W/m2.K4)
+		FArray1D< Real64 > & HHAT( Work.HHAT ); // convective heat transfer coefficient (W/m2.K4)
 		//   based on EB, NOT temperature difference
 		Real64 RHOF_ROOM; // effective longwave room-side properties
 		Real64 TAU_ROOM;
@@ -4942,7 +4945,7 @@ namespace WindowEquivalentLayer {
 		Real64 RHOB_OUT; // effective longwave outdoor environment properties
 		Real64 TAU_OUT;
 		Real64 EPSB_OUT;
-		FArray1D< Real64 > QNET( FS.NL ); // checksum - net heat flux to a layer - should be zero - not needed
+		FArray1D< Real64 > & QNET( Work.QNET ); // checksum - net heat flux to a layer - should be zero - not needed
 		int ADIM; // dimension of the A matrix
 		int CONVRG;
 		int NL;
@@ -4951,38 +4954,38 @@ namespace WindowEquivalentLayer {
 		int L;
 		int ITRY;
 		int hin_scheme; // flags different schemes for indoor convection coefficients
-		FArray1D_int ISDL( {0,FS.NL+1} ); // Flag to mark diathermanous layers, 0=opaque
+		FArray1D_int & ISDL( Work.ISDL ); // Flag to mark diathermanous layers, 0=opaque
 		int NDLIAR; // Number of Diathermanous Layers In A Row (i.e., consecutive)
 		int IB; // Counter begin and end limits
 		int IE;
 		int IDV; // Integer dummy variable, general utility
 		int IM_ON; // Turns on calculation of Indices of Merit if IM_ON=1
-		FArray1D< Real64 > QOCF_F( FS.NL ); // heat flux to outdoor-facing surface of layer i, from gap i-1,
+		FArray1D< Real64 > & QOCF_F( Work.QOCF_F ); // heat flux to outdoor-facing surface of layer i, from gap i-1,
 		//   due to open channel flow, W/m2
-		FArray1D< Real64 > QOCF_B( FS.NL ); // heat flux to indoor-facing surface of layer i, from gap i,
+		FArray1D< Real64 > & QOCF_B( Work.QOCF_B ); // heat flux to indoor-facing surface of layer i, from gap i,
 		//   due to open channel flow, W/m2
 		Real64 Rvalue; // R-value in IP units [hr.ft2.F/BTU]
 		Real64 TAE_IN; // Indoor and outdoor effective ambient temperatures [K]
 		Real64 TAE_OUT;
-		FArray1D< Real64 > HR( {0,FS.NL} ); // Radiant heat transfer coefficient [W/m2K]
-		FArray1D< Real64 > HJR( FS.NL ); // radiative and convective jump heat transfer coefficients
-		FArray1D< Real64 > HJC( FS.NL );
+		FArray1D< Real64 > & HR( Work.HR ); // Radiant heat transfer coefficient [W/m2K]
+		FArray1D< Real64 > & HJR( Work.HJR ); // radiative and convective jump heat transfer coefficients
+		FArray1D< Real64 > & HJC( Work.HJC );
 		Real64 FHR_OUT; // hre/(hre+hce) fraction radiant h, outdoor or indoor, used for TAE
 		Real64 FHR_IN;
 		Real64 Q_IN; // net gain to the room [W/m2], including transmitted solar
-		FArray1D< Real64 > RHOF( {0,FS.NL+1} ); // longwave reflectance, front    !  these variables help simplify
-		FArray1D< Real64 > RHOB( {0,FS.NL+1} ); // longwave reflectance, back     !  the code because it is useful to
-		FArray1D< Real64 > EPSF( {0,FS.NL+1} ); // longwave emisivity,   front    !  increase the scope of the arrays
-		FArray1D< Real64 > EPSB( {0,FS.NL+1} ); // longwave emisivity,   back     !  to include indoor and outdoor
-		FArray1D< Real64 > TAU( {0,FS.NL+1} ); // longwave transmittance         !  nodes - more general
+		FArray1D< Real64 > & RHOF( Work.RHOF ); // longwave reflectance, front    !  these variables help simplify
+		FArray1D< Real64 > & RHOB( Work.RHOB ); // longwave reflectance, back     !  the code because it is useful to
+		FArray1D< Real64 > & EPSF( Work.EPSF ); // longwave emisivity,   front    !  increase the scope of the arrays
+		FArray1D< Real64 > & EPSB( Work.EPSB ); // longwave emisivity,   back     !  to include indoor and outdoor
+		FArray1D< Real64 > & TAU( Work.TAU ); // longwave transmittance         !  nodes - more general
 		Real64 RTOT; // total resistance from TAE_OUT to TAE_IN [m2K/W]
-		FArray2D< Real64 > HC2D( 6, 6 ); // convective heat transfer coefficients between layers i and j
-		FArray2D< Real64 > HR2D( 6, 6 ); // radiant heat transfer coefficients between layers i and j
-		FArray1D< Real64 > HCIout( 6 ); // convective and radiant heat transfer coefficients between
-		FArray1D< Real64 > HRIout( 6 );
+		FArray2D< Real64 > & HC2D( Work.HC2D ); // convective heat transfer coefficients between layers i and j
+		FArray2D< Real64 > & HR2D( Work.HR2D ); // radiant heat transfer coefficients between layers i and j
+		FArray1D< Real64 > & HCIout( Work.HCIout ); // convective and radiant heat transfer coefficients between
+		FArray1D< Real64 > & HRIout( Work.HRIout );
 		// layer i and outdoor air or mean radiant temperature, resp.
-		FArray1D< Real64 > HCIin( 6 ); // convective and radiant heat transfer coefficients between
-		FArray1D< Real64 > HRIin( 6 );
+		FArray1D< Real64 > & HCIin( Work.HCIin ); // convective and radiant heat transfer coefficients between
+		FArray1D< Real64 > & HRIin( Work.HRIin );
 		// layer i and indoor air or mean radiant temperature, resp.
 		Real64 HCinout; // convective and radiant heat transfer coefficients between
 		Real64 HRinout;
@@ -5000,7 +5003,7 @@ namespace WindowEquivalentLayer {
 		Real64 TOUTdv;
 		Real64 TRMINdv; // for boundary conditions in calculating
 		Real64 TRMOUTdv;
-		FArray1D< Real64 > SOURCEdv( FS.NL+1 ); // indices of merit
+		FArray1D< Real64 > & SOURCEdv( Work.SOURCEdv ); // indices of merit
 		Real64 SUMERR; // error summation used to check validity of code/model
 		Real64 QGAIN; // total gain to conditioned space [[W/m2]
 		Real64 SaveHCNLm; // place to save HC(NL-1) - two resistance networks differ
@@ -5008,6 +5011,24 @@ namespace WindowEquivalentLayer {
 		// in their definitions of these heat transfer coefficients
 		bool DoPrint; // set true to print debugging info
 		// Flow
+		A.dimension( 3*FS.NL+2, 3*FS.NL+4 );
+		XSOL.dimension( 3*FS.NL+2 );
+		TNEW.dimension( FS.NL );
+		EB.dimension( {0,FS.NL+1} );
+		HHAT.dimension( {0,FS.NL} );
+		QNET.dimension( FS.NL );
+		ISDL.dimension( {0,FS.NL+1} );
+		QOCF_F.dimension( FS.NL );
+		QOCF_B.dimension( FS.NL );
+		HR.dimension( {0,FS.NL} );
+		HJR.dimension( FS.NL );
+		HJC.dimension( FS.NL );
+		RHOF.dimension( {0,FS.NL+1} );
+		RHOB.dimension( {0,FS.NL+1} );
+		EPSF.dimension( {0,FS.NL+1} );
+		EPSB.dimension( {0,FS.NL+1} );
+		TAU.dimension( {0,FS.NL+1} );
+		SOURCEdv.dimension( FS.NL+1 );
 
 		ASHWAT_Thermal = false; // init to failure
 		NL = FS.NL; // working copy
@@ -5408,15 +5429,15 @@ namespace WindowEquivalentLayer {
 			if ( ( ISDL( I ) == 0 ) && ( ISDL( I + 1 ) == 1 ) && ( ISDL( I + 2 ) == 0 ) ) {
 				if ( I == 0 ) { //  outdoor layer is diathermanous
 					if ( NL == 1 ) {
-						DL_RES_r2( TRMOUT, T( 1 ), TRMIN, RHOB( 0 ), RHOF( 1 ), RHOB( 1 ), TAU( 1 ), RHOF( 2 ), HJR( 1 ), HR( 0 ), HR( 1 ) );
+						DL_RES_r2( TRMOUT, T( 1 ), TRMIN, RHOB( 0 ), RHOF( 1 ), RHOB( 1 ), TAU( 1 ), RHOF( 2 ), HJR( 1 ), HR( 0 ), HR( 1 ), Work );
 					} else {
-						DL_RES_r2( TRMOUT, T( 1 ), T( 2 ), RHOB( 0 ), RHOF( 1 ), RHOB( 1 ), TAU( 1 ), RHOF( 2 ), HJR( 1 ), HR( 0 ), HR( 1 ) );
+						DL_RES_r2( TRMOUT, T( 1 ), T( 2 ), RHOB( 0 ), RHOF( 1 ), RHOB( 1 ), TAU( 1 ), RHOF( 2 ), HJR( 1 ), HR( 0 ), HR( 1 ), Work );
 					}
 				} else { //  with IF (I .EQ. 0)   i.e., i != 0
 					if ( I == NL - 1 ) { //  indoor layer is diathermanous
-						DL_RES_r2( T( NL - 1 ), T( NL ), TRMIN, RHOB( NL - 1 ), RHOF( NL ), RHOB( NL ), TAU( NL ), RHOF( NL + 1 ), HJR( NL ), HR( NL - 1 ), HR( NL ) );
+						DL_RES_r2( T( NL - 1 ), T( NL ), TRMIN, RHOB( NL - 1 ), RHOF( NL ), RHOB( NL ), TAU( NL ), RHOF( NL + 1 ), HJR( NL ), HR( NL - 1 ), HR( NL ), Work );
 					} else { // some intermediate layer is diathermanous
-						DL_RES_r2( T( I ), T( I + 1 ), T( I + 2 ), RHOB( I ), RHOF( I + 1 ), RHOB( I + 1 ), TAU( I + 1 ), RHOF( I + 2 ), HJR( I + 1 ), HR( I ), HR( I + 1 ) );
+						DL_RES_r2( T( I ), T( I + 1 ), T( I + 2 ), RHOB( I ), RHOF( I + 1 ), RHOB( I + 1 ), TAU( I + 1 ), RHOF( I + 2 ), HJR( I + 1 ), HR( I ), HR( I + 1 ), Work );
 					} //   end of IF/ELSE (I .EQ. NL-1)
 				} //  end of IF/ELSE (I .EQ. 0)
 			} //  end of IF(ISDL(I) .EQ. 0) .AND. .....
@@ -5800,7 +5821,8 @@ namespace WindowEquivalentLayer {
 		Real64 const rhom, // reflectance of the room, {-}
 		Real64 & hr_gm, // heat transfer coefficient between left and right surface {W/m2K}
 		Real64 & hr_gd, // heat transfer coefficient between left and middle surface {W/m2K}
-		Real64 & hr_md // heat transfer coefficient between right and middle surface {W/m2K}
+		Real64 & hr_md, // heat transfer coefficient between right and middle surface {W/m2K}
+		EQLThermalWorkspace & Work // scratch arrays of the layer solve
 	)
 	{
 		// SUBROUTINE INFORMATION:
@@ -5846,8 +5868,8 @@ namespace WindowEquivalentLayer {
 		Real64 Epsdf;
 		Real64 Epsdb;
 		Real64 Epsm;
-		FArray2D< Real64 > A( 20, 22 );
-		FArray1D< Real64 > X( 20 );
+		FArray2D< Real64 > & A( Work.ADL );
+		FArray1D< Real64 > & X( Work.XDL );
 		// real FSg_g, FSdf_g, FSdb_g, FSm_g
 		Real64 FSg_df;
 		Real64 FSdf_df;
@@ -6697,6 +6719,7 @@ namespace WindowEquivalentLayer {
 		FArray1D< Real64 > Q( {0,FS.NL} );
 		FArray1D< Real64 > H( {0,FS.NL+1} );
 		FArray1D< Real64 > SOURCE( FS.NL+1 );
+		EQLThermalWorkspace Work; // scratch arrays of the layer solve
 		Real64 ISOL;
 		Real64 UX;
 		Real64 SHGC;
@@ -6720,7 +6743,7 @@ namespace WindowEquivalentLayer {
 		ISOL = 0.0; // no solar winter condition
 		SOURCE = 0.0;
 
-		CFSUFactor = ASHWAT_Thermal( FS, TIABS, TOABS, HCIN, HCOUT, TRMOUT, TRMIN, ISOL, SOURCE( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, U, SHGC, true );
+		CFSUFactor = ASHWAT_Thermal( FS, TIABS, TOABS, HCIN, HCOUT, TRMOUT, TRMIN, ISOL, SOURCE( {1,NL+1} ), TOL, QOCF, QOCFRoom, T, Q, JF, JB, H, U, SHGC, Work, true );
 		if ( ! CFSUFactor ) return CFSUFactor;
 		CFSUFactor = true;
 		return CFSUFactor;
@@ -6,8 +6,10 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
+#include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray1S.hh>
 #include <ObjexxFCL/FArray2A.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/FArray2S.hh>
 #include <ObjexxFCL/FArray3D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -46,6 +48,69 @@ namespace WindowEquivalentLayer {
 	extern FArray3D< Real64 > CFSDiffAbsTrans;
 	extern FArray1D_bool EQLDiffPropFlag;
 
+	// Types
+
+	struct EQLThermalWorkspace // scratch arrays of the heat balance of one equivalent layer window
+	{
+		// Members
+		// EQLWindowSurfaceHeatBalance: results of ASHWAT_Thermal
+		FArray1D< Real64 > QOCF; // heat flux to layer i from gaps i-1 and i, W/m2
+		FArray1D< Real64 > JB; // back (inside facing) radiosity, W/m2
+		FArray1D< Real64 > JF; // front (outside facing) radiosity, W/m2
+		FArray1D< Real64 > T; // layer temperatures, K
+		FArray1D< Real64 > Q; // heat flux at ith gap, W/m2
+		FArray1D< Real64 > H; // gap convective heat transfer coefficient, W/m2K
+		FArray1D< Real64 > QAllSWwinAbs; // absorbed short wave radiation by layer, W/m2
+		// ASHWAT_Thermal: dimensioned by the number of layers
+		FArray2D< Real64 > A; // system matrix
+		FArray1D< Real64 > XSOL; // solution vector
+		FArray1D< Real64 > TNEW; // latest estimate of layer temperatures, K
+		FArray1D< Real64 > EB; // black emissive power by layer, W/m2
+		FArray1D< Real64 > HHAT; // convective heat transfer coefficient (W/m2.K4)
+		FArray1D< Real64 > QNET; // net heat flux to a layer
+		FArray1D_int ISDL; // Flag to mark diathermanous layers, 0=opaque
+		FArray1D< Real64 > QOCF_F; // heat flux to outdoor-facing surface of layer i due to open channel flow, W/m2
+		FArray1D< Real64 > QOCF_B; // heat flux to indoor-facing surface of layer i due to open channel flow, W/m2
+		FArray1D< Real64 > HR; // Radiant heat transfer coefficient [W/m2K]
+		FArray1D< Real64 > HJR; // radiative jump heat transfer coefficient
+		FArray1D< Real64 > HJC; // convective jump heat transfer coefficient
+		FArray1D< Real64 > RHOF; // longwave reflectance, front
+		FArray1D< Real64 > RHOB; // longwave reflectance, back
+		FArray1D< Real64 > EPSF; // longwave emisivity, front
+		FArray1D< Real64 > EPSB; // longwave emisivity, back
+		FArray1D< Real64 > TAU; // longwave transmittance
+		FArray1D< Real64 > SOURCEdv; // indices of merit
+		FArray2D< Real64 > HC2D; // convective heat transfer coefficients between layers i and j
+		FArray2D< Real64 > HR2D; // radiant heat transfer coefficients between layers i and j
+		FArray1D< Real64 > HCIout; // convective heat transfer coefficients between layer i and outdoor air
+		FArray1D< Real64 > HRIout; // radiant heat transfer coefficients between layer i and outdoor
+		FArray1D< Real64 > HCIin; // convective heat transfer coefficients between layer i and indoor air
+		FArray1D< Real64 > HRIin; // radiant heat transfer coefficients between layer i and indoor
+		// DL_RES_r2: diathermanous layer radiosity system
+		FArray2D< Real64 > ADL;
+		FArray1D< Real64 > XDL;
+
+		// Default Constructor
+		EQLThermalWorkspace() :
+			QOCF( CFSMAXNL ),
+			JB( {0,CFSMAXNL} ),
+			JF( {1,CFSMAXNL+1} ),
+			T( CFSMAXNL ),
+			Q( {0,CFSMAXNL} ),
+			H( {0,CFSMAXNL+1} ),
+			QAllSWwinAbs( {1,CFSMAXNL+1} ),
+			HC2D( 6, 6 ),
+			HR2D( 6, 6 ),
+			HCIout( 6 ),
+			HRIout( 6 ),
+			HCIin( 6 ),
+			HRIin( 6 ),
+			ADL( 20, 22 ),
+			XDL( 20 )
+		{}
+
+	};
+
 	// MODULE SUBROUTINES:
 	// Initialization routines for module
 
@@ -91,7 +156,8 @@ namespace WindowEquivalentLayer {
 		Real64 & SurfInsideTemp, // Inside window surface temperature (innermost face) [C]
 		Real64 & SurfOutsideTemp, // Outside surface temperature (C)
 		Real64 & SurfOutsideEmiss,
-		int const CalcCondition // Calucation condition (summer, winter or no condition)
+		int const CalcCondition, // Calucation condition (summer, winter or no condition)
+		EQLThermalWorkspace & Work // scratch arrays of the heat balance
 	);
 
 	void
@@ -501,6 +567,7 @@ namespace WindowEquivalentLayer {
 		FArray1A< Real64 > HC, // returned: gap convective heat transfer coefficient, W/m2K
 		Real64 & UCG, // returned: center-glass U-factor, W/m2-K
 		Real64 & SHGC, // returned: center-glass SHGC (Solar Heat Gain Coefficient)
+		EQLThermalWorkspace & Work, // scratch arrays of the layer solve
 		Optional_bool_const HCInFlag = _ // If true uses ISO Std 150099 routine for HCIn calc
 	);
 
@@ -516,7 +583,8 @@ namespace WindowEquivalentLayer {
 		Real64 const rhom, // reflectance of the room, {-}
 		Real64 & hr_gm, // heat transfer coefficient between left and right surface {W/m2K}
 		Real64 & hr_gd, // heat transfer coefficient between left and middle surface {W/m2K}
-		Real64 & hr_md // heat transfer coefficient between right and middle surface {W/m2K}
+		Real64 & hr_md, // heat transfer coefficient between right and middle surface {W/m2K}
+		EQLThermalWorkspace & Work // scratch arrays of the layer solve
 	);
 
 	void
@@ -105,38 +105,8 @@ namespace WindowManager {
 
 	// MODULE VARIABLE DECLARATIONS:
 
-	int ngllayer; // Number of glass layers
-	int nglface; // Number of glass faces
-	int nglfacep; // Number of glass faces, + 2 if shade layer present
-	Real64 tout; // Outside air temperature (K)
-	Real64 tin; // Inside air temperature (previous timestep) (K)
-	Real64 tilt; // Window tilt (deg)
-	Real64 tiltr; // Window tilt (radians)
-	Real64 hcin; // Convective inside air film conductance (W/m2-K)
-	Real64 hcout; // Convective outside air film conductance (W/m2-K)
-	Real64 Ebout; // Sigma*(outside air temp)**4 (W/m2)
-	Real64 Outir; // IR radiance of window's exterior surround (W/m2)
-	Real64 Rmir; // IR radiance of window's interior surround (W/m2)
-	Real64 Rtot; // Total thermal resistance of window (m2-K/W)
-	FArray3D< Real64 > gcon( 5, 5, 3, 0.0 ); // Gas thermal conductivity coefficients for each gap
-	FArray3D< Real64 > gvis( 5, 5, 3, 0.0 ); // Gas viscosity coefficients for each gap
-	FArray3D< Real64 > gcp( 5, 5, 3, 0.0 ); // Gas specific-heat coefficients for each gap
-	FArray2D< Real64 > gwght( 5, 5, 0.0 ); // Gas molecular weights for each gap
-	FArray2D< Real64 > gfract( 5, 5, 0.0 ); // Gas fractions for each gap
-	FArray1D_int gnmix( 5, 0 ); // Number of gases in gap
-	FArray1D< Real64 > gap( 5, 0.0 ); // Gap width (m)
-	FArray1D< Real64 > thick( 5, 0.0 ); // Glass layer thickness (m)
-	FArray1D< Real64 > scon( 5, 0.0 ); // Glass layer conductance--conductivity/thickness (W/m2-K)
-	FArray1D< Real64 > tir( 10, 0.0 ); // Front and back IR transmittance for each glass layer
-	FArray1D< Real64 > emis( 10, 0.0 ); // Front and back IR emissivity for each glass layer
 	FArray1D< Real64 > rir( 10, 0.0 ); // Front and back IR reflectance for each glass layer
 	//  (program calculates from tir and emis)
-	FArray1D< Real64 > AbsRadGlassFace( 10, 0.0 ); // Solar radiation and IR radiation from internal
-	//  gains absorbed by glass face
-	FArray1D< Real64 > thetas( 10, 0.0 ); // Glass surface temperatures (K)
-	FArray1D< Real64 > thetasPrev( 10, 0.0 ); // Previous-iteration glass surface temperatures (K)
-	FArray1D< Real64 > fvec( 10, 0.0 ); // Glass face heat balance function
-	FArray2D< Real64 > fjac( 10, 10, 0.0 ); // Glass face heat balance Jacobian
 	FArray1D< Real64 > dtheta( 5, 0.0 ); // Glass layer temperature difference factor [K]
 	FArray2D< Real64 > zir( 10, 10, 0.0 ); // IR transfer matrix
 	FArray2D< Real64 > ziri( 10, 10, 0.0 ); // Inverse of IR transfer matrix
@@ -150,21 +120,11 @@ namespace WindowManager {
 	FArray1D< Real64 > sour( 10, 0.0 ); // IR source term at each face [W/m2]
 	FArray1D< Real64 > delta( 5, 0.0 ); // Residual at each glass layer [W/m2]
 	FArray1D< Real64 > hcgap( 5, 0.0 ); // Convective gap conductance
-	FArray1D< Real64 > hrgap( 5, 0.0 ); // Radiative gap conductance
 	FArray1D< Real64 > rgap( 6, 0.0 ); // Convective plus radiative gap resistance
 	//   (inverse of hcgap + hrgap)
 	FArray1D< Real64 > rs( 6, 0.0 ); // Outside film convective resistance, gap resistances,
 	//   inside air film convective resistance
 	FArray1D< Real64 > arhs( 6, 0.0 );
-	Real64 A23P; // Intermediate variables in glass face
-	Real64 A32P;
-	Real64 A45P;
-	Real64 A54P;
-	Real64 A67P;
-	Real64 A76P;
-	Real64 A23; // heat balance equations
-	Real64 A45;
-	Real64 A67;
 
 	FArray2D< Real64 > wlt( MaxSpectralDataElements, 5, 0.0 ); // Spectral data wavelengths for each glass layer in a glazing system
 	// Following data, Spectral data for each layer for each wavelength in wlt
@@ -201,6 +161,9 @@ namespace WindowManager {
 	FArray1D< Real64 > rbvisPhi( 10, 0.0 ); // Glazing system visible back reflectance for each angle of incidence
 	FArray1D< Real64 > CosPhiIndepVar( 10, 0.0 ); // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Object Data
+	WindowThermalWorkspace WindowHeatBalanceWork; // glazing system state of the surface heat balance, used by one window after another
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -1957,7 +1920,8 @@ namespace WindowManager {
 		int const SurfNum, // Surface number
 		Real64 const HextConvCoeff, // Outside air film conductance coefficient
 		Real64 & SurfInsideTemp, // Inside window surface temperature
-		Real64 & SurfOutsideTemp // Outside surface temperature (C)
+		Real64 & SurfOutsideTemp, // Outside surface temperature (C)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -2034,6 +1998,43 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int & ngllayer( Work.ngllayer );
+		int & nglface( Work.nglface );
+		int & nglfacep( Work.nglfacep );
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		Real64 & tilt( Work.tilt );
+		Real64 & tiltr( Work.tiltr );
+		Real64 & hcin( Work.hcin );
+		Real64 & hcout( Work.hcout );
+		Real64 & Ebout( Work.Ebout );
+		Real64 & Outir( Work.Outir );
+		Real64 & Rmir( Work.Rmir );
+		FArray3D< Real64 > & gcon( Work.gcon );
+		FArray3D< Real64 > & gvis( Work.gvis );
+		FArray3D< Real64 > & gcp( Work.gcp );
+		FArray2D< Real64 > & gwght( Work.gwght );
+		FArray2D< Real64 > & gfract( Work.gfract );
+		FArray1D_int & gnmix( Work.gnmix );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & thick( Work.thick );
+		FArray1D< Real64 > & scon( Work.scon );
+		FArray1D< Real64 > & tir( Work.tir );
+		FArray1D< Real64 > & emis( Work.emis );
+		FArray1D< Real64 > & AbsRadGlassFace( Work.AbsRadGlassFace );
+		FArray1D< Real64 > & thetas( Work.thetas );
+		FArray1D< Real64 > & thetasPrev( Work.thetasPrev );
+		FArray1D< Real64 > & fvec( Work.fvec );
+		FArray2D< Real64 > & fjac( Work.fjac );
+		Real64 & A23P( Work.A23P );
+		Real64 & A32P( Work.A32P );
+		Real64 & A45P( Work.A45P );
+		Real64 & A54P( Work.A54P );
+		Real64 & A67P( Work.A67P );
+		Real64 & A76P( Work.A76P );
+		Real64 & A23( Work.A23 );
+		Real64 & A45( Work.A45 );
+		Real64 & A67( Work.A67 );
 
 		int ZoneNum; // Zone number corresponding to SurfNum
 		int BlNum; // Window blind number
@@ -2105,7 +2106,7 @@ namespace WindowManager {
 			temp = 0;
 
 			//Simon: Complex fenestration state works only with tarcog
-			CalcComplexWindowThermal( SurfNum, temp, HextConvCoeff, SurfInsideTemp, SurfOutsideTemp, SurfOutsideEmiss, noCondition );
+			CalcComplexWindowThermal( SurfNum, temp, HextConvCoeff, SurfInsideTemp, SurfOutsideTemp, SurfOutsideEmiss, noCondition, Work.TARCOG );
 
 			ConstrNum = surface.Construction;
 			TotGlassLay = Construct( ConstrNum ).TotGlassLayers;
@@ -2130,7 +2131,7 @@ namespace WindowManager {
 
 		} else if ( window.WindowModelType == WindowEQLModel ) {
 
-			EQLWindowSurfaceHeatBalance( SurfNum, HextConvCoeff, SurfInsideTemp, SurfOutsideTemp, SurfOutsideEmiss, noCondition );
+			EQLWindowSurfaceHeatBalance( SurfNum, HextConvCoeff, SurfInsideTemp, SurfOutsideTemp, SurfOutsideEmiss, noCondition, Work.EQL );
 			hcout = HextConvCoeff;
 			// Required for report variables calculations.
 			if ( surface.ExtWind ) { // Window is exposed to wind (and possibly rain)
@@ -2507,7 +2508,7 @@ namespace WindowManager {
 
 			// Calculate window face temperatures
 
-			SolveForWindowTemperatures( SurfNum );
+			SolveForWindowTemperatures( SurfNum, Work );
 
 			// Temperature difference across glass layers (for debugging)
 
@@ -2593,7 +2594,10 @@ namespace WindowManager {
 	//****************************************************************************
 
 	void
-	WindowHeatBalanceEquations( int const SurfNum ) // Surface number
+	WindowHeatBalanceEquations(
+		int const SurfNum, // Surface number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
+	)
 	{
 
 		// SUBROUTINE INFORMATION:
@@ -2615,6 +2619,22 @@ namespace WindowManager {
 
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int & ngllayer( Work.ngllayer );
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		Real64 & hcin( Work.hcin );
+		Real64 & hcout( Work.hcout );
+		Real64 & Outir( Work.Outir );
+		Real64 & Rmir( Work.Rmir );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & scon( Work.scon );
+		FArray1D< Real64 > & emis( Work.emis );
+		FArray1D< Real64 > & AbsRadGlassFace( Work.AbsRadGlassFace );
+		FArray1D< Real64 > & thetas( Work.thetas );
+		FArray1D< Real64 > & fvec( Work.fvec );
+		Real64 & A23( Work.A23 );
+		Real64 & A45( Work.A45 );
+		Real64 & A67( Work.A67 );
 
 		FArray1D< Real64 > hgap( 5 ); // Gap gas conductance
 		Real64 gr; // Gap gas Grashof number
@@ -2635,8 +2655,8 @@ namespace WindowManager {
 			fvec( 2 ) = Rmir * emis( 2 ) - emis( 2 ) * sigma * pow_4( thetas( 2 ) ) + scon( 1 ) * ( thetas( 1 ) - thetas( 2 ) ) + hcin * ( tin - thetas( 2 ) ) + AbsRadGlassFace( 2 );
 
 		} else if ( SELECT_CASE_var == 2 ) { // double pane
-			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 			hgap( 1 ) = ( con / gap( 1 ) * nu ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
 
 			fvec( 1 ) = Outir * emis( 1 ) - emis( 1 ) * sigma * pow_4( thetas( 1 ) ) + scon( 1 ) * ( thetas( 2 ) - thetas( 1 ) ) + hcout * ( tout - thetas( 1 ) ) + AbsRadGlassFace( 1 );
@@ -2646,12 +2666,12 @@ namespace WindowManager {
 			fvec( 4 ) = Rmir * emis( 4 ) - emis( 4 ) * sigma * pow_4( thetas( 4 ) ) + scon( 2 ) * ( thetas( 3 ) - thetas( 4 ) ) + hcin * ( tin - thetas( 4 ) ) + AbsRadGlassFace( 4 );
 
 		} else if ( SELECT_CASE_var == 3 ) { // Triple Pane
-			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 			hgap( 1 ) = con / gap( 1 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
 
-			WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
+			WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr, Work );
+			NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu, Work );
 			hgap( 2 ) = con / gap( 2 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
 
 			Real64 const thetas_2_3_4( pow_4( thetas( 2 ) ) - pow_4( thetas( 3 ) ) );
@@ -2664,16 +2684,16 @@ namespace WindowManager {
 			fvec( 6 ) = Rmir * emis( 6 ) - emis( 6 ) * sigma * pow_4( thetas( 6 ) ) + scon( 3 ) * ( thetas( 5 ) - thetas( 6 ) ) + hcin * ( tin - thetas( 6 ) ) + AbsRadGlassFace( 6 );
 
 		} else if ( SELECT_CASE_var == 4 ) { // Quad Pane
-			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+			WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+			NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 			hgap( 1 ) = con / gap( 1 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
 
-			WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
+			WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr, Work );
+			NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu, Work );
 			hgap( 2 ) = con / gap( 2 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
 
-			WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr );
-			NusseltNumber( SurfNum, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu );
+			WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr, Work );
+			NusseltNumber( SurfNum, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu, Work );
 			hgap( 3 ) = con / gap( 3 ) * nu * SurfaceWindow( SurfNum ).EdgeGlCorrFac;
 
 			Real64 const thetas_2_3_4( pow_4( thetas( 2 ) ) - pow_4( thetas( 3 ) ) );
@@ -2694,7 +2714,10 @@ namespace WindowManager {
 	//****************************************************************************
 
 	void
-	SolveForWindowTemperatures( int const SurfNum ) // Surface number
+	SolveForWindowTemperatures(
+		int const SurfNum, // Surface number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
+	)
 	{
 
 		// SUBROUTINE INFORMATION:
@@ -2786,6 +2809,32 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int & ngllayer( Work.ngllayer );
+		int & nglface( Work.nglface );
+		int & nglfacep( Work.nglfacep );
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		Real64 & hcin( Work.hcin );
+		Real64 & hcout( Work.hcout );
+		Real64 & Outir( Work.Outir );
+		Real64 & Rmir( Work.Rmir );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & scon( Work.scon );
+		FArray1D< Real64 > & tir( Work.tir );
+		FArray1D< Real64 > & emis( Work.emis );
+		FArray1D< Real64 > & AbsRadGlassFace( Work.AbsRadGlassFace );
+		FArray1D< Real64 > & thetas( Work.thetas );
+		FArray1D< Real64 > & thetasPrev( Work.thetasPrev );
+		FArray1D< Real64 > & hrgap( Work.hrgap );
+		Real64 & A23P( Work.A23P );
+		Real64 & A32P( Work.A32P );
+		Real64 & A45P( Work.A45P );
+		Real64 & A54P( Work.A54P );
+		Real64 & A67P( Work.A67P );
+		Real64 & A76P( Work.A76P );
+		Real64 & A23( Work.A23 );
+		Real64 & A45( Work.A45 );
+		Real64 & A67( Work.A67 );
 
 		int ZoneNum; // Zone number corresponding to SurfNum
 		int i; // Counter
@@ -2910,7 +2959,7 @@ namespace WindowManager {
 
 		// Initialize face temperatures.
 
-		StartingWindowTemps( SurfNum, AbsRadShadeFace );
+		StartingWindowTemps( SurfNum, AbsRadShadeFace, Work );
 
 		hcvPrev = 0.0;
 		VGapPrev = 0.0;
@@ -2950,7 +2999,7 @@ namespace WindowManager {
 			// effective gap air temperature, velocity of air in gap and gap outlet temperature.
 
 			if ( ShadeFlag == IntShadeOn || ShadeFlag == ExtShadeOn || ShadeFlag == IntBlindOn || ShadeFlag == ExtBlindOn || ShadeFlag == ExtScreenOn ) {
-				ExtOrIntShadeNaturalFlow( SurfNum, iter, VGap, TGapNew, TGapOutlet, hcv, ConvHeatFlowNatural );
+				ExtOrIntShadeNaturalFlow( SurfNum, iter, VGap, TGapNew, TGapOutlet, hcv, ConvHeatFlowNatural, Work );
 				if ( iter >= 1 ) {
 					hcv = 0.5 * ( hcvPrev + hcv );
 					VGap = 0.5 * ( VGapPrev + VGap );
@@ -2966,7 +3015,7 @@ namespace WindowManager {
 			// convective heat flow from gap.
 
 			if ( ShadeFlag != BGShadeOn && ShadeFlag != BGBlindOn && SurfaceWindow( SurfNum ).AirflowThisTS > 0.0 ) {
-				BetweenGlassForcedFlow( SurfNum, iter, VAirflowGap, TAirflowGapNew, TAirflowGapOutlet, hcvAirflowGap, ConvHeatFlowForced );
+				BetweenGlassForcedFlow( SurfNum, iter, VAirflowGap, TAirflowGapNew, TAirflowGapOutlet, hcvAirflowGap, ConvHeatFlowForced, Work );
 			}
 
 			// If between-glass shade or blind is present, get convective heat transfer
@@ -2976,9 +3025,9 @@ namespace WindowManager {
 
 			if ( ShadeFlag == BGShadeOn || ShadeFlag == BGBlindOn ) {
 				if ( SurfaceWindow( SurfNum ).AirflowThisTS == 0.0 ) { // Natural convection in gaps
-					BetweenGlassShadeNaturalFlow( SurfNum, iter, VGap, TGapNewBG, hcvBG );
+					BetweenGlassShadeNaturalFlow( SurfNum, iter, VGap, TGapNewBG, hcvBG, Work );
 				} else { // Forced convection in gaps
-					BetweenGlassShadeForcedFlow( SurfNum, iter, VGap, TGapNewBG, TAirflowGapOutlet, hcvBG, ConvHeatFlowForced );
+					BetweenGlassShadeForcedFlow( SurfNum, iter, VGap, TGapNewBG, TAirflowGapOutlet, hcvBG, ConvHeatFlowForced, Work );
 				}
 			}
 
@@ -3026,8 +3075,8 @@ namespace WindowManager {
 				}
 
 			} else if ( SELECT_CASE_var == 2 ) {
-				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 				hgap( 1 ) = con / gap( 1 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 1 ) = 0.5 * std::abs( A23 ) * pow_3( thetas( 2 ) + thetas( 3 ) );
@@ -3126,16 +3175,16 @@ namespace WindowManager {
 				}
 
 			} else if ( SELECT_CASE_var == 3 ) {
-				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 				hgap( 1 ) = con / gap( 1 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 1 ) = 0.5 * std::abs( A23 ) * pow_3( thetas( 2 ) + thetas( 3 ) );
 					hgap( 1 ) = hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
-				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-				NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
+				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr, Work );
+				NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu, Work );
 				hgap( 2 ) = con / gap( 2 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 2 ) = 0.5 * std::abs( A45 ) * pow_3( thetas( 4 ) + thetas( 5 ) );
@@ -3244,24 +3293,24 @@ namespace WindowManager {
 				}
 
 			} else if ( SELECT_CASE_var == 4 ) {
-				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 				hgap( 1 ) = con / gap( 1 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 1 ) = 0.5 * std::abs( A23 ) * pow_3( thetas( 2 ) + thetas( 3 ) );
 					hgap( 1 ) = hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
-				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-				NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
+				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr, Work );
+				NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu, Work );
 				hgap( 2 ) = con / gap( 2 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 2 ) = 0.5 * std::abs( A45 ) * pow_3( thetas( 4 ) + thetas( 5 ) );
 					hgap( 2 ) = hgap( 2 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 2 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
-				WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr );
-				NusseltNumber( SurfNum, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu );
+				WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr, Work );
+				NusseltNumber( SurfNum, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu, Work );
 				hgap( 3 ) = con / gap( 3 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 3 ) = 0.5 * std::abs( A67 ) * pow_3( thetas( 6 ) + thetas( 7 ) );
@@ -3503,7 +3552,8 @@ namespace WindowManager {
 		Real64 & TGapNew, // Current-iteration average air temp in glass-shade/blind gap (K)
 		Real64 & TGapOutlet, // Temperature of air leaving glass-shade/blind gap at top for upward
 		Real64 & hcv, // Convection coefficient from gap glass or shade to gap air (W/m2-K)
-		Real64 & QConvGap // Convective heat gain from glass-shade/blind gap for interior shade (W)
+		Real64 & QConvGap, // Convective heat gain from glass-shade/blind gap for interior shade (W)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -3542,6 +3592,10 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & thetas( Work.thetas );
 
 		int ConstrNumSh; // Shaded construction number
 		int MatNumSh; // Material number of shade/blind layer
@@ -3615,8 +3669,8 @@ namespace WindowManager {
 		}
 
 		// Conductance of gap between glass and shade assuming gap is sealed
-		WindowGasConductance( TGlassFace, TShadeFace, TotGaps, con, pr, gr );
-		NusseltNumber( SurfNum, TGlassFace, TShadeFace, TotGaps, gr, pr, nu );
+		WindowGasConductance( TGlassFace, TShadeFace, TotGaps, con, pr, gr, Work );
+		NusseltNumber( SurfNum, TGlassFace, TShadeFace, TotGaps, gr, pr, nu, Work );
 		hGapStill = con / gap( TotGaps ) * nu;
 
 		// For near-horizontal windows (i.e., no more than 5 deg from horizontal) assume
@@ -3715,7 +3769,8 @@ namespace WindowManager {
 		int const iter, // Iteration number for glass heat balance calculation
 		Real64 & VGap, // Gas velocity in gaps (m/s)
 		FArray1A< Real64 > TGapNew, // Current-iteration average gas temp in gaps (K)
-		FArray1A< Real64 > hcv // Convection coefficient from gap glass or shade to gap gas (W/m2-K)
+		FArray1A< Real64 > hcv, // Convection coefficient from gap glass or shade to gap gas (W/m2-K)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -3761,6 +3816,8 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & thetas( Work.thetas );
 		int ConstrNumSh; // Shaded construction number
 		int MatNumSh; // Material number of shade/blind layer
 		int nglassfaces; // Number of glass faces in contruction
@@ -3833,8 +3890,8 @@ namespace WindowManager {
 				TGapOld( IGap ) = TGapNew( IGap );
 			}
 			// Conductance of gaps on either side of shade/blind assuming gaps are sealed
-			WindowGasConductance( TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, con, pr, gr );
-			NusseltNumber( SurfNum, TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, gr, pr, nu );
+			WindowGasConductance( TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, con, pr, gr, Work );
+			NusseltNumber( SurfNum, TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, gr, pr, nu, Work );
 			hGapStill( IGap ) = con / gap( IGap + IGapInc ) * nu;
 		}
 
@@ -3872,7 +3929,7 @@ namespace WindowManager {
 		}
 
 		for ( IGap = 1; IGap <= 2; ++IGap ) {
-			WindowGasPropertiesAtTemp( TGapOld( IGap ), IGap + IGapInc, RhoGas( IGap ), ViscGas( IGap ) );
+			WindowGasPropertiesAtTemp( TGapOld( IGap ), IGap + IGapInc, RhoGas( IGap ), ViscGas( IGap ), Work );
 		}
 
 		BVGap = 12.0 * ( ViscGas( 1 ) + ViscGas( 2 ) ) * GapHeight / pow_2( GapDepth );
@@ -3891,7 +3948,7 @@ namespace WindowManager {
 		Zinlet = pow_2( AGap / ( 0.6 * AEqInlet + 0.000001 ) - 1.0 );
 		Zoutlet = pow_2( AGap / ( 0.6 * AEqOutlet + 0.000001 ) - 1.0 );
 		AVGap = 0.5 * ( RhoGas( 1 ) + RhoGas( 2 ) ) * ( 1.0 + Zinlet + Zoutlet );
-		WindowGasPropertiesAtTemp( TKelvin, 1 + IGapInc, RhoGasZero, ViscGasZero );
+		WindowGasPropertiesAtTemp( TKelvin, 1 + IGapInc, RhoGasZero, ViscGasZero, Work );
 		RhoTRef = RhoGasZero * TKelvin;
 		CVGap = RhoTRef * 9.81 * GapHeight * Surface( SurfNum ).SinTilt * ( TGapOld( 1 ) - TGapOld( 2 ) ) / ( TGapOld( 1 ) * TGapOld( 2 ) );
 
@@ -3928,7 +3985,8 @@ namespace WindowManager {
 		Real64 & TGapNew, // Current-iteration average air temp in airflow gap (K)
 		Real64 & TGapOutlet, // Temperature of air leaving glass-shade/blind gap at top for upward
 		Real64 & hcv, // Convection coefficient from gap glass faces to gap air (W/m2-K)
-		Real64 & QConvGap // Convective heat gain from air flow gap (W)
+		Real64 & QConvGap, // Convective heat gain from air flow gap (W)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -3973,6 +4031,10 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & thetas( Work.thetas );
 		int ConstrNum; // Construction number of surface
 		int NGlass; // Number of glass layers in construction
 		int GapNum; // Number of airflow gap
@@ -4019,8 +4081,8 @@ namespace WindowManager {
 		}
 
 		// Conductance of gap assuming it is sealed
-		WindowGasConductance( TGlassFace1, TGlassFace2, GapNum, con, pr, gr );
-		NusseltNumber( SurfNum, TGlassFace1, TGlassFace2, GapNum, gr, pr, nu );
+		WindowGasConductance( TGlassFace1, TGlassFace2, GapNum, con, pr, gr, Work );
+		NusseltNumber( SurfNum, TGlassFace1, TGlassFace2, GapNum, gr, pr, nu, Work );
 		hGapStill = con / gap( GapNum ) * nu;
 		GapHeight = Surface( SurfNum ).Height;
 		GapDepth = Material( Construct( ConstrNum ).LayerPoint( 2 * NGlass - 2 ) ).Thickness;
@@ -4054,7 +4116,8 @@ namespace WindowManager {
 		FArray1A< Real64 > TGapNew, // Current-iteration average gas temp in gaps (K)
 		Real64 & TGapOutletAve, // Average of TGapOutlet(1) and TGapOutlet(2) (K)
 		FArray1A< Real64 > hcv, // Convection coefficient from gap glass or shade to gap gas (W/m2-K)
-		Real64 & QConvTot // Sum of convective heat flow from gaps (W)
+		Real64 & QConvTot, // Sum of convective heat flow from gaps (W)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -4103,6 +4166,10 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & thetas( Work.thetas );
 		int ConstrNumSh; // Shaded construction number
 		int MatNumSh; // Material number of shade/blind layer
 		// In the following, "gaps" refer to the gaps on either side of the shade/blind
@@ -4172,8 +4239,8 @@ namespace WindowManager {
 				TGapOld( IGap ) = TGapNew( IGap );
 			}
 			// Conductance of gaps on either side of shade/blind assuming gaps are sealed
-			WindowGasConductance( TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, con, pr, gr );
-			NusseltNumber( SurfNum, TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, gr, pr, nu );
+			WindowGasConductance( TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, con, pr, gr, Work );
+			NusseltNumber( SurfNum, TGlassFace( IGap ), TShadeFace( IGap ), IGap + IGapInc, gr, pr, nu, Work );
 			hGapStill( IGap ) = con / gap( IGap + IGapInc ) * nu;
 			// Shade/blind or glass surface to air convection coefficient
 			hcv( IGap ) = 2.0 * hGapStill( IGap ) + 4.0 * VGap;
@@ -4385,7 +4452,8 @@ namespace WindowManager {
 		int const IGap, // Gap number
 		Real64 & con, // Gap gas conductance (W/m2-K)
 		Real64 & pr, // Gap gas Prandtl number
-		Real64 & gr // Gap gas Grashof number
+		Real64 & gr, // Gap gas Grashof number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -4425,6 +4493,13 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray3D< Real64 > & gcon( Work.gcon );
+		FArray3D< Real64 > & gvis( Work.gvis );
+		FArray3D< Real64 > & gcp( Work.gcp );
+		FArray2D< Real64 > & gwght( Work.gwght );
+		FArray2D< Real64 > & gfract( Work.gfract );
+		FArray1D_int & gnmix( Work.gnmix );
+		FArray1D< Real64 > & gap( Work.gap );
 		//Tuned Arrays made static
 		int IMix; // Counters of gases in a mixture
 		int i;
@@ -4555,7 +4630,8 @@ namespace WindowManager {
 		Real64 const tmean, // Temperature of gas in gap (K)
 		int const IGap, // Gap number
 		Real64 & dens, // Gap gas density at tmean (kg/m3)
-		Real64 & visc // Gap gas dynamic viscosity at tmean (g/m-s)
+		Real64 & visc, // Gap gas dynamic viscosity at tmean (g/m-s)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -4594,6 +4670,10 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		FArray3D< Real64 > & gvis( Work.gvis );
+		FArray2D< Real64 > & gwght( Work.gwght );
+		FArray2D< Real64 > & gfract( Work.gfract );
+		FArray1D_int & gnmix( Work.gnmix );
 		int IMix; // Counters of gases in a mixture
 		int i;
 		int j;
@@ -4664,7 +4744,8 @@ namespace WindowManager {
 	void
 	StartingWindowTemps(
 		int const SurfNum, // Surface number
-		FArray1A< Real64 > AbsRadShade // Short-wave radiation absorbed by shade/blind faces
+		FArray1A< Real64 > AbsRadShade, // Short-wave radiation absorbed by shade/blind faces
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -4704,6 +4785,13 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int & nglface( Work.nglface );
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		Real64 & hcin( Work.hcin );
+		Real64 & hcout( Work.hcout );
+		FArray1D< Real64 > & scon( Work.scon );
+		FArray1D< Real64 > & thetas( Work.thetas );
 
 		int i; // Face counter
 		int ShadeFlag; // Shading flag
@@ -4818,7 +4906,8 @@ namespace WindowManager {
 		int const IGap, // Gap number
 		Real64 const gr, // Gap gas Grashof number
 		Real64 const pr, // Gap gas Prandtl number
-		Real64 & gnu // Gap gas Nusselt number
+		Real64 & gnu, // Gap gas Nusselt number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -4853,6 +4942,9 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 & tilt( Work.tilt );
+		Real64 & tiltr( Work.tiltr );
+		FArray1D< Real64 > & gap( Work.gap );
 		Real64 asp; // Aspect ratio: window height to gap width
 		Real64 ra; // Rayleigh number
 		Real64 gnu901; // Nusselt number temporary variables for
@@ -6101,7 +6193,7 @@ namespace WindowManager {
 			//  ( SurfaceWindow(SurfNum)%FrameEmis*(sigma*(SurfaceWindow(SurfNum)%FrameTempSurfIn+TKelvin)**4 - rmir) + &
 			//    hcin*(SurfaceWindow(SurfNum)%FrameTempSurfIn+TKelvin - tin) )
 
-			FrameHeatGain = SurfaceWindow( SurfNum ).FrameArea * ( 1.0 + SurfaceWindow( SurfNum ).ProjCorrFrIn ) * ( hcin * ( SurfaceWindow( SurfNum ).FrameTempSurfIn + TKelvin - tin ) );
+			FrameHeatGain = SurfaceWindow( SurfNum ).FrameArea * ( 1.0 + SurfaceWindow( SurfNum ).ProjCorrFrIn ) * ( HInConv * ( SurfaceWindow( SurfNum ).FrameTempSurfIn + TKelvin - tin ) );
 
 			if ( FrameHeatGain > 0.0 ) {
 				SurfaceWindow( SurfNum ).FrameHeatGain = FrameHeatGain;
@@ -6283,6 +6375,39 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		WindowThermalWorkspace Work; // heat balance state of the glazing system
+		int & ngllayer( Work.ngllayer );
+		int & nglface( Work.nglface );
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		Real64 & tilt( Work.tilt );
+		Real64 & hcin( Work.hcin );
+		Real64 & hcout( Work.hcout );
+		Real64 & Outir( Work.Outir );
+		Real64 & Rmir( Work.Rmir );
+		Real64 & Rtot( Work.Rtot );
+		FArray3D< Real64 > & gcon( Work.gcon );
+		FArray3D< Real64 > & gvis( Work.gvis );
+		FArray3D< Real64 > & gcp( Work.gcp );
+		FArray2D< Real64 > & gwght( Work.gwght );
+		FArray2D< Real64 > & gfract( Work.gfract );
+		FArray1D_int & gnmix( Work.gnmix );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & thick( Work.thick );
+		FArray1D< Real64 > & scon( Work.scon );
+		FArray1D< Real64 > & tir( Work.tir );
+		FArray1D< Real64 > & emis( Work.emis );
+		FArray1D< Real64 > & AbsRadGlassFace( Work.AbsRadGlassFace );
+		FArray1D< Real64 > & thetas( Work.thetas );
+		Real64 & A23P( Work.A23P );
+		Real64 & A32P( Work.A32P );
+		Real64 & A45P( Work.A45P );
+		Real64 & A54P( Work.A54P );
+		Real64 & A67P( Work.A67P );
+		Real64 & A76P( Work.A76P );
+		Real64 & A23( Work.A23 );
+		Real64 & A45( Work.A45 );
+		Real64 & A67( Work.A67 );
 		int TotLay; // Total number of layers in a construction
 		//   (sum of solid layers and gap layers)
 		int TotGlassLay; // Total number of glass layers in a construction
@@ -6625,7 +6750,7 @@ namespace WindowManager {
 
 		thetas = 0.0;
 
-		WindowTempsForNominalCond( ConstrNum, hgap );
+		WindowTempsForNominalCond( ConstrNum, hgap, Work );
 
 		// Get center-of-glass conductance and solar heat gain coefficient
 		// including inside and outside air films
@@ -6685,7 +6810,8 @@ namespace WindowManager {
 	void
 	WindowTempsForNominalCond(
 		int const ConstrNum, // Construction number
-		FArray1A< Real64 > hgap // Gap gas conductive conductance (W/m2-K)
+		FArray1A< Real64 > hgap, // Gap gas conductive conductance (W/m2-K)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	)
 	{
 
@@ -6747,6 +6873,25 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int & ngllayer( Work.ngllayer );
+		int & nglface( Work.nglface );
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		Real64 & hcin( Work.hcin );
+		Real64 & hcout( Work.hcout );
+		Real64 & Outir( Work.Outir );
+		Real64 & Rmir( Work.Rmir );
+		FArray1D< Real64 > & gap( Work.gap );
+		FArray1D< Real64 > & scon( Work.scon );
+		FArray1D< Real64 > & emis( Work.emis );
+		FArray1D< Real64 > & AbsRadGlassFace( Work.AbsRadGlassFace );
+		FArray1D< Real64 > & thetas( Work.thetas );
+		Real64 & A23P( Work.A23P );
+		Real64 & A32P( Work.A32P );
+		Real64 & A45P( Work.A45P );
+		Real64 & A54P( Work.A54P );
+		Real64 & A67P( Work.A67P );
+		Real64 & A76P( Work.A76P );
 		int i; // Counter
 		Real64 gr; // Grashof number of gas in a gap
 		Real64 con; // Gap gas conductivity
@@ -6779,7 +6924,7 @@ namespace WindowManager {
 		iter = 0;
 
 		// Initialize face temperatures
-		StartingWinTempsForNominalCond();
+		StartingWinTempsForNominalCond( Work );
 
 		// Calculate radiative conductance
 		errtemp = errtemptol * 2.0;
@@ -6841,8 +6986,8 @@ namespace WindowManager {
 				Aface( 2, 2 ) = hr( 2 ) + scon( 1 ) + hcin;
 
 			} else if ( SELECT_CASE_var == 2 ) {
-				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-				NusseltNumber( 0, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+				NusseltNumber( 0, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 				hgap( 1 ) = con / gap( 1 ) * nu;
 
 				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
@@ -6865,12 +7010,12 @@ namespace WindowManager {
 				Aface( 4, 4 ) = hr( 4 ) + scon( 2 ) + hcin;
 
 			} else if ( SELECT_CASE_var == 3 ) {
-				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-				NusseltNumber( 0, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+				NusseltNumber( 0, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 				hgap( 1 ) = con / gap( 1 ) * nu;
 
-				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-				NusseltNumber( 0, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
+				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr, Work );
+				NusseltNumber( 0, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu, Work );
 				hgap( 2 ) = con / gap( 2 ) * nu;
 
 				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
@@ -6903,16 +7048,16 @@ namespace WindowManager {
 				Aface( 6, 6 ) = hr( 6 ) + scon( 3 ) + hcin;
 
 			} else if ( SELECT_CASE_var == 4 ) {
-				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
-				NusseltNumber( 0, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
+				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr, Work );
+				NusseltNumber( 0, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu, Work );
 				hgap( 1 ) = con / gap( 1 ) * nu;
 
-				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
-				NusseltNumber( 0, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
+				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr, Work );
+				NusseltNumber( 0, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu, Work );
 				hgap( 2 ) = con / gap( 2 ) * nu;
 
-				WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr );
-				NusseltNumber( 0, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu );
+				WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr, Work );
+				NusseltNumber( 0, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu, Work );
 				hgap( 3 ) = con / gap( 3 ) * nu;
 
 				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
@@ -6981,7 +7126,9 @@ namespace WindowManager {
 	//****************************************************************************
 
 	void
-	StartingWinTempsForNominalCond()
+	StartingWinTempsForNominalCond(
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
+	)
 	{
 
 		// SUBROUTINE INFORMATION:
@@ -7020,6 +7167,12 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int & nglface( Work.nglface );
+		Real64 & tout( Work.tout );
+		Real64 & tin( Work.tin );
+		Real64 & hcout( Work.hcout );
+		FArray1D< Real64 > & scon( Work.scon );
+		FArray1D< Real64 > & thetas( Work.thetas );
 		int i; // Face counter
 		FArray1D< Real64 > rguess( 11 ); // Combined radiative/convective resistance (m2-K/W) of
 		// inside or outside air film, or gap
@@ -7107,6 +7260,7 @@ namespace WindowManager {
 		static bool HasEQLWindows( false ); // equivalent layer window defined
 		static int SurfConstr( 0 );
 		static Real64 TempVar( 0.0 ); // just temporary usage for complex fenestration
+		TARCOGCommon::TARCOGWorkspace TARCOGWork; // scratch arrays of the complex fenestration nominal U and SHGC
 
 		int ThisNum;
 		int Layer;
@@ -7201,8 +7355,8 @@ namespace WindowManager {
 				if ( Construct( ThisNum ).WindowTypeBSDF ) {
 
 					i = ThisNum;
-					CalcComplexWindowThermal( 0, i, TempVar, TempVar, TempVar, TempVar, winterCondition );
-					CalcComplexWindowThermal( 0, i, TempVar, TempVar, TempVar, TempVar, summerCondition );
+					CalcComplexWindowThermal( 0, i, TempVar, TempVar, TempVar, TempVar, winterCondition, TARCOGWork );
+					CalcComplexWindowThermal( 0, i, TempVar, TempVar, TempVar, TempVar, summerCondition, TARCOGWork );
 
 					gio::write( OutputFileInits, Format_800 ) << Construct( ThisNum ).Name << RoundSigDigits( ThisNum ) << RoundSigDigits( Construct( ThisNum ).TotSolidLayers ) << RoundSigDigits( NominalU( ThisNum ), 3 ) << RoundSigDigits( Construct( ThisNum ).SummerSHGC, 3 );
 
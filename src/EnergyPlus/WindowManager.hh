@@ -3,11 +3,15 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1A.hh>
+#include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray2A.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/FArray3D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <TARCOGCommon.hh>
+#include <WindowEquivalentLayer.hh>
 
 namespace EnergyPlus {
 
@@ -41,38 +45,8 @@ namespace WindowManager {
 
 	// MODULE VARIABLE DECLARATIONS:
 
-	extern int ngllayer; // Number of glass layers
-	extern int nglface; // Number of glass faces
-	extern int nglfacep; // Number of glass faces, + 2 if shade layer present
-	extern Real64 tout; // Outside air temperature (K)
-	extern Real64 tin; // Inside air temperature (previous timestep) (K)
-	extern Real64 tilt; // Window tilt (deg)
-	extern Real64 tiltr; // Window tilt (radians)
-	extern Real64 hcin; // Convective inside air film conductance (W/m2-K)
-	extern Real64 hcout; // Convective outside air film conductance (W/m2-K)
-	extern Real64 Ebout; // Sigma*(outside air temp)**4 (W/m2)
-	extern Real64 Outir; // IR radiance of window's exterior surround (W/m2)
-	extern Real64 Rmir; // IR radiance of window's interior surround (W/m2)
-	extern Real64 Rtot; // Total thermal resistance of window (m2-K/W)
-	extern FArray3D< Real64 > gcon; // Gas thermal conductivity coefficients for each gap
-	extern FArray3D< Real64 > gvis; // Gas viscosity coefficients for each gap
-	extern FArray3D< Real64 > gcp; // Gas specific-heat coefficients for each gap
-	extern FArray2D< Real64 > gwght; // Gas molecular weights for each gap
-	extern FArray2D< Real64 > gfract; // Gas fractions for each gap
-	extern FArray1D_int gnmix; // Number of gases in gap
-	extern FArray1D< Real64 > gap; // Gap width (m)
-	extern FArray1D< Real64 > thick; // Glass layer thickness (m)
-	extern FArray1D< Real64 > scon; // Glass layer conductance--conductivity/thickness (W/m2-K)
-	extern FArray1D< Real64 > tir; // Front and back IR transmittance for each glass layer
-	extern FArray1D< Real64 > emis; // Front and back IR emissivity for each glass layer
 	extern FArray1D< Real64 > rir; // Front and back IR reflectance for each glass layer
 	//  (program calculates from tir and emis)
-	extern FArray1D< Real64 > AbsRadGlassFace; // Solar radiation and IR radiation from internal
-	//  gains absorbed by glass face
-	extern FArray1D< Real64 > thetas; // Glass surface temperatures (K)
-	extern FArray1D< Real64 > thetasPrev; // Previous-iteration glass surface temperatures (K)
-	extern FArray1D< Real64 > fvec; // Glass face heat balance function
-	extern FArray2D< Real64 > fjac; // Glass face heat balance Jacobian
 	extern FArray1D< Real64 > dtheta; // Glass layer temperature difference factor [K]
 	extern FArray2D< Real64 > zir; // IR transfer matrix
 	extern FArray2D< Real64 > ziri; // Inverse of IR transfer matrix
@@ -86,21 +60,11 @@ namespace WindowManager {
 	extern FArray1D< Real64 > sour; // IR source term at each face [W/m2]
 	extern FArray1D< Real64 > delta; // Residual at each glass layer [W/m2]
 	extern FArray1D< Real64 > hcgap; // Convective gap conductance
-	extern FArray1D< Real64 > hrgap; // Radiative gap conductance
 	extern FArray1D< Real64 > rgap; // Convective plus radiative gap resistance
 	//   (inverse of hcgap + hrgap)
 	extern FArray1D< Real64 > rs; // Outside film convective resistance, gap resistances,
 	//   inside air film convective resistance
 	extern FArray1D< Real64 > arhs;
-	extern Real64 A23P; // Intermediate variables in glass face
-	extern Real64 A32P;
-	extern Real64 A45P;
-	extern Real64 A54P;
-	extern Real64 A67P;
-	extern Real64 A76P;
-	extern Real64 A23; // heat balance equations
-	extern Real64 A45;
-	extern Real64 A67;
 
 	extern FArray2D< Real64 > wlt; // Spectral data wavelengths for each glass layer in a glazing system
 	// Following data, Spectral data for each layer for each wavelength in wlt
@@ -137,6 +101,102 @@ namespace WindowManager {
 	extern FArray1D< Real64 > rbvisPhi; // Glazing system visible back reflectance for each angle of incidence
 	extern FArray1D< Real64 > CosPhiIndepVar; // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Types
+
+	struct WindowThermalWorkspace // state of the heat balance of one glazing system
+	{
+		// Members
+		int ngllayer; // Number of glass layers
+		int nglface; // Number of glass faces
+		int nglfacep; // Number of glass faces, + 2 if shade layer present
+		Real64 tout; // Outside air temperature (K)
+		Real64 tin; // Inside air temperature (previous timestep) (K)
+		Real64 tilt; // Window tilt (deg)
+		Real64 tiltr; // Window tilt (radians)
+		Real64 hcin; // Convective inside air film conductance (W/m2-K)
+		Real64 hcout; // Convective outside air film conductance (W/m2-K)
+		Real64 Ebout; // Sigma*(outside air temp)**4 (W/m2)
+		Real64 Outir; // IR radiance of window's exterior surround (W/m2)
+		Real64 Rmir; // IR radiance of window's interior surround (W/m2)
+		Real64 Rtot; // Total thermal resistance of window (m2-K/W)
+		FArray3D< Real64 > gcon; // Gas thermal conductivity coefficients for each gap
+		FArray3D< Real64 > gvis; // Gas viscosity coefficients for each gap
+		FArray3D< Real64 > gcp; // Gas specific-heat coefficients for each gap
+		FArray2D< Real64 > gwght; // Gas molecular weights for each gap
+		FArray2D< Real64 > gfract; // Gas fractions for each gap
+		FArray1D_int gnmix; // Number of gases in gap
+		FArray1D< Real64 > gap; // Gap width (m)
+		FArray1D< Real64 > thick; // Glass layer thickness (m)
+		FArray1D< Real64 > scon; // Glass layer conductance--conductivity/thickness (W/m2-K)
+		FArray1D< Real64 > tir; // Front and back IR transmittance for each glass layer
+		FArray1D< Real64 > emis; // Front and back IR emissivity for each glass layer
+		FArray1D< Real64 > AbsRadGlassFace; // Solar radiation and IR radiation from internal
+		//  gains absorbed by glass face
+		FArray1D< Real64 > thetas; // Glass surface temperatures (K)
+		FArray1D< Real64 > thetasPrev; // Previous-iteration glass surface temperatures (K)
+		FArray1D< Real64 > fvec; // Glass face heat balance function
+		FArray2D< Real64 > fjac; // Glass face heat balance Jacobian
+		FArray1D< Real64 > hrgap; // Radiative gap conductance
+		Real64 A23P; // Intermediate variables in glass face
+		Real64 A32P;
+		Real64 A45P;
+		Real64 A54P;
+		Real64 A67P;
+		Real64 A76P;
+		Real64 A23; // heat balance equations
+		Real64 A45;
+		Real64 A67;
+		WindowEquivalentLayer::EQLThermalWorkspace EQL; // scratch arrays of the equivalent layer model
+		TARCOGCommon::TARCOGWorkspace TARCOG; // scratch arrays of the complex fenestration model
+
+		// Default Constructor
+		WindowThermalWorkspace() :
+			ngllayer( 0 ),
+			nglface( 0 ),
+			nglfacep( 0 ),
+			tout( 0.0 ),
+			tin( 0.0 ),
+			tilt( 0.0 ),
+			tiltr( 0.0 ),
+			hcin( 0.0 ),
+			hcout( 0.0 ),
+			Ebout( 0.0 ),
+			Outir( 0.0 ),
+			Rmir( 0.0 ),
+			Rtot( 0.0 ),
+			gcon( 5, 5, 3, 0.0 ),
+			gvis( 5, 5, 3, 0.0 ),
+			gcp( 5, 5, 3, 0.0 ),
+			gwght( 5, 5, 0.0 ),
+			gfract( 5, 5, 0.0 ),
+			gnmix( 5, 0 ),
+			gap( 5, 0.0 ),
+			thick( 5, 0.0 ),
+			scon( 5, 0.0 ),
+			tir( 10, 0.0 ),
+			emis( 10, 0.0 ),
+			AbsRadGlassFace( 10, 0.0 ),
+			thetas( 10, 0.0 ),
+			thetasPrev( 10, 0.0 ),
+			fvec( 10, 0.0 ),
+			fjac( 10, 10, 0.0 ),
+			hrgap( 5, 0.0 ),
+			A23P( 0.0 ),
+			A32P( 0.0 ),
+			A45P( 0.0 ),
+			A54P( 0.0 ),
+			A67P( 0.0 ),
+			A76P( 0.0 ),
+			A23( 0.0 ),
+			A45( 0.0 ),
+			A67( 0.0 )
+		{}
+
+	};
+
+	// Object Data
+	extern WindowThermalWorkspace WindowHeatBalanceWork; // glazing system state of the surface heat balance, used by one window after another
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -210,18 +270,25 @@ namespace WindowManager {
 		int const SurfNum, // Surface number
 		Real64 const HextConvCoeff, // Outside air film conductance coefficient
 		Real64 & SurfInsideTemp, // Inside window surface temperature
-		Real64 & SurfOutsideTemp // Outside surface temperature (C)
+		Real64 & SurfOutsideTemp, // Outside surface temperature (C)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//****************************************************************************
 
 	void
-	WindowHeatBalanceEquations( int const SurfNum ); // Surface number
+	WindowHeatBalanceEquations(
+		int const SurfNum, // Surface number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
+	);
 
 	//****************************************************************************
 
 	void
-	SolveForWindowTemperatures( int const SurfNum ); // Surface number
+	SolveForWindowTemperatures(
+		int const SurfNum, // Surface number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
+	);
 
 	//****************************************************************************
 
@@ -233,7 +300,8 @@ namespace WindowManager {
 		Real64 & TGapNew, // Current-iteration average air temp in glass-shade/blind gap (K)
 		Real64 & TGapOutlet, // Temperature of air leaving glass-shade/blind gap at top for upward
 		Real64 & hcv, // Convection coefficient from gap glass or shade to gap air (W/m2-K)
-		Real64 & QConvGap // Convective heat gain from glass-shade/blind gap for interior shade (W)
+		Real64 & QConvGap, // Convective heat gain from glass-shade/blind gap for interior shade (W)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//****************************************************************************
@@ -244,7 +312,8 @@ namespace WindowManager {
 		int const iter, // Iteration number for glass heat balance calculation
 		Real64 & VGap, // Gas velocity in gaps (m/s)
 		FArray1A< Real64 > TGapNew, // Current-iteration average gas temp in gaps (K)
-		FArray1A< Real64 > hcv // Convection coefficient from gap glass or shade to gap gas (W/m2-K)
+		FArray1A< Real64 > hcv, // Convection coefficient from gap glass or shade to gap gas (W/m2-K)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//****************************************************************************
@@ -257,7 +326,8 @@ namespace WindowManager {
 		Real64 & TGapNew, // Current-iteration average air temp in airflow gap (K)
 		Real64 & TGapOutlet, // Temperature of air leaving glass-shade/blind gap at top for upward
 		Real64 & hcv, // Convection coefficient from gap glass faces to gap air (W/m2-K)
-		Real64 & QConvGap // Convective heat gain from air flow gap (W)
+		Real64 & QConvGap, // Convective heat gain from air flow gap (W)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//****************************************************************************
@@ -270,7 +340,8 @@ namespace WindowManager {
 		FArray1A< Real64 > TGapNew, // Current-iteration average gas temp in gaps (K)
 		Real64 & TGapOutletAve, // Average of TGapOutlet(1) and TGapOutlet(2) (K)
 		FArray1A< Real64 > hcv, // Convection coefficient from gap glass or shade to gap gas (W/m2-K)
-		Real64 & QConvTot // Sum of convective heat flow from gaps (W)
+		Real64 & QConvTot, // Sum of convective heat flow from gaps (W)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//****************************************************************************
@@ -302,7 +373,8 @@ namespace WindowManager {
 		int const IGap, // Gap number
 		Real64 & con, // Gap gas conductance (W/m2-K)
 		Real64 & pr, // Gap gas Prandtl number
-		Real64 & gr // Gap gas Grashof number
+		Real64 & gr, // Gap gas Grashof number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//******************************************************************************
@@ -312,7 +384,8 @@ namespace WindowManager {
 		Real64 const tmean, // Temperature of gas in gap (K)
 		int const IGap, // Gap number
 		Real64 & dens, // Gap gas density at tmean (kg/m3)
-		Real64 & visc // Gap gas dynamic viscosity at tmean (g/m-s)
+		Real64 & visc, // Gap gas dynamic viscosity at tmean (g/m-s)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//********************************************************************************
@@ -320,7 +393,8 @@ namespace WindowManager {
 	void
 	StartingWindowTemps(
 		int const SurfNum, // Surface number
-		FArray1A< Real64 > AbsRadShade // Short-wave radiation absorbed by shade/blind faces
+		FArray1A< Real64 > AbsRadShade, // Short-wave radiation absorbed by shade/blind faces
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//****************************************************************************
@@ -333,7 +407,8 @@ namespace WindowManager {
 		int const IGap, // Gap number
 		Real64 const gr, // Gap gas Grashof number
 		Real64 const pr, // Gap gas Prandtl number
-		Real64 & gnu // Gap gas Nusselt number
+		Real64 & gnu, // Gap gas Nusselt number
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//*******************************************************************************************************
@@ -445,13 +520,16 @@ namespace WindowManager {
 	void
 	WindowTempsForNominalCond(
 		int const ConstrNum, // Construction number
-		FArray1A< Real64 > hgap // Gap gas conductive conductance (W/m2-K)
+		FArray1A< Real64 > hgap, // Gap gas conductive conductance (W/m2-K)
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
 	);
 
 	//****************************************************************************
 
 	void
-	StartingWinTempsForNominalCond();
+	StartingWinTempsForNominalCond(
+		WindowThermalWorkspace & Work // heat balance state of the glazing system
+	);
 
 	//****************************************************************************
 
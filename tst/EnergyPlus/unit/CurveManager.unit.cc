@@ -0,0 +1,87 @@
+// EnergyPlus::CurveManager Unit Tests
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/DataGlobals.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+using namespace ObjexxFCL;
+
+TEST( CurveManagerTest, TableLookupObjectMatchesDLAG )
+{
+	GetCurvesInputFlag = false;
+	DataGlobals::BeginEnvrnFlag = false;
+	NumCurves = 1;
+	PerfCurve.allocate( NumCurves );
+	TableLookup.allocate( 1 );
+	PerfCurveTableData.allocate( 1 );
+
+	auto & Curve( PerfCurve( 1 ) );
+	Curve.InterpolationType = LagrangeInterpolationLinearExtrapolation;
+	Curve.TableIndex = 1;
+	Curve.Var1Min = -100.0;
+	Curve.Var1Max = 100.0;
+	Curve.Var2Min = -100.0;
+	Curve.Var2Max = 100.0;
+	Curve.Var3Min = -100.0;
+	Curve.Var3Max = 100.0;
+
+	auto & Table( TableLookup( 1 ) );
+	Table.NumIndependentVars = 3;
+	Table.InterpolationOrder = 3;
+	Table.NumX1Vars = 5;
+	Table.NumX2Vars = 4;
+	Table.NumX3Vars = 3;
+	Table.X1Var = FArray1D< Real64 >( 5, { 12.0, 15.0, 19.4, 21.0, 24.0 } );
+	Table.X2Var = FArray1D< Real64 >( 4, { 18.0, 24.0, 35.0, 46.0 } );
+	Table.X3Var = FArray1D< Real64 >( 3, { 0.5, 1.0, 1.5 } );
+	Table.TableLookupZData.allocate( 5, 4, 3, 1, 1 );
+	for ( int i = 1; i <= 5; ++i ) {
+		for ( int j = 1; j <= 4; ++j ) {
+			for ( int k = 1; k <= 3; ++k ) {
+				Real64 const x( Table.X1Var( i ) ), y( Table.X2Var( j ) ), z( Table.X3Var( k ) );
+				Table.TableLookupZData( i, j, k, 1, 1 ) = 0.9 + 0.01 * x - 0.0004 * x * x - 0.008 * y + 0.00003 * y * y + 0.05 * z * std::sqrt( x );
+			}
+		}
+	}
+	PrepareTableLookupGrids();
+
+	FArray1D< Real64 > const X1Points( 8, { 10.0, 12.0, 13.3, 15.0, 19.0, 22.5, 24.0, 27.0 } );
+	FArray1D< Real64 > const X2Points( 6, { 15.0, 18.0, 20.0, 35.0, 40.0, 50.0 } );
+	FArray1D< Real64 > const X3Points( 5, { 0.2, 0.5, 0.8, 1.5, 1.7 } );
+	FArray2D< Real64 > TwoDVals( 3, 1 );
+	int IEXTX, IEXTY, IEXTV3, IEXTV4;
+	for ( int i = 1; i <= 8; ++i ) {
+		for ( int j = 1; j <= 6; ++j ) {
+			for ( int k = 1; k <= 5; ++k ) {
+				// the original nested DLAG evaluation of a three variable table
+				for ( int IV3 = 1; IV3 <= 3; ++IV3 ) {
+					TwoDVals( IV3, 1 ) = DLAG( X1Points( i ), X2Points( j ), Table.X1Var, Table.X2Var, Table.TableLookupZData( _, _, IV3, 1, 1 ), 5, 4, 3, IEXTX, IEXTY );
+				}
+				Real64 const Expected( DLAG( X3Points( k ), 1.0, Table.X3Var, Table.X3Var, TwoDVals, 3, 1, 3, IEXTV3, IEXTV4 ) );
+				EXPECT_DOUBLE_EQ( Expected, TableLookupObject( 1, X1Points( i ), X2Points( j ), X3Points( k ) ) );
+			}
+		}
+	}
+	// repeat in reverse order so the hinted search has to move backwards
+	for ( int i = 8; i >= 1; --i ) {
+		for ( int IV3 = 1; IV3 <= 3; ++IV3 ) {
+			TwoDVals( IV3, 1 ) = DLAG( X1Points( i ), X2Points( 3 ), Table.X1Var, Table.X2Var, Table.TableLookupZData( _, _, IV3, 1, 1 ), 5, 4, 3, IEXTX, IEXTY );
+		}
+		Real64 const Expected( DLAG( X3Points( 3 ), 1.0, Table.X3Var, Table.X3Var, TwoDVals, 3, 1, 3, IEXTV3, IEXTV4 ) );
+		EXPECT_DOUBLE_EQ( Expected, TableLookupObject( 1, X1Points( i ), X2Points( 3 ), X3Points( 3 ) ) );
+	}
+
+	NumCurves = 0;
+	PerfCurve.deallocate();
+	TableLookup.deallocate();
+	PerfCurveTableData.deallocate();
+	GetCurvesInputFlag = true;
+}
@@ -0,0 +1,218 @@
+// EnergyPlus::DXCoils Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <DXCoils.hh>
+#include <CurveManager.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHVACGlobals.hh>
+#include <Psychrometrics.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DXCoils;
+using namespace ObjexxFCL;
+
+namespace {
+
+void
+SetUpCurve(
+	int const CurveNum,
+	int const CurveType,
+	FArray1D< Real64 > const & Coeffs,
+	Real64 const VarMin,
+	Real64 const VarMax
+)
+{
+	auto & Curve( CurveManager::PerfCurve( CurveNum ) );
+	Curve.CurveType = CurveType;
+	Curve.InterpolationType = CurveManager::EvaluateCurveToLimits;
+	Curve.Coeff1 = Coeffs( 1 );
+	Curve.Coeff2 = Coeffs( 2 );
+	Curve.Coeff3 = Coeffs( 3 );
+	if ( CurveType == CurveManager::BiQuadratic ) {
+		Curve.Coeff4 = Coeffs( 4 );
+		Curve.Coeff5 = Coeffs( 5 );
+		Curve.Coeff6 = Coeffs( 6 );
+	}
+	Curve.Var1Min = VarMin;
+	Curve.Var1Max = VarMax;
+	Curve.Var2Min = 18.0; // condenser inlet temperature of the temperature curves
+	Curve.Var2Max = 46.11111;
+}
+
+// Single speed cooling coil with a cycling fan, at a hot and humid condition
+void
+SetUpSingleSpeedCoil()
+{
+	using DataEnvironment::OutBaroPress;
+	using DataEnvironment::OutDryBulbTemp;
+	using DataEnvironment::OutHumRat;
+	using DataEnvironment::OutWetBulbTemp;
+	using Psychrometrics::PsyHFnTdbW;
+	using Psychrometrics::PsyTwbFnTdbWPb;
+
+	if ( ! Psychrometrics::cached_Twb.allocated() ) Psychrometrics::InitializePsychRoutines();
+
+	CurveManager::GetCurvesInputFlag = false;
+	DataGlobals::BeginEnvrnFlag = false;
+	CurveManager::NumCurves = 5;
+	CurveManager::PerfCurve.allocate( CurveManager::NumCurves );
+	SetUpCurve( 1, CurveManager::BiQuadratic, FArray1D< Real64 >( 6, { 0.942587793, 0.009543347, 0.000683770, -0.011042676, 0.000005249, -0.000009720 } ), 12.77778, 23.88889 );
+	SetUpCurve( 2, CurveManager::Quadratic, FArray1D< Real64 >( 3, { 0.8, 0.2, 0.0 } ), 0.5, 1.5 );
+	SetUpCurve( 3, CurveManager::BiQuadratic, FArray1D< Real64 >( 6, { 0.342414409, 0.034885008, -0.000623700, 0.004977216, 0.000437951, -0.000728028 } ), 12.77778, 23.88889 );
+	SetUpCurve( 4, CurveManager::Quadratic, FArray1D< Real64 >( 3, { 1.1552, -0.1808, 0.0256 } ), 0.5, 1.5 );
+	SetUpCurve( 5, CurveManager::Quadratic, FArray1D< Real64 >( 3, { 0.85, 0.15, 0.0 } ), 0.0, 1.0 );
+
+	NumDXCoils = 1;
+	GetCoilsInputFlag = false;
+	DXCoil.allocate( NumDXCoils );
+	DXCoilFullLoad.allocate( MaxModes, NumDXCoils );
+	DXCoilOutletTemp.allocate( NumDXCoils );
+	DXCoilOutletHumRat.allocate( NumDXCoils );
+	DXCoilPartLoadRatio.allocate( NumDXCoils );
+	DXCoilFanOpMode.allocate( NumDXCoils );
+	DXCoilFullLoadOutAirTemp.allocate( NumDXCoils );
+	DXCoilFullLoadOutAirHumRat.allocate( NumDXCoils );
+	DataHeatBalance::HeatReclaimDXCoil.allocate( NumDXCoils );
+
+	auto & Coil( DXCoil( 1 ) );
+	Coil.Name = "MAIN COOLING COIL";
+	Coil.DXCoilType = "Coil:Cooling:DX:SingleSpeed";
+	Coil.DXCoilType_Num = DataHVACGlobals::CoilDX_CoolingSingleSpeed;
+	Coil.SchedPtr = -1;
+	Coil.RatedTotCap( 1 ) = 10000.0;
+	Coil.RatedSHR( 1 ) = 0.75;
+	Coil.RatedEIR( 1 ) = 1.0 / 3.2;
+	Coil.RatedAirVolFlowRate( 1 ) = 0.5;
+	Coil.RatedAirMassFlowRate( 1 ) = 0.6;
+	Coil.RatedCBF( 1 ) = 0.1;
+	Coil.CCapFTemp( 1 ) = 1;
+	Coil.TotCapTempModFacCurveType( 1 ) = DXCoils::BiQuadratic;
+	Coil.CCapFFlow( 1 ) = 2;
+	Coil.EIRFTemp( 1 ) = 3;
+	Coil.EIRTempModFacCurveType( 1 ) = DXCoils::BiQuadratic;
+	Coil.EIRFFlow( 1 ) = 4;
+	Coil.PLFFPLR( 1 ) = 5;
+
+	OutBaroPress = 101325.0;
+	OutDryBulbTemp = 35.0;
+	OutHumRat = 0.014;
+	OutWetBulbTemp = PsyTwbFnTdbWPb( OutDryBulbTemp, OutHumRat, OutBaroPress );
+
+	Coil.InletAirTemp = 26.7;
+	Coil.InletAirHumRat = 0.011;
+	Coil.InletAirEnthalpy = PsyHFnTdbW( Coil.InletAirTemp, Coil.InletAirHumRat );
+}
+
+void
+TearDownSingleSpeedCoil()
+{
+	DataGlobals::AnyEnergyManagementSystemInModel = false;
+	DXCoil.deallocate();
+	DXCoilFullLoad.deallocate();
+	DXCoilOutletTemp.deallocate();
+	DXCoilOutletHumRat.deallocate();
+	DXCoilPartLoadRatio.deallocate();
+	DXCoilFanOpMode.deallocate();
+	DXCoilFullLoadOutAirTemp.deallocate();
+	DXCoilFullLoadOutAirHumRat.deallocate();
+	DataHeatBalance::HeatReclaimDXCoil.deallocate();
+	NumDXCoils = 0;
+	CurveManager::PerfCurve.deallocate();
+	CurveManager::NumCurves = 0;
+}
+
+// Runs the coil at a part-load ratio with the cycling fan flow for that ratio
+void
+RunCoil( Real64 const PartLoadRatio )
+{
+	DXCoil( 1 ).InletAirMassFlowRate = 0.6 * PartLoadRatio;
+	CalcDoe2DXCoil( 1, On, true, PartLoadRatio, DataHVACGlobals::CycFanCycCoil );
+}
+
+void
+ExpectSameCoilOutput(
+	DXCoilData const & Expected,
+	DXCoilData const & Actual
+)
+{
+	EXPECT_DOUBLE_EQ( Expected.TotalCoolingEnergyRate, Actual.TotalCoolingEnergyRate );
+	EXPECT_DOUBLE_EQ( Expected.SensCoolingEnergyRate, Actual.SensCoolingEnergyRate );
+	EXPECT_DOUBLE_EQ( Expected.ElecCoolingPower, Actual.ElecCoolingPower );
+	EXPECT_DOUBLE_EQ( Expected.CoolingCoilRuntimeFraction, Actual.CoolingCoilRuntimeFraction );
+	EXPECT_DOUBLE_EQ( Expected.OutletAirTemp, Actual.OutletAirTemp );
+	EXPECT_DOUBLE_EQ( Expected.OutletAirHumRat, Actual.OutletAirHumRat );
+	EXPECT_DOUBLE_EQ( Expected.OutletAirEnthalpy, Actual.OutletAirEnthalpy );
+}
+
+}
+
+TEST( DXCoilsTest, FullLoadPointReuseMatchesRecomputation )
+{
+	SetUpSingleSpeedCoil();
+	auto const & FullLoad( DXCoilFullLoad( 1, 1 ) );
+
+	// The first evaluation fills the full-load point, the second at the same conditions reuses it
+	RunCoil( 0.5 );
+	EXPECT_EQ( 0, FullLoad.NumHits );
+	ASSERT_TRUE( FullLoad.Valid );
+	DXCoilData const Computed( DXCoil( 1 ) );
+	Real64 const ComputedFullLoadOutAirTemp( DXCoilFullLoadOutAirTemp( 1 ) );
+	RunCoil( 0.5 );
+	EXPECT_EQ( 1, FullLoad.NumHits );
+	ExpectSameCoilOutput( Computed, DXCoil( 1 ) );
+	EXPECT_DOUBLE_EQ( ComputedFullLoadOutAirTemp, DXCoilFullLoadOutAirTemp( 1 ) );
+
+	// Another part-load ratio at the same full-load conditions, reused and then recomputed
+	RunCoil( 0.8 );
+	EXPECT_EQ( 2, FullLoad.NumHits );
+	DXCoilData const Reused( DXCoil( 1 ) );
+	Real64 const ReusedTotCap( FullLoad.TotCap );
+	Real64 const ReusedEIRTempModFac( FullLoad.EIRTempModFac );
+	Real64 const ReusedEIRFlowModFac( FullLoad.EIRFlowModFac );
+	DXCoilFullLoad( 1, 1 ).Valid = false;
+	RunCoil( 0.8 );
+	EXPECT_EQ( 2, FullLoad.NumHits );
+	ExpectSameCoilOutput( DXCoil( 1 ), Reused );
+	EXPECT_DOUBLE_EQ( FullLoad.TotCap, ReusedTotCap );
+	EXPECT_DOUBLE_EQ( FullLoad.EIRTempModFac, ReusedEIRTempModFac );
+	EXPECT_DOUBLE_EQ( FullLoad.EIRFlowModFac, ReusedEIRFlowModFac );
+
+	// A change in the inlet conditions is not served from the saved point
+	DXCoil( 1 ).InletAirTemp = 25.0;
+	DXCoil( 1 ).InletAirEnthalpy = Psychrometrics::PsyHFnTdbW( DXCoil( 1 ).InletAirTemp, DXCoil( 1 ).InletAirHumRat );
+	RunCoil( 0.8 );
+	EXPECT_EQ( 2, FullLoad.NumHits );
+	EXPECT_LT( DXCoil( 1 ).OutletAirTemp, Reused.OutletAirTemp );
+
+	TearDownSingleSpeedCoil();
+}
+
+TEST( DXCoilsTest, FullLoadPointNotReusedWithEMS )
+{
+	SetUpSingleSpeedCoil();
+	auto const & FullLoad( DXCoilFullLoad( 1, 1 ) );
+	DataGlobals::AnyEnergyManagementSystemInModel = true;
+
+	RunCoil( 0.5 );
+	DXCoilData const Computed( DXCoil( 1 ) );
+	RunCoil( 0.5 );
+	EXPECT_EQ( 0, FullLoad.NumHits );
+	ExpectSameCoilOutput( Computed, DXCoil( 1 ) );
+
+	// An EMS curve override between evaluations at unchanged conditions takes effect at once
+	CurveManager::PerfCurve( 1 ).EMSOverrideOn = true;
+	CurveManager::PerfCurve( 1 ).EMSOverrideCurveValue = 0.5 * CurveManager::PerfCurve( 1 ).CurveOutput;
+	RunCoil( 0.5 );
+	EXPECT_EQ( 0, FullLoad.NumHits );
+	EXPECT_LT( DXCoil( 1 ).TotalCoolingEnergyRate, 0.75 * Computed.TotalCoolingEnergyRate );
+
+	TearDownSingleSpeedCoil();
+}
@@ -0,0 +1,21 @@
+// EnergyPlus::DataLoopNode Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataLoopNode.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataLoopNode;
+
+TEST( DataLoopNodeTest, MemberConstructorDefaults )
+{
+	// the member constructor keeps its argument order after the member reordering
+	NodeData const Defaults( DefaultNodeValues );
+	EXPECT_EQ( SensedNodeFlagValue, Defaults.TempSetPoint );
+	EXPECT_EQ( 0.0, Defaults.MassFlowRateMax );
+	EXPECT_EQ( SensedNodeFlagValue, Defaults.TempSetPointLo );
+	EXPECT_EQ( -1.0, Defaults.Height );
+	EXPECT_FALSE( Defaults.SPMNodeWetBulbRepReq );
+}
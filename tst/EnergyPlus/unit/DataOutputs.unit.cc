@@ -0,0 +1,40 @@
+// EnergyPlus::DataOutputs Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataOutputs.hh>
+#include <EnergyPlus/InputProcessor.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataOutputs;
+using namespace EnergyPlus::InputProcessor;
+
+TEST( DataOutputsTest, FindItemInVariableList )
+{
+	OutputVariablesForSimulation.allocate( 10 );
+	MaxConsideredOutputVariables = 10;
+	NumConsideredOutputVariables = 0;
+	OutputVariablesForSimulationIndex.clear();
+
+	AddRecordToOutputVariableStructure( "ZONE ONE", "ZONE MEAN AIR TEMPERATURE [C]" );
+	AddRecordToOutputVariableStructure( "ZONE TWO", "ZONE MEAN AIR TEMPERATURE" );
+	AddRecordToOutputVariableStructure( "*", "SITE OUTDOOR AIR DRYBULB TEMPERATURE" );
+
+	// one linked list per variable name
+	EXPECT_EQ( 3, NumConsideredOutputVariables );
+	EXPECT_EQ( 2, OutputVariablesForSimulation( 1 ).Next );
+	EXPECT_EQ( 1, OutputVariablesForSimulation( 2 ).Previous );
+
+	EXPECT_TRUE( FindItemInVariableList( "Zone One", "Zone Mean Air Temperature" ) );
+	EXPECT_TRUE( FindItemInVariableList( "ZONE TWO", "zone mean air temperature" ) );
+	EXPECT_FALSE( FindItemInVariableList( "ZONE THREE", "ZONE MEAN AIR TEMPERATURE" ) );
+	EXPECT_TRUE( FindItemInVariableList( "Environment", "Site Outdoor Air Drybulb Temperature" ) );
+	EXPECT_FALSE( FindItemInVariableList( "ZONE ONE", "ZONE AIR HUMIDITY RATIO" ) );
+
+	OutputVariablesForSimulation.deallocate();
+	MaxConsideredOutputVariables = 0;
+	NumConsideredOutputVariables = 0;
+	OutputVariablesForSimulationIndex.clear();
+}
@@ -0,0 +1,100 @@
+// EnergyPlus::EconomicTariff Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EconomicTariff.hh>
+#include <DataGlobals.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::EconomicTariff;
+
+TEST( EconomicTariffTest, CSVFields )
+{
+	std::vector< std::string > fields;
+
+	EXPECT_EQ( "\"Electricity:Facility\"", quotedCSVField( "Electricity:Facility" ) );
+	EXPECT_EQ( "\"Meter \"\"A\"\", North\"", quotedCSVField( "Meter \"A\", North" ) );
+
+	splitCSVLine( "Meters,\"Meter \"\"A\"\", North\",\"B\",3.5\r", fields );
+	ASSERT_EQ( 4u, fields.size() );
+	EXPECT_EQ( "Meters", fields[ 0 ] );
+	EXPECT_EQ( "Meter \"A\", North", fields[ 1 ] );
+	EXPECT_EQ( "B", fields[ 2 ] );
+	EXPECT_EQ( "3.5", fields[ 3 ] );
+
+	splitCSVLine( "", fields );
+	ASSERT_EQ( 1u, fields.size() );
+	EXPECT_TRUE( fields[ 0 ].empty() );
+}
+
+TEST( EconomicTariffTest, TariffMeterDataRoundTrip )
+{
+	std::string const FileName( "EconomicTariffTest_eplustmd.csv" );
+	int savedTimeStepsInHour( 0 );
+
+	DataGlobals::NumOfTimeStepInHour = 4;
+	numMeterDataCol = 2;
+	meterDataName.dimension( numMeterDataCol );
+	meterDataResource.dimension( numMeterDataCol );
+	meterDataUnits.dimension( numMeterDataCol );
+	meterDataName( 1 ) = "Electricity:Facility";
+	meterDataName( 2 ) = "Custom \"Gas\", Kitchen";
+	meterDataResource( 1 ) = "Electricity";
+	meterDataResource( 2 ) = "Gas";
+	meterDataUnits( 1 ) = meterDataUnits( 2 ) = "J";
+	meterDataStamp.clear();
+	meterDataStamp.push_back( MeterDataStampType( 1, 1, 1, 0, 0, 1, 1 ) );
+	meterDataStamp.push_back( MeterDataStampType( 12, 365, 7, 2, 1, 24, 4 ) );
+	meterDataHistory.assign( 1, 0.1 );
+	meterDataHistory.push_back( 1.0 / 3.0 );
+	meterDataHistory.push_back( 123456789.123456789 );
+	meterDataHistory.push_back( 2.5e-300 );
+
+	std::vector< Real64 > const savedHistory( meterDataHistory );
+	WriteTariffMeterDataFile( FileName );
+
+	// Read back into cleared data: everything is restored exactly
+	numMeterDataCol = 0;
+	meterDataName.deallocate();
+	meterDataResource.deallocate();
+	meterDataUnits.deallocate();
+	meterDataStamp.clear();
+	meterDataHistory.clear();
+	ReadTariffMeterDataFile( FileName, savedTimeStepsInHour );
+	std::remove( FileName.c_str() );
+
+	EXPECT_EQ( 4, savedTimeStepsInHour );
+	ASSERT_EQ( 2, numMeterDataCol );
+	EXPECT_EQ( "Electricity:Facility", meterDataName( 1 ) );
+	EXPECT_EQ( "Custom \"Gas\", Kitchen", meterDataName( 2 ) );
+	EXPECT_EQ( "Electricity", meterDataResource( 1 ) );
+	EXPECT_EQ( "Gas", meterDataResource( 2 ) );
+	EXPECT_EQ( "J", meterDataUnits( 2 ) );
+	ASSERT_EQ( 2u, meterDataStamp.size() );
+	EXPECT_EQ( 12, meterDataStamp[ 1 ].month );
+	EXPECT_EQ( 365, meterDataStamp[ 1 ].dayOfYear );
+	EXPECT_EQ( 7, meterDataStamp[ 1 ].dayOfWeek );
+	EXPECT_EQ( 2, meterDataStamp[ 1 ].holiday );
+	EXPECT_EQ( 1, meterDataStamp[ 1 ].dst );
+	EXPECT_EQ( 24, meterDataStamp[ 1 ].hour );
+	EXPECT_EQ( 4, meterDataStamp[ 1 ].timeStep );
+	ASSERT_EQ( savedHistory.size(), meterDataHistory.size() );
+	for ( std::vector< Real64 >::size_type i = 0; i < savedHistory.size(); ++i ) {
+		EXPECT_EQ( savedHistory[ i ], meterDataHistory[ i ] );
+	}
+
+	numMeterDataCol = 0;
+	meterDataName.deallocate();
+	meterDataResource.deallocate();
+	meterDataUnits.deallocate();
+	meterDataValue.deallocate();
+	meterDataStamp.clear();
+	meterDataHistory.clear();
+}
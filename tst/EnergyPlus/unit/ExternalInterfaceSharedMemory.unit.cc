@@ -0,0 +1,173 @@
+// EnergyPlus::ExternalInterfaceSharedMemory Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// EnergyPlus Headers
+#include <EnergyPlus/ExternalInterfaceSharedMemory.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ExternalInterfaceSharedMemory;
+
+namespace {
+
+	std::string
+	UniqueChannelName( std::string const & Prefix )
+	{
+		return Prefix + std::to_string( std::chrono::steady_clock::now().time_since_epoch().count() );
+	}
+
+	// Peer that answers the next request with its own values after 200 ms
+	void
+	AnswerSlowly( SharedMemoryIPCType & Peer )
+	{
+		Real64 dblValPeer[ 1 ] = { 0.0 };
+		int flaPeer( 0 );
+		int nDblPeer( 0 );
+		Real64 simTimPeer( 0.0 );
+		WaitForSharedMemoryRequest( Peer, flaPeer, nDblPeer, simTimPeer, dblValPeer, 1.0 );
+		std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+		PostSharedMemoryReply( Peer, 0, 1, simTimPeer, dblValPeer );
+	}
+
+}
+
+TEST( ExternalInterfaceSharedMemoryTest, Loopback )
+{
+	std::string const Name( UniqueChannelName( "EnergyPlusShmLoopback" ) );
+	SharedMemoryIPCType Peer;
+	SharedMemoryIPCType Client;
+
+	ASSERT_EQ( shmOK, CreateSharedMemoryChannel( Name, Peer ) );
+	ASSERT_EQ( shmOK, OpenSharedMemoryChannel( Name, Client ) );
+
+	Real64 const dblValWri[ 3 ] = { 1.0, 2.5, -4.0 };
+	Real64 dblValPeer[ 3 ] = { 0.0, 0.0, 0.0 };
+	Real64 dblValRea[ 3 ] = { 0.0, 0.0, 0.0 };
+	int flaRea( -1 );
+	int nDblRea( 0 );
+	Real64 simTimRea( 0.0 );
+
+	for ( int Step = 1; Step <= 2; ++Step ) {
+		// EnergyPlus posts its values of the time step
+		EXPECT_EQ( shmOK, PostSharedMemoryRequest( Client, 0, 3, 900.0 * Step, dblValWri ) );
+
+		// The peer reads them and answers with doubled values
+		EXPECT_EQ( shmOK, WaitForSharedMemoryRequest( Peer, flaRea, nDblRea, simTimRea, dblValPeer, 1.0 ) );
+		EXPECT_EQ( 0, flaRea );
+		EXPECT_EQ( 3, nDblRea );
+		EXPECT_DOUBLE_EQ( 900.0 * Step, simTimRea );
+		for ( int i = 0; i < 3; ++i ) dblValPeer[ i ] *= 2.0;
+		EXPECT_EQ( shmOK, PostSharedMemoryReply( Peer, 0, 3, simTimRea + 900.0, dblValPeer ) );
+
+		// EnergyPlus reads the answer
+		EXPECT_EQ( shmOK, WaitForSharedMemoryReply( Client, flaRea, nDblRea, simTimRea, dblValRea, 1.0 ) );
+		EXPECT_EQ( 0, flaRea );
+		EXPECT_EQ( 3, nDblRea );
+		EXPECT_DOUBLE_EQ( 900.0 * ( Step + 1 ), simTimRea );
+		EXPECT_DOUBLE_EQ( 2.0, dblValRea[ 0 ] );
+		EXPECT_DOUBLE_EQ( 5.0, dblValRea[ 1 ] );
+		EXPECT_DOUBLE_EQ( -8.0, dblValRea[ 2 ] );
+	}
+
+	CloseSharedMemoryChannel( Client );
+	CloseSharedMemoryChannel( Peer );
+}
+
+TEST( ExternalInterfaceSharedMemoryTest, Errors )
+{
+	std::string const Name( UniqueChannelName( "EnergyPlusShmErrors" ) );
+	SharedMemoryIPCType Peer;
+	SharedMemoryIPCType Client;
+	Real64 dblVal[ 1 ] = { 0.0 };
+	int flaRea( 0 );
+	int nDblRea( 0 );
+	Real64 simTimRea( 0.0 );
+
+	// Nothing to open before the peer created the channel
+	EXPECT_NE( shmOK, OpenSharedMemoryChannel( Name, Client ) );
+	EXPECT_EQ( shmNotOpen, PostSharedMemoryRequest( Client, 0, 0, 0.0, nullptr ) );
+
+	ASSERT_EQ( shmOK, CreateSharedMemoryChannel( Name, Peer ) );
+	ASSERT_EQ( shmOK, OpenSharedMemoryChannel( Name, Client ) );
+
+	EXPECT_EQ( shmTooManyDoubles, PostSharedMemoryRequest( Client, 0, maxSharedMemoryDoubles + 1, 0.0, dblVal ) );
+
+	// No reply is posted, so the wait must time out
+	EXPECT_EQ( shmOK, PostSharedMemoryRequest( Client, 0, 1, 0.0, dblVal ) );
+	EXPECT_EQ( shmTimeOut, WaitForSharedMemoryReply( Client, flaRea, nDblRea, simTimRea, dblVal, 0.01 ) );
+
+	CloseSharedMemoryChannel( Client );
+	CloseSharedMemoryChannel( Peer );
+}
+
+TEST( ExternalInterfaceSharedMemoryTest, SlowPeer )
+{
+	std::string const Name( UniqueChannelName( "EnergyPlusShmSlowPeer" ) );
+	SharedMemoryIPCType Peer;
+	SharedMemoryIPCType Client;
+	Real64 dblVal[ 1 ] = { 3.0 };
+	Real64 dblValRea[ 1 ] = { 0.0 };
+	int flaRea( -1 );
+	int nDblRea( 0 );
+	Real64 simTimRea( 0.0 );
+
+	ASSERT_EQ( shmOK, CreateSharedMemoryChannel( Name, Peer ) );
+	ASSERT_EQ( shmOK, OpenSharedMemoryChannel( Name, Client ) );
+
+	// The reply comes long after the spin phase, while EnergyPlus sleeps between polls
+	EXPECT_EQ( shmOK, PostSharedMemoryRequest( Client, 0, 1, 60.0, dblVal ) );
+	std::thread PeerThread( AnswerSlowly, std::ref( Peer ) );
+	EXPECT_EQ( shmOK, WaitForSharedMemoryReply( Client, flaRea, nDblRea, simTimRea, dblValRea, 5.0 ) );
+	PeerThread.join();
+	EXPECT_EQ( 1, nDblRea );
+	EXPECT_DOUBLE_EQ( 60.0, simTimRea );
+	EXPECT_DOUBLE_EQ( 3.0, dblValRea[ 0 ] );
+
+	CloseSharedMemoryChannel( Client );
+	CloseSharedMemoryChannel( Peer );
+}
+
+#ifndef _WIN32
+TEST( ExternalInterfaceSharedMemoryTest, PeerGone )
+{
+	std::string const Name( UniqueChannelName( "EnergyPlusShmPeerGone" ) );
+	SharedMemoryIPCType Peer;
+	SharedMemoryIPCType Client;
+	Real64 dblVal[ 1 ] = { 0.0 };
+	int flaRea( 0 );
+	int nDblRea( 0 );
+	Real64 simTimRea( 0.0 );
+
+	ASSERT_EQ( shmOK, CreateSharedMemoryChannel( Name, Peer ) );
+	ASSERT_EQ( shmOK, OpenSharedMemoryChannel( Name, Client ) );
+
+	// Pretend the channel was created by a process that has exited since
+	pid_t const Child( fork() );
+	ASSERT_GE( Child, 0 );
+	if ( Child == 0 ) _exit( 0 );
+	waitpid( Child, nullptr, 0 );
+	Client.Channel->peerProcessId.store( std::int32_t( Child ) );
+
+	// The wait ends soon after the check of the peer, long before the time out
+	auto const StartTime( std::chrono::steady_clock::now() );
+	EXPECT_EQ( shmOK, PostSharedMemoryRequest( Client, 0, 1, 0.0, dblVal ) );
+	EXPECT_EQ( shmPeerGone, WaitForSharedMemoryReply( Client, flaRea, nDblRea, simTimRea, dblVal, 60.0 ) );
+	std::chrono::duration< Real64 > const Elapsed( std::chrono::steady_clock::now() - StartTime );
+	EXPECT_LT( Elapsed.count(), 10.0 );
+
+	CloseSharedMemoryChannel( Client );
+	CloseSharedMemoryChannel( Peer );
+}
+#endif
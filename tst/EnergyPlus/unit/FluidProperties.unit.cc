@@ -0,0 +1,72 @@
+// EnergyPlus::FluidProperties Unit Tests
+
+// C++ Headers
+#include <algorithm>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FluidProperties.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::FluidProperties;
+using namespace ObjexxFCL;
+
+TEST( FluidPropertiesTest, TempGridMatchesLinearSearch )
+{
+	// Uneven spacing with zero data at both ends, as in the default glycol tables
+	FArray1D< Real64 > Temps( { -35.0, -30.0, -25.0, -20.0, -10.0, 0.0, 2.5, 5.0, 20.0, 40.0, 60.0, 100.0, 125.0 } );
+	int const LowTempIndex( 2 );
+	int const HighTempIndex( 12 );
+	FluidPropsTempGridData Grid;
+
+	InitializeTempGrid( Temps, LowTempIndex + 1, HighTempIndex, Grid );
+	EXPECT_GT( Grid.NumCells, 0 );
+
+	for ( Real64 Temperature = Temps( LowTempIndex ); Temperature <= Temps( HighTempIndex ); Temperature += 0.37 ) {
+		int Expected( 0 );
+		for ( int Loop = LowTempIndex + 1; Loop <= HighTempIndex; ++Loop ) {
+			if ( Temperature > Temps( Loop ) ) continue;
+			Expected = Loop;
+			break;
+		}
+		EXPECT_EQ( Expected, FindTempGridUpperIndex( Temperature, Temps, Grid ) );
+	}
+
+	// Exact data points and the range ends bracket from above, as the searches do
+	for ( int Loop = LowTempIndex; Loop <= HighTempIndex; ++Loop ) {
+		EXPECT_EQ( std::max( Loop, LowTempIndex + 1 ), FindTempGridUpperIndex( Temps( Loop ), Temps, Grid ) );
+	}
+}
+
+TEST( FluidPropertiesTest, TempGridNotBuiltForRepeatedTemps )
+{
+	FArray1D< Real64 > Temps( { 0.0, 10.0, 10.0, 20.0 } );
+	FluidPropsTempGridData Grid;
+
+	InitializeTempGrid( Temps, 2, 4, Grid );
+	EXPECT_EQ( 0, Grid.NumCells );
+}
+
+TEST( FluidPropertiesTest, GridArrayIndexMatchesFindArrayIndex )
+{
+	// Superheated pressures are spaced unevenly over several decades
+	FArray1D< Real64 > Press( { 1.0e4, 2.0e4, 5.0e4, 1.0e5, 1.5e5, 2.0e5, 5.0e5, 1.0e6, 2.5e6, 5.0e6 } );
+	int const NumPress( Press.isize() );
+	FluidPropsTempGridData Grid;
+
+	InitializeTempGrid( Press, 2, NumPress, Grid );
+	EXPECT_GT( Grid.NumCells, 0 );
+
+	for ( Real64 Pressure = 0.5e4; Pressure <= 6.0e6; Pressure *= 1.07 ) {
+		EXPECT_EQ( FindArrayIndex( Pressure, Press, 1, NumPress ), FindGridArrayIndex( Pressure, Press, 1, NumPress, Grid ) );
+	}
+	for ( int Loop = 1; Loop <= NumPress; ++Loop ) {
+		EXPECT_EQ( FindArrayIndex( Press( Loop ), Press, 1, NumPress ), FindGridArrayIndex( Press( Loop ), Press, 1, NumPress, Grid ) );
+	}
+
+	// Without a grid the search falls back to FindArrayIndex
+	FluidPropsTempGridData NoGrid;
+	EXPECT_EQ( FindArrayIndex( 3.0e5, Press, 1, NumPress ), FindGridArrayIndex( 3.0e5, Press, 1, NumPress, NoGrid ) );
+}
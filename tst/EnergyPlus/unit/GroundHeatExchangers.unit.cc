@@ -0,0 +1,85 @@
+// EnergyPlus::GroundHeatExchangers Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cmath>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <GroundHeatExchangers.hh>
+#include <DataGlobals.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::GroundHeatExchangers;
+using namespace ObjexxFCL;
+
+namespace {
+
+// Hourly response factor evaluated directly from the g-function, without the per-borefield table
+Real64
+UncachedHourlyResponse(
+	int const GlheNum,
+	int const HourOffset,
+	Real64 const TimeSS_Factor,
+	Real64 const K_Ground_Factor
+)
+{
+	Real64 GfuncVal;
+	Real64 HourFrac = CurrentSimTime - int( CurrentSimTime );
+
+	INTERP( GlheNum, std::log( ( HourFrac + HourOffset ) / TimeSS_Factor ), GfuncVal );
+	return GfuncVal / K_Ground_Factor;
+}
+
+}
+
+TEST( GroundHeatExchangersTest, HourlyResponseCacheAcrossHistoryReset )
+{
+	int const NumHours( 48 );
+	Real64 const TimeSS_Factor( 1500.0 );
+	Real64 const K_Ground_Factor( 2.0 * DataGlobals::Pi * 0.7 );
+
+	NumVerticalGlhes = 1;
+	VerticalGlhe.allocate( NumVerticalGlhes );
+	VerticalGlhe( 1 ).NPairs = 5;
+	VerticalGlhe( 1 ).LNTTS.allocate( 5 );
+	VerticalGlhe( 1 ).LNTTS = FArray1D< Real64 >( { -15.0, -10.0, -6.0, -3.0, 0.0 } );
+	VerticalGlhe( 1 ).GFNC.allocate( 5 );
+	VerticalGlhe( 1 ).GFNC = FArray1D< Real64 >( { -2.0, 1.5, 3.5, 5.2, 6.4 } );
+	VerticalGlhe( 1 ).GfuncCorrection = -0.1;
+	VerticalGlhe( 1 ).HourlyResponse.dimension( NumHours, MaxTSinHr, 0.0 );
+	VerticalGlhe( 1 ).HourlyResponseFrac.dimension( MaxTSinHr, 0.0 );
+	VerticalGlhe( 1 ).HourlyResponseCount.dimension( MaxTSinHr, 0 );
+
+	// Fill the table over a first run, revisiting each hour fraction at later hours
+	FArray1D< Real64 > const FirstRun( { 1.25, 1.5, 3.25, 3.5, 3.75, 20.25, 20.5, 20.75, 30.0, 40.25 } );
+	for ( int Step = 1; Step <= FirstRun.isize(); ++Step ) {
+		CurrentSimTime = FirstRun( Step );
+		for ( int Offset = 1; Offset <= int( CurrentSimTime ); ++Offset ) {
+			EXPECT_DOUBLE_EQ( UncachedHourlyResponse( 1, Offset, TimeSS_Factor, K_Ground_Factor ), HourlyResponseFactor( 1, Offset, TimeSS_Factor, K_Ground_Factor ) );
+		}
+	}
+
+	// Reset the history as at the start of a new environment; the table is keyed only on the
+	// hour fraction, so the responses filled before the reset must still match a recomputation
+	CurrentSimTime = 0.0;
+	VerticalGlhe( 1 ).HistoryN = 0;
+	FArray1D< Real64 > const SecondRun( { 0.5, 1.25, 2.0, 2.75, 8.5, 45.75 } );
+	for ( int Step = 1; Step <= SecondRun.isize(); ++Step ) {
+		CurrentSimTime = SecondRun( Step );
+		for ( int Offset = 1; Offset <= int( CurrentSimTime ); ++Offset ) {
+			EXPECT_DOUBLE_EQ( UncachedHourlyResponse( 1, Offset, TimeSS_Factor, K_Ground_Factor ), HourlyResponseFactor( 1, Offset, TimeSS_Factor, K_Ground_Factor ) );
+		}
+	}
+
+	// The slot filled for this hour fraction before the reset was extended rather than refilled
+	EXPECT_EQ( 45, VerticalGlhe( 1 ).HourlyResponseCount( VerticalGlhe( 1 ).HourlyResponseSlot ) );
+
+	CurrentSimTime = 0.0;
+	VerticalGlhe.deallocate();
+	NumVerticalGlhes = 0;
+}
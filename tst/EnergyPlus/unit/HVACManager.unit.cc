@@ -0,0 +1,161 @@
+// EnergyPlus::HVACManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <HVACManager.hh>
+#include <DataAirLoop.hh>
+#include <DataAirSystems.hh>
+#include <DataBranchNodeConnections.hh>
+#include <DataGlobals.hh>
+#include <DataHVACGlobals.hh>
+#include <DataPlant.hh>
+#include <DataZoneEquipment.hh>
+#include <General.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HVACManager;
+
+namespace {
+
+// Air loop with one branch holding one component
+void
+SetUpAirLoop(
+	int const AirLoopNum,
+	std::string const & CompType,
+	std::string const & CompName,
+	int const ZoneNum // zone cooled by the air loop
+)
+{
+	auto & air_sys( DataAirSystems::PrimaryAirSystem( AirLoopNum ) );
+	air_sys.Name = "AIR LOOP " + General::TrimSigDigits( AirLoopNum );
+	air_sys.NumBranches = 1;
+	air_sys.Branch.allocate( 1 );
+	air_sys.Branch( 1 ).Name = air_sys.Name + " BRANCH";
+	air_sys.Branch( 1 ).TotalComponents = 1;
+	air_sys.Branch( 1 ).Comp.allocate( 1 );
+	air_sys.Branch( 1 ).Comp( 1 ).TypeOf = CompType;
+	air_sys.Branch( 1 ).Comp( 1 ).Name = CompName;
+	auto & air_to_zone( DataAirLoop::AirToZoneNodeInfo( AirLoopNum ) );
+	air_to_zone.NumZonesCooled = 1;
+	air_to_zone.CoolCtrlZoneNums.dimension( 1, ZoneNum );
+	air_to_zone.NumZonesHeated = 0;
+}
+
+// Plant loop with a demand side branch holding one component
+void
+SetUpPlantLoop(
+	int const LoopNum,
+	std::string const & CompType,
+	std::string const & CompName,
+	int const ConnectedLoopNum // loop connected to the supply side (0 = none)
+)
+{
+	auto & loop( DataPlant::PlantLoop( LoopNum ) );
+	loop.Name = "PLANT LOOP " + General::TrimSigDigits( LoopNum );
+	loop.LoopSide.allocate( 2 );
+	auto & demand_side( loop.LoopSide( DataPlant::DemandSide ) );
+	demand_side.TotalBranches = 1;
+	demand_side.Branch.allocate( 1 );
+	demand_side.Branch( 1 ).TotalComponents = 1;
+	demand_side.Branch( 1 ).Comp.allocate( 1 );
+	demand_side.Branch( 1 ).Comp( 1 ).TypeOf = CompType;
+	demand_side.Branch( 1 ).Comp( 1 ).Name = CompName;
+	auto & supply_side( loop.LoopSide( DataPlant::SupplySide ) );
+	if ( ConnectedLoopNum > 0 ) {
+		supply_side.TotalConnected = 1;
+		supply_side.Connected.allocate( 1 );
+		supply_side.Connected( 1 ).LoopNum = ConnectedLoopNum;
+		supply_side.Connected( 1 ).LoopSideNum = DataPlant::DemandSide;
+	}
+}
+
+void
+SetCompSet(
+	int const CompSetNum,
+	std::string const & ParentCType,
+	std::string const & ParentCName,
+	std::string const & CType,
+	std::string const & CName
+)
+{
+	auto & comp_set( DataBranchNodeConnections::CompSets( CompSetNum ) );
+	comp_set.ParentCType = ParentCType;
+	comp_set.ParentCName = ParentCName;
+	comp_set.CType = CType;
+	comp_set.CName = CName;
+}
+
+}
+
+TEST( HVACManagerTest, LoopConcurrencyGroups )
+{
+	using DataAirLoop::AirToZoneNodeInfo;
+	using DataAirSystems::PrimaryAirSystem;
+	using DataBranchNodeConnections::CompSets;
+	using DataBranchNodeConnections::NumCompSets;
+	using DataPlant::PlantLoop;
+	using DataZoneEquipment::ZoneEquipConfig;
+	using DataZoneEquipment::ZoneEquipList;
+
+	// Air loop 1 has a chilled water coil on plant loop 1, which is connected to condenser loop 3.
+	// Air loop 2 serves zone 2, whose air terminal has a reheat coil on plant loop 2.
+	// Air loop 3 and air loop 4 serve zone 3, plant loop 4 serves nothing of either.
+	DataGlobals::NumOfZones = 3;
+	DataHVACGlobals::NumPrimaryAirSys = 4;
+	DataPlant::TotNumLoops = 4;
+	PrimaryAirSystem.allocate( 4 );
+	AirToZoneNodeInfo.allocate( 4 );
+	PlantLoop.allocate( 4 );
+	SetUpAirLoop( 1, "Coil:Cooling:Water", "Cooling Coil 1", 1 );
+	SetUpAirLoop( 2, "Fan:VariableVolume", "Fan 2", 2 );
+	SetUpAirLoop( 3, "AirLoopHVAC:UnitarySystem", "Unitary 3", 3 );
+	SetUpAirLoop( 4, "Fan:ConstantVolume", "Fan 4", 3 );
+	SetUpPlantLoop( 1, "Coil:Cooling:Water", "COOLING COIL 1", 3 );
+	SetUpPlantLoop( 2, "Coil:Heating:Water", "Reheat Coil 2", 0 );
+	SetUpPlantLoop( 3, "Chiller:Electric:EIR", "Chiller 1", 0 );
+	SetUpPlantLoop( 4, "WaterHeater:Mixed", "Water Heater 4", 0 );
+
+	ZoneEquipConfig.allocate( 3 );
+	ZoneEquipList.allocate( 3 );
+	for ( int ZoneNum = 1; ZoneNum <= 3; ++ZoneNum ) {
+		ZoneEquipConfig( ZoneNum ).IsControlled = true;
+		ZoneEquipConfig( ZoneNum ).ActualZoneNum = ZoneNum;
+	}
+	ZoneEquipList( 2 ).NumOfEquipTypes = 1;
+	ZoneEquipList( 2 ).EquipType.dimension( 1, "ZoneHVAC:AirDistributionUnit" );
+	ZoneEquipList( 2 ).EquipName.dimension( 1, "ADU 2" );
+
+	// The reheat coil is found through its air terminal and air distribution unit
+	NumCompSets = 2;
+	CompSets.allocate( NumCompSets );
+	SetCompSet( 1, "AIRTERMINAL:SINGLEDUCT:VAV:REHEAT", "VAV 2", "COIL:HEATING:WATER", "REHEAT COIL 2" );
+	SetCompSet( 2, "ZONEHVAC:AIRDISTRIBUTIONUNIT", "ADU 2", "AIRTERMINAL:SINGLEDUCT:VAV:REHEAT", "VAV 2" );
+
+	SetupLoopConcurrencyGroups();
+
+	EXPECT_EQ( 4, NumLoopConcurrencyGroups );
+	EXPECT_EQ( 1, AirLoopConcurrencyGroup( 1 ) );
+	EXPECT_EQ( 2, AirLoopConcurrencyGroup( 2 ) );
+	EXPECT_EQ( 3, AirLoopConcurrencyGroup( 3 ) );
+	EXPECT_EQ( 3, AirLoopConcurrencyGroup( 4 ) );
+	EXPECT_EQ( 1, PlantLoopConcurrencyGroup( 1 ) );
+	EXPECT_EQ( 2, PlantLoopConcurrencyGroup( 2 ) );
+	EXPECT_EQ( 1, PlantLoopConcurrencyGroup( 3 ) );
+	EXPECT_EQ( 4, PlantLoopConcurrencyGroup( 4 ) );
+
+	DataGlobals::NumOfZones = 0;
+	DataHVACGlobals::NumPrimaryAirSys = 0;
+	DataPlant::TotNumLoops = 0;
+	NumCompSets = 0;
+	PrimaryAirSystem.deallocate();
+	AirToZoneNodeInfo.deallocate();
+	PlantLoop.deallocate();
+	ZoneEquipConfig.deallocate();
+	ZoneEquipList.deallocate();
+	CompSets.deallocate();
+	NumLoopConcurrencyGroups = 0;
+	AirLoopConcurrencyGroup.deallocate();
+	PlantLoopConcurrencyGroup.deallocate();
+}
@@ -0,0 +1,65 @@
+// EnergyPlus::HeatBalanceIntRadExchange Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
+
+// EnergyPlus Headers
+#include <HeatBalanceIntRadExchange.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HeatBalanceIntRadExchange;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceIntRadExchangeTest, UpdateRadiosityInverse )
+{
+	// Cube-like enclosure of 8 surfaces: every surface sees the others equally
+	int const N( 8 );
+	FArray1D< Real64 > A( N, 10.0 );
+	FArray2D< Real64 > F( N, N, 1.0 / ( N - 1 ) );
+	for ( int i = 1; i <= N; ++i ) F( i, i ) = 0.0;
+	A( 1 ) = 4.0; // window
+	A( 2 ) = 6.0; // window
+
+	FArray1D< Real64 > BaseEmiss( N, 0.9 );
+	BaseEmiss( 1 ) = 0.84;
+	BaseEmiss( 2 ) = 0.84;
+	FArray2D< Real64 > BaseInverse( N, N );
+	FArray1D< Real64 > Emiss( BaseEmiss );
+	CalcRadiosityInverse( N, A, F, Emiss, BaseInverse );
+
+	// Interior shades on both windows
+	FArray1D< Real64 > ShadedEmiss( BaseEmiss );
+	ShadedEmiss( 1 ) = 0.6;
+	ShadedEmiss( 2 ) = 0.35;
+	FArray2D< Real64 > Expected( N, N );
+	Emiss = ShadedEmiss;
+	CalcRadiosityInverse( N, A, F, Emiss, Expected );
+
+	FArray2D< Real64 > Updated( N, N );
+	Emiss = ShadedEmiss;
+	ASSERT_TRUE( UpdateRadiosityInverse( N, A, BaseEmiss, Emiss, BaseInverse, Updated ) );
+	for ( int j = 1; j <= N; ++j ) {
+		for ( int i = 1; i <= N; ++i ) {
+			EXPECT_NEAR( Expected( i, j ), Updated( i, j ), 1.0e-12 );
+		}
+	}
+
+	// Same Script F from either inverse
+	FArray2D< Real64 > ExpectedScriptF( N, N );
+	FArray2D< Real64 > UpdatedScriptF( N, N );
+	CalcScriptFFromInverse( N, A, Emiss, Expected, ExpectedScriptF );
+	CalcScriptFFromInverse( N, A, Emiss, Updated, UpdatedScriptF );
+	for ( int j = 1; j <= N; ++j ) {
+		for ( int i = 1; i <= N; ++i ) {
+			EXPECT_NEAR( ExpectedScriptF( i, j ), UpdatedScriptF( i, j ), 1.0e-12 );
+		}
+	}
+
+	// Too many changed surfaces for a low rank update
+	Emiss = 0.5;
+	EXPECT_FALSE( UpdateRadiosityInverse( N, A, BaseEmiss, Emiss, BaseInverse, Updated ) );
+}
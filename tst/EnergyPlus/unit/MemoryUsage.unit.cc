@@ -0,0 +1,61 @@
+// EnergyPlus::MemoryUsage Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray2D.hh>
+
+// EnergyPlus Headers
+#include <MemoryUsage.hh>
+#include <DataViewFactorInformation.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::MemoryUsage;
+using namespace ObjexxFCL;
+
+TEST( MemoryUsageTest, ArrayBytes )
+{
+	FArray2D< Real64 > A( 3, 4 );
+	EXPECT_DOUBLE_EQ( 12.0 * sizeof( Real64 ), ArrayBytes( A ) );
+
+	std::vector< int > V;
+	V.reserve( 10 );
+	EXPECT_DOUBLE_EQ( Real64( V.capacity() ) * sizeof( int ), ArrayBytes( V ) );
+
+	FArray1D< Real64 > Empty;
+	EXPECT_DOUBLE_EQ( 0.0, ArrayBytes( Empty ) );
+}
+
+TEST( MemoryUsageTest, ModuleArrayBytes )
+{
+	using DataViewFactorInformation::ZoneInfo;
+
+	Real64 const EmptyBytes( ModuleArrayBytes( IntRadExchangeModule ) );
+
+	// nested arrays of the derived types are counted
+	ZoneInfo.allocate( 2 );
+	ZoneInfo( 1 ).F.allocate( 4, 4 );
+	ZoneInfo( 2 ).ScriptF.allocate( 6, 6 );
+	EXPECT_DOUBLE_EQ( EmptyBytes + ArrayBytes( ZoneInfo ) + ( 16.0 + 36.0 ) * sizeof( Real64 ), ModuleArrayBytes( IntRadExchangeModule ) );
+
+	ZoneInfo.deallocate();
+	EXPECT_DOUBLE_EQ( EmptyBytes, ModuleArrayBytes( IntRadExchangeModule ) );
+}
+
+TEST( MemoryUsageTest, GetProcessMemoryUsage )
+{
+	Real64 ResidentBytes;
+	Real64 PeakResidentBytes;
+	GetProcessMemoryUsage( ResidentBytes, PeakResidentBytes );
+#ifdef __linux__
+	EXPECT_GT( ResidentBytes, 0.0 );
+	EXPECT_GE( PeakResidentBytes, ResidentBytes );
+#else
+	EXPECT_DOUBLE_EQ( -1.0, ResidentBytes );
+	EXPECT_DOUBLE_EQ( -1.0, PeakResidentBytes );
+#endif
+}
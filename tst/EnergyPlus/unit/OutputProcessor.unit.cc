@@ -0,0 +1,79 @@
+// EnergyPlus::OutputProcessor Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus/OutputProcessor.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::OutputProcessor;
+
+TEST( OutputProcessorTest, DirectCSVOutput )
+{
+	AddDirectCSVColumn( ReportHourly, 7, "ZONE ONE:Zone Mean Air Temperature [C]" );
+
+	StartDirectCSVRow( ReportHourly, " 01/21  01:00:00" );
+	SetDirectCSVValue( 7, "20.5" );
+
+	// a column added after the first row was written
+	StartDirectCSVRow( ReportHourly, " 01/21  02:00:00" );
+	AddDirectCSVColumn( ReportHourly, 9, "Electricity:Facility [J]" );
+	SetDirectCSVValue( 9, "100.0" );
+	StartDirectCSVRow( ReportHourly, " 01/21  02:00:00" ); // same time stamp continues the row
+	SetDirectCSVValue( 7, "21.0" );
+
+	// not in a table
+	SetDirectCSVValue( 8, "1.0" );
+
+	CloseDirectCSVOutput();
+
+	std::ifstream Table( "eplusout_hourly.csv" );
+	std::string Line;
+	ASSERT_TRUE( static_cast< bool >( std::getline( Table, Line ) ) );
+	EXPECT_EQ( "Date/Time,ZONE ONE:Zone Mean Air Temperature [C](Hourly),Electricity:Facility [J](Hourly)", Line );
+	ASSERT_TRUE( static_cast< bool >( std::getline( Table, Line ) ) );
+	EXPECT_EQ( " 01/21  01:00:00,20.5,", Line );
+	ASSERT_TRUE( static_cast< bool >( std::getline( Table, Line ) ) );
+	EXPECT_EQ( " 01/21  02:00:00,21.0,100.0", Line );
+	EXPECT_FALSE( static_cast< bool >( std::getline( Table, Line ) ) );
+	Table.close();
+
+	EXPECT_FALSE( std::ifstream( "eplusout_hourly.csv.tmp" ).good() );
+	std::remove( "eplusout_hourly.csv" );
+}
+
+TEST( OutputProcessorTest, DirectCSVOutputTwoDesignDays )
+{
+	// Run period rows of two design days have the same time stamp
+	DataEnvironment::CurEnvirNum = 1;
+	AddDirectCSVColumn( ReportSim, 3, "Environment:Site Outdoor Air Drybulb Temperature [C]" );
+	StartDirectCSVRow( ReportSim, "simdays=1" );
+	SetDirectCSVValue( 3, "-17.3" );
+
+	DataEnvironment::CurEnvirNum = 2;
+	StartDirectCSVRow( ReportSim, "simdays=1" );
+	SetDirectCSVValue( 3, "23.8" );
+
+	CloseDirectCSVOutput();
+	DataEnvironment::CurEnvirNum = 0;
+
+	std::ifstream Table( "eplusout_runperiod.csv" );
+	std::string Line;
+	ASSERT_TRUE( static_cast< bool >( std::getline( Table, Line ) ) );
+	EXPECT_EQ( "Date/Time,Environment:Site Outdoor Air Drybulb Temperature [C](RunPeriod)", Line );
+	ASSERT_TRUE( static_cast< bool >( std::getline( Table, Line ) ) );
+	EXPECT_EQ( "simdays=1,-17.3", Line );
+	ASSERT_TRUE( static_cast< bool >( std::getline( Table, Line ) ) );
+	EXPECT_EQ( "simdays=1,23.8", Line );
+	EXPECT_FALSE( static_cast< bool >( std::getline( Table, Line ) ) );
+	Table.close();
+
+	std::remove( "eplusout_runperiod.csv" );
+}
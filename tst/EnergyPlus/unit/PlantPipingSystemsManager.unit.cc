@@ -0,0 +1,47 @@
+// EnergyPlus::PlantPipingSystemsManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <PlantPipingSystemsManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::PlantPipingSystemsManager;
+using namespace ObjexxFCL;
+
+TEST( PlantPipingSystemsManagerTest, SolveTridiagonalSystem )
+{
+	// Line of 5 cells: (1 + 2c) * T(i) - c * T(i-1) - c * T(i+1) = RHS(i), with the known solution T(i) = i
+	int const N( 5 );
+	Real64 const c( 0.5 );
+	FArray1D< Real64 > Lower( N, -c );
+	FArray1D< Real64 > Diag( N, 1.0 + 2.0 * c );
+	FArray1D< Real64 > Upper( N, -c );
+	FArray1D< Real64 > RHS( N );
+	Diag( 1 ) = 1.0 + c; // end cells have one line neighbor
+	Diag( N ) = 1.0 + c;
+	for ( int i = 1; i <= N; ++i ) {
+		RHS( i ) = Diag( i ) * i;
+		if ( i > 1 ) RHS( i ) += Lower( i ) * ( i - 1 );
+		if ( i < N ) RHS( i ) += Upper( i ) * ( i + 1 );
+	}
+
+	SolveTridiagonalSystem( N, Lower, Diag, Upper, RHS );
+
+	for ( int i = 1; i <= N; ++i ) {
+		EXPECT_NEAR( Real64( i ), RHS( i ), 1.0e-12 );
+	}
+
+	// only the first N equations are solved when the arrays are larger
+	FArray1D< Real64 > LongLower( 8, 0.0 );
+	FArray1D< Real64 > LongDiag( 8, 2.0 );
+	FArray1D< Real64 > LongUpper( 8, 0.0 );
+	FArray1D< Real64 > LongRHS( 8, 4.0 );
+	SolveTridiagonalSystem( 1, LongLower, LongDiag, LongUpper, LongRHS );
+	EXPECT_DOUBLE_EQ( 2.0, LongRHS( 1 ) );
+	EXPECT_DOUBLE_EQ( 4.0, LongRHS( 2 ) );
+}
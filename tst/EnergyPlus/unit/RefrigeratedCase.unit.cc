@@ -0,0 +1,79 @@
+// EnergyPlus::RefrigeratedCase Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <string>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <RefrigeratedCase.hh>
+#include <DataErrorTracking.hh>
+#include <DataHeatBalance.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RefrigeratedCase;
+using namespace ObjexxFCL;
+
+TEST( RefrigeratedCaseTest, CoupledSystemsNotConverged )
+{
+	using DataErrorTracking::NumRecurringErrors;
+	using DataErrorTracking::RecurringErrors;
+	using DataHeatBalance::NumRefrigCondensers;
+	using DataHeatBalance::NumRefrigSystems;
+
+	// Two systems sharing a condenser and a third, independent system
+	NumRefrigSystems = 3;
+	System.allocate( NumRefrigSystems );
+	System( 1 ).Name = "MEDIUM TEMP SYSTEM";
+	System( 2 ).Name = "LOW TEMP SYSTEM";
+	System( 3 ).Name = "STAND ALONE SYSTEM";
+	NumRefrigCondensers = 2;
+	Condenser.allocate( NumRefrigCondensers );
+	Condenser( 1 ).NumSysAttach = 2;
+	Condenser( 1 ).SysNum.dimension( NumRefrigSystems, 0 );
+	Condenser( 1 ).SysNum( 1 ) = 1;
+	Condenser( 1 ).SysNum( 2 ) = 2;
+	Condenser( 2 ).NumSysAttach = 1;
+	Condenser( 2 ).SysNum.dimension( NumRefrigSystems, 0 );
+	Condenser( 2 ).SysNum( 1 ) = 3;
+
+	SetupRefrigSystemCoupling();
+	EXPECT_EQ( 1, System( 1 ).CouplingGroup );
+	EXPECT_EQ( 1, System( 2 ).CouplingGroup );
+	EXPECT_EQ( 0, System( 3 ).CouplingGroup );
+
+	FArray1D_bool CouplingGroupConverged( NumRefrigSystems, false );
+	FArray1D< Real64 > CouplingGroupError( NumRefrigSystems, 0.0 );
+	CouplingGroupError( 1 ) = 0.02;
+	int const NumErrorsBefore( NumRecurringErrors );
+
+	// One recurring warning for the group, kept on its lowest system and naming both systems
+	ReportCoupledSystemConvergence( CouplingGroupConverged, CouplingGroupError );
+	ASSERT_EQ( NumErrorsBefore + 1, NumRecurringErrors );
+	EXPECT_EQ( NumRecurringErrors, System( 1 ).CouplingWarnIndex );
+	EXPECT_EQ( 0, System( 2 ).CouplingWarnIndex );
+	EXPECT_EQ( 0, System( 3 ).CouplingWarnIndex );
+	EXPECT_NE( std::string::npos, RecurringErrors( NumRecurringErrors ).Message.find( "MEDIUM TEMP SYSTEM, LOW TEMP SYSTEM" ) );
+	EXPECT_EQ( std::string::npos, RecurringErrors( NumRecurringErrors ).Message.find( "STAND ALONE SYSTEM" ) );
+
+	// Later time steps count against the same warning
+	CouplingGroupError( 1 ) = 0.05;
+	ReportCoupledSystemConvergence( CouplingGroupConverged, CouplingGroupError );
+	EXPECT_EQ( NumErrorsBefore + 1, NumRecurringErrors );
+	EXPECT_EQ( 2, RecurringErrors( NumRecurringErrors ).Count );
+	EXPECT_DOUBLE_EQ( 0.05, RecurringErrors( NumRecurringErrors ).MaxValue );
+
+	// A converged group is not reported
+	CouplingGroupConverged( 1 ) = true;
+	ReportCoupledSystemConvergence( CouplingGroupConverged, CouplingGroupError );
+	EXPECT_EQ( 2, RecurringErrors( NumRecurringErrors ).Count );
+
+	System.deallocate();
+	Condenser.deallocate();
+	NumRefrigSystems = 0;
+	NumRefrigCondensers = 0;
+}
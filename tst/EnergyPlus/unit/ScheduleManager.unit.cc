@@ -0,0 +1,90 @@
+// EnergyPlus::ScheduleManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/ScheduleManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ScheduleManager;
+using namespace ObjexxFCL;
+
+TEST( ScheduleManagerTest, ScheduleReferencedDuringRun )
+{
+	ScheduleInputProcessed = true;
+	NumSchedules = 2;
+	Schedule.allocate( NumSchedules );
+	WeekSchedule.allocate( {0,NumSchedules} );
+	DaySchedule.allocate( {0,NumSchedules} );
+	DataGlobals::NumOfTimeStepInHour = 2;
+	for ( int SchNum = 1; SchNum <= NumSchedules; ++SchNum ) {
+		DaySchedule( SchNum ).TSValue.allocate( 24, DataGlobals::NumOfTimeStepInHour );
+		for ( int Hour = 1; Hour <= 24; ++Hour ) {
+			for ( int TS = 1; TS <= DataGlobals::NumOfTimeStepInHour; ++TS ) {
+				DaySchedule( SchNum ).TSValue( Hour, TS ) = 100.0 * SchNum + Hour + 0.1 * TS;
+			}
+		}
+		WeekSchedule( SchNum ).DaySchedulePointer = SchNum;
+		Schedule( SchNum ).WeekSchedulePointer = SchNum;
+	}
+	Schedule( 1 ).Name = "FIRST";
+	Schedule( 2 ).Name = "SECOND";
+
+	DataEnvironment::DayOfYear_Schedule = 10;
+	DataEnvironment::DayOfWeek = 3;
+	DataEnvironment::HolidayIndex = 0;
+	DataEnvironment::DSTIndicator = 0;
+	DataGlobals::HourOfDay = 5;
+	DataGlobals::TimeStep = 2;
+
+	EXPECT_EQ( 1, GetScheduleIndex( "FIRST" ) );
+	UpdateScheduleValues();
+	EXPECT_EQ( 1, NumActiveSchedules );
+	EXPECT_DOUBLE_EQ( 105.2, Schedule( 1 ).CurrentValue );
+	EXPECT_DOUBLE_EQ( 0.0, Schedule( 2 ).CurrentValue );
+
+	// A schedule first referenced during the run is added to the active list with its current value
+	EXPECT_EQ( 2, GetScheduleIndex( "SECOND" ) );
+	EXPECT_EQ( 2, NumActiveSchedules );
+	EXPECT_EQ( 2, ActiveSchedule( 2 ) );
+	EXPECT_DOUBLE_EQ( 205.2, Schedule( 2 ).CurrentValue );
+	EXPECT_FALSE( ActiveScheduleListChanged );
+
+	DataGlobals::TimeStep = 1;
+	UpdateScheduleValues();
+	EXPECT_DOUBLE_EQ( 105.1, Schedule( 1 ).CurrentValue );
+	EXPECT_DOUBLE_EQ( 205.1, Schedule( 2 ).CurrentValue );
+
+	NumSchedules = 0;
+	NumActiveSchedules = 0;
+	Schedule.deallocate();
+	WeekSchedule.deallocate();
+	DaySchedule.deallocate();
+	ActiveSchedule.deallocate();
+	ActiveDaySchedulePtr.deallocate();
+	ActiveScheduleListChanged = true;
+	ScheduleValuesUpdated = false;
+	ScheduleInputProcessed = false;
+}
+
+TEST( ScheduleManagerTest, DayScheduleValueHash )
+{
+	FArray2D< Real64 > FirstDay( 24, 4, 0.5 );
+	FArray2D< Real64 > SecondDay( 24, 4, 0.5 );
+	EXPECT_EQ( DayScheduleValueHash( FirstDay ), DayScheduleValueHash( SecondDay ) );
+
+	SecondDay( 13, 2 ) = 0.75;
+	EXPECT_NE( DayScheduleValueHash( FirstDay ), DayScheduleValueHash( SecondDay ) );
+	FirstDay( 13, 2 ) = 0.75;
+	EXPECT_EQ( DayScheduleValueHash( FirstDay ), DayScheduleValueHash( SecondDay ) );
+
+	// The same values in a different order are a different profile
+	FirstDay( 1, 1 ) = 1.0;
+	FirstDay( 1, 2 ) = 2.0;
+	SecondDay( 1, 1 ) = 2.0;
+	SecondDay( 1, 2 ) = 1.0;
+	EXPECT_NE( DayScheduleValueHash( FirstDay ), DayScheduleValueHash( SecondDay ) );
+}
@@ -0,0 +1,171 @@
+// EnergyPlus::SolarShading Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cmath>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
+// EnergyPlus Headers
+#include <SolarShading.hh>
+#include <DataBSDFWindow.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataShadowingCombinations.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SolarShading;
+using namespace ObjexxFCL;
+
+namespace {
+
+// Two sunlit receiving surfaces without shading surfaces or subsurfaces
+void
+SetUpSunlitFracCacheTest( Real64 const Tolerance )
+{
+	using DataBSDFWindow::MaxBkSurf;
+	using DataHeatBalance::BackSurfaces;
+	using DataHeatBalance::OverlapAreas;
+	using DataHeatBalance::SunlitFracWithoutReveal;
+	using DataShadowingCombinations::ShadowComb;
+	using DataSurfaces::Surface;
+	using DataSurfaces::TotSurfaces;
+
+	DataSystemVariables::SunlitFracCacheTolerance = Tolerance;
+	GetSunlitFracCacheSettings = true;
+	SunlitFracCache.clear();
+	SunlitFracCacheIndex.clear();
+	NumSunlitFracCacheLookups = 0;
+	NumSunlitFracCacheHits = 0;
+	NumSunlitFracCacheChecks = 0;
+	MaxSunlitFracCacheDeviation = 0.0;
+
+	TotSurfaces = 2;
+	Surface.allocate( TotSurfaces );
+	Surface( 1 ).Area = Surface( 1 ).NetAreaShadowCalc = 10.0;
+	Surface( 2 ).Area = Surface( 2 ).NetAreaShadowCalc = 4.0;
+	ShadowComb.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) ShadowComb( SurfNum ).UseThisSurf = true;
+	CTHETA.dimension( TotSurfaces, 0.5 );
+	SAREA.dimension( TotSurfaces, 0.0 );
+	SunlitFracWithoutReveal.dimension( TotSurfaces, 24, 1, 0.0 );
+	WindowRevealStatus.dimension( TotSurfaces, 24, 1, 0 );
+	BackSurfaces.dimension( TotSurfaces, MaxBkSurf, 24, 1, 0 );
+	OverlapAreas.dimension( TotSurfaces, MaxBkSurf, 24, 1, 0.0 );
+}
+
+void
+TearDownSunlitFracCacheTest()
+{
+	DataSystemVariables::SunlitFracCacheTolerance = 0.0;
+	GetSunlitFracCacheSettings = true;
+	SunlitFracCache.clear();
+	SunlitFracCacheIndex.clear();
+	DataSurfaces::TotSurfaces = 0;
+	DataSurfaces::Surface.deallocate();
+	DataShadowingCombinations::ShadowComb.deallocate();
+	CTHETA.deallocate();
+	SAREA.deallocate();
+	DataHeatBalance::SunlitFracWithoutReveal.deallocate();
+	WindowRevealStatus.deallocate();
+	DataHeatBalance::BackSurfaces.deallocate();
+	DataHeatBalance::OverlapAreas.deallocate();
+}
+
+// Sun direction from its altitude and azimuth {deg}
+void
+SetSunDirection(
+	Real64 const Altitude,
+	Real64 const Azimuth
+)
+{
+	Real64 const Alt( Altitude * DataGlobals::DegToRadians );
+	Real64 const Azi( Azimuth * DataGlobals::DegToRadians );
+	SUNCOS( 1 ) = std::cos( Alt ) * std::sin( Azi );
+	SUNCOS( 2 ) = std::cos( Alt ) * std::cos( Azi );
+	SUNCOS( 3 ) = std::sin( Alt );
+}
+
+}
+
+TEST( SolarShadingTest, SunlitFracCacheOff )
+{
+	using DataHeatBalance::BackSurfaces;
+
+	SetUpSunlitFracCacheTest( 0.0 );
+	SetSunDirection( 40.0, 170.0 );
+	CTHETA( 2 ) = -0.5; // Surface 2 faces away from the sun
+
+	SHADOW( 10, 1 );
+	FArray1D< Real64 > const ShadowSAREA( SAREA );
+	BackSurfaces( 1, 1, 10, 1 ) = 2;
+
+	// Without EP_SUNLIT_CACHE_TOLERANCE the shadows are always calculated: bit-identical results
+	for ( int Repeat = 1; Repeat <= 2; ++Repeat ) {
+		SAREA = -1.0;
+		CachedSHADOW( 10, 1 );
+		for ( int SurfNum = 1; SurfNum <= 2; ++SurfNum ) {
+			EXPECT_EQ( ShadowSAREA( SurfNum ), SAREA( SurfNum ) );
+		}
+	}
+	EXPECT_EQ( 2, BackSurfaces( 1, 1, 10, 1 ) );
+	EXPECT_FALSE( UseSunlitFracCache );
+	EXPECT_EQ( 0, NumSunlitFracCacheLookups );
+	EXPECT_TRUE( SunlitFracCache.empty() );
+
+	TearDownSunlitFracCacheTest();
+}
+
+TEST( SolarShadingTest, SunlitFracCacheHit )
+{
+	using DataHeatBalance::BackSurfaces;
+	using DataHeatBalance::OverlapAreas;
+	using DataHeatBalance::SunlitFracWithoutReveal;
+
+	SetUpSunlitFracCacheTest( 1.0 );
+
+	// First sun direction: calculated and stored with the other results of the time step
+	SetSunDirection( 40.0, 170.0 );
+	SunlitFracWithoutReveal( 1, 10, 1 ) = 0.7;
+	SunlitFracWithoutReveal( 2, 10, 1 ) = 0.4;
+	WindowRevealStatus( 1, 10, 1 ) = 1;
+	BackSurfaces( 1, 1, 10, 1 ) = 2;
+	OverlapAreas( 1, 1, 10, 1 ) = 1.5;
+	CachedSHADOW( 10, 1 );
+	EXPECT_TRUE( UseSunlitFracCache );
+	EXPECT_EQ( 1, NumSunlitFracCacheLookups );
+	EXPECT_EQ( 0, NumSunlitFracCacheHits );
+	ASSERT_EQ( 1u, SunlitFracCache.size() );
+
+	// Nearby sun direction at another hour: reused
+	SetSunDirection( 40.05, 170.05 );
+	SHADOW( 11, 1 );
+	FArray1D< Real64 > const ShadowSAREA( SAREA );
+	SAREA = -1.0;
+	CachedSHADOW( 11, 1 );
+	EXPECT_EQ( 2, NumSunlitFracCacheLookups );
+	EXPECT_EQ( 1, NumSunlitFracCacheHits );
+	for ( int SurfNum = 1; SurfNum <= 2; ++SurfNum ) {
+		EXPECT_NEAR( ShadowSAREA( SurfNum ), SAREA( SurfNum ), 1.e-6 * DataSurfaces::Surface( SurfNum ).NetAreaShadowCalc );
+		EXPECT_EQ( SunlitFracWithoutReveal( SurfNum, 10, 1 ), SunlitFracWithoutReveal( SurfNum, 11, 1 ) );
+		EXPECT_EQ( WindowRevealStatus( SurfNum, 10, 1 ), WindowRevealStatus( SurfNum, 11, 1 ) );
+	}
+	EXPECT_EQ( 2, BackSurfaces( 1, 1, 11, 1 ) );
+	EXPECT_EQ( 1.5, OverlapAreas( 1, 1, 11, 1 ) );
+	EXPECT_EQ( 0, BackSurfaces( 2, 1, 11, 1 ) );
+
+	// Sun direction beyond the tolerance: calculated
+	SetSunDirection( 45.0, 170.0 );
+	CachedSHADOW( 12, 1 );
+	EXPECT_EQ( 3, NumSunlitFracCacheLookups );
+	EXPECT_EQ( 1, NumSunlitFracCacheHits );
+	EXPECT_EQ( 0, BackSurfaces( 1, 1, 12, 1 ) );
+	EXPECT_EQ( 0.0, OverlapAreas( 1, 1, 12, 1 ) );
+
+	TearDownSunlitFracCacheTest();
+}
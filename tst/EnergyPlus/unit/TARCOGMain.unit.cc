@@ -0,0 +1,287 @@
+// EnergyPlus::TARCOGMain Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
+
+// EnergyPlus Headers
+#include <DataComplexFenestration.hh>
+#include <DataHeatBalance.hh>
+#include <TARCOGCommon.hh>
+#include <TARCOGGassesParams.hh>
+#include <TARCOGMain.hh>
+#include <TARCOGParams.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::TARCOGGassesParams;
+using namespace EnergyPlus::TARCOGMain;
+using namespace EnergyPlus::TARCOGParams;
+using namespace ObjexxFCL;
+
+namespace {
+
+// Inputs and results of one TARCOG90 call, sized as in CalcComplexWindowThermal
+struct GlazingSystem
+{
+	int nlayer;
+	FArray1D< Real64 > gap;
+	FArray1D< Real64 > GapDefMax;
+	FArray1D< Real64 > thick;
+	FArray1D< Real64 > scon;
+	FArray1D< Real64 > YoungsMod;
+	FArray1D< Real64 > PoissonsRat;
+	FArray1D< Real64 > tir;
+	FArray1D< Real64 > emis;
+	FArray1D< Real64 > asol;
+	FArray1D< Real64 > presure;
+	FArray2D_int iprop;
+	FArray2D< Real64 > frct;
+	FArray2D< Real64 > gcon;
+	FArray2D< Real64 > gvis;
+	FArray2D< Real64 > gcp;
+	FArray1D< Real64 > wght;
+	FArray1D< Real64 > gama;
+	FArray1D_int nmix;
+	FArray1D_int SupportPillar;
+	FArray1D< Real64 > PillarSpacing;
+	FArray1D< Real64 > PillarRadius;
+	FArray1D_int ibc;
+	FArray1D< Real64 > Atop;
+	FArray1D< Real64 > Abot;
+	FArray1D< Real64 > Al;
+	FArray1D< Real64 > Ar;
+	FArray1D< Real64 > Ah;
+	FArray1D< Real64 > SlatThick;
+	FArray1D< Real64 > SlatWidth;
+	FArray1D< Real64 > SlatAngle;
+	FArray1D< Real64 > SlatCond;
+	FArray1D< Real64 > SlatSpacing;
+	FArray1D< Real64 > SlatCurve;
+	FArray1D< Real64 > vvent;
+	FArray1D< Real64 > tvent;
+	FArray1D_int LayerType;
+	FArray1D_int nslice;
+	FArray1D< Real64 > LaminateA;
+	FArray1D< Real64 > LaminateB;
+	FArray1D< Real64 > sumsol;
+	// Results
+	FArray1D< Real64 > theta;
+	FArray1D< Real64 > LayerDef;
+	FArray1D< Real64 > q;
+	FArray1D< Real64 > qv;
+	FArray1D< Real64 > hcgas;
+	FArray1D< Real64 > hrgas;
+	FArray1D< Real64 > hg;
+	FArray1D< Real64 > hr;
+	FArray1D< Real64 > hs;
+	FArray1D< Real64 > Ra;
+	FArray1D< Real64 > Nu;
+	FArray1D< Real64 > Keff;
+	FArray1D< Real64 > ShadeGapKeffConv;
+	Real64 ufactor;
+	Real64 shgc;
+	Real64 hcin;
+	Real64 hcout;
+	int nperr;
+
+	GlazingSystem(
+		int const nlayer,
+		Real64 const gapWidth,
+		int const gasType, // index in the DataHeatBalance gas coefficient tables
+		bool const interiorBlind // true if the inner layer is a venetian blind
+	) :
+		nlayer( nlayer ),
+		gap( maxlay, 0.0 ),
+		GapDefMax( maxlay - 1, 0.0 ),
+		thick( maxlay, 0.0 ),
+		scon( maxlay, 0.0 ),
+		YoungsMod( maxlay, 0.0 ),
+		PoissonsRat( maxlay, 0.0 ),
+		tir( maxlay2, 0.0 ),
+		emis( maxlay2, 0.0 ),
+		asol( maxlay, 0.0 ),
+		presure( maxlay1, 101325.0 ),
+		iprop( maxlay1, maxgas, 1 ),
+		frct( maxlay1, maxgas, 0.0 ),
+		gcon( maxgas, 3, 0.0 ),
+		gvis( maxgas, 3, 0.0 ),
+		gcp( maxgas, 3, 0.0 ),
+		wght( maxgas, 0.0 ),
+		gama( maxgas, 0.0 ),
+		nmix( maxlay1, 1 ),
+		SupportPillar( maxlay, 0 ),
+		PillarSpacing( maxlay, 0.0 ),
+		PillarRadius( maxlay, 0.0 ),
+		ibc( 2, 0 ),
+		Atop( maxlay, 0.0 ),
+		Abot( maxlay, 0.0 ),
+		Al( maxlay, 0.0 ),
+		Ar( maxlay, 0.0 ),
+		Ah( maxlay, 0.0 ),
+		SlatThick( maxlay, 0.0 ),
+		SlatWidth( maxlay, 0.0 ),
+		SlatAngle( maxlay, 0.0 ),
+		SlatCond( maxlay, 0.0 ),
+		SlatSpacing( maxlay, 0.0 ),
+		SlatCurve( maxlay, 0.0 ),
+		vvent( maxlay1, 0.0 ),
+		tvent( maxlay1, 0.0 ),
+		LayerType( maxlay, 0 ),
+		nslice( maxlay, 0 ),
+		LaminateA( maxlay, 0.0 ),
+		LaminateB( maxlay, 0.0 ),
+		sumsol( maxlay, 0.0 ),
+		theta( maxlay2, 273.15 ),
+		LayerDef( maxlay, 0.0 ),
+		q( maxlay3, 0.0 ),
+		qv( maxlay1, 0.0 ),
+		hcgas( maxlay1, 0.0 ),
+		hrgas( maxlay1, 0.0 ),
+		hg( maxlay, 0.0 ),
+		hr( maxlay, 0.0 ),
+		hs( maxlay, 0.0 ),
+		Ra( maxlay1, 0.0 ),
+		Nu( maxlay1, 0.0 ),
+		Keff( maxlay, 0.0 ),
+		ShadeGapKeffConv( MaxGap, 0.0 ),
+		ufactor( 0.0 ),
+		shgc( 0.0 ),
+		hcin( 0.0 ),
+		hcout( 0.0 ),
+		nperr( 0 )
+	{
+		using namespace DataHeatBalance;
+		using DataComplexFenestration::GasCoeffsAir;
+
+		// air outdoors and indoors (gas 1) and the fill gas in the gaps (gas 2)
+		for ( int i = 1; i <= 3; ++i ) {
+			gcon( 1, i ) = GasCoeffsCon( GasCoeffsAir, i );
+			gvis( 1, i ) = GasCoeffsVis( GasCoeffsAir, i );
+			gcp( 1, i ) = GasCoeffsCp( GasCoeffsAir, i );
+			gcon( 2, i ) = GasCoeffsCon( gasType, i );
+			gvis( 2, i ) = GasCoeffsVis( gasType, i );
+			gcp( 2, i ) = GasCoeffsCp( gasType, i );
+		}
+		wght( 1 ) = GasWght( GasCoeffsAir );
+		gama( 1 ) = GasSpecificHeatRatio( GasCoeffsAir );
+		wght( 2 ) = GasWght( gasType );
+		gama( 2 ) = GasSpecificHeatRatio( gasType );
+
+		for ( int i = 1; i <= nlayer + 1; ++i ) {
+			frct( i, 1 ) = 1.0;
+			if ( i > 1 && i <= nlayer ) iprop( i, 1 ) = 2;
+		}
+		for ( int i = 1; i <= nlayer; ++i ) {
+			thick( i ) = 0.006;
+			scon( i ) = 1.0;
+			emis( 2 * i - 1 ) = 0.84;
+			emis( 2 * i ) = 0.84;
+			asol( i ) = 20.0 * i;
+			YoungsMod( i ) = 7.2e10;
+			PoissonsRat( i ) = 0.22;
+			if ( i < nlayer ) {
+				gap( i ) = gapWidth;
+				GapDefMax( i ) = gapWidth;
+			}
+		}
+		emis( 2 * nlayer - 1 ) = 0.1; // low-e coating facing the inner gap
+
+		if ( interiorBlind ) {
+			int const sd( nlayer );
+			LayerType( sd ) = VENETBLIND;
+			thick( sd ) = 0.0001;
+			scon( sd ) = 160.0;
+			emis( 2 * sd - 1 ) = 0.9;
+			emis( 2 * sd ) = 0.9;
+			emis( 2 * sd - 3 ) = 0.1; // low-e coating stays on the inner glass
+			Atop( sd ) = 0.5 * gapWidth;
+			Abot( sd ) = 0.5 * gapWidth;
+			Ah( sd ) = 0.2;
+			SlatThick( sd ) = 0.0001;
+			SlatWidth( sd ) = 0.016;
+			SlatAngle( sd ) = 45.0;
+			SlatCond( sd ) = 160.0;
+			SlatSpacing( sd ) = 0.012;
+			iprop( sd, 1 ) = 1; // room air between the inner glass and the blind
+		}
+	}
+
+	void
+	Solve( TARCOGCommon::TARCOGWorkspace & Work )
+	{
+		Real64 tout( 255.15 );
+		Real64 tind( 294.15 );
+		Real64 trmin( 294.15 );
+		Real64 esky( 1.0 );
+		Real64 VacuumMaxGapThickness( 0.01 );
+		Real64 sc( 0.0 );
+		Real64 hflux( 0.0 );
+		Real64 hrin( 0.0 );
+		Real64 hrout( 0.0 );
+		Real64 hin( 0.0 );
+		Real64 hout( 0.0 );
+		Real64 shgct( 0.0 );
+		Real64 tamb( 0.0 );
+		Real64 troom( 0.0 );
+		Real64 he( 0.0 );
+		Real64 hi( 0.0 );
+		Real64 ShadeEmisRatioOut( 0.0 );
+		Real64 ShadeEmisRatioIn( 0.0 );
+		Real64 ShadeHcRatioOut( 0.0 );
+		Real64 ShadeHcRatioIn( 0.0 );
+		Real64 HcUnshadedOut( 0.0 );
+		Real64 HcUnshadedIn( 0.0 );
+		int NumOfIterations( 0 );
+		std::string ErrorMessage;
+
+		theta = 273.15;
+		TARCOG90( nlayer, 0, tout, tind, trmin, 5.5, 0.0, 783.0, 0.0, 0, tout, esky, 1.0, 13.238, VacuumMaxGapThickness, 0, 101325.0, 101325.0, 293.15, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, 0.5, 90.0, asol, 1.0, 1.0, 1.0, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPillar, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgas, hrgas, shgc, nperr, ErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, ISO15099, THERM_MOD_ISO15099, 0, "", "Test", -1, -1, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, 0.0, 1, NumOfIterations, Work );
+	}
+};
+
+void
+ExpectSameResults( GlazingSystem const & a, GlazingSystem const & b )
+{
+	EXPECT_EQ( a.nperr, b.nperr );
+	EXPECT_DOUBLE_EQ( a.ufactor, b.ufactor );
+	EXPECT_DOUBLE_EQ( a.shgc, b.shgc );
+	EXPECT_DOUBLE_EQ( a.hcin, b.hcin );
+	EXPECT_DOUBLE_EQ( a.hcout, b.hcout );
+	for ( int i = 1; i <= 2 * a.nlayer; ++i ) {
+		EXPECT_DOUBLE_EQ( a.theta( i ), b.theta( i ) );
+	}
+	for ( int i = 1; i <= 2 * a.nlayer + 1; ++i ) {
+		EXPECT_DOUBLE_EQ( a.q( i ), b.q( i ) );
+	}
+	for ( int i = 1; i <= a.nlayer + 1; ++i ) {
+		EXPECT_DOUBLE_EQ( a.hcgas( i ), b.hcgas( i ) );
+		EXPECT_DOUBLE_EQ( a.hrgas( i ), b.hrgas( i ) );
+	}
+}
+
+}
+
+TEST( TARCOGMainTest, SolveOrderIndependent )
+{
+	// Argon filled double glazing with an interior blind and air filled double glazing, each solved first and second
+	// with the same scratch arrays
+	TARCOGCommon::TARCOGWorkspace Work;
+	GlazingSystem BlindFirst( 3, 0.016, 2, true );
+	GlazingSystem ClearSecond( 2, 0.012, DataComplexFenestration::GasCoeffsAir, false );
+	BlindFirst.Solve( Work );
+	ClearSecond.Solve( Work );
+
+	GlazingSystem ClearFirst( 2, 0.012, DataComplexFenestration::GasCoeffsAir, false );
+	GlazingSystem BlindSecond( 3, 0.016, 2, true );
+	ClearFirst.Solve( Work );
+	BlindSecond.Solve( Work );
+
+	ASSERT_EQ( 0, BlindFirst.nperr );
+	ASSERT_EQ( 0, ClearFirst.nperr );
+	EXPECT_GT( ClearFirst.ufactor, BlindFirst.ufactor );
+	ExpectSameResults( BlindFirst, BlindSecond );
+	ExpectSameResults( ClearFirst, ClearSecond );
+}